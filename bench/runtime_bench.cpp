@@ -0,0 +1,701 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <span>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "mode_helpers.h"
+#include "spectre/config.h"
+#include "spectre/runtime.h"
+#include "spectre/status.h"
+#include "spectre/subsystems.h"
+#include "spectre/es2025/environment.h"
+#include "spectre/es2025/value.h"
+#include "spectre/es2025/modules/array_buffer_module.h"
+#include "spectre/es2025/modules/array_module.h"
+#include "spectre/es2025/modules/atomics_module.h"
+#include "spectre/es2025/modules/data_view_module.h"
+#include "spectre/es2025/modules/json_module.h"
+#include "spectre/es2025/modules/map_module.h"
+#include "spectre/es2025/modules/object_module.h"
+#include "spectre/es2025/modules/set_module.h"
+#include "spectre/es2025/modules/shared_array_buffer_module.h"
+#include "spectre/es2025/modules/string_module.h"
+#include "spectre/es2025/modules/structured_clone_module.h"
+#include "spectre/es2025/modules/typed_array_module.h"
+
+namespace {
+    using spectre::RuntimeMode;
+    using spectre::SpectreRuntime;
+    using spectre::StatusCode;
+    using Clock = std::chrono::steady_clock;
+
+    constexpr int kBatches = 5;
+
+    struct BenchOptions {
+        double minBatchSeconds;
+        std::string filter;
+        std::string outputPath;
+    };
+
+    struct BenchResult {
+        std::string name;
+        std::uint64_t iterations;
+        double nsPerOp;
+        double minNsPerOp;
+        double bytesPerOp;
+    };
+
+    volatile std::uint64_t g_Sink = 0;
+
+    template<typename T>
+    void Keep(const T &value) {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r"(&value) : "memory");
+#else
+        g_Sink = g_Sink + static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(&value) & 1u);
+#endif
+    }
+
+    double RunBatch(const std::function<void()> &body, std::uint64_t iterations) {
+        auto begin = Clock::now();
+        for (std::uint64_t i = 0; i < iterations; ++i) {
+            body();
+        }
+        auto end = Clock::now();
+        return std::chrono::duration<double, std::nano>(end - begin).count();
+    }
+
+    bool Selected(const BenchOptions &options, std::string_view name) {
+        return options.filter.empty() || name.find(options.filter) != std::string_view::npos;
+    }
+
+    // Grows the batch until it runs for at least minBatchSeconds, then reports the median and the
+    // fastest of kBatches batches so one noisy batch does not move the result.
+    void Measure(const BenchOptions &options, std::vector<BenchResult> &results, std::string name,
+                 double bytesPerOp, const std::function<void()> &body) {
+        if (!Selected(options, name)) {
+            return;
+        }
+        std::uint64_t iterations = 1;
+        auto targetNs = options.minBatchSeconds * 1e9;
+        while (true) {
+            auto elapsed = RunBatch(body, iterations);
+            if (elapsed >= targetNs || iterations >= (1ull << 32)) {
+                break;
+            }
+            auto scale = elapsed <= 0.0 ? 10.0 : std::min(10.0, std::max(1.5, targetNs / elapsed * 1.2));
+            iterations = static_cast<std::uint64_t>(static_cast<double>(iterations) * scale) + 1;
+        }
+        std::vector<double> samples;
+        samples.reserve(kBatches);
+        for (int i = 0; i < kBatches; ++i) {
+            samples.push_back(RunBatch(body, iterations) / static_cast<double>(iterations));
+        }
+        std::sort(samples.begin(), samples.end());
+        std::cerr << name << ": " << samples[kBatches / 2] << " ns/op" << std::endl;
+        results.push_back({std::move(name), iterations, samples[kBatches / 2], samples.front(), bytesPerOp});
+    }
+
+    void AppendJsonString(std::ostringstream &out, std::string_view text) {
+        out << '"';
+        for (char ch: text) {
+            if (ch == '"' || ch == '\\') {
+                out << '\\';
+            }
+            out << ch;
+        }
+        out << '"';
+    }
+
+    std::string RenderJson(const std::vector<BenchResult> &results, const BenchOptions &options) {
+        std::ostringstream out;
+        out.precision(6);
+        out << std::fixed;
+        out << "{\"suite\":\"spectre_bench\",\"version\":\"" << SPECTRE_VERSION_STRING << "\",";
+        out << "\"min_batch_seconds\":" << options.minBatchSeconds << ",\"batches\":" << kBatches << ",";
+        out << "\"results\":[";
+        for (std::size_t i = 0; i < results.size(); ++i) {
+            const auto &result = results[i];
+            if (i != 0) {
+                out << ',';
+            }
+            out << "{\"name\":";
+            AppendJsonString(out, result.name);
+            out << ",\"iterations\":" << result.iterations;
+            out << ",\"ns_per_op\":" << result.nsPerOp;
+            out << ",\"min_ns_per_op\":" << result.minNsPerOp;
+            out << ",\"ops_per_sec\":" << (result.nsPerOp > 0.0 ? 1e9 / result.nsPerOp : 0.0);
+            if (result.bytesPerOp > 0.0) {
+                out << ",\"mb_per_sec\":" << (result.nsPerOp > 0.0
+                                                   ? result.bytesPerOp / result.nsPerOp * 1e9 / (1024.0 * 1024.0)
+                                                   : 0.0);
+            }
+            out << '}';
+        }
+        out << "]}";
+        return out.str();
+    }
+
+    std::string MakeLargeScript(std::size_t terms) {
+        std::string source = "// generated lexer benchmark input\n";
+        source.reserve(terms * 16);
+        source.append("return 1");
+        for (std::size_t i = 0; i < terms; ++i) {
+            source.append(i % 4 == 0 ? " + " : i % 4 == 1 ? " * " : i % 4 == 2 ? " - " : " / ");
+            source.append(std::to_string((i % 97) + 1));
+            source.append(".25");
+            if (i % 64 == 63) {
+                source.append(" // line\n");
+            }
+        }
+        source.append(";");
+        return source;
+    }
+
+    std::string MakeJsonDocument(std::size_t records) {
+        std::string json = "{\"records\":[";
+        for (std::size_t i = 0; i < records; ++i) {
+            if (i != 0) {
+                json.push_back(',');
+            }
+            json.append("{\"id\":").append(std::to_string(i));
+            json.append(",\"name\":\"entity-").append(std::to_string(i));
+            json.append("\",\"position\":[1.5,-2.25,3.125],\"active\":true,\"tags\":[\"a\",\"b\"]}");
+        }
+        json.append("]}");
+        return json;
+    }
+
+    spectre::RuntimeConfig MakeBenchConfig() {
+        auto config = spectre::MakeDefaultConfig();
+        config.mode = RuntimeMode::SingleThread;
+        return config;
+    }
+
+    template<typename T>
+    T *FindModule(SpectreRuntime &runtime, std::string_view name) {
+        return dynamic_cast<T *>(runtime.EsEnvironment().FindModule(name));
+    }
+
+    void BenchFrontend(const BenchOptions &options, std::vector<BenchResult> &results) {
+        auto suite = spectre::detail::CreateCpuSubsystemSuite(MakeBenchConfig());
+        spectre::detail::ScriptUnit large{"lexer", MakeLargeScript(20000)};
+        spectre::detail::ModuleArtifact probe{};
+        if (suite.parser->ParseModule(large, probe) != StatusCode::Ok) {
+            std::cerr << "frontend input rejected: " << probe.diagnostics << std::endl;
+            return;
+        }
+        auto largeBytes = static_cast<double>(large.source.size());
+        Measure(options, results, "parser.lex_large_script", largeBytes, [&]() {
+            spectre::detail::ModuleArtifact artifact{};
+            suite.parser->ParseModule(large, artifact);
+            Keep(artifact);
+        });
+
+        spectre::ScriptSource small{"compile", "return (1 + 2) * 3 - 4 / 5;"};
+        Measure(options, results, "compile.small_script", 0.0, [&]() {
+            spectre::detail::ExecutableProgram program{};
+            std::string diagnostics;
+            spectre::detail::CompileScript(*suite.parser, *suite.bytecode, small, program, diagnostics, nullptr);
+            Keep(program);
+        });
+
+        spectre::detail::ExecutableProgram program{};
+        std::string diagnostics;
+        spectre::detail::CompileScript(*suite.parser, *suite.bytecode, {"serialize", large.source}, program,
+                                       diagnostics, nullptr);
+        auto bytes = spectre::detail::SerializeProgram(program);
+        Measure(options, results, "bytecode.serialize", static_cast<double>(bytes.size()), [&]() {
+            auto data = spectre::detail::SerializeProgram(program);
+            Keep(data);
+        });
+        Measure(options, results, "bytecode.deserialize", static_cast<double>(bytes.size()), [&]() {
+            spectre::detail::ExecutableProgram restored{};
+            std::string errors;
+            spectre::detail::DeserializeProgram(bytes, restored, errors);
+            Keep(restored);
+        });
+    }
+
+    void BenchEvaluate(const BenchOptions &options, std::vector<BenchResult> &results) {
+        auto runtime = SpectreRuntime::Create(MakeBenchConfig());
+        runtime->CreateContext({"bench", 1u << 16}, nullptr);
+        runtime->LoadScript("bench", {"arith", "return (1 + 2) * 3 - 4 / 5;"});
+        runtime->LoadScript("bench", {"literal", "return 'spectre';"});
+        Measure(options, results, "runtime.evaluate_sync.arith", 0.0, [&]() {
+            auto result = runtime->EvaluateSync("bench", "arith");
+            Keep(result);
+        });
+        Measure(options, results, "runtime.evaluate_sync.literal", 0.0, [&]() {
+            auto result = runtime->EvaluateSync("bench", "literal");
+            Keep(result);
+        });
+    }
+
+    void BenchEnvironmentTick(const BenchOptions &options, std::vector<BenchResult> &results,
+                              std::uint32_t handles, std::string name) {
+        if (!Selected(options, name)) {
+            return;
+        }
+        auto runtime = SpectreRuntime::Create(MakeBenchConfig());
+        auto *maps = FindModule<spectre::es2025::MapModule>(*runtime, "Map");
+        if (maps == nullptr) {
+            return;
+        }
+        for (std::uint32_t i = 0; i < handles; ++i) {
+            spectre::es2025::MapModule::Handle handle = 0;
+            maps->Create("bench.tick", handle);
+            maps->Set(handle, spectre::es2025::Value::Int32(static_cast<std::int32_t>(i)),
+                      spectre::es2025::Value::Number(static_cast<double>(i)));
+        }
+        std::uint64_t frame = 0;
+        Measure(options, results, std::move(name), 0.0, [&]() {
+            runtime->EsEnvironment().Tick({0.016, ++frame});
+        });
+    }
+
+    void BenchModules(const BenchOptions &options, std::vector<BenchResult> &results) {
+        auto runtime = SpectreRuntime::Create(MakeBenchConfig());
+
+        if (auto *maps = FindModule<spectre::es2025::MapModule>(*runtime, "Map")) {
+            spectre::es2025::MapModule::Handle map = 0;
+            maps->Create("bench.map", map);
+            constexpr std::int32_t kKeys = 4096;
+            for (std::int32_t i = 0; i < kKeys; ++i) {
+                maps->Set(map, spectre::es2025::Value::Int32(i), spectre::es2025::Value::Int32(i));
+            }
+            std::int32_t cursor = 0;
+            Measure(options, results, "map.set.int_key", 0.0, [&]() {
+                cursor = (cursor + 1) & (kKeys - 1);
+                maps->Set(map, spectre::es2025::Value::Int32(cursor), spectre::es2025::Value::Int32(cursor));
+            });
+            spectre::es2025::Value out;
+            Measure(options, results, "map.get.int_key", 0.0, [&]() {
+                cursor = (cursor + 7) & (kKeys - 1);
+                maps->Get(map, spectre::es2025::Value::Int32(cursor), out);
+                Keep(out);
+            });
+            std::array<spectre::es2025::Value, 64> batchKeys;
+            std::array<spectre::es2025::Value, 64> batchValues;
+            std::array<std::uint64_t, 1> batchFound{};
+            Measure(options, results, "map.get_many.int_key", 0.0, [&]() {
+                for (auto &key: batchKeys) {
+                    cursor = (cursor + 7) & (kKeys - 1);
+                    key = spectre::es2025::Value::Int32(cursor);
+                }
+                maps->GetMany(map, batchKeys, batchValues, batchFound);
+                Keep(batchFound[0]);
+            });
+            std::vector<std::pair<spectre::es2025::Value, spectre::es2025::Value> > load;
+            for (std::int32_t i = 0; i < kKeys; ++i) {
+                load.emplace_back(spectre::es2025::Value::Int32(i), spectre::es2025::Value::Int32(i));
+            }
+            Measure(options, results, "map.set_many.load_4k", 0.0, [&]() {
+                spectre::es2025::MapModule::Handle bulk = 0;
+                maps->Create("bench.bulk", bulk);
+                maps->SetMany(bulk, load);
+                maps->Destroy(bulk);
+            });
+            std::vector<spectre::es2025::Value> copied;
+            Measure(options, results, "map.values.copy_4k", 0.0, [&]() {
+                maps->Values(map, copied);
+                Keep(copied.size());
+            });
+            Measure(options, results, "map.values.cursor_4k", 0.0, [&]() {
+                spectre::es2025::MapModule::Cursor iteration{};
+                maps->OpenCursor(map, iteration);
+                std::size_t count = 0;
+                std::size_t total = 0;
+                do {
+                    maps->NextValues(iteration, batchValues, count);
+                    total += count;
+                } while (count != 0);
+                Keep(total);
+            });
+            bool removed = false;
+            Measure(options, results, "map.churn.int_key", 0.0, [&]() {
+                cursor = (cursor + 13) & (kKeys - 1);
+                maps->Delete(map, spectre::es2025::Value::Int32(cursor), removed);
+                maps->Set(map, spectre::es2025::Value::Int32(cursor), spectre::es2025::Value::Int32(cursor));
+            });
+
+            // Tables far larger than the caches, where GetMany's prefetching has misses to hide.
+            // Keys are visited with a prime stride so consecutive lookups land on unrelated slots.
+            for (std::int32_t largeKeys: {100000, 1000000}) {
+                std::string suffix = largeKeys == 100000 ? "_100k" : "_1m";
+                if (!Selected(options, "map.get.int_key" + suffix)
+                    && !Selected(options, "map.get_many.int_key" + suffix)) {
+                    continue;
+                }
+                spectre::es2025::MapModule::Handle large = 0;
+                maps->Create("bench.map.large", large);
+                std::vector<std::pair<spectre::es2025::Value, spectre::es2025::Value> > fill;
+                fill.reserve(static_cast<std::size_t>(largeKeys));
+                for (std::int32_t i = 0; i < largeKeys; ++i) {
+                    fill.emplace_back(spectre::es2025::Value::Int32(i), spectre::es2025::Value::Int32(i));
+                }
+                maps->SetMany(large, fill);
+                std::int32_t position = 0;
+                Measure(options, results, "map.get.int_key" + suffix, 0.0, [&]() {
+                    position = (position + 7919) % largeKeys;
+                    maps->Get(large, spectre::es2025::Value::Int32(position), out);
+                    Keep(out);
+                });
+                Measure(options, results, "map.get_many.int_key" + suffix, 0.0, [&]() {
+                    for (auto &key: batchKeys) {
+                        position = (position + 7919) % largeKeys;
+                        key = spectre::es2025::Value::Int32(position);
+                    }
+                    maps->GetMany(large, batchKeys, batchValues, batchFound);
+                    Keep(batchFound[0]);
+                });
+                maps->Destroy(large);
+            }
+        }
+
+        if (auto *arrays = FindModule<spectre::es2025::ArrayModule>(*runtime, "Array")) {
+            constexpr std::size_t kElements = 16384;
+            std::vector<double> samples(kElements);
+            std::uint32_t seed = 7;
+            for (auto &sample: samples) {
+                seed = seed * 1664525u + 1013904223u;
+                sample = static_cast<double>(seed) / 65536.0;
+            }
+            spectre::es2025::ArrayModule::Handle numbers = 0;
+            arrays->CreateDense("bench.numbers", kElements, numbers);
+            Measure(options, results, "array.sort_numeric.double_16k", kElements * sizeof(double), [&]() {
+                arrays->Clear(numbers);
+                for (auto sample: samples) {
+                    arrays->PushNumber(numbers, sample);
+                }
+                arrays->SortNumeric(numbers, true);
+            });
+            std::size_t index = 0;
+            Measure(options, results, "array.binary_search.double", 0.0, [&]() {
+                index = (index + 97) & (kElements - 1);
+                std::size_t found = 0;
+                arrays->BinarySearch(numbers, spectre::es2025::Value::Number(samples[index]), true, found);
+                Keep(found);
+            });
+        }
+
+        if (auto *buffers = FindModule<spectre::es2025::ArrayBufferModule>(*runtime, "ArrayBuffer")) {
+            constexpr std::size_t kMiB = 1024 * 1024;
+            Measure(options, results, "array_buffer.grow.64m_to_128m", 0.0, [&]() {
+                spectre::es2025::ArrayBufferModule::Handle grown = 0;
+                buffers->Create("bench.grow", 64 * kMiB, grown);
+                buffers->Resize(grown, 128 * kMiB);
+                buffers->Destroy(grown);
+            });
+        }
+
+        if (auto *typed = FindModule<spectre::es2025::TypedArrayModule>(*runtime, "TypedArray")) {
+            using Type = spectre::es2025::TypedArrayModule::ElementType;
+            constexpr std::size_t kElements = 1000000;
+            std::vector<double> samples(kElements);
+            std::uint32_t seed = 11;
+            for (auto &sample: samples) {
+                seed = seed * 1664525u + 1013904223u;
+                sample = static_cast<double>(seed % 100000) / 256.0 - 128.0;
+            }
+            spectre::es2025::TypedArrayModule::Handle floats = 0;
+            spectre::es2025::TypedArrayModule::Handle doubles = 0;
+            spectre::es2025::TypedArrayModule::Handle pixels = 0;
+            typed->Create(Type::Float32, kElements, "bench.f32", floats);
+            typed->Create(Type::Float64, kElements, "bench.f64", doubles);
+            typed->Create(Type::Uint8Clamped, kElements, "bench.u8c", pixels);
+            typed->SetFromSpan(floats, samples);
+            Measure(options, results, "typed_array.set_from_span.f32_1m", kElements * sizeof(float), [&]() {
+                typed->SetFromSpan(floats, samples);
+            });
+            Measure(options, results, "typed_array.set_from_span.u8c_1m", kElements, [&]() {
+                typed->SetFromSpan(pixels, samples);
+            });
+            Measure(options, results, "typed_array.set_from.f32_to_f64_1m", kElements * sizeof(double), [&]() {
+                typed->SetFrom(doubles, floats);
+            });
+            double reduced = 0.0;
+            Measure(options, results, "typed_array.reduce_sum.f32_1m", kElements * sizeof(float), [&]() {
+                typed->Reduce(floats, spectre::es2025::TypedArrayModule::ReduceOp::Sum, reduced);
+                Keep(reduced);
+            });
+            Measure(options, results, "typed_array.dot.f32_1m", 2 * kElements * sizeof(float), [&]() {
+                typed->Dot(floats, floats, reduced);
+                Keep(reduced);
+            });
+            Measure(options, results, "typed_array.fill.f32_1m", kElements * sizeof(float), [&]() {
+                typed->Fill(floats, 0.5);
+            });
+        }
+
+        auto *views = FindModule<spectre::es2025::DataViewModule>(*runtime, "DataView");
+        if (auto *buffers = FindModule<spectre::es2025::ArrayBufferModule>(*runtime, "ArrayBuffer"); views && buffers) {
+            using DataView = spectre::es2025::DataViewModule;
+            using FieldType = DataView::FieldType;
+            constexpr std::size_t kRecords = 65536;
+            constexpr std::size_t kStride = 16;
+            const std::array<DataView::Field, 3> fields{{
+                {FieldType::Uint32, 0, false},
+                {FieldType::Float32, 4, false},
+                {FieldType::Float64, 8, false},
+            }};
+            DataView::Schema schema;
+            DataView::BuildSchema(fields, kStride, schema);
+            spectre::es2025::ArrayBufferModule::Handle packets = 0;
+            buffers->Create("bench.packets", kRecords * kStride, packets);
+            DataView::Handle view = 0;
+            views->Create(packets, 0, DataView::kUseRemaining, "bench.packets.view", view);
+            std::vector<std::uint32_t> ids(kRecords, 7);
+            std::vector<float> xs(kRecords, 1.5f);
+            std::vector<double> stamps(kRecords, 2.25);
+            const std::array<DataView::Column, 3> columns{ids, xs, stamps};
+            Measure(options, results, "data_view.encode_records.be_64k", kRecords * kStride, [&]() {
+                views->EncodeRecords(view, schema, 0, kRecords, columns);
+            });
+            Measure(options, results, "data_view.decode_records.be_64k", kRecords * kStride, [&]() {
+                views->DecodeRecords(view, schema, 0, kRecords, columns);
+                Keep(stamps.back());
+            });
+            Measure(options, results, "data_view.decode_scalar.be_64k", kRecords * kStride, [&]() {
+                for (std::size_t i = 0; i < kRecords; ++i) {
+                    views->GetUint32(view, i * kStride, false, ids[i]);
+                    views->GetFloat32(view, i * kStride + 4, false, xs[i]);
+                    views->GetFloat64(view, i * kStride + 8, false, stamps[i]);
+                }
+                Keep(stamps.back());
+            });
+        }
+
+        using Atomics = spectre::es2025::AtomicsModule;
+        if (auto *atomics = FindModule<Atomics>(*runtime, "Atomics")) {
+            // Four threads bump independent lanes (or one sharded counter); packed lanes share a
+            // cache line, padded lanes and counter stripes do not.
+            constexpr std::size_t kThreads = 4;
+            constexpr int kAdds = 50000;
+            Atomics::Handle packed = 0;
+            Atomics::Handle padded = 0;
+            Atomics::Handle counter = 0;
+            atomics->CreateBuffer("bench.packed", kThreads, packed);
+            atomics->CreateBuffer("bench.padded", kThreads, padded, Atomics::Layout::Padded);
+            atomics->CreateCounter("bench.counter", counter, kThreads);
+            auto contend = [&](auto &&add) {
+                std::vector<std::thread> workers;
+                for (std::size_t t = 0; t < kThreads; ++t) {
+                    workers.emplace_back([&add, t]() {
+                        for (int i = 0; i < kAdds; ++i) {
+                            add(t);
+                        }
+                    });
+                }
+                for (auto &worker: workers) {
+                    worker.join();
+                }
+            };
+            Measure(options, results, "atomics.add.packed_4t", 0.0, [&]() {
+                contend([&](std::size_t lane) {
+                    std::int64_t previous = 0;
+                    atomics->Add(packed, lane, 1, previous);
+                });
+            });
+            Measure(options, results, "atomics.add.padded_4t", 0.0, [&]() {
+                contend([&](std::size_t lane) {
+                    std::int64_t previous = 0;
+                    atomics->Add(padded, lane, 1, previous);
+                });
+            });
+            Measure(options, results, "atomics.counter_add_4t", 0.0, [&]() {
+                contend([&](std::size_t) {
+                    atomics->CounterAdd(counter, 1);
+                });
+            });
+        }
+
+        using SharedArrayBuffer = spectre::es2025::SharedArrayBufferModule;
+        if (auto *shared = FindModule<SharedArrayBuffer>(*runtime, "SharedArrayBuffer")) {
+            constexpr std::size_t kBatch = 64;
+            SharedArrayBuffer::Handle channel = 0;
+            shared->CreateChannel("bench.channel", 64, 256, channel);
+            std::array<std::uint8_t, 48> payload{};
+            std::array<std::span<const std::uint8_t>, kBatch> batch;
+            batch.fill(payload);
+            std::vector<SharedArrayBuffer::ChannelMessage> inbox;
+            Measure(options, results, "shared_array_buffer.channel_batch_64", kBatch * payload.size(), [&]() {
+                std::size_t sent = 0;
+                shared->ChannelSend(channel, batch, sent);
+                shared->ChannelReceive(channel, inbox, kBatch);
+                Keep(inbox.size() + sent);
+            });
+        }
+
+        if (auto *sets = FindModule<spectre::es2025::SetModule>(*runtime, "Set")) {
+            spectre::es2025::SetModule::Handle set = 0;
+            sets->Create("bench.set", set);
+            constexpr std::int32_t kValues = 4096;
+            sets->Reserve(set, kValues);
+            for (std::int32_t i = 0; i < kValues; ++i) {
+                sets->Add(set, spectre::es2025::Value::Int32(i * 2));
+            }
+            std::int32_t cursor = 0;
+            Measure(options, results, "set.has.mixed", 0.0, [&]() {
+                cursor = (cursor + 7) & (2 * kValues - 1);
+                Keep(sets->Has(set, spectre::es2025::Value::Int32(cursor)));
+            });
+        }
+
+        if (auto *objects = FindModule<spectre::es2025::ObjectModule>(*runtime, "Object")) {
+            spectre::es2025::ObjectModule::Handle object = 0;
+            objects->Create("bench.object", 0, object);
+            const char *keys[] = {"x", "y", "z", "w", "name", "velocity", "health", "target"};
+            for (auto *key: keys) {
+                objects->Set(object, key, spectre::es2025::Value::Number(1.0));
+            }
+            std::size_t cursor = 0;
+            spectre::es2025::Value out;
+            Measure(options, results, "object.get", 0.0, [&]() {
+                cursor = (cursor + 1) & 7u;
+                objects->Get(object, keys[cursor], out);
+                Keep(out);
+            });
+            spectre::es2025::ObjectModule::CacheSlot sites[8];
+            Measure(options, results, "object.get_cached", 0.0, [&]() {
+                cursor = (cursor + 1) & 7u;
+                objects->LookupCached(object, keys[cursor], sites[cursor], out);
+                Keep(out);
+            });
+        }
+
+        if (auto *strings = FindModule<spectre::es2025::StringModule>(*runtime, "String")) {
+            using Handle = spectre::es2025::StringModule::Handle;
+            std::string payload = "   ";
+            for (int i = 0; i < 64; ++i) {
+                payload += "Field" + std::to_string(i) + "=Value_" + std::to_string(i * 31) + ";";
+            }
+            payload += "   ";
+            auto bytes = static_cast<double>(payload.size());
+            Handle text = 0;
+            strings->Create("bench.payload", payload, text);
+            bool upper = false;
+            Measure(options, results, "string.case_fold", bytes, [&]() {
+                upper = !upper;
+                auto status = upper ? strings->ToUpperAscii(text) : strings->ToLowerAscii(text);
+                Keep(status);
+            });
+            Handle trimmed = 0;
+            Measure(options, results, "string.trim", bytes, [&]() {
+                strings->Create("bench.trim", payload, trimmed);
+                strings->TrimAscii(trimmed);
+                strings->Release(trimmed);
+            });
+            std::size_t index = 0;
+            Measure(options, results, "string.index_of", bytes, [&]() {
+                strings->IndexOf(text, "field63=", 0, index);
+                Keep(index);
+            });
+            std::size_t count = 0;
+            Measure(options, results, "string.count", bytes, [&]() {
+                strings->Count(text, ";", count);
+                Keep(count);
+            });
+            std::vector<Handle> fields;
+            Measure(options, results, "string.split", bytes, [&]() {
+                strings->Split(text, ";", "bench.field", fields);
+                for (auto field: fields) {
+                    strings->Release(field);
+                }
+            });
+            std::vector<Handle> batch(256, text);
+            std::array<bool, 256> matches{};
+            Measure(options, results, "string.starts_with_batch", 0.0, [&]() {
+                strings->StartsWith(batch, "   field0", matches);
+                Keep(matches[0]);
+            });
+        }
+
+        if (auto *json = FindModule<spectre::es2025::JsonModule>(*runtime, "JSON")) {
+            auto document = MakeJsonDocument(256);
+            Measure(options, results, "json.parse", static_cast<double>(document.size()), [&]() {
+                spectre::es2025::JsonModule::Document parsed{};
+                std::string diagnostics;
+                json->Parse(document, parsed, diagnostics);
+                Keep(parsed);
+            });
+        }
+
+        if (auto *clone = FindModule<spectre::es2025::StructuredCloneModule>(*runtime, "StructuredClone")) {
+            using Node = spectre::es2025::StructuredCloneModule::Node;
+            Node root;
+            root.kind = Node::Kind::Object;
+            for (int i = 0; i < 64; ++i) {
+                Node item;
+                item.kind = Node::Kind::Array;
+                item.arrayItems = {Node::FromNumber(i), Node::FromString("entity"), Node::FromBoolean(i % 2 == 0)};
+                root.objectProperties.emplace_back("field" + std::to_string(i), std::move(item));
+            }
+            std::vector<std::uint8_t> bytes;
+            clone->Serialize(root, bytes);
+            auto payload = static_cast<double>(bytes.size());
+            Measure(options, results, "structured_clone.serialize", payload, [&]() {
+                bytes.clear();
+                clone->Serialize(root, bytes);
+                Keep(bytes);
+            });
+        }
+    }
+
+    bool ParseArgs(int argc, char **argv, BenchOptions &options) {
+        for (int i = 1; i < argc; ++i) {
+            std::string_view arg = argv[i];
+            if (arg == "--filter" && i + 1 < argc) {
+                options.filter = argv[++i];
+            } else if (arg == "--out" && i + 1 < argc) {
+                options.outputPath = argv[++i];
+            } else if (arg == "--min-time" && i + 1 < argc) {
+                options.minBatchSeconds = std::max(0.001, std::atof(argv[++i]));
+            } else {
+                std::cerr << "usage: spectre_bench [--filter substring] [--min-time seconds] [--out file.json]"
+                          << std::endl;
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+int main(int argc, char **argv) {
+    BenchOptions options{0.05, {}, {}};
+    if (!ParseArgs(argc, argv, options)) {
+        return 2;
+    }
+
+    std::vector<BenchResult> results;
+    BenchFrontend(options, results);
+    BenchEvaluate(options, results);
+    BenchEnvironmentTick(options, results, 1000, "environment.tick.1k_handles");
+    BenchEnvironmentTick(options, results, 100000, "environment.tick.100k_handles");
+    BenchModules(options, results);
+
+    auto json = RenderJson(results, options);
+    if (options.outputPath.empty()) {
+        std::cout << json << std::endl;
+        return 0;
+    }
+    std::ofstream file(options.outputPath, std::ios::binary);
+    if (!file) {
+        std::cerr << "failed to open " << options.outputPath << std::endl;
+        return 1;
+    }
+    file << json << '\n';
+    return 0;
+}
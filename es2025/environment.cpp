@@ -1,6 +1,11 @@
 #include "spectre/es2025/environment.h"
 
+#include <algorithm>
+#include <string>
+
 #include "spectre/es2025/modules/all_modules.h"
+#include "spectre/runtime.h"
+#include "spectre/subsystems.h"
 
 namespace spectre::es2025 {
     Environment::Environment() : m_Subsystems(nullptr), m_Config{}, m_ConfigValid(false) {
@@ -68,6 +73,11 @@ namespace spectre::es2025 {
             }
             m_Index.emplace(name, module.get());
         }
+        m_MemoryStats.assign(m_Modules.size(), ModuleMemoryStats{});
+        for (std::size_t i = 0; i < m_Modules.size(); ++i) {
+            m_MemoryStats[i].name = m_Modules[i]->Name();
+        }
+        m_MemoryChannels.clear();
     }
 
     void Environment::Initialize(const ModuleInitContext &context) {
@@ -85,9 +95,95 @@ namespace spectre::es2025 {
             return;
         }
         ModuleTickContext tickContext{*m_Subsystems};
+        auto *tracer = m_Subsystems->tracer.get();
         for (auto &module: m_Modules) {
+            detail::TraceScope scope(tracer, module->Name(), "module.tick");
             module->Tick(info, tickContext);
         }
+        if (m_Config.telemetry.enableProfiling) {
+            SampleMemory(info.deltaSeconds);
+            PublishMemory(info.frameIndex);
+        }
+    }
+
+    void Environment::SampleMemory(double deltaSeconds) {
+        for (std::size_t i = 0; i < m_Modules.size(); ++i) {
+            auto &stats = m_MemoryStats[i];
+            auto previousAllocated = stats.counters.allocatedBytes;
+            m_Modules[i]->SampleMemory(stats.counters);
+            const auto &counters = stats.counters;
+            auto liveBytes = counters.allocatedBytes - std::min(counters.allocatedBytes, counters.freedBytes);
+            stats.peakLiveBytes = std::max(stats.peakLiveBytes, liveBytes);
+            // Rate of allocation, not of net growth, so churn that frees what it allocates still shows.
+            stats.allocationRate = deltaSeconds > 0.0 && counters.allocatedBytes > previousAllocated
+                                       ? static_cast<double>(counters.allocatedBytes - previousAllocated) /
+                                         deltaSeconds
+                                       : 0.0;
+            stats.slotFragmentation = counters.slotCount == 0
+                                          ? 0.0
+                                          : static_cast<double>(counters.freeSlotCount) /
+                                            static_cast<double>(counters.slotCount);
+        }
+    }
+
+    void Environment::NoteMemoryUsage(std::size_t index, const ModuleMemoryUsage &usage) noexcept {
+        if (index >= m_MemoryStats.size()) {
+            return;
+        }
+        auto &stats = m_MemoryStats[index];
+        stats.usage = usage;
+        stats.peakLiveBytes = std::max(stats.peakLiveBytes, usage.liveBytes);
+        stats.arenaFragmentation = usage.reservedBytes == 0
+                                       ? 0.0
+                                       : static_cast<double>(usage.freeListBytes) /
+                                         static_cast<double>(usage.reservedBytes);
+    }
+
+    const std::vector<ModuleMemoryStats> &Environment::MemoryStats() const noexcept {
+        return m_MemoryStats;
+    }
+
+    void Environment::PublishMemory(std::uint64_t frameIndex) {
+        if (!m_Subsystems || !m_Subsystems->telemetry) {
+            return;
+        }
+        auto &telemetry = *m_Subsystems->telemetry;
+        constexpr std::size_t kChannelsPerModule = 4;
+        if (m_MemoryChannels.empty()) {
+            // Channels are interned once; the per-frame path only pushes trivially copyable samples.
+            m_MemoryChannels.reserve(m_MemoryStats.size() * kChannelsPerModule + 2);
+            std::string channel;
+            for (const auto &stats: m_MemoryStats) {
+                channel.assign("memory.").append(stats.name);
+                auto prefixLength = channel.size();
+                for (auto suffix: {".live", ".peak", ".rate", ".fragmentation"}) {
+                    channel.resize(prefixLength);
+                    m_MemoryChannels.push_back(telemetry.RegisterChannel(channel.append(suffix)));
+                }
+            }
+            m_MemoryChannels.push_back(telemetry.RegisterChannel("memory.modules.live"));
+            m_MemoryChannels.push_back(telemetry.RegisterChannel("memory.modules.allocated"));
+        }
+        std::uint64_t totalLive = 0;
+        std::uint64_t totalAllocated = 0;
+        for (std::size_t i = 0; i < m_MemoryStats.size(); ++i) {
+            const auto &stats = m_MemoryStats[i];
+            const auto &counters = stats.counters;
+            if (!counters.measured || counters.allocatedBytes == 0) {
+                continue;
+            }
+            auto liveBytes = counters.allocatedBytes - std::min(counters.allocatedBytes, counters.freedBytes);
+            totalLive += liveBytes;
+            totalAllocated += counters.allocatedBytes;
+            const auto *channels = m_MemoryChannels.data() + i * kChannelsPerModule;
+            telemetry.PushSample({channels[0], static_cast<double>(liveBytes), frameIndex});
+            telemetry.PushSample({channels[1], static_cast<double>(stats.peakLiveBytes), frameIndex});
+            telemetry.PushSample({channels[2], stats.allocationRate, frameIndex});
+            telemetry.PushSample({channels[3], stats.slotFragmentation, frameIndex});
+        }
+        const auto *totals = m_MemoryChannels.data() + m_MemoryStats.size() * kChannelsPerModule;
+        telemetry.PushSample({totals[0], static_cast<double>(totalLive), frameIndex});
+        telemetry.PushSample({totals[1], static_cast<double>(totalAllocated), frameIndex});
     }
 
     void Environment::OptimizeGpu(bool enableAcceleration) {
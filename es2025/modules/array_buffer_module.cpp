@@ -1,10 +1,20 @@
 #include "spectre/es2025/modules/array_buffer_module.h"
 
 #include <algorithm>
+#include <cstdio>
 #include <cstring>
 #include <limits>
 #include <utility>
 
+#if defined(__unix__) || defined(__APPLE__)
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define SPECTRE_ARRAY_BUFFER_MMAP 1
+#endif
+
 #include "spectre/runtime.h"
 namespace spectre::es2025 {
     namespace {
@@ -13,6 +23,59 @@ namespace spectre::es2025 {
         constexpr std::string_view kReference = "ECMA-262 Section 25.1";
 
         constexpr std::uint64_t kHandleSlotMask = 0xffffffffull;
+
+#if defined(SPECTRE_ARRAY_BUFFER_MMAP)
+        void AdviseHugePages(void *pages, std::size_t bytes) noexcept {
+#if defined(MADV_HUGEPAGE)
+            madvise(pages, bytes, MADV_HUGEPAGE);
+#else
+            (void) pages;
+            (void) bytes;
+#endif
+        }
+
+        // Fresh anonymous mappings read as zero and are only backed once touched.
+        std::uint8_t *MapPages(std::size_t bytes) noexcept {
+            void *pages = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (pages == MAP_FAILED) {
+                return nullptr;
+            }
+            AdviseHugePages(pages, bytes);
+            return static_cast<std::uint8_t *>(pages);
+        }
+
+        // Moves or resizes a mapping in place; the kernel relinks pages rather than copying them.
+        std::uint8_t *RemapPages(std::uint8_t *data, std::size_t oldBytes, std::size_t newBytes) noexcept {
+#if defined(__linux__)
+            void *pages = mremap(data, oldBytes, newBytes, MREMAP_MAYMOVE);
+            if (pages == MAP_FAILED) {
+                return nullptr;
+            }
+            if (newBytes > oldBytes) {
+                AdviseHugePages(pages, newBytes);
+            }
+            return static_cast<std::uint8_t *>(pages);
+#else
+            auto *pages = MapPages(newBytes);
+            if (!pages) {
+                return nullptr;
+            }
+            std::memcpy(pages, data, std::min(oldBytes, newBytes));
+            munmap(data, oldBytes);
+            return pages;
+#endif
+        }
+#endif
+    }
+
+    void ArrayBufferModule::BlockDeleter::operator()(std::uint8_t *data) const noexcept {
+#if defined(SPECTRE_ARRAY_BUFFER_MMAP)
+        if (mappedBytes != 0) {
+            munmap(data, mappedBytes);
+            return;
+        }
+#endif
+        delete[] data;
     }
 
     ArrayBufferModule::Metrics::Metrics() noexcept
@@ -25,7 +88,10 @@ namespace spectre::es2025 {
           copyBetweenBuffers(0),
           fills(0),
           poolReuses(0),
+          poolMisses(0),
           poolReturns(0),
+          poolEvictions(0),
+          poolDecays(0),
           bytesAllocated(0),
           bytesRecycled(0),
           bytesInUse(0),
@@ -34,18 +100,100 @@ namespace spectre::es2025 {
           activeBuffers(0),
           lastFrameTouched(0),
           hotBuffers(0),
+          borrows(0),
+          pinConflicts(0),
+          mappedBuffers(0),
+          mappedBytes(0),
+          remaps(0),
+          fileMappedBuffers(0),
+          fileMappedBytes(0),
           gpuOptimized(false) {
     }
 
-    ArrayBufferModule::Block::Block() noexcept : data(), capacity(0) {
+    ArrayBufferModule::Borrow::Borrow() noexcept
+        : m_Module(nullptr), m_Handle(0), m_Data(nullptr), m_Size(0), m_ReadOnly(false) {
+    }
+
+    ArrayBufferModule::Borrow::Borrow(Borrow &&other) noexcept
+        : m_Module(other.m_Module),
+          m_Handle(other.m_Handle),
+          m_Data(other.m_Data),
+          m_Size(other.m_Size),
+          m_ReadOnly(other.m_ReadOnly) {
+        other.m_Module = nullptr;
+        other.m_Handle = 0;
+        other.m_Data = nullptr;
+        other.m_Size = 0;
+        other.m_ReadOnly = false;
+    }
+
+    ArrayBufferModule::Borrow &ArrayBufferModule::Borrow::operator=(Borrow &&other) noexcept {
+        if (this != &other) {
+            Release();
+            std::swap(m_Module, other.m_Module);
+            std::swap(m_Handle, other.m_Handle);
+            std::swap(m_Data, other.m_Data);
+            std::swap(m_Size, other.m_Size);
+            std::swap(m_ReadOnly, other.m_ReadOnly);
+        }
+        return *this;
+    }
+
+    ArrayBufferModule::Borrow::~Borrow() {
+        Release();
     }
 
-    ArrayBufferModule::Block::Block(std::unique_ptr<std::uint8_t[]> ptr, std::size_t cap) noexcept
-        : data(std::move(ptr)), capacity(cap) {
+    bool ArrayBufferModule::Borrow::Active() const noexcept {
+        return m_Module != nullptr;
+    }
+
+    bool ArrayBufferModule::Borrow::ReadOnly() const noexcept {
+        return m_ReadOnly;
+    }
+
+    const std::uint8_t *ArrayBufferModule::Borrow::Data() const noexcept {
+        return m_Data;
+    }
+
+    std::uint8_t *ArrayBufferModule::Borrow::MutableData() const noexcept {
+        return m_ReadOnly ? nullptr : m_Data;
+    }
+
+    std::size_t ArrayBufferModule::Borrow::Size() const noexcept {
+        return m_Size;
+    }
+
+    std::span<const std::uint8_t> ArrayBufferModule::Borrow::Bytes() const noexcept {
+        return {m_Data, m_Size};
+    }
+
+    std::span<std::uint8_t> ArrayBufferModule::Borrow::MutableBytes() const noexcept {
+        if (m_ReadOnly) {
+            return {};
+        }
+        return {m_Data, m_Size};
+    }
+
+    void ArrayBufferModule::Borrow::Release() noexcept {
+        if (m_Module) {
+            m_Module->Unpin(m_Handle);
+        }
+        m_Module = nullptr;
+        m_Handle = 0;
+        m_Data = nullptr;
+        m_Size = 0;
+        m_ReadOnly = false;
+    }
+
+    ArrayBufferModule::Block::Block() noexcept : data(), capacity(0), pooledFrame(0) {
+    }
+
+    ArrayBufferModule::Block::Block(BlockPtr ptr, std::size_t cap) noexcept
+        : data(std::move(ptr)), capacity(cap), pooledFrame(0) {
     }
 
     ArrayBufferModule::Block::Block(Block &&other) noexcept
-        : data(std::move(other.data)), capacity(other.capacity) {
+        : data(std::move(other.data)), capacity(other.capacity), pooledFrame(other.pooledFrame) {
         other.capacity = 0;
     }
 
@@ -53,6 +201,7 @@ namespace spectre::es2025 {
         if (this != &other) {
             data = std::move(other.data);
             capacity = other.capacity;
+            pooledFrame = other.pooledFrame;
             other.capacity = 0;
         }
         return *this;
@@ -68,9 +217,12 @@ namespace spectre::es2025 {
           capacity(0),
           version(0),
           lastTouchFrame(0),
+          pins(0),
           detachable(true),
           detached(false),
-          hot(false) {
+          hot(false),
+          readOnly(false),
+          fileBacked(false) {
     }
 
     ArrayBufferModule::Slot::Slot() noexcept : record(), generation(0), inUse(false) {
@@ -86,8 +238,12 @@ namespace spectre::es2025 {
           m_Slots(),
           m_FreeSlots(),
           m_Pool(),
+          m_PoolStats(),
           m_TotalPooledBytes(0),
+          m_Memory(),
+          m_SlotTableBytes(0),
           m_Metrics() {
+        ResetPoolStats();
     }
 
     std::string_view ArrayBufferModule::Name() const noexcept {
@@ -116,6 +272,7 @@ namespace spectre::es2025 {
     void ArrayBufferModule::Tick(const TickInfo &info, const ModuleTickContext &) noexcept {
         m_CurrentFrame = info.frameIndex;
         RecomputeHotMetrics();
+        DecayPool();
     }
 
     void ArrayBufferModule::OptimizeGpu(const ModuleGpuContext &context) noexcept {
@@ -127,6 +284,33 @@ namespace spectre::es2025 {
         m_Config = config;
         m_GpuEnabled = config.enableGpuAcceleration;
         m_Metrics.gpuOptimized = m_GpuEnabled;
+        TrimPool(PoolLimit());
+    }
+
+    void ArrayBufferModule::CollectMemory(ModuleMemoryUsage &usage) const noexcept {
+        memory::Begin(usage);
+        std::uint64_t poolTableBytes = 0;
+        for (const auto &bucket: m_Pool) {
+            poolTableBytes += memory::VectorBytes(bucket);
+        }
+        memory::AddSlotTable(usage, m_Slots.size(), m_FreeSlots.size(), sizeof(Slot),
+                             memory::VectorBytes(m_Slots) + memory::VectorBytes(m_FreeSlots) + poolTableBytes);
+        for (const auto &slot: m_Slots) {
+            if (!slot.inUse) {
+                continue;
+            }
+            const auto &record = slot.record;
+            auto labelBytes = memory::StringBytes(record.label);
+            usage.reservedBytes += labelBytes + record.capacity;
+            usage.liveBytes += labelBytes + record.byteLength;
+            usage.freeListBytes += record.capacity - std::min(record.capacity, record.byteLength);
+        }
+        usage.reservedBytes += m_TotalPooledBytes;
+        usage.freeListBytes += m_TotalPooledBytes;
+    }
+
+    void ArrayBufferModule::SampleMemory(ModuleMemoryCounters &counters) const noexcept {
+        memory::Sample(counters, m_Memory, m_Slots.size(), m_FreeSlots.size());
     }
 
     StatusCode ArrayBufferModule::Create(std::string_view label, std::size_t byteLength, Handle &outHandle) {
@@ -137,12 +321,12 @@ namespace spectre::es2025 {
         if (m_Metrics.bytesInUse + byteLength > m_Config.memory.heapBytes) {
             return StatusCode::CapacityExceeded;
         }
-        auto alignedCapacity = AlignCapacity(byteLength);
+        auto alignedCapacity = CapacityFor(byteLength);
         Block block = AcquireBlock(alignedCapacity);
         if (byteLength > 0 && alignedCapacity > 0 && !block.data) {
             return StatusCode::InternalError;
         }
-        if (byteLength > 0 && block.data) {
+        if (byteLength > 0 && block.data && !Mapped(block.data)) {
             std::memset(block.data.get(), 0, byteLength);
         }
 
@@ -160,6 +344,7 @@ namespace spectre::es2025 {
         } else {
             slot.record.label.assign(label);
         }
+        m_Memory.Allocate(memory::StringBytes(slot.record.label));
         slot.record.byteLength = byteLength;
         slot.record.capacity = block.capacity;
         slot.record.detached = false;
@@ -189,6 +374,100 @@ namespace spectre::es2025 {
         return StatusCode::Ok;
     }
 
+    StatusCode ArrayBufferModule::CreateMapped(std::string_view path,
+                                               bool readOnly,
+                                               std::string_view label,
+                                               Handle &outHandle) {
+        outHandle = 0;
+        if (path.empty()) {
+            return StatusCode::InvalidArgument;
+        }
+        std::string filePath(path);
+#if defined(SPECTRE_ARRAY_BUFFER_MMAP)
+        int fd = open(filePath.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            return errno == ENOENT ? StatusCode::NotFound : StatusCode::InvalidArgument;
+        }
+        struct stat info {};
+        if (fstat(fd, &info) != 0 || !S_ISREG(info.st_mode)) {
+            close(fd);
+            return StatusCode::InvalidArgument;
+        }
+        auto byteLength = static_cast<std::size_t>(info.st_size);
+        BlockPtr data;
+        if (byteLength > 0) {
+            // The mapping keeps the file referenced, so the descriptor can be closed right away.
+            void *pages = readOnly
+                              ? mmap(nullptr, byteLength, PROT_READ, MAP_SHARED, fd, 0)
+                              : mmap(nullptr, byteLength, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+            if (pages == MAP_FAILED) {
+                close(fd);
+                return StatusCode::InternalError;
+            }
+            data = BlockPtr(static_cast<std::uint8_t *>(pages), BlockDeleter{byteLength});
+        }
+        close(fd);
+
+        auto slotIndex = AcquireSlot();
+        auto &slot = m_Slots[slotIndex];
+        auto handle = EncodeHandle(slotIndex, slot.generation);
+        slot.record = BufferRecord();
+        slot.record.handle = handle;
+        slot.record.slot = slotIndex;
+        slot.record.generation = slot.generation;
+        slot.record.label.assign(label.empty() ? path : label);
+        m_Memory.Allocate(memory::StringBytes(slot.record.label));
+        slot.record.data = std::move(data);
+        slot.record.byteLength = byteLength;
+        slot.record.capacity = byteLength;
+        slot.record.version = 1;
+        slot.record.lastTouchFrame = m_CurrentFrame;
+        slot.record.hot = true;
+        slot.record.readOnly = readOnly;
+        slot.record.fileBacked = true;
+        slot.inUse = true;
+
+        m_Metrics.allocations += 1;
+        m_Metrics.activeBuffers += 1;
+        m_Metrics.fileMappedBuffers += 1;
+        m_Metrics.fileMappedBytes += byteLength;
+        m_Metrics.lastFrameTouched = m_CurrentFrame;
+        m_Metrics.hotBuffers += 1;
+        outHandle = handle;
+        return StatusCode::Ok;
+#else
+        // Without mmap the file is read into an ordinary buffer; read-only is still enforced.
+        std::FILE *file = std::fopen(filePath.c_str(), "rb");
+        if (!file) {
+            return StatusCode::NotFound;
+        }
+        long size = -1;
+        if (std::fseek(file, 0, SEEK_END) == 0) {
+            size = std::ftell(file);
+        }
+        if (size < 0 || std::fseek(file, 0, SEEK_SET) != 0) {
+            std::fclose(file);
+            return StatusCode::InvalidArgument;
+        }
+        auto byteLength = static_cast<std::size_t>(size);
+        auto status = Create(label.empty() ? path : label, byteLength, outHandle);
+        if (status != StatusCode::Ok) {
+            std::fclose(file);
+            return status;
+        }
+        auto *record = FindMutable(outHandle);
+        auto read = byteLength > 0 ? std::fread(record->data.get(), 1, byteLength, file) : 0;
+        std::fclose(file);
+        if (read != byteLength) {
+            Destroy(outHandle);
+            outHandle = 0;
+            return StatusCode::InternalError;
+        }
+        record->readOnly = readOnly;
+        return StatusCode::Ok;
+#endif
+    }
+
         StatusCode ArrayBufferModule::Clone(Handle handle, std::string_view label, Handle &outHandle) {
         outHandle = 0;
         const BufferRecord *source = Find(handle);
@@ -224,12 +503,15 @@ namespace spectre::es2025 {
         if (!record) {
             return StatusCode::NotFound;
         }
-        if (record->detached) {
+        if (record->detached || record->readOnly || record->fileBacked) {
             return StatusCode::InvalidArgument;
         }
         if (newByteLength == record->byteLength) {
             return StatusCode::Ok;
         }
+        if (RejectPinned(*record)) {
+            return StatusCode::InvalidArgument;
+        }
         if (newByteLength > m_Config.memory.heapBytes) {
             return StatusCode::CapacityExceeded;
         }
@@ -240,26 +522,46 @@ namespace spectre::es2025 {
         }
         auto oldLength = record->byteLength;
         auto oldCapacity = record->capacity;
-        auto desiredCapacity = AlignCapacity(newByteLength);
+        auto desiredCapacity = CapacityFor(newByteLength);
         if (desiredCapacity == 0) {
             Block oldBlock(std::move(record->data), record->capacity);
             record->capacity = 0;
             ReturnBlock(std::move(oldBlock));
+#if defined(SPECTRE_ARRAY_BUFFER_MMAP)
+        } else if (preserveData && Mapped(record->data) && desiredCapacity >= kMappedThreshold
+                   && desiredCapacity != oldCapacity) {
+            auto *pages = RemapPages(record->data.get(), oldCapacity, desiredCapacity);
+            if (!pages) {
+                return StatusCode::InternalError;
+            }
+            static_cast<void>(record->data.release());
+            record->data = BlockPtr(pages, BlockDeleter{desiredCapacity});
+            record->capacity = desiredCapacity;
+            m_Memory.Resize(oldCapacity, desiredCapacity);
+            // Pages past the old capacity arrive zeroed; only the stale tail of the old block
+            // needs clearing.
+            if (newByteLength > oldLength) {
+                std::memset(pages + oldLength, 0, std::min(newByteLength, oldCapacity) - oldLength);
+            }
+            m_Metrics.mappedBytes = m_Metrics.mappedBytes - oldCapacity + desiredCapacity;
+            m_Metrics.remaps += 1;
+#endif
         } else if (desiredCapacity > oldCapacity || (desiredCapacity < oldCapacity / 2 && desiredCapacity > 0)) {
             Block newBlock = AcquireBlock(desiredCapacity);
             if (newByteLength > 0 && !newBlock.data) {
                 return StatusCode::InternalError;
             }
             if (newByteLength > 0) {
+                auto fresh = Mapped(newBlock.data);
                 if (preserveData && record->data) {
                     auto copyBytes = std::min(oldLength, newByteLength);
                     if (copyBytes > 0) {
                         std::memcpy(newBlock.data.get(), record->data.get(), copyBytes);
                     }
-                    if (newByteLength > copyBytes) {
+                    if (newByteLength > copyBytes && !fresh) {
                         std::memset(newBlock.data.get() + copyBytes, 0, newByteLength - copyBytes);
                     }
-                } else {
+                } else if (!fresh) {
                     std::memset(newBlock.data.get(), 0, newByteLength);
                 }
             }
@@ -339,12 +641,17 @@ namespace spectre::es2025 {
         if (record->detached) {
             return StatusCode::Ok;
         }
-        auto releasedBytes = record->byteLength;
-        Block oldBlock(std::move(record->data), record->capacity);
-        record->capacity = 0;
+        if (RejectPinned(*record)) {
+            return StatusCode::InvalidArgument;
+        }
+        auto releasedBytes = record->fileBacked ? 0 : record->byteLength;
+        if (record->fileBacked) {
+            ReleaseFileMapping(*record);
+        } else {
+            ReturnBlock(*record);
+        }
         record->byteLength = 0;
         record->detached = true;
-        ReturnBlock(std::move(oldBlock));
         m_Metrics.bytesInUse = (releasedBytes > m_Metrics.bytesInUse) ? 0 : (m_Metrics.bytesInUse - releasedBytes);
         m_Metrics.detaches += 1;
         Touch(*record);
@@ -356,12 +663,17 @@ namespace spectre::es2025 {
         if (!record) {
             return StatusCode::NotFound;
         }
+        if (RejectPinned(*record)) {
+            return StatusCode::InvalidArgument;
+        }
         auto slotIndex = record->slot;
-        auto reclaimedBytes = record->byteLength;
-        Block oldBlock(std::move(record->data), record->capacity);
-        record->capacity = 0;
+        auto reclaimedBytes = record->fileBacked ? 0 : record->byteLength;
+        if (record->fileBacked) {
+            ReleaseFileMapping(*record);
+        } else {
+            ReturnBlock(*record);
+        }
         record->byteLength = 0;
-        ReturnBlock(std::move(oldBlock));
         m_Metrics.bytesInUse = (reclaimedBytes > m_Metrics.bytesInUse) ? 0 : (m_Metrics.bytesInUse - reclaimedBytes);
         if (m_Metrics.activeBuffers > 0) {
             m_Metrics.activeBuffers -= 1;
@@ -374,7 +686,7 @@ namespace spectre::es2025 {
 
     StatusCode ArrayBufferModule::Fill(Handle handle, std::uint8_t value) noexcept {
         auto *record = FindMutable(handle);
-        if (!record || record->detached) {
+        if (!record || record->detached || record->readOnly) {
             return record ? StatusCode::InvalidArgument : StatusCode::NotFound;
         }
         if (!record->data || record->byteLength == 0) {
@@ -391,7 +703,7 @@ namespace spectre::es2025 {
                                          const std::uint8_t *data,
                                          std::size_t size) noexcept {
         auto *record = FindMutable(handle);
-        if (!record || record->detached) {
+        if (!record || record->detached || record->readOnly) {
             return record ? StatusCode::InvalidArgument : StatusCode::NotFound;
         }
         if ((size > 0 && !data) || offset > record->byteLength) {
@@ -444,7 +756,7 @@ namespace spectre::es2025 {
         if (!sourceRecord || !targetRecord) {
             return StatusCode::NotFound;
         }
-        if (sourceRecord->detached || targetRecord->detached) {
+        if (sourceRecord->detached || targetRecord->detached || targetRecord->readOnly) {
             return StatusCode::InvalidArgument;
         }
         if (sourceOffset + size > sourceRecord->byteLength ||
@@ -459,6 +771,37 @@ namespace spectre::es2025 {
         return StatusCode::Ok;
     }
 
+    StatusCode ArrayBufferModule::BorrowBytes(Handle handle, std::size_t offset, std::size_t size,
+                                              Borrow &outBorrow) noexcept {
+        outBorrow.Release();
+        auto *record = FindMutable(handle);
+        if (!record || record->detached) {
+            return record ? StatusCode::InvalidArgument : StatusCode::NotFound;
+        }
+        if (offset > record->byteLength || size > record->byteLength - offset) {
+            return StatusCode::InvalidArgument;
+        }
+        record->pins += 1;
+        outBorrow.m_Module = this;
+        outBorrow.m_Handle = handle;
+        outBorrow.m_Data = record->data ? record->data.get() + offset : nullptr;
+        outBorrow.m_Size = size;
+        outBorrow.m_ReadOnly = record->readOnly;
+        m_Metrics.borrows += 1;
+        Touch(*record);
+        return StatusCode::Ok;
+    }
+
+    StatusCode ArrayBufferModule::BorrowBytes(Handle handle, Borrow &outBorrow) noexcept {
+        auto length = ByteLength(handle);
+        return BorrowBytes(handle, 0, length, outBorrow);
+    }
+
+    std::uint32_t ArrayBufferModule::PinCount(Handle handle) const noexcept {
+        const auto *record = Find(handle);
+        return record ? record->pins : 0;
+    }
+
     bool ArrayBufferModule::Has(Handle handle) const noexcept {
         return Find(handle) != nullptr;
     }
@@ -468,6 +811,11 @@ namespace spectre::es2025 {
         return record ? record->detached : false;
     }
 
+    bool ArrayBufferModule::ReadOnly(Handle handle) const noexcept {
+        const auto *record = Find(handle);
+        return record ? record->readOnly : false;
+    }
+
     std::size_t ArrayBufferModule::ByteLength(Handle handle) const noexcept {
         const auto *record = Find(handle);
         if (!record || record->detached) {
@@ -480,6 +828,31 @@ namespace spectre::es2025 {
         return m_Metrics;
     }
 
+    std::uint64_t ArrayBufferModule::PoolLimit() const noexcept {
+        return m_Config.memory.arenaBytes;
+    }
+
+    std::span<const ArrayBufferModule::PoolBucketStats> ArrayBufferModule::PoolStats() const noexcept {
+        return m_PoolStats;
+    }
+
+    void ArrayBufferModule::TrimPool(std::uint64_t maxRetainedBytes) noexcept {
+        while (m_TotalPooledBytes > maxRetainedBytes) {
+            // Evict the least recently returned block; on a tie prefer the larger bucket.
+            std::size_t victim = kPoolBuckets;
+            for (std::size_t bucket = kPoolBuckets; bucket-- > 0;) {
+                if (!m_Pool[bucket].empty()
+                    && (victim == kPoolBuckets || m_Pool[bucket].front().pooledFrame < m_Pool[victim].front().pooledFrame)) {
+                    victim = bucket;
+                }
+            }
+            if (victim == kPoolBuckets) {
+                break;
+            }
+            DropPooled(victim, 1, false);
+        }
+    }
+
     bool ArrayBufferModule::GpuEnabled() const noexcept {
         return m_GpuEnabled;
     }
@@ -547,6 +920,21 @@ namespace spectre::es2025 {
         return capacity;
     }
 
+    std::size_t ArrayBufferModule::CapacityFor(std::size_t byteLength) noexcept {
+        auto capacity = AlignCapacity(byteLength);
+#if defined(SPECTRE_ARRAY_BUFFER_MMAP)
+        if (capacity >= kMappedThreshold) {
+            // Round to the huge-page granule instead of the next power of two.
+            capacity = (byteLength + (kMappedThreshold - 1)) & ~(kMappedThreshold - 1);
+        }
+#endif
+        return capacity;
+    }
+
+    bool ArrayBufferModule::Mapped(const BlockPtr &data) noexcept {
+        return data && data.get_deleter().mappedBytes != 0;
+    }
+
     std::size_t ArrayBufferModule::BucketIndex(std::size_t capacity) noexcept {
         if (capacity <= kMinCapacity) {
             return 0;
@@ -566,13 +954,21 @@ namespace spectre::es2025 {
         for (auto &bucket: m_Pool) {
             bucket.clear();
         }
+        ResetPoolStats();
         m_TotalPooledBytes = 0;
+        m_Memory.Reset();
+        m_SlotTableBytes = 0;
+        TrackSlots();
         m_CurrentFrame = 0;
         m_Metrics.bytesInUse = 0;
         m_Metrics.peakBytesInUse = 0;
         m_Metrics.pooledBytes = 0;
         m_Metrics.activeBuffers = 0;
         m_Metrics.hotBuffers = 0;
+        m_Metrics.mappedBuffers = 0;
+        m_Metrics.mappedBytes = 0;
+        m_Metrics.fileMappedBuffers = 0;
+        m_Metrics.fileMappedBytes = 0;
         m_Metrics.lastFrameTouched = 0;
     }
 
@@ -587,6 +983,7 @@ namespace spectre::es2025 {
         }
         auto slotIndex = static_cast<std::uint32_t>(m_Slots.size());
         m_Slots.emplace_back();
+        TrackSlots();
         auto &slot = m_Slots[slotIndex];
         slot.inUse = true;
         slot.generation = 1;
@@ -603,16 +1000,36 @@ namespace spectre::es2025 {
         }
         slot.inUse = false;
         slot.generation += 1;
+        m_Memory.Free(memory::StringBytes(slot.record.label));
         slot.record = BufferRecord();
         m_FreeSlots.push_back(slotIndex);
+        TrackSlots();
+    }
+
+    void ArrayBufferModule::TrackSlots() noexcept {
+        auto bytes = memory::VectorBytes(m_Slots) + memory::VectorBytes(m_FreeSlots);
+        m_Memory.Resize(m_SlotTableBytes, bytes);
+        m_SlotTableBytes = bytes;
     }
 
     ArrayBufferModule::Block ArrayBufferModule::AcquireBlock(std::size_t capacity) {
         if (capacity == 0) {
             return Block();
         }
+#if defined(SPECTRE_ARRAY_BUFFER_MMAP)
+        if (capacity >= kMappedThreshold) {
+            if (auto *pages = MapPages(capacity)) {
+                m_Metrics.bytesAllocated += capacity;
+                m_Memory.Allocate(capacity);
+                m_Metrics.mappedBuffers += 1;
+                m_Metrics.mappedBytes += capacity;
+                return Block(BlockPtr(pages, BlockDeleter{capacity}), capacity);
+            }
+        }
+#endif
         auto bucket = BucketIndex(capacity);
         auto &list = m_Pool[bucket];
+        auto &stats = m_PoolStats[bucket];
         if (!list.empty()) {
             Block block = std::move(list.back());
             list.pop_back();
@@ -622,12 +1039,20 @@ namespace spectre::es2025 {
             } else {
                 m_TotalPooledBytes = 0;
             }
+            stats.hits += 1;
+            stats.retainedBlocks -= 1;
+            stats.retainedBytes -= std::min<std::uint64_t>(stats.retainedBytes, cap);
             m_Metrics.poolReuses += 1;
             m_Metrics.pooledBytes = m_TotalPooledBytes;
             return block;
         }
-        auto ptr = std::make_unique<std::uint8_t[]>(capacity);
+        stats.misses += 1;
+        m_Metrics.poolMisses += 1;
+        // Create and Resize zero the bytes they expose, so the allocation itself is left
+        // uninitialized.
+        BlockPtr ptr(new std::uint8_t[capacity]);
         m_Metrics.bytesAllocated += capacity;
+        m_Memory.Allocate(capacity);
         return Block(std::move(ptr), capacity);
     }
 
@@ -635,15 +1060,83 @@ namespace spectre::es2025 {
         if (!block.data || block.capacity == 0) {
             return;
         }
+        if (Mapped(block.data)) {
+            // Unmapping hands the pages straight back to the kernel; pooling them would pin RSS.
+            m_Metrics.mappedBuffers -= std::min<std::uint64_t>(m_Metrics.mappedBuffers, 1);
+            m_Metrics.mappedBytes -= std::min<std::uint64_t>(m_Metrics.mappedBytes, block.capacity);
+            m_Memory.Free(block.capacity);
+            block.data.reset();
+            block.capacity = 0;
+            return;
+        }
         auto bucket = BucketIndex(block.capacity);
         auto cap = block.capacity;
+        auto limit = PoolLimit();
+        if (cap > limit) {
+            m_PoolStats[bucket].evictions += 1;
+            m_Metrics.poolEvictions += 1;
+            m_Memory.Free(cap);
+            return;
+        }
+        if (m_TotalPooledBytes + cap > limit) {
+            TrimPool(limit - cap);
+        }
+        block.pooledFrame = m_CurrentFrame;
         m_TotalPooledBytes += cap;
+        m_PoolStats[bucket].retainedBlocks += 1;
+        m_PoolStats[bucket].retainedBytes += cap;
         m_Metrics.poolReturns += 1;
         m_Metrics.bytesRecycled += cap;
         m_Metrics.pooledBytes = m_TotalPooledBytes;
         m_Pool[bucket].push_back(std::move(block));
     }
 
+    void ArrayBufferModule::DropPooled(std::size_t bucket, std::size_t count, bool decayed) noexcept {
+        auto &list = m_Pool[bucket];
+        auto &stats = m_PoolStats[bucket];
+        count = std::min(count, list.size());
+        std::uint64_t released = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            released += list[i].capacity;
+        }
+        list.erase(list.begin(), list.begin() + static_cast<std::ptrdiff_t>(count));
+        m_Memory.Free(released);
+        m_TotalPooledBytes -= std::min(m_TotalPooledBytes, released);
+        stats.retainedBlocks -= std::min<std::uint64_t>(stats.retainedBlocks, count);
+        stats.retainedBytes -= std::min(stats.retainedBytes, released);
+        if (decayed) {
+            stats.decays += count;
+            m_Metrics.poolDecays += count;
+        } else {
+            stats.evictions += count;
+            m_Metrics.poolEvictions += count;
+        }
+        m_Metrics.pooledBytes = m_TotalPooledBytes;
+    }
+
+    void ArrayBufferModule::DecayPool() noexcept {
+        if (m_TotalPooledBytes == 0) {
+            return;
+        }
+        for (std::size_t bucket = 0; bucket < kPoolBuckets; ++bucket) {
+            const auto &list = m_Pool[bucket];
+            std::size_t idle = 0;
+            while (idle < list.size() && m_CurrentFrame >= list[idle].pooledFrame
+                   && m_CurrentFrame - list[idle].pooledFrame > kPoolIdleFrames) {
+                ++idle;
+            }
+            if (idle != 0) {
+                DropPooled(bucket, idle, true);
+            }
+        }
+    }
+
+    void ArrayBufferModule::ResetPoolStats() noexcept {
+        for (std::size_t bucket = 0; bucket < kPoolBuckets; ++bucket) {
+            m_PoolStats[bucket] = PoolBucketStats{static_cast<std::uint64_t>(kMinCapacity) << bucket, 0, 0, 0, 0, 0, 0};
+        }
+    }
+
     void ArrayBufferModule::ReturnBlock(BufferRecord &record) noexcept {
         if (!record.data || record.capacity == 0) {
             record.data.reset();
@@ -655,6 +1148,16 @@ namespace spectre::es2025 {
         ReturnBlock(std::move(block));
     }
 
+    void ArrayBufferModule::ReleaseFileMapping(BufferRecord &record) noexcept {
+        // File pages never enter the pool or the anonymous-mapping totals; unmapping drops this
+        // process's reference and leaves the page cache to other mappers.
+        m_Metrics.fileMappedBuffers -= std::min<std::uint64_t>(m_Metrics.fileMappedBuffers, 1);
+        m_Metrics.fileMappedBytes -= std::min<std::uint64_t>(m_Metrics.fileMappedBytes, record.byteLength);
+        record.data.reset();
+        record.capacity = 0;
+        record.fileBacked = false;
+    }
+
     void ArrayBufferModule::Touch(BufferRecord &record) noexcept {
         record.version += 1;
         record.lastTouchFrame = m_CurrentFrame;
@@ -682,6 +1185,21 @@ namespace spectre::es2025 {
         }
         m_Metrics.hotBuffers = hotCount;
     }
+
+    void ArrayBufferModule::Unpin(Handle handle) noexcept {
+        auto *record = FindMutable(handle);
+        if (record && record->pins > 0) {
+            record->pins -= 1;
+        }
+    }
+
+    bool ArrayBufferModule::RejectPinned(const BufferRecord &record) noexcept {
+        if (record.pins == 0) {
+            return false;
+        }
+        m_Metrics.pinConflicts += 1;
+        return true;
+    }
 }
 
 
@@ -1,6 +1,8 @@
 ﻿#include "spectre/es2025/modules/array_module.h"
 
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <cmath>
 #include <iterator>
 #include <limits>
@@ -18,6 +20,255 @@ namespace spectre::es2025 {
         constexpr std::size_t kDefaultDenseCapacity = 16;
         constexpr double kSparsePromotionRatio = 0.75;
         constexpr double kDenseCompactionRatio = 0.30;
+        // Packed arrays shorter than this sort with std::sort; longer ones use radix passes.
+        constexpr std::size_t kRadixSortThreshold = 64;
+
+        // LSD radix sort over order-preserving unsigned keys, one byte per pass. Passes where every
+        // key shares the digit are skipped, so narrow value ranges cost only a few passes.
+        template<typename Key>
+        void RadixSort(std::vector<Key> &keys) {
+            std::vector<Key> scratch(keys.size());
+            for (unsigned shift = 0; shift < sizeof(Key) * 8; shift += 8) {
+                std::array<std::size_t, 256> counts{};
+                for (auto key: keys) {
+                    counts[(key >> shift) & 0xffu] += 1;
+                }
+                if (counts[(keys.front() >> shift) & 0xffu] == keys.size()) {
+                    continue;
+                }
+                std::size_t offset = 0;
+                for (auto &count: counts) {
+                    auto bucket = count;
+                    count = offset;
+                    offset += bucket;
+                }
+                for (auto key: keys) {
+                    scratch[counts[(key >> shift) & 0xffu]++] = key;
+                }
+                keys.swap(scratch);
+            }
+        }
+
+        void SortInts(std::vector<std::int32_t> &values, bool ascending) {
+            if (values.size() < kRadixSortThreshold) {
+                std::sort(values.begin(), values.end());
+            } else {
+                std::vector<std::uint32_t> keys(values.size());
+                for (std::size_t i = 0; i < values.size(); ++i) {
+                    keys[i] = static_cast<std::uint32_t>(values[i]) ^ 0x80000000u;
+                }
+                RadixSort(keys);
+                for (std::size_t i = 0; i < values.size(); ++i) {
+                    values[i] = static_cast<std::int32_t>(keys[i] ^ 0x80000000u);
+                }
+            }
+            if (!ascending) {
+                std::reverse(values.begin(), values.end());
+            }
+        }
+
+        // NaN has no numeric order; it is kept after every other value in either direction.
+        void SortDoubles(std::vector<double> &values, bool ascending) {
+            auto numbers = std::partition(values.begin(), values.end(), [](double value) {
+                return !std::isnan(value);
+            });
+            auto count = static_cast<std::size_t>(numbers - values.begin());
+            if (count < kRadixSortThreshold) {
+                std::sort(values.begin(), numbers);
+            } else {
+                // Flipping the sign bit of positives and every bit of negatives makes the IEEE
+                // encoding order-preserving as an unsigned integer.
+                constexpr std::uint64_t kSign = 1ull << 63;
+                std::vector<std::uint64_t> keys(count);
+                for (std::size_t i = 0; i < count; ++i) {
+                    auto bits = std::bit_cast<std::uint64_t>(values[i]);
+                    keys[i] = (bits & kSign) != 0 ? ~bits : bits | kSign;
+                }
+                RadixSort(keys);
+                for (std::size_t i = 0; i < count; ++i) {
+                    auto key = keys[i];
+                    values[i] = std::bit_cast<double>((key & kSign) != 0 ? key & ~kSign : ~key);
+                }
+            }
+            if (!ascending) {
+                std::reverse(values.begin(), numbers);
+            }
+        }
+
+        template<typename Element>
+        bool SearchPacked(const std::vector<Element> &values, double needle, std::size_t &outIndex) {
+            std::size_t left = 0;
+            std::size_t right = values.size();
+            while (left < right) {
+                std::size_t mid = left + ((right - left) >> 1);
+                auto value = static_cast<double>(values[mid]);
+                if (value < needle) {
+                    left = mid + 1;
+                } else if (value > needle) {
+                    right = mid;
+                } else {
+                    outIndex = mid;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        template<typename Element>
+        void ReallocateVector(std::vector<Element> &values, std::size_t capacity) {
+            std::vector<Element> next;
+            next.reserve(capacity);
+            next.insert(next.end(), std::make_move_iterator(values.begin()), std::make_move_iterator(values.end()));
+            values.swap(next);
+        }
+    }
+
+    std::size_t ArrayModule::DenseData::Size() const noexcept {
+        switch (elements) {
+            case ElementKind::PackedInt32:
+                return ints.size();
+            case ElementKind::PackedDouble:
+                return doubles.size();
+            default:
+                return items.size();
+        }
+    }
+
+    std::size_t ArrayModule::DenseData::Capacity() const noexcept {
+        switch (elements) {
+            case ElementKind::PackedInt32:
+                return ints.capacity();
+            case ElementKind::PackedDouble:
+                return doubles.capacity();
+            default:
+                return items.capacity();
+        }
+    }
+
+    std::uint64_t ArrayModule::DenseData::ReservedBytes() const noexcept {
+        return memory::VectorBytes(ints) + memory::VectorBytes(doubles) + memory::VectorBytes(items);
+    }
+
+    std::uint64_t ArrayModule::DenseData::UsedBytes() const noexcept {
+        return memory::UsedVectorBytes(ints) + memory::UsedVectorBytes(doubles) + memory::UsedVectorBytes(items);
+    }
+
+    Value ArrayModule::DenseData::At(std::size_t index) const {
+        switch (elements) {
+            case ElementKind::PackedInt32:
+                return Value::Int32(ints[index]);
+            case ElementKind::PackedDouble:
+                return Value::Number(doubles[index]);
+            default:
+                return items[index];
+        }
+    }
+
+    void ArrayModule::DenseData::Store(std::size_t index, const Value &value) {
+        switch (elements) {
+            case ElementKind::PackedInt32:
+                ints[index] = value.AsInt32();
+                break;
+            case ElementKind::PackedDouble:
+                doubles[index] = value.AsNumber();
+                break;
+            default:
+                items[index] = value;
+                break;
+        }
+    }
+
+    void ArrayModule::DenseData::Append(const Value &value) {
+        switch (elements) {
+            case ElementKind::PackedInt32:
+                ints.push_back(value.AsInt32());
+                break;
+            case ElementKind::PackedDouble:
+                doubles.push_back(value.AsNumber());
+                break;
+            default:
+                items.push_back(value);
+                break;
+        }
+    }
+
+    void ArrayModule::DenseData::InsertAt(std::size_t index, const Value &value) {
+        auto offset = static_cast<std::ptrdiff_t>(index);
+        switch (elements) {
+            case ElementKind::PackedInt32:
+                ints.insert(ints.begin() + offset, value.AsInt32());
+                break;
+            case ElementKind::PackedDouble:
+                doubles.insert(doubles.begin() + offset, value.AsNumber());
+                break;
+            default:
+                items.insert(items.begin() + offset, value);
+                break;
+        }
+    }
+
+    void ArrayModule::DenseData::EraseAt(std::size_t index) {
+        auto offset = static_cast<std::ptrdiff_t>(index);
+        switch (elements) {
+            case ElementKind::PackedInt32:
+                ints.erase(ints.begin() + offset);
+                break;
+            case ElementKind::PackedDouble:
+                doubles.erase(doubles.begin() + offset);
+                break;
+            default:
+                items.erase(items.begin() + offset);
+                break;
+        }
+    }
+
+    void ArrayModule::DenseData::PopBack() noexcept {
+        switch (elements) {
+            case ElementKind::PackedInt32:
+                ints.pop_back();
+                break;
+            case ElementKind::PackedDouble:
+                doubles.pop_back();
+                break;
+            default:
+                items.pop_back();
+                break;
+        }
+    }
+
+    void ArrayModule::DenseData::Clear() noexcept {
+        ints.clear();
+        doubles.clear();
+        items.clear();
+    }
+
+    void ArrayModule::DenseData::Reallocate(std::size_t capacity) {
+        switch (elements) {
+            case ElementKind::PackedInt32:
+                ReallocateVector(ints, capacity);
+                break;
+            case ElementKind::PackedDouble:
+                ReallocateVector(doubles, capacity);
+                break;
+            default:
+                ReallocateVector(items, capacity);
+                break;
+        }
+    }
+
+    void ArrayModule::DenseData::Retype(ElementKind kind) {
+        if (kind == elements) {
+            return;
+        }
+        auto size = Size();
+        auto capacity = Capacity();
+        DenseData next;
+        next.elements = kind;
+        next.Reallocate(capacity);
+        for (std::size_t i = 0; i < size; ++i) {
+            next.Append(At(i));
+        }
+        *this = std::move(next);
     }
 
     ArrayModule::ArrayModule()
@@ -29,7 +280,9 @@ namespace spectre::es2025 {
           m_CurrentFrame(0),
           m_Slots(),
           m_FreeSlots(),
-          m_Metrics() {
+          m_Metrics(),
+          m_Memory(),
+          m_SlotTableBytes(0) {
     }
 
     std::string_view ArrayModule::Name() const noexcept {
@@ -54,6 +307,9 @@ namespace spectre::es2025 {
         m_Slots.clear();
         m_FreeSlots.clear();
         m_Metrics = Metrics();
+        m_Memory.Reset();
+        m_SlotTableBytes = 0;
+        TrackSlots();
     }
 
     void ArrayModule::Tick(const TickInfo &info, const ModuleTickContext &) noexcept {
@@ -78,6 +334,7 @@ namespace spectre::es2025 {
                     MaybePromote(record);
                 }
             }
+            Track(record);
             record.hot = false;
         }
     }
@@ -91,6 +348,35 @@ namespace spectre::es2025 {
         m_GpuEnabled = config.enableGpuAcceleration;
     }
 
+    void ArrayModule::CollectMemory(ModuleMemoryUsage &usage) const noexcept {
+        memory::Begin(usage);
+        memory::AddSlotTable(usage, m_Slots.size(), m_FreeSlots.size(), sizeof(Slot),
+                             memory::VectorBytes(m_Slots) + memory::VectorBytes(m_FreeSlots));
+        for (const auto &slot: m_Slots) {
+            if (!slot.inUse) {
+                continue;
+            }
+            const auto &record = slot.record;
+            auto labelBytes = memory::StringBytes(record.label);
+            auto storageBytes = record.dense.ReservedBytes() + memory::VectorBytes(record.sparse.entries);
+            auto usedBytes = record.dense.UsedBytes() + memory::UsedVectorBytes(record.sparse.entries);
+            std::uint64_t payloadBytes = 0;
+            for (const auto &item: record.dense.items) {
+                payloadBytes += item.HeapBytes();
+            }
+            for (const auto &entry: record.sparse.entries) {
+                payloadBytes += entry.value.HeapBytes();
+            }
+            usage.reservedBytes += labelBytes + storageBytes + payloadBytes;
+            usage.liveBytes += labelBytes + usedBytes + payloadBytes;
+            usage.freeListBytes += storageBytes - usedBytes;
+        }
+    }
+
+    void ArrayModule::SampleMemory(ModuleMemoryCounters &counters) const noexcept {
+        memory::Sample(counters, m_Memory, m_Slots.size(), m_FreeSlots.size());
+    }
+
     StatusCode ArrayModule::CreateDense(std::string_view label, std::size_t capacityHint, Handle &outHandle) {
         return CreateInternal(label, StorageKind::Dense, capacityHint, outHandle);
     }
@@ -108,7 +394,7 @@ namespace spectre::es2025 {
         StatusCode status = CreateInternal(label,
                                            source->kind,
                                            source->kind == StorageKind::Dense
-                                               ? source->dense.items.capacity()
+                                               ? source->dense.Capacity()
                                                : source->sparse.entries.size(),
                                            outHandle);
         if (status != StatusCode::Ok) {
@@ -123,10 +409,13 @@ namespace spectre::es2025 {
             return StatusCode::InternalError;
         }
         if (source->kind == StorageKind::Dense) {
-            auto previousCapacity = target->dense.items.capacity();
+            auto previousCapacity = target->dense.Capacity();
+            target->dense.Retype(source->dense.elements);
+            target->dense.ints = source->dense.ints;
+            target->dense.doubles = source->dense.doubles;
             target->dense.items = source->dense.items;
-            UpdateMetricsOnResizeDense(previousCapacity, target->dense.items.capacity());
-            UpdateLength(*target, target->dense.items.size());
+            UpdateMetricsOnResizeDense(previousCapacity, target->dense.Capacity());
+            UpdateLength(*target, target->dense.Size());
         } else {
             auto previous = target->sparse.entries.size();
             target->sparse.entries = source->sparse.entries;
@@ -137,6 +426,7 @@ namespace spectre::es2025 {
         target->version = source->version;
         target->lastTouchFrame = m_CurrentFrame;
         target->hot = true;
+        Track(*target);
         m_Metrics.clones += 1;
         m_Metrics.lastMutationFrame = m_CurrentFrame;
         return StatusCode::Ok;
@@ -153,9 +443,12 @@ namespace spectre::es2025 {
             return StatusCode::NotFound;
         }
         UpdateMetricsOnDestroy(slot.record);
+        m_Memory.Free(slot.record.trackedBytes);
+        slot.record.trackedBytes = 0;
         slot.inUse = false;
         slot.generation += 1;
         m_FreeSlots.push_back(slotIndex);
+        TrackSlots();
         return StatusCode::Ok;
     }
 
@@ -165,22 +458,19 @@ namespace spectre::es2025 {
             return StatusCode::NotFound;
         }
         if (record->kind == StorageKind::Dense) {
-            auto &items = record->dense.items;
-            if (items.capacity() == 0) {
-                auto desired = AlignCapacity(std::max<std::size_t>(kDefaultDenseCapacity, items.size() + 1));
-                items.reserve(desired);
-                UpdateMetricsOnResizeDense(0, items.capacity());
-            } else if (items.size() == items.capacity()) {
-                auto previousCapacity = items.capacity();
-                auto desired = AlignCapacity(previousCapacity * 2);
-                std::vector<Value> expanded;
-                expanded.reserve(desired);
-                expanded.insert(expanded.end(), items.begin(), items.end());
-                items.swap(expanded);
-                UpdateMetricsOnResizeDense(previousCapacity, items.capacity());
+            Accommodate(*record, value);
+            auto &dense = record->dense;
+            if (dense.Capacity() == 0) {
+                auto desired = AlignCapacity(std::max<std::size_t>(kDefaultDenseCapacity, dense.Size() + 1));
+                dense.Reallocate(desired);
+                UpdateMetricsOnResizeDense(0, dense.Capacity());
+            } else if (dense.Size() == dense.Capacity()) {
+                auto previousCapacity = dense.Capacity();
+                dense.Reallocate(AlignCapacity(previousCapacity * 2));
+                UpdateMetricsOnResizeDense(previousCapacity, dense.Capacity());
             }
-            items.push_back(value);
-            UpdateLength(*record, items.size());
+            dense.Append(value);
+            UpdateLength(*record, dense.Size());
         } else {
             auto previous = record->sparse.entries.size();
             record->sparse.entries.push_back({record->length, value});
@@ -216,14 +506,14 @@ namespace spectre::es2025 {
             return StatusCode::NotFound;
         }
         if (record->kind == StorageKind::Dense) {
-            auto &items = record->dense.items;
-            if (items.empty()) {
+            auto &dense = record->dense;
+            if (dense.Size() == 0) {
                 outValue = Value::Undefined();
                 return StatusCode::NotFound;
             }
-            outValue = items.back();
-            items.pop_back();
-            UpdateLength(*record, items.size());
+            outValue = dense.At(dense.Size() - 1);
+            dense.PopBack();
+            UpdateLength(*record, dense.Size());
             Touch(*record);
             EnsureCompaction(*record);
             return StatusCode::Ok;
@@ -253,15 +543,14 @@ namespace spectre::es2025 {
             return StatusCode::NotFound;
         }
         if (record->kind == StorageKind::Dense) {
-            auto &items = record->dense.items;
-            if (items.empty()) {
+            auto &dense = record->dense;
+            if (dense.Size() == 0) {
                 outValue = Value::Undefined();
                 return StatusCode::NotFound;
             }
-            outValue = items.front();
-            std::move(items.begin() + 1, items.end(), items.begin());
-            items.pop_back();
-            UpdateLength(*record, items.size());
+            outValue = dense.At(0);
+            dense.EraseAt(0);
+            UpdateLength(*record, dense.Size());
             Touch(*record);
             EnsureCompaction(*record);
             return StatusCode::Ok;
@@ -293,20 +582,18 @@ namespace spectre::es2025 {
             return StatusCode::NotFound;
         }
         if (record->kind == StorageKind::Dense) {
-            auto &items = record->dense.items;
-            if (items.capacity() == 0) {
-                items.reserve(AlignCapacity(kDefaultDenseCapacity));
-                UpdateMetricsOnResizeDense(0, items.capacity());
-            } else if (items.size() == items.capacity()) {
-                auto previousCapacity = items.capacity();
-                std::vector<Value> expanded;
-                expanded.reserve(AlignCapacity(previousCapacity * 2));
-                expanded.insert(expanded.end(), items.begin(), items.end());
-                items.swap(expanded);
-                UpdateMetricsOnResizeDense(previousCapacity, items.capacity());
+            Accommodate(*record, value);
+            auto &dense = record->dense;
+            if (dense.Capacity() == 0) {
+                dense.Reallocate(AlignCapacity(kDefaultDenseCapacity));
+                UpdateMetricsOnResizeDense(0, dense.Capacity());
+            } else if (dense.Size() == dense.Capacity()) {
+                auto previousCapacity = dense.Capacity();
+                dense.Reallocate(AlignCapacity(previousCapacity * 2));
+                UpdateMetricsOnResizeDense(previousCapacity, dense.Capacity());
             }
-            items.insert(items.begin(), value);
-            UpdateLength(*record, items.size());
+            dense.InsertAt(0, value);
+            UpdateLength(*record, dense.Size());
         } else {
             auto &entries = record->sparse.entries;
             auto previous = entries.size();
@@ -332,11 +619,11 @@ namespace spectre::es2025 {
             return StatusCode::NotFound;
         }
         if (record->kind == StorageKind::Dense) {
-            if (index >= record->dense.items.size()) {
+            if (index >= record->dense.Size()) {
                 outValue = Value::Undefined();
                 return StatusCode::NotFound;
             }
-            outValue = record->dense.items[index];
+            outValue = record->dense.At(index);
             return StatusCode::Ok;
         }
         const auto &entries = record->sparse.entries;
@@ -358,15 +645,16 @@ namespace spectre::es2025 {
             return StatusCode::NotFound;
         }
         if (record->kind == StorageKind::Dense) {
-            auto &items = record->dense.items;
-            if (index > items.size()) {
+            auto size = record->dense.Size();
+            if (index > size) {
                 ConvertToSparse(*record);
                 return Set(handle, index, value);
             }
-            if (index == items.size()) {
+            if (index == size) {
                 return Push(handle, value);
             }
-            items[index] = value;
+            Accommodate(*record, value);
+            record->dense.Store(index, value);
             Touch(*record);
             return StatusCode::Ok;
         }
@@ -394,12 +682,12 @@ namespace spectre::es2025 {
             return StatusCode::NotFound;
         }
         if (record->kind == StorageKind::Dense) {
-            auto &items = record->dense.items;
-            if (index >= items.size()) {
+            auto &dense = record->dense;
+            if (index >= dense.Size()) {
                 return StatusCode::NotFound;
             }
-            items.erase(items.begin() + static_cast<std::ptrdiff_t>(index));
-            UpdateLength(*record, items.size());
+            dense.EraseAt(index);
+            UpdateLength(*record, dense.Size());
             Touch(*record);
             EnsureCompaction(*record);
             return StatusCode::Ok;
@@ -437,9 +725,25 @@ namespace spectre::es2025 {
         if (record->kind == StorageKind::Sparse) {
             ConvertToDense(*record);
         }
-        auto &items = record->dense.items;
-        for (auto &entry: items) {
-            entry = value;
+        // Every element is replaced, so the array can take the fill value's kind outright.
+        auto &dense = record->dense;
+        auto size = dense.Size();
+        auto kind = ElementKindFor(value);
+        if (kind != dense.elements) {
+            dense.Clear();
+            dense.Retype(kind);
+            m_Metrics.elementTransitions += 1;
+        }
+        switch (kind) {
+            case ElementKind::PackedInt32:
+                dense.ints.assign(size, value.AsInt32());
+                break;
+            case ElementKind::PackedDouble:
+                dense.doubles.assign(size, value.AsNumber());
+                break;
+            default:
+                dense.items.assign(size, value);
+                break;
         }
         Touch(*record);
         return StatusCode::Ok;
@@ -451,17 +755,18 @@ namespace spectre::es2025 {
             return StatusCode::NotFound;
         }
         if (record->kind == StorageKind::Dense) {
-            auto &items = record->dense.items;
-            auto previousCapacity = items.capacity();
-            auto desired = AlignCapacity(std::max(capacity, items.size()));
+            auto &dense = record->dense;
+            auto previousCapacity = dense.Capacity();
+            auto desired = AlignCapacity(std::max(capacity, dense.Size()));
             if (desired <= previousCapacity) {
                 return StatusCode::Ok;
             }
-            items.reserve(desired);
-            UpdateMetricsOnResizeDense(previousCapacity, items.capacity());
+            dense.Reallocate(desired);
+            UpdateMetricsOnResizeDense(previousCapacity, dense.Capacity());
         } else {
             record->sparse.entries.reserve(capacity);
         }
+        Track(*record);
         return StatusCode::Ok;
     }
 
@@ -480,9 +785,10 @@ namespace spectre::es2025 {
             return StatusCode::NotFound;
         }
         if (record->kind == StorageKind::Dense) {
-            auto &items = record->dense.items;
-            auto previousCapacity = items.capacity();
-            items.clear();
+            auto &dense = record->dense;
+            auto previousCapacity = dense.Capacity();
+            dense.Clear();
+            dense.Retype(ElementKind::PackedInt32);
             UpdateLength(*record, 0);
             Touch(*record);
             if (previousCapacity > AlignCapacity(kDefaultDenseCapacity)) {
@@ -544,6 +850,61 @@ namespace spectre::es2025 {
         return StatusCode::Ok;
     }
 
+    StatusCode ArrayModule::OpenCursor(Handle handle, std::size_t begin, std::size_t end, Cursor &outCursor) const {
+        outCursor = {};
+        auto *record = Find(handle);
+        if (record == nullptr) {
+            return StatusCode::NotFound;
+        }
+        if (begin > end || end > record->length) {
+            return StatusCode::InvalidArgument;
+        }
+        outCursor.handle = handle;
+        outCursor.version = record->version;
+        outCursor.position = begin;
+        outCursor.end = end;
+        return StatusCode::Ok;
+    }
+
+    StatusCode ArrayModule::Next(Cursor &cursor, std::span<Value> out, std::size_t &outCount) const {
+        outCount = 0;
+        auto *record = Find(cursor.handle);
+        if (record == nullptr) {
+            return StatusCode::NotFound;
+        }
+        if (record->version != cursor.version) {
+            return StatusCode::InvalidArgument;
+        }
+        auto count = std::min(out.size(), cursor.end - cursor.position);
+        if (record->kind == StorageKind::Dense) {
+            const auto &dense = record->dense;
+            auto size = dense.Size();
+            for (std::size_t i = 0; i < count; ++i) {
+                auto index = cursor.position + i;
+                out[i] = index < size ? dense.At(index) : Value::Undefined();
+            }
+        } else {
+            // Sparse entries are sorted by index: find the first one in range, then merge-walk.
+            const auto &entries = record->sparse.entries;
+            auto it = std::lower_bound(entries.begin(), entries.end(), cursor.position,
+                                       [](const SparseEntry &entry, std::size_t value) {
+                                           return entry.index < value;
+                                       });
+            for (std::size_t i = 0; i < count; ++i) {
+                auto index = cursor.position + i;
+                if (it != entries.end() && it->index == index) {
+                    out[i] = it->value;
+                    ++it;
+                } else {
+                    out[i] = Value::Undefined();
+                }
+            }
+        }
+        cursor.position += count;
+        outCount = count;
+        return StatusCode::Ok;
+    }
+
     StatusCode ArrayModule::SortNumeric(Handle handle, bool ascending) {
         auto *record = FindMutable(handle);
         if (record == nullptr) {
@@ -552,15 +913,21 @@ namespace spectre::es2025 {
         if (record->kind == StorageKind::Sparse) {
             ConvertToDense(*record);
         }
-        auto &items = record->dense.items;
-        auto comparator = [ascending](const Value &lhs, const Value &rhs) {
-            int cmp = NumericCompare(lhs, rhs);
-            if (ascending) {
-                return cmp < 0;
-            }
-            return cmp > 0;
-        };
-        std::sort(items.begin(), items.end(), comparator);
+        auto &dense = record->dense;
+        if (dense.elements == ElementKind::PackedInt32) {
+            SortInts(dense.ints, ascending);
+        } else if (dense.elements == ElementKind::PackedDouble) {
+            SortDoubles(dense.doubles, ascending);
+        } else {
+            auto comparator = [ascending](const Value &lhs, const Value &rhs) {
+                int cmp = NumericCompare(lhs, rhs);
+                if (ascending) {
+                    return cmp < 0;
+                }
+                return cmp > 0;
+            };
+            std::sort(dense.items.begin(), dense.items.end(), comparator);
+        }
         Touch(*record);
         return StatusCode::Ok;
     }
@@ -573,7 +940,7 @@ namespace spectre::es2025 {
         if (record->kind == StorageKind::Sparse) {
             ConvertToDense(*record);
         }
-        auto &items = record->dense.items;
+        auto &dense = record->dense;
         auto comparator = [ascending](const Value &lhs, const Value &rhs) {
             int cmp = LexicographicCompare(lhs, rhs);
             if (ascending) {
@@ -581,7 +948,16 @@ namespace spectre::es2025 {
             }
             return cmp > 0;
         };
-        std::sort(items.begin(), items.end(), comparator);
+        auto packedComparator = [&comparator](auto lhs, auto rhs) {
+            return comparator(Value(lhs), Value(rhs));
+        };
+        if (dense.elements == ElementKind::PackedInt32) {
+            std::sort(dense.ints.begin(), dense.ints.end(), packedComparator);
+        } else if (dense.elements == ElementKind::PackedDouble) {
+            std::sort(dense.doubles.begin(), dense.doubles.end(), packedComparator);
+        } else {
+            std::sort(dense.items.begin(), dense.items.end(), comparator);
+        }
         Touch(*record);
         return StatusCode::Ok;
     }
@@ -596,15 +972,23 @@ namespace spectre::es2025 {
         if (record->kind != StorageKind::Dense) {
             return StatusCode::InvalidArgument;
         }
-        const auto &items = record->dense.items;
-        if (items.empty()) {
+        const auto &dense = record->dense;
+        if (dense.Size() == 0) {
             return StatusCode::NotFound;
         }
+        if (numeric && dense.elements != ElementKind::Generic) {
+            auto target = ResolveNumeric(needle, 0.0);
+            bool found = dense.elements == ElementKind::PackedInt32
+                             ? SearchPacked(dense.ints, target, outIndex)
+                             : SearchPacked(dense.doubles, target, outIndex);
+            return found ? StatusCode::Ok : StatusCode::NotFound;
+        }
         std::size_t left = 0;
-        std::size_t right = items.size();
+        std::size_t right = dense.Size();
         while (left < right) {
             std::size_t mid = left + ((right - left) >> 1);
-            int cmp = numeric ? NumericCompare(items[mid], needle) : LexicographicCompare(items[mid], needle);
+            auto item = dense.At(mid);
+            int cmp = numeric ? NumericCompare(item, needle) : LexicographicCompare(item, needle);
             if (cmp == 0) {
                 outIndex = mid;
                 return StatusCode::Ok;
@@ -624,7 +1008,7 @@ namespace spectre::es2025 {
             return 0;
         }
         if (record->kind == StorageKind::Dense) {
-            return record->dense.items.size();
+            return record->dense.Size();
         }
         return record->length;
     }
@@ -641,6 +1025,14 @@ namespace spectre::es2025 {
         return record->kind;
     }
 
+    ArrayModule::ElementKind ArrayModule::ElementKindOf(Handle handle) const noexcept {
+        auto *record = Find(handle);
+        if (record == nullptr || record->kind != StorageKind::Dense) {
+            return ElementKind::Generic;
+        }
+        return record->dense.elements;
+    }
+
     const ArrayModule::Metrics &ArrayModule::GetMetrics() const noexcept {
         return m_Metrics;
     }
@@ -699,6 +1091,7 @@ namespace spectre::es2025 {
             outHandle = EncodeHandle(slotIndex, slot.generation);
             ResetRecord(slot.record, kind, label, capacityHint, outHandle, slotIndex, slot.generation);
             UpdateMetricsOnCreate(slot.record);
+            TrackSlots();
             return StatusCode::Ok;
         }
         slotIndex = static_cast<std::uint32_t>(m_Slots.size());
@@ -710,6 +1103,7 @@ namespace spectre::es2025 {
         ResetRecord(m_Slots[slotIndex].record, kind, label, capacityHint, outHandle, slotIndex,
                     m_Slots[slotIndex].generation);
         UpdateMetricsOnCreate(m_Slots[slotIndex].record);
+        TrackSlots();
         return StatusCode::Ok;
     }
 
@@ -721,7 +1115,7 @@ namespace spectre::es2025 {
         record.generation = generation;
         record.kind = kind;
         record.label.assign(label);
-        record.dense.items.clear();
+        record.dense = DenseData();
         record.sparse.entries.clear();
         record.sparse.maxIndex = 0;
         record.length = 0;
@@ -731,9 +1125,10 @@ namespace spectre::es2025 {
         record.hot = true;
         if (kind == StorageKind::Dense) {
             auto desired = AlignCapacity(std::max<std::size_t>(capacityHint, kDefaultDenseCapacity));
-            record.dense.items.reserve(desired);
-            UpdateMetricsOnResizeDense(0, record.dense.items.capacity());
+            record.dense.Reallocate(desired);
+            UpdateMetricsOnResizeDense(0, record.dense.Capacity());
         }
+        Track(record);
     }
 
     void ArrayModule::Touch(ArrayRecord &record) noexcept {
@@ -741,12 +1136,45 @@ namespace spectre::es2025 {
         record.lastTouchFrame = m_CurrentFrame;
         record.hot = true;
         m_Metrics.lastMutationFrame = m_CurrentFrame;
+        Track(record);
+    }
+
+    // O(1) retake of the record's own storage; Value payloads are left to CollectMemory.
+    void ArrayModule::Track(ArrayRecord &record) noexcept {
+        auto bytes = memory::StringBytes(record.label) + record.dense.ReservedBytes() +
+                     memory::VectorBytes(record.sparse.entries);
+        m_Memory.Resize(record.trackedBytes, bytes);
+        record.trackedBytes = bytes;
+    }
+
+    void ArrayModule::TrackSlots() noexcept {
+        auto bytes = memory::VectorBytes(m_Slots) + memory::VectorBytes(m_FreeSlots);
+        m_Memory.Resize(m_SlotTableBytes, bytes);
+        m_SlotTableBytes = bytes;
+    }
+
+    void ArrayModule::Accommodate(ArrayRecord &record, const Value &value) {
+        auto needed = std::max(record.dense.elements, ElementKindFor(value));
+        if (needed != record.dense.elements) {
+            record.dense.Retype(needed);
+            m_Metrics.elementTransitions += 1;
+        }
+    }
+
+    ArrayModule::ElementKind ArrayModule::ElementKindFor(const Value &value) noexcept {
+        if (value.IsInt32()) {
+            return ElementKind::PackedInt32;
+        }
+        if (value.IsNumber()) {
+            return ElementKind::PackedDouble;
+        }
+        return ElementKind::Generic;
     }
 
     void ArrayModule::UpdateMetricsOnCreate(const ArrayRecord &record) {
         if (record.kind == StorageKind::Dense) {
             m_Metrics.denseCount += 1;
-            m_Metrics.denseCapacity += record.dense.items.capacity();
+            m_Metrics.denseCapacity += record.dense.Capacity();
         } else {
             m_Metrics.sparseCount += 1;
         }
@@ -758,8 +1186,8 @@ namespace spectre::es2025 {
             if (m_Metrics.denseCount > 0) {
                 m_Metrics.denseCount -= 1;
             }
-            if (m_Metrics.denseCapacity >= record.dense.items.capacity()) {
-                m_Metrics.denseCapacity -= record.dense.items.capacity();
+            if (m_Metrics.denseCapacity >= record.dense.Capacity()) {
+                m_Metrics.denseCapacity -= record.dense.Capacity();
             } else {
                 m_Metrics.denseCapacity = 0;
             }
@@ -835,8 +1263,8 @@ namespace spectre::es2025 {
         if (record.kind == StorageKind::Sparse) {
             return;
         }
-        auto previousCapacity = record.dense.items.capacity();
-        auto previousLength = record.dense.items.size();
+        auto previousCapacity = record.dense.Capacity();
+        auto previousLength = record.dense.Size();
         UpdateKindMetrics(StorageKind::Dense, StorageKind::Sparse);
         if (m_Metrics.denseCapacity >= previousCapacity) {
             m_Metrics.denseCapacity -= previousCapacity;
@@ -850,12 +1278,13 @@ namespace spectre::es2025 {
         }
         std::vector<SparseEntry> entries;
         entries.reserve(previousLength);
-        for (std::size_t i = 0; i < record.dense.items.size(); ++i) {
-            if (!record.dense.items[i].Empty()) {
-                entries.push_back({i, record.dense.items[i]});
+        for (std::size_t i = 0; i < previousLength; ++i) {
+            auto value = record.dense.At(i);
+            if (!value.Empty()) {
+                entries.push_back({i, std::move(value)});
             }
         }
-        record.dense.items.clear();
+        record.dense = DenseData();
         record.kind = StorageKind::Sparse;
         auto previous = record.sparse.entries.size();
         record.sparse.entries = std::move(entries);
@@ -878,28 +1307,44 @@ namespace spectre::es2025 {
         UpdateSparseEntryCount(record, previousCount, 0);
         std::size_t targetLength = record.sparse.entries.empty() ? 0 : record.sparse.maxIndex + 1;
         std::size_t desiredCapacity = AlignCapacity(std::max<std::size_t>(targetLength, kDefaultDenseCapacity));
-        std::vector<Value> dense;
-        dense.reserve(desiredCapacity);
-        dense.resize(targetLength, Value::Undefined());
+        // Holes read as undefined and force Generic; a hole-free array takes the widest kind of
+        // its entries.
+        auto elements = ElementKind::PackedInt32;
+        if (record.sparse.entries.size() != targetLength) {
+            elements = ElementKind::Generic;
+        }
         for (const auto &entry: record.sparse.entries) {
-            if (entry.index < dense.size()) {
-                dense[entry.index] = entry.value;
+            elements = std::max(elements, ElementKindFor(entry.value));
+        }
+        DenseData dense;
+        dense.elements = elements;
+        dense.Reallocate(desiredCapacity);
+        if (elements == ElementKind::Generic) {
+            dense.items.resize(targetLength, Value::Undefined());
+            for (const auto &entry: record.sparse.entries) {
+                if (entry.index < targetLength) {
+                    dense.items[entry.index] = entry.value;
+                }
+            }
+        } else {
+            for (const auto &entry: record.sparse.entries) {
+                dense.Append(entry.value);
             }
         }
         record.sparse.entries.clear();
         record.sparse.maxIndex = 0;
         record.kind = StorageKind::Dense;
-        auto previousCapacity = record.dense.items.capacity();
-        record.dense.items = std::move(dense);
-        UpdateMetricsOnResizeDense(previousCapacity, record.dense.items.capacity());
-        UpdateLength(record, record.dense.items.size());
+        auto previousCapacity = record.dense.Capacity();
+        record.dense = std::move(dense);
+        UpdateMetricsOnResizeDense(previousCapacity, record.dense.Capacity());
+        UpdateLength(record, record.dense.Size());
         m_Metrics.transitionsToDense += 1;
     }
 
     void ArrayModule::EnsureCompaction(ArrayRecord &record) {
         if (record.kind == StorageKind::Dense) {
-            auto capacity = record.dense.items.capacity();
-            auto size = record.dense.items.size();
+            auto capacity = record.dense.Capacity();
+            auto size = record.dense.Size();
             if (capacity > 0 && size * 2 < capacity) {
                 record.pendingCompaction = true;
             }
@@ -909,16 +1354,13 @@ namespace spectre::es2025 {
     }
 
     void ArrayModule::CompactDense(ArrayRecord &record) {
-        auto previousCapacity = record.dense.items.capacity();
-        auto desiredCapacity = AlignCapacity(std::max<std::size_t>(record.dense.items.size(), kDefaultDenseCapacity));
+        auto previousCapacity = record.dense.Capacity();
+        auto desiredCapacity = AlignCapacity(std::max<std::size_t>(record.dense.Size(), kDefaultDenseCapacity));
         if (desiredCapacity == previousCapacity) {
             return;
         }
-        std::vector<Value> compacted;
-        compacted.reserve(desiredCapacity);
-        compacted.insert(compacted.end(), record.dense.items.begin(), record.dense.items.end());
-        record.dense.items.swap(compacted);
-        UpdateMetricsOnResizeDense(previousCapacity, record.dense.items.capacity());
+        record.dense.Reallocate(desiredCapacity);
+        UpdateMetricsOnResizeDense(previousCapacity, record.dense.Capacity());
     }
 
     void ArrayModule::CompactSparse(ArrayRecord &record) {
@@ -966,11 +1408,11 @@ namespace spectre::es2025 {
         if (record.kind != StorageKind::Dense) {
             return false;
         }
-        auto capacity = record.dense.items.capacity();
+        auto capacity = record.dense.Capacity();
         if (capacity == 0) {
             return false;
         }
-        auto size = record.dense.items.size();
+        auto size = record.dense.Size();
         if (size == 0 && capacity > kDefaultDenseCapacity) {
             record.pendingCompaction = true;
             return true;
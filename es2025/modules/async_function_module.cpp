@@ -148,6 +148,26 @@ namespace spectre::es2025 {
         m_GpuEnabled = config.enableGpuAcceleration;
     }
 
+    void AsyncFunctionModule::CollectMemory(ModuleMemoryUsage &usage) const noexcept {
+        memory::Begin(usage);
+        memory::AddSlotTable(usage, m_Slots.size(), m_FreeList.size(), sizeof(Slot),
+                             memory::VectorBytes(m_Slots) + memory::VectorBytes(m_FreeList));
+        auto queueBytes = memory::VectorBytes(m_WaitingQueue) + memory::VectorBytes(m_ReadyQueue) +
+                          memory::VectorBytes(m_Completed);
+        for (const auto &result: m_Completed) {
+            queueBytes += result.value.HeapBytes() + memory::StringBytes(result.diagnostics);
+        }
+        usage.reservedBytes += queueBytes;
+        usage.liveBytes += queueBytes;
+    }
+
+    void AsyncFunctionModule::SampleMemory(ModuleMemoryCounters &counters) const noexcept {
+        m_Memory.Observe(memory::VectorBytes(m_Slots) + memory::VectorBytes(m_FreeList) +
+                         memory::VectorBytes(m_WaitingQueue) + memory::VectorBytes(m_ReadyQueue) +
+                         memory::VectorBytes(m_Completed));
+        memory::Sample(counters, m_Memory.Totals(), m_Slots.size(), m_FreeList.size());
+    }
+
     StatusCode AsyncFunctionModule::Configure(std::size_t queueCapacity, std::size_t completionCapacity) {
         if (queueCapacity == 0) {
             queueCapacity = kDefaultQueueCapacity;
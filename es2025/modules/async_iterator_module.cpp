@@ -230,6 +230,40 @@ AsyncIteratorModule::AsyncIteratorModule()
         Configure(streamCap, queueCap, waiterCap);
     }
 
+    void AsyncIteratorModule::CollectMemory(ModuleMemoryUsage &usage) const noexcept {
+        memory::Begin(usage);
+        memory::AddSlotTable(usage, m_Slots.size(), m_FreeSlots.size(), sizeof(Slot),
+                             memory::VectorBytes(m_Slots) + memory::VectorBytes(m_FreeSlots));
+        for (const auto &slot: m_Slots) {
+            if (!slot.inUse) {
+                continue;
+            }
+            auto bytes = memory::VectorBytes(slot.queue) + memory::VectorBytes(slot.waiters) +
+                         memory::StringBytes(slot.terminalDiagnostics);
+            for (const auto &entry: slot.queue) {
+                bytes += entry.value.HeapBytes() + memory::StringBytes(entry.diagnostics);
+            }
+            // The queue and waiter rings are preallocated; only their occupied entries are live.
+            auto idleBytes = static_cast<std::uint64_t>(slot.queue.size() - slot.count) * sizeof(Entry) +
+                             static_cast<std::uint64_t>(slot.waiters.size() - slot.waiterCount) * sizeof(Waiter);
+            usage.reservedBytes += bytes;
+            usage.liveBytes += bytes - idleBytes;
+            usage.freeListBytes += idleBytes;
+        }
+        auto settledBytes = memory::VectorBytes(m_Settled);
+        for (const auto &result: m_Settled) {
+            settledBytes += result.value.HeapBytes() + memory::StringBytes(result.diagnostics);
+        }
+        usage.reservedBytes += settledBytes;
+        usage.liveBytes += settledBytes;
+    }
+
+    void AsyncIteratorModule::SampleMemory(ModuleMemoryCounters &counters) const noexcept {
+        m_Memory.Observe(memory::VectorBytes(m_Slots) + memory::VectorBytes(m_FreeSlots) +
+                         memory::VectorBytes(m_Settled));
+        memory::Sample(counters, m_Memory.Totals(), m_Slots.size(), m_FreeSlots.size());
+    }
+
     StatusCode AsyncIteratorModule::Configure(std::size_t streamCapacity,
                                               std::size_t queueCapacity,
                                               std::size_t waiterCapacity) {
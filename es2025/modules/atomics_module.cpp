@@ -1,7 +1,11 @@
 ﻿#include "spectre/es2025/modules/atomics_module.h"
 
 #include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cmath>
 #include <limits>
+#include <thread>
 
 #include "spectre/runtime.h"
 
@@ -14,6 +18,17 @@ namespace spectre::es2025 {
         constexpr std::size_t kHotFrameWindow = 8;
         constexpr std::size_t kAlignmentWords = 16;
         constexpr std::size_t kMaxLinearWords = static_cast<std::size_t>(1) << 26; // 64M bytes of 64-bit lanes.
+        constexpr double kMaxWaitMilliseconds = 1.0e12;
+        constexpr std::size_t kCacheLineBytes = 64;
+        constexpr std::size_t kWordsPerLine = kCacheLineBytes / sizeof(std::int64_t);
+        constexpr std::size_t kMaxCounterStripes = 256;
+
+        // Small id handed out to each thread on first use; stripes are picked from it.
+        std::size_t ThreadStripe() noexcept {
+            static std::atomic<std::size_t> next{0};
+            thread_local const std::size_t stripe = next.fetch_add(1, std::memory_order_relaxed);
+            return stripe;
+        }
 
         std::memory_order NormalizeFailureOrder(std::memory_order order) noexcept {
             switch (order) {
@@ -49,9 +64,20 @@ namespace spectre::es2025 {
           m_GpuEnabled(false),
           m_Initialized(false),
           m_CurrentFrame(0),
-          m_Slots{},
+          m_SlotChunks{},
+          m_SlotCount(0),
+          m_SlotMutex(),
           m_FreeSlots{},
-          m_Metrics{} {
+          m_Metrics{},
+          m_Memory{},
+          m_SlotTableBytes(0),
+          m_WaitBuckets{},
+          m_Waits(0),
+          m_Wakes(0),
+          m_WaitTimeouts(0),
+          m_WaitMismatches(0),
+          m_Notifies(0),
+          m_ActiveWaiters(0) {
     }
 
     std::string_view AtomicsModule::Name() const noexcept {
@@ -73,14 +99,28 @@ namespace spectre::es2025 {
         m_GpuEnabled = context.config.enableGpuAcceleration;
         m_Metrics = BufferMetrics();
         m_Metrics.gpuOptimized = m_GpuEnabled;
-        m_Slots.clear();
+        for (auto &stripe: m_OpStripes) {
+            stripe.loads.store(0, std::memory_order_relaxed);
+            stripe.stores.store(0, std::memory_order_relaxed);
+            stripe.rmws.store(0, std::memory_order_relaxed);
+            stripe.compareExchangeHits.store(0, std::memory_order_relaxed);
+            stripe.compareExchangeMisses.store(0, std::memory_order_relaxed);
+        }
+        for (auto &chunk: m_SlotChunks) {
+            chunk.reset();
+        }
+        m_SlotCount.store(0, std::memory_order_release);
         m_FreeSlots.clear();
+        m_Memory.Reset();
+        m_SlotTableBytes = 0;
+        TrackSlots();
         m_CurrentFrame = 0;
         m_Initialized = true;
     }
 
     void AtomicsModule::Tick(const TickInfo &info, const ModuleTickContext &) noexcept {
-        m_CurrentFrame = info.frameIndex;
+        // Touch reads the frame from whichever thread runs an operation.
+        std::atomic_ref<std::uint64_t>(m_CurrentFrame).store(info.frameIndex, std::memory_order_relaxed);
         RecomputeHotMetrics();
     }
 
@@ -95,51 +135,149 @@ namespace spectre::es2025 {
         m_Metrics.gpuOptimized = m_GpuEnabled;
     }
 
-    StatusCode AtomicsModule::CreateBuffer(std::string_view label, std::size_t wordCount, Handle &outHandle) {
+    void AtomicsModule::CollectMemory(ModuleMemoryUsage &usage) const noexcept {
+        memory::Begin(usage);
+        auto slotCount = m_SlotCount.load(std::memory_order_acquire);
+        auto chunkCount = (slotCount + kSlotChunkSize - 1) / kSlotChunkSize;
+        memory::AddSlotTable(usage, slotCount, m_FreeSlots.size(), sizeof(Slot),
+                             chunkCount * sizeof(SlotChunk) + memory::VectorBytes(m_FreeSlots));
+        for (std::uint32_t index = 0; index < slotCount; ++index) {
+            const auto &slot = *SlotAt(index);
+            if (!slot.inUse) {
+                continue;
+            }
+            const auto &record = slot.record;
+            auto labelBytes = memory::StringBytes(record.label);
+            auto wordBytes = memory::VectorBytes(record.lanes->words);
+            auto laneBytes = static_cast<std::uint64_t>(record.logicalLength) * record.wordStride * sizeof(std::int64_t);
+            usage.reservedBytes += labelBytes + wordBytes;
+            usage.liveBytes += labelBytes + laneBytes;
+            usage.freeListBytes += wordBytes - std::min<std::uint64_t>(wordBytes, laneBytes);
+        }
+    }
+
+    StatusCode AtomicsModule::CreateBuffer(std::string_view label,
+                                           std::size_t wordCount,
+                                           Handle &outHandle,
+                                           Layout layout) {
         outHandle = 0;
-        if (wordCount == 0 || wordCount > kMaxLinearWords) {
+        auto maxWords = layout == Layout::Padded ? kMaxLinearWords / kWordsPerLine : kMaxLinearWords;
+        if (wordCount == 0 || wordCount > maxWords) {
             return StatusCode::InvalidArgument;
         }
+        std::unique_lock lock(m_SlotMutex);
+        bool reused = !m_FreeSlots.empty();
         std::uint32_t slotIndex;
-        if (!m_FreeSlots.empty()) {
+        if (reused) {
             slotIndex = m_FreeSlots.back();
-            m_FreeSlots.pop_back();
-            auto &slot = m_Slots[slotIndex];
-            slot.inUse = true;
-            slot.generation += 1;
-            outHandle = EncodeHandle(slotIndex, slot.generation);
-            ResetRecord(slot.record, label, wordCount, outHandle, slotIndex, slot.generation);
-            UpdateMetricsOnCreate(slot.record);
-            Touch(slot.record);
-            RecomputeHotMetrics();
-            return StatusCode::Ok;
+        } else {
+            slotIndex = m_SlotCount.load(std::memory_order_relaxed);
+            auto chunk = slotIndex / kSlotChunkSize;
+            if (chunk >= kMaxSlotChunks) {
+                return StatusCode::CapacityExceeded;
+            }
+            if (!m_SlotChunks[chunk]) {
+                m_SlotChunks[chunk] = std::make_unique<SlotChunk>();
+            }
         }
-        slotIndex = static_cast<std::uint32_t>(m_Slots.size());
-        Slot slot{};
+        auto &slot = *SlotAt(slotIndex);
+        ResetRecord(slot.record, label, wordCount, layout, EncodeHandle(slotIndex, slot.generation + 1), slotIndex,
+                    slot.generation + 1);
         slot.inUse = true;
-        slot.generation = 1;
-        m_Slots.push_back(slot);
-        outHandle = EncodeHandle(slotIndex, slot.generation);
-        ResetRecord(m_Slots[slotIndex].record, label, wordCount, outHandle, slotIndex, slot.generation);
-        UpdateMetricsOnCreate(m_Slots[slotIndex].record);
-        Touch(m_Slots[slotIndex].record);
+        slot.generation += 1;
+        outHandle = slot.record.handle;
+        if (reused) {
+            m_FreeSlots.pop_back();
+        } else {
+            m_SlotCount.store(slotIndex + 1, std::memory_order_release);
+            TrackSlots();
+        }
+        UpdateMetricsOnCreate(slot.record);
+        Touch(slot.record);
         RecomputeHotMetrics();
         return StatusCode::Ok;
     }
 
+    void AtomicsModule::SampleMemory(ModuleMemoryCounters &counters) const noexcept {
+        memory::Sample(counters, m_Memory, m_SlotCount.load(std::memory_order_acquire), m_FreeSlots.size());
+    }
+
     StatusCode AtomicsModule::DestroyBuffer(Handle handle) {
+        std::shared_ptr<LaneBlock> lanes;
+        {
+            std::unique_lock lock(m_SlotMutex);
+            auto *record = FindMutable(handle);
+            if (!record) {
+                return StatusCode::NotFound;
+            }
+            if (HasWaiters(*record)) {
+                return StatusCode::InvalidArgument;
+            }
+            m_FreeSlots.reserve(m_FreeSlots.size() + 1);
+            UpdateMetricsOnDestroy(*record);
+            auto slotIndex = record->slot;
+            auto &slot = *SlotAt(slotIndex);
+            slot.inUse = false;
+            slot.generation += 1;
+            m_Memory.Free(RecordBytes(slot.record));
+            lanes = std::move(slot.record.lanes);
+            slot.record = BufferRecord{};
+            m_FreeSlots.push_back(slotIndex);
+            TrackSlots();
+        }
+        // A Wait that looked the lane up before the slot lock was taken may still be on its way
+        // to park; it sees retired under its bucket lock, or is woken here if it got in first.
+        RetireLanes(*lanes);
+        RecomputeHotMetrics();
+        return StatusCode::Ok;
+    }
+
+    StatusCode AtomicsModule::CreateCounter(std::string_view label, Handle &outHandle, std::size_t stripes) {
+        outHandle = 0;
+        if (stripes == 0) {
+            stripes = std::clamp<std::size_t>(std::thread::hardware_concurrency(), 1, kMaxCounterStripes);
+        }
+        if (stripes > kMaxCounterStripes) {
+            return StatusCode::InvalidArgument;
+        }
+        auto status = CreateBuffer(label, std::bit_ceil(stripes), outHandle, Layout::Padded);
+        if (status != StatusCode::Ok) {
+            return status;
+        }
+        FindMutable(outHandle)->counter = true;
+        return StatusCode::Ok;
+    }
+
+    StatusCode AtomicsModule::CounterAdd(Handle handle, std::int64_t value) noexcept {
         auto *record = FindMutable(handle);
         if (!record) {
             return StatusCode::NotFound;
         }
-        UpdateMetricsOnDestroy(*record);
-        auto slotIndex = record->slot;
-        auto &slot = m_Slots[slotIndex];
-        slot.inUse = false;
-        slot.generation += 1;
-        slot.record = BufferRecord{};
-        m_FreeSlots.push_back(slotIndex);
-        RecomputeHotMetrics();
+        if (!record->counter) {
+            return StatusCode::InvalidArgument;
+        }
+        auto stripe = ThreadStripe() & (record->logicalLength - 1);
+        std::atomic_ref<std::int64_t>(*Lane(*record, stripe)).fetch_add(value, std::memory_order_relaxed);
+        Touch(*record);
+        LocalStripe().rmws.fetch_add(1, std::memory_order_relaxed);
+        return StatusCode::Ok;
+    }
+
+    StatusCode AtomicsModule::CounterRead(Handle handle, std::int64_t &outValue) const noexcept {
+        outValue = 0;
+        const auto *record = Find(handle);
+        if (!record) {
+            return StatusCode::NotFound;
+        }
+        if (!record->counter) {
+            return StatusCode::InvalidArgument;
+        }
+        std::int64_t total = 0;
+        for (std::size_t i = 0; i < record->logicalLength; ++i) {
+            total += std::atomic_ref<std::int64_t>(*Lane(*record, i)).load(std::memory_order_relaxed);
+        }
+        outValue = total;
+        LocalStripe().loads.fetch_add(1, std::memory_order_relaxed);
         return StatusCode::Ok;
     }
 
@@ -150,11 +288,11 @@ namespace spectre::es2025 {
         }
         auto memOrder = ToStdOrder(order);
         for (std::size_t i = 0; i < record->logicalLength; ++i) {
-            std::atomic_ref<std::int64_t> ref(record->words[i]);
+            std::atomic_ref<std::int64_t> ref(*Lane(*record, i));
             ref.store(value, memOrder);
         }
         Touch(*record);
-        m_Metrics.storeOps += record->logicalLength;
+        LocalStripe().stores.fetch_add(record->logicalLength, std::memory_order_relaxed);
         return StatusCode::Ok;
     }
 
@@ -169,10 +307,10 @@ namespace spectre::es2025 {
         if (index >= record->logicalLength) {
             return StatusCode::InvalidArgument;
         }
-        std::atomic_ref<std::int64_t> ref(record->words[index]);
+        std::atomic_ref<std::int64_t> ref(*Lane(*record, index));
         outValue = ref.load(ToStdOrder(order));
         Touch(*record);
-        m_Metrics.loadOps += 1;
+        LocalStripe().loads.fetch_add(1, std::memory_order_relaxed);
         return StatusCode::Ok;
     }
 
@@ -187,10 +325,10 @@ namespace spectre::es2025 {
         if (index >= record->logicalLength) {
             return StatusCode::InvalidArgument;
         }
-        std::atomic_ref<std::int64_t> ref(record->words[index]);
+        std::atomic_ref<std::int64_t> ref(*Lane(*record, index));
         ref.store(value, ToStdOrder(order));
         Touch(*record);
-        m_Metrics.storeOps += 1;
+        LocalStripe().stores.fetch_add(1, std::memory_order_relaxed);
         return StatusCode::Ok;
     }
 
@@ -206,10 +344,10 @@ namespace spectre::es2025 {
         if (index >= record->logicalLength) {
             return StatusCode::InvalidArgument;
         }
-        std::atomic_ref<std::int64_t> ref(record->words[index]);
+        std::atomic_ref<std::int64_t> ref(*Lane(*record, index));
         outPrevious = ref.exchange(value, ToStdOrder(order));
         Touch(*record);
-        m_Metrics.rmwOps += 1;
+        LocalStripe().rmws.fetch_add(1, std::memory_order_relaxed);
         return StatusCode::Ok;
     }
 
@@ -227,7 +365,7 @@ namespace spectre::es2025 {
         if (index >= record->logicalLength) {
             return StatusCode::InvalidArgument;
         }
-        std::atomic_ref<std::int64_t> ref(record->words[index]);
+        std::atomic_ref<std::int64_t> ref(*Lane(*record, index));
         auto expectedLocal = expected;
         auto success = ref.compare_exchange_strong(expectedLocal,
                                                    desired,
@@ -235,11 +373,12 @@ namespace spectre::es2025 {
                                                    NormalizeFailureOrder(ToStdOrder(failureOrder)));
         outPrevious = success ? expected : expectedLocal;
         Touch(*record);
-        m_Metrics.rmwOps += 1;
+        auto &stripe = LocalStripe();
+        stripe.rmws.fetch_add(1, std::memory_order_relaxed);
         if (success) {
-            m_Metrics.compareExchangeHits += 1;
+            stripe.compareExchangeHits.fetch_add(1, std::memory_order_relaxed);
         } else {
-            m_Metrics.compareExchangeMisses += 1;
+            stripe.compareExchangeMisses.fetch_add(1, std::memory_order_relaxed);
         }
         return StatusCode::Ok;
     }
@@ -256,10 +395,10 @@ namespace spectre::es2025 {
         if (index >= record->logicalLength) {
             return StatusCode::InvalidArgument;
         }
-        std::atomic_ref<std::int64_t> ref(record->words[index]);
+        std::atomic_ref<std::int64_t> ref(*Lane(*record, index));
         outPrevious = ref.fetch_add(value, ToStdOrder(order));
         Touch(*record);
-        m_Metrics.rmwOps += 1;
+        LocalStripe().rmws.fetch_add(1, std::memory_order_relaxed);
         return StatusCode::Ok;
     }
 
@@ -275,10 +414,10 @@ namespace spectre::es2025 {
         if (index >= record->logicalLength) {
             return StatusCode::InvalidArgument;
         }
-        std::atomic_ref<std::int64_t> ref(record->words[index]);
+        std::atomic_ref<std::int64_t> ref(*Lane(*record, index));
         outPrevious = ref.fetch_sub(value, ToStdOrder(order));
         Touch(*record);
-        m_Metrics.rmwOps += 1;
+        LocalStripe().rmws.fetch_add(1, std::memory_order_relaxed);
         return StatusCode::Ok;
     }
 
@@ -294,10 +433,10 @@ namespace spectre::es2025 {
         if (index >= record->logicalLength) {
             return StatusCode::InvalidArgument;
         }
-        std::atomic_ref<std::int64_t> ref(record->words[index]);
+        std::atomic_ref<std::int64_t> ref(*Lane(*record, index));
         outPrevious = ref.fetch_and(value, ToStdOrder(order));
         Touch(*record);
-        m_Metrics.rmwOps += 1;
+        LocalStripe().rmws.fetch_add(1, std::memory_order_relaxed);
         return StatusCode::Ok;
     }
 
@@ -313,10 +452,10 @@ namespace spectre::es2025 {
         if (index >= record->logicalLength) {
             return StatusCode::InvalidArgument;
         }
-        std::atomic_ref<std::int64_t> ref(record->words[index]);
+        std::atomic_ref<std::int64_t> ref(*Lane(*record, index));
         outPrevious = ref.fetch_or(value, ToStdOrder(order));
         Touch(*record);
-        m_Metrics.rmwOps += 1;
+        LocalStripe().rmws.fetch_add(1, std::memory_order_relaxed);
         return StatusCode::Ok;
     }
 
@@ -332,19 +471,133 @@ namespace spectre::es2025 {
         if (index >= record->logicalLength) {
             return StatusCode::InvalidArgument;
         }
-        std::atomic_ref<std::int64_t> ref(record->words[index]);
+        std::atomic_ref<std::int64_t> ref(*Lane(*record, index));
         outPrevious = ref.fetch_xor(value, ToStdOrder(order));
         Touch(*record);
-        m_Metrics.rmwOps += 1;
+        LocalStripe().rmws.fetch_add(1, std::memory_order_relaxed);
         return StatusCode::Ok;
     }
 
+    StatusCode AtomicsModule::Wait(Handle handle,
+                                   std::size_t index,
+                                   std::int64_t expected,
+                                   WaitResult &outResult,
+                                   double timeoutMilliseconds) {
+        outResult = WaitResult::NotEqual;
+        // Nothing below touches the record: the caller may be any thread, and the lane reference
+        // keeps the words alive even if the buffer is destroyed while this thread is parked.
+        std::shared_ptr<LaneBlock> lanes;
+        std::int64_t *address = nullptr;
+        auto status = AcquireLane(handle, index, lanes, address);
+        if (status != StatusCode::Ok) {
+            return status;
+        }
+        auto &bucket = BucketFor(address);
+        std::unique_lock lock(bucket.mutex);
+        if (lanes->retired.load(std::memory_order_acquire)) {
+            return StatusCode::NotFound;
+        }
+        m_Waits.fetch_add(1, std::memory_order_relaxed);
+        if (std::atomic_ref<std::int64_t>(*address).load(std::memory_order_seq_cst) != expected) {
+            m_WaitMismatches.fetch_add(1, std::memory_order_relaxed);
+            return StatusCode::Ok;
+        }
+        // Anything past kMaxWaitMilliseconds would overflow the clock; it is as good as forever.
+        auto forever = std::isnan(timeoutMilliseconds) || timeoutMilliseconds > kMaxWaitMilliseconds;
+        if (!forever && timeoutMilliseconds <= 0.0) {
+            m_WaitTimeouts.fetch_add(1, std::memory_order_relaxed);
+            outResult = WaitResult::TimedOut;
+            return StatusCode::Ok;
+        }
+        Waiter waiter{address, {}, nullptr, false, false};
+        if (bucket.tail) {
+            bucket.tail->next = &waiter;
+        } else {
+            bucket.head = &waiter;
+        }
+        bucket.tail = &waiter;
+        m_ActiveWaiters.fetch_add(1, std::memory_order_relaxed);
+        if (forever) {
+            waiter.wake.wait(lock, [&waiter] { return waiter.notified; });
+        } else {
+            auto deadline = std::chrono::steady_clock::now()
+                            + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                std::chrono::duration<double, std::milli>(timeoutMilliseconds));
+            waiter.wake.wait_until(lock, deadline, [&waiter] { return waiter.notified; });
+        }
+        m_ActiveWaiters.fetch_sub(1, std::memory_order_relaxed);
+        if (waiter.retired) {
+            return StatusCode::NotFound;
+        }
+        if (waiter.notified) {
+            outResult = WaitResult::Ok;
+        } else {
+            Unlink(bucket, waiter);
+            m_WaitTimeouts.fetch_add(1, std::memory_order_relaxed);
+            outResult = WaitResult::TimedOut;
+        }
+        return StatusCode::Ok;
+    }
+
+    StatusCode AtomicsModule::Notify(Handle handle, std::size_t index, std::size_t &outWoken, std::size_t count) {
+        outWoken = 0;
+        std::shared_ptr<LaneBlock> lanes;
+        std::int64_t *address = nullptr;
+        auto status = AcquireLane(handle, index, lanes, address);
+        if (status != StatusCode::Ok) {
+            return status;
+        }
+        auto &bucket = BucketFor(address);
+        {
+            std::lock_guard lock(bucket.mutex);
+            Waiter *previous = nullptr;
+            for (auto *waiter = bucket.head; waiter && outWoken < count;) {
+                auto *next = waiter->next;
+                if (waiter->address != address) {
+                    previous = waiter;
+                    waiter = next;
+                    continue;
+                }
+                if (previous) {
+                    previous->next = next;
+                } else {
+                    bucket.head = next;
+                }
+                if (bucket.tail == waiter) {
+                    bucket.tail = previous;
+                }
+                waiter->next = nullptr;
+                waiter->notified = true;
+                // Signalled under the lock: the waiter cannot return and free its node until the
+                // lock is released.
+                waiter->wake.notify_one();
+                outWoken += 1;
+                waiter = next;
+            }
+        }
+        m_Notifies.fetch_add(1, std::memory_order_relaxed);
+        m_Wakes.fetch_add(outWoken, std::memory_order_relaxed);
+        return StatusCode::Ok;
+    }
+
+    AtomicsModule::WaitMetrics AtomicsModule::WaitStatistics() const noexcept {
+        return WaitMetrics{m_Waits.load(std::memory_order_relaxed),
+                           m_Wakes.load(std::memory_order_relaxed),
+                           m_WaitTimeouts.load(std::memory_order_relaxed),
+                           m_WaitMismatches.load(std::memory_order_relaxed),
+                           m_Notifies.load(std::memory_order_relaxed),
+                           m_ActiveWaiters.load(std::memory_order_relaxed)};
+    }
+
     StatusCode AtomicsModule::Snapshot(Handle handle, std::vector<std::int64_t> &outValues) const {
         const auto *record = Find(handle);
         if (!record) {
             return StatusCode::NotFound;
         }
-        outValues.assign(record->words.begin(), record->words.begin() + static_cast<std::ptrdiff_t>(record->logicalLength));
+        outValues.resize(record->logicalLength);
+        for (std::size_t i = 0; i < record->logicalLength; ++i) {
+            outValues[i] = *Lane(*record, i);
+        }
         return StatusCode::Ok;
     }
 
@@ -357,23 +610,39 @@ namespace spectre::es2025 {
         return record ? record->logicalLength : 0;
     }
 
-    const AtomicsModule::BufferMetrics &AtomicsModule::Metrics() const noexcept {
-        return m_Metrics;
+    AtomicsModule::BufferMetrics AtomicsModule::Metrics() const noexcept {
+        auto metrics = m_Metrics;
+        for (const auto &stripe: m_OpStripes) {
+            metrics.loadOps += stripe.loads.load(std::memory_order_relaxed);
+            metrics.storeOps += stripe.stores.load(std::memory_order_relaxed);
+            metrics.rmwOps += stripe.rmws.load(std::memory_order_relaxed);
+            metrics.compareExchangeHits += stripe.compareExchangeHits.load(std::memory_order_relaxed);
+            metrics.compareExchangeMisses += stripe.compareExchangeMisses.load(std::memory_order_relaxed);
+        }
+        return metrics;
     }
 
     bool AtomicsModule::GpuEnabled() const noexcept {
         return m_GpuEnabled;
     }
 
+    AtomicsModule::Slot *AtomicsModule::SlotAt(std::uint32_t index) noexcept {
+        return &m_SlotChunks[index / kSlotChunkSize]->slots[index % kSlotChunkSize];
+    }
+
+    const AtomicsModule::Slot *AtomicsModule::SlotAt(std::uint32_t index) const noexcept {
+        return &m_SlotChunks[index / kSlotChunkSize]->slots[index % kSlotChunkSize];
+    }
+
     AtomicsModule::BufferRecord *AtomicsModule::FindMutable(Handle handle) noexcept {
         if (handle == 0) {
             return nullptr;
         }
         auto slotIndex = DecodeSlot(handle);
-        if (slotIndex >= m_Slots.size()) {
+        if (slotIndex >= m_SlotCount.load(std::memory_order_acquire)) {
             return nullptr;
         }
-        auto &slot = m_Slots[slotIndex];
+        auto &slot = *SlotAt(slotIndex);
         if (!slot.inUse) {
             return nullptr;
         }
@@ -388,10 +657,10 @@ namespace spectre::es2025 {
             return nullptr;
         }
         auto slotIndex = DecodeSlot(handle);
-        if (slotIndex >= m_Slots.size()) {
+        if (slotIndex >= m_SlotCount.load(std::memory_order_acquire)) {
             return nullptr;
         }
-        const auto &slot = m_Slots[slotIndex];
+        const auto &slot = *SlotAt(slotIndex);
         if (!slot.inUse) {
             return nullptr;
         }
@@ -401,6 +670,25 @@ namespace spectre::es2025 {
         return &slot.record;
     }
 
+    // Takes a reference to the lane storage under the slot lock, so the words stay allocated
+    // for as long as the caller holds it, even if the buffer is destroyed meanwhile.
+    StatusCode AtomicsModule::AcquireLane(Handle handle,
+                                          std::size_t index,
+                                          std::shared_ptr<LaneBlock> &outLanes,
+                                          std::int64_t *&outAddress) {
+        std::shared_lock lock(m_SlotMutex);
+        auto *record = FindMutable(handle);
+        if (!record) {
+            return StatusCode::NotFound;
+        }
+        if (index >= record->logicalLength) {
+            return StatusCode::InvalidArgument;
+        }
+        outLanes = record->lanes;
+        outAddress = Lane(*record, index);
+        return StatusCode::Ok;
+    }
+
     std::uint32_t AtomicsModule::DecodeSlot(Handle handle) noexcept {
         return static_cast<std::uint32_t>(handle & 0xffffffffull);
     }
@@ -432,6 +720,7 @@ namespace spectre::es2025 {
     void AtomicsModule::ResetRecord(BufferRecord &record,
                                     std::string_view label,
                                     std::size_t wordCount,
+                                    Layout layout,
                                     Handle handle,
                                     std::uint32_t slot,
                                     std::uint32_t generation) {
@@ -440,17 +729,59 @@ namespace spectre::es2025 {
         record.generation = generation;
         record.label.assign(label);
         record.logicalLength = wordCount;
-        record.words.assign(AlignWordCount(wordCount), 0);
+        record.counter = false;
+        // A fresh block every time: a waiter may still hold the previous buffer's.
+        record.lanes = std::make_shared<LaneBlock>();
+        auto &words = record.lanes->words;
+        if (layout == Layout::Padded) {
+            // One spare line lets the first lane start on a cache-line boundary.
+            record.wordStride = kWordsPerLine;
+            words.assign(AlignWordCount((wordCount + 1) * kWordsPerLine), 0);
+            auto misalignment = reinterpret_cast<std::uintptr_t>(words.data()) % kCacheLineBytes;
+            record.base = words.data() + (misalignment == 0 ? 0 : (kCacheLineBytes - misalignment) / sizeof(std::int64_t));
+        } else {
+            record.wordStride = 1;
+            words.assign(AlignWordCount(wordCount), 0);
+            record.base = words.data();
+        }
         record.version = 0;
         record.lastTouchFrame = m_CurrentFrame;
         record.hot = true;
+        m_Memory.Allocate(RecordBytes(record));
+    }
+
+    // Lane storage is sized once in ResetRecord, so it is counted there and again on destroy.
+    std::uint64_t AtomicsModule::RecordBytes(const BufferRecord &record) noexcept {
+        return memory::StringBytes(record.label) + (record.lanes ? memory::VectorBytes(record.lanes->words) : 0);
+    }
+
+    void AtomicsModule::TrackSlots() noexcept {
+        auto slotCount = m_SlotCount.load(std::memory_order_relaxed);
+        auto chunkCount = (slotCount + kSlotChunkSize - 1) / kSlotChunkSize;
+        auto bytes = chunkCount * sizeof(SlotChunk) + memory::VectorBytes(m_FreeSlots);
+        m_Memory.Resize(m_SlotTableBytes, bytes);
+        m_SlotTableBytes = bytes;
+    }
+
+    std::int64_t *AtomicsModule::Lane(const BufferRecord &record, std::size_t index) noexcept {
+        return record.base + index * record.wordStride;
+    }
+
+    AtomicsModule::OpStripe &AtomicsModule::LocalStripe() const noexcept {
+        return m_OpStripes[ThreadStripe() & (kOpStripes - 1)];
     }
 
     void AtomicsModule::Touch(BufferRecord &record) noexcept {
-        record.version += 1;
-        record.lastTouchFrame = m_CurrentFrame;
-        record.hot = true;
-        m_Metrics.lastFrameTouched = m_CurrentFrame;
+        // Operations may run on any thread. Writing only when the frame moves keeps concurrent
+        // operations on one buffer from bouncing the record's cache line between cores.
+        auto frame = std::atomic_ref<std::uint64_t>(m_CurrentFrame).load(std::memory_order_relaxed);
+        std::atomic_ref<std::uint64_t> lastTouch(record.lastTouchFrame);
+        if (lastTouch.load(std::memory_order_relaxed) == frame) {
+            return;
+        }
+        lastTouch.store(frame, std::memory_order_relaxed);
+        std::atomic_ref<std::uint64_t>(record.version).fetch_add(1, std::memory_order_relaxed);
+        std::atomic_ref<bool>(record.hot).store(true, std::memory_order_relaxed);
     }
 
     void AtomicsModule::UpdateMetricsOnCreate(const BufferRecord &record) {
@@ -470,13 +801,17 @@ namespace spectre::es2025 {
 
     void AtomicsModule::RecomputeHotMetrics() noexcept {
         std::uint64_t hot = 0;
-        for (auto &slot : m_Slots) {
+        auto slotCount = m_SlotCount.load(std::memory_order_relaxed);
+        for (std::uint32_t index = 0; index < slotCount; ++index) {
+            auto &slot = *SlotAt(index);
             if (!slot.inUse) {
                 continue;
             }
             auto &record = slot.record;
-            record.hot = (m_CurrentFrame - record.lastTouchFrame) <= kHotFrameWindow;
-            if (record.hot) {
+            auto lastTouch = std::atomic_ref<std::uint64_t>(record.lastTouchFrame).load(std::memory_order_relaxed);
+            auto isHot = (m_CurrentFrame - lastTouch) <= kHotFrameWindow;
+            std::atomic_ref<bool>(record.hot).store(isHot, std::memory_order_relaxed);
+            if (isHot) {
                 ++hot;
             }
         }
@@ -491,4 +826,77 @@ namespace spectre::es2025 {
         auto blocks = (count + (kAlignmentWords - 1)) / kAlignmentWords;
         return blocks * kAlignmentWords;
     }
+
+    AtomicsModule::WaitBucket &AtomicsModule::BucketFor(const std::int64_t *address) noexcept {
+        auto key = reinterpret_cast<std::uintptr_t>(address) / sizeof(std::int64_t);
+        key ^= key >> 7;
+        return m_WaitBuckets[key % kWaitBuckets];
+    }
+
+    bool AtomicsModule::HasWaiters(const BufferRecord &record) noexcept {
+        if (m_ActiveWaiters.load(std::memory_order_relaxed) == 0 || !record.lanes) {
+            return false;
+        }
+        const auto *begin = record.lanes->words.data();
+        const auto *end = begin + record.lanes->words.size();
+        for (auto &bucket: m_WaitBuckets) {
+            std::lock_guard lock(bucket.mutex);
+            for (auto *waiter = bucket.head; waiter; waiter = waiter->next) {
+                if (waiter->address >= begin && waiter->address < end) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    void AtomicsModule::RetireLanes(LaneBlock &lanes) noexcept {
+        lanes.retired.store(true, std::memory_order_release);
+        const auto *begin = lanes.words.data();
+        const auto *end = begin + lanes.words.size();
+        for (auto &bucket: m_WaitBuckets) {
+            std::lock_guard lock(bucket.mutex);
+            Waiter *previous = nullptr;
+            for (auto *waiter = bucket.head; waiter;) {
+                auto *next = waiter->next;
+                if (waiter->address < begin || waiter->address >= end) {
+                    previous = waiter;
+                    waiter = next;
+                    continue;
+                }
+                if (previous) {
+                    previous->next = next;
+                } else {
+                    bucket.head = next;
+                }
+                if (bucket.tail == waiter) {
+                    bucket.tail = previous;
+                }
+                waiter->next = nullptr;
+                waiter->notified = true;
+                waiter->retired = true;
+                waiter->wake.notify_one();
+                waiter = next;
+            }
+        }
+    }
+
+    void AtomicsModule::Unlink(WaitBucket &bucket, Waiter &waiter) noexcept {
+        Waiter *previous = nullptr;
+        for (auto *cursor = bucket.head; cursor; previous = cursor, cursor = cursor->next) {
+            if (cursor != &waiter) {
+                continue;
+            }
+            if (previous) {
+                previous->next = waiter.next;
+            } else {
+                bucket.head = waiter.next;
+            }
+            if (bucket.tail == &waiter) {
+                bucket.tail = previous;
+            }
+            waiter.next = nullptr;
+            return;
+        }
+    }
 }
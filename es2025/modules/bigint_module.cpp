@@ -83,6 +83,26 @@ namespace spectre::es2025 {
         m_Metrics.gpuOptimized = m_GpuEnabled;
     }
 
+    void BigIntModule::CollectMemory(ModuleMemoryUsage &usage) const noexcept {
+        memory::Begin(usage);
+        memory::AddSlotTable(usage, m_Slots.size(), m_FreeSlots.size(), sizeof(Slot),
+                             memory::VectorBytes(m_Slots) + memory::VectorBytes(m_FreeSlots));
+        for (const auto &slot: m_Slots) {
+            if (!slot.inUse) {
+                continue;
+            }
+            const auto &entry = slot.entry;
+            auto bytes = memory::StringBytes(entry.label) + memory::VectorBytes(entry.limbs);
+            usage.reservedBytes += bytes;
+            usage.liveBytes += bytes;
+        }
+    }
+
+    void BigIntModule::SampleMemory(ModuleMemoryCounters &counters) const noexcept {
+        m_Memory.Observe(memory::VectorBytes(m_Slots) + memory::VectorBytes(m_FreeSlots));
+        memory::Sample(counters, m_Memory.Totals(), m_Slots.size(), m_FreeSlots.size());
+    }
+
     StatusCode BigIntModule::Create(std::string_view label, std::int64_t value, Handle &outHandle) {
         return CreateInternal(label, value, false, outHandle);
     }
@@ -105,6 +105,25 @@ namespace spectre::es2025 {
         m_Metrics.gpuOptimized = m_GpuEnabled;
     }
 
+    void BooleanModule::CollectMemory(ModuleMemoryUsage &usage) const noexcept {
+        memory::Begin(usage);
+        memory::AddSlotTable(usage, m_Slots.size(), m_FreeSlots.size(), sizeof(Slot),
+                             memory::VectorBytes(m_Slots) + memory::VectorBytes(m_FreeSlots));
+        for (const auto &slot: m_Slots) {
+            if (!slot.inUse) {
+                continue;
+            }
+            auto labelBytes = memory::StringBytes(slot.entry.label);
+            usage.reservedBytes += labelBytes;
+            usage.liveBytes += labelBytes;
+        }
+    }
+
+    void BooleanModule::SampleMemory(ModuleMemoryCounters &counters) const noexcept {
+        m_Memory.Observe(memory::VectorBytes(m_Slots) + memory::VectorBytes(m_FreeSlots));
+        memory::Sample(counters, m_Memory.Totals(), m_Slots.size(), m_FreeSlots.size());
+    }
+
     bool BooleanModule::ToBoolean(double value) const noexcept {
         return !std::isnan(value) && value != 0.0;
     }
@@ -1,11 +1,13 @@
 #include "spectre/es2025/modules/data_view_module.h"
 
+#include <algorithm>
 #include <bit>
 #include <cstring>
 #include <limits>
 #include <type_traits>
 
 #include "spectre/es2025/environment.h"
+#include "spectre/es2025/simd.h"
 #include "spectre/runtime.h"
 
 namespace spectre::es2025 {
@@ -71,6 +73,64 @@ namespace spectre::es2025 {
             }
             std::memcpy(ptr, &value, sizeof(T));
         }
+
+        // Fields are staged through a fixed block when encoding needs a byte swap, so the caller's
+        // column is never modified.
+        constexpr std::size_t kStageElements = 256;
+
+        template <std::size_t Width>
+        void GatherStrided(std::uint8_t *target, const std::uint8_t *source, std::size_t stride,
+                           std::size_t count) noexcept {
+            for (std::size_t i = 0; i < count; ++i) {
+                std::memcpy(target + i * Width, source + i * stride, Width);
+            }
+        }
+
+        template <std::size_t Width>
+        void ScatterStrided(std::uint8_t *target, const std::uint8_t *source, std::size_t stride,
+                            std::size_t count) noexcept {
+            for (std::size_t i = 0; i < count; ++i) {
+                std::memcpy(target + i * stride, source + i * Width, Width);
+            }
+        }
+
+        // Packs count width-byte fields spaced stride bytes apart into target.
+        void Gather(std::uint8_t *target, const std::uint8_t *source, std::size_t width, std::size_t stride,
+                    std::size_t count) noexcept {
+            if (stride == width) {
+                std::memcpy(target, source, width * count);
+                return;
+            }
+            switch (width) {
+                case 1: GatherStrided<1>(target, source, stride, count); break;
+                case 2: GatherStrided<2>(target, source, stride, count); break;
+                case 4: GatherStrided<4>(target, source, stride, count); break;
+                default: GatherStrided<8>(target, source, stride, count); break;
+            }
+        }
+
+        void Scatter(std::uint8_t *target, const std::uint8_t *source, std::size_t width, std::size_t stride,
+                     std::size_t count) noexcept {
+            if (stride == width) {
+                std::memcpy(target, source, width * count);
+                return;
+            }
+            switch (width) {
+                case 1: ScatterStrided<1>(target, source, stride, count); break;
+                case 2: ScatterStrided<2>(target, source, stride, count); break;
+                case 4: ScatterStrided<4>(target, source, stride, count); break;
+                default: ScatterStrided<8>(target, source, stride, count); break;
+            }
+        }
+
+        void SwapPacked(std::uint8_t *data, std::size_t width, std::size_t count) noexcept {
+            switch (width) {
+                case 2: simd::ByteSwap16(data, count); break;
+                case 4: simd::ByteSwap32(data, count); break;
+                case 8: simd::ByteSwap64(data, count); break;
+                default: break;
+            }
+        }
     }
 
     DataViewModule::Metrics::Metrics() noexcept
@@ -82,8 +142,21 @@ namespace spectre::es2025 {
           hotViews(0),
           activeViews(0),
           lastFrameTouched(0),
+          recordsDecoded(0),
+          recordsEncoded(0),
           gpuOptimized(false) {}
 
+    DataViewModule::Schema::Schema() noexcept : m_Fields(), m_Stride(0), m_Extent(0) {
+    }
+
+    std::span<const DataViewModule::Field> DataViewModule::Schema::Fields() const noexcept {
+        return m_Fields;
+    }
+
+    std::size_t DataViewModule::Schema::Stride() const noexcept {
+        return m_Stride;
+    }
+
     DataViewModule::ViewRecord::ViewRecord() noexcept
         : handle(0),
           slot(0),
@@ -112,7 +185,9 @@ namespace spectre::es2025 {
           m_CurrentFrame(0),
           m_Metrics(),
           m_Slots(),
-          m_FreeSlots() {}
+          m_FreeSlots(),
+          m_Memory(),
+          m_SlotTableBytes(0) {}
 
     std::string_view DataViewModule::Name() const noexcept {
         return kName;
@@ -156,6 +231,19 @@ namespace spectre::es2025 {
         m_Metrics.gpuOptimized = m_GpuEnabled;
     }
 
+    void DataViewModule::CollectMemory(ModuleMemoryUsage &usage) const noexcept {
+        memory::Begin(usage);
+        memory::AddSlotTable(usage, m_Slots.size(), m_FreeSlots.size(), sizeof(SlotRecord),
+                             memory::VectorBytes(m_Slots) + memory::VectorBytes(m_FreeSlots));
+        for (const auto &slot: m_Slots) {
+            if (slot.inUse) {
+                auto labelBytes = memory::StringBytes(slot.record.label);
+                usage.reservedBytes += labelBytes;
+                usage.liveBytes += labelBytes;
+            }
+        }
+    }
+
     StatusCode DataViewModule::Create(ArrayBufferModule::Handle buffer,
                                       std::size_t byteOffset,
                                       std::size_t byteLength,
@@ -211,6 +299,7 @@ namespace spectre::es2025 {
         slot.record.hot = true;
         slot.record.label = label.empty() ? std::string("dataview.").append(std::to_string(slotIndex))
                                           : std::string(label);
+        m_Memory.Allocate(memory::StringBytes(slot.record.label));
 
         outHandle = handle;
         m_Metrics.createdViews += 1;
@@ -450,6 +539,137 @@ namespace spectre::es2025 {
         return SetScalar(handle, byteOffset, value, littleEndian);
     }
 
+    StatusCode DataViewModule::BuildSchema(std::span<const Field> fields, std::size_t recordStride,
+                                           Schema &outSchema) {
+        outSchema = Schema();
+        if (fields.empty() || recordStride == 0 || recordStride > std::numeric_limits<std::uint32_t>::max()) {
+            return StatusCode::InvalidArgument;
+        }
+        std::size_t extent = 0;
+        for (const auto &field: fields) {
+            auto width = FieldWidth(field.type);
+            if (width == 0 || width > recordStride || field.offset > recordStride - width) {
+                return StatusCode::InvalidArgument;
+            }
+            extent = std::max(extent, static_cast<std::size_t>(field.offset) + width);
+        }
+        outSchema.m_Fields.assign(fields.begin(), fields.end());
+        outSchema.m_Stride = recordStride;
+        outSchema.m_Extent = extent;
+        return StatusCode::Ok;
+    }
+
+    std::size_t DataViewModule::FieldWidth(FieldType type) noexcept {
+        switch (type) {
+            case FieldType::Int8:
+            case FieldType::Uint8:
+                return 1;
+            case FieldType::Int16:
+            case FieldType::Uint16:
+                return 2;
+            case FieldType::Int32:
+            case FieldType::Uint32:
+            case FieldType::Float32:
+                return 4;
+            case FieldType::Float64:
+            case FieldType::BigInt64:
+            case FieldType::BigUint64:
+                return 8;
+        }
+        return 0;
+    }
+
+    StatusCode DataViewModule::DecodeRecords(Handle handle,
+                                             const Schema &schema,
+                                             std::size_t byteOffset,
+                                             std::size_t count,
+                                             std::span<const Column> columns) const noexcept {
+        const auto *record = Find(handle);
+        if (!record) {
+            return StatusCode::NotFound;
+        }
+        if (!ValidateRecords(*record, schema, byteOffset, count, columns, true)) {
+            return StatusCode::InvalidArgument;
+        }
+        if (count == 0) {
+            return StatusCode::Ok;
+        }
+        const ArrayBufferModule::BufferRecord *buffer = nullptr;
+        if (ResolveBuffer(*record, buffer) != StatusCode::Ok || !buffer->data) {
+            return StatusCode::InvalidArgument;
+        }
+        const auto *base = buffer->data.get() + record->byteOffset + byteOffset;
+        std::uint64_t values = 0;
+        for (std::size_t i = 0; i < columns.size(); ++i) {
+            const auto &column = columns[i];
+            if (!column.m_Data) {
+                continue;
+            }
+            const auto &field = schema.m_Fields[i];
+            auto width = FieldWidth(field.type);
+            Gather(column.m_Data, base + field.offset, width, schema.m_Stride, count);
+            if (width > 1 && field.littleEndian != kHostIsLittleEndian) {
+                SwapPacked(column.m_Data, width, count);
+            }
+            values += count;
+        }
+        m_Metrics.readOps += values;
+        m_Metrics.recordsDecoded += count;
+        return StatusCode::Ok;
+    }
+
+    StatusCode DataViewModule::EncodeRecords(Handle handle,
+                                             const Schema &schema,
+                                             std::size_t byteOffset,
+                                             std::size_t count,
+                                             std::span<const Column> columns) noexcept {
+        auto *record = FindMutable(handle);
+        if (!record) {
+            return StatusCode::NotFound;
+        }
+        if (!ValidateRecords(*record, schema, byteOffset, count, columns, false)) {
+            return StatusCode::InvalidArgument;
+        }
+        if (count == 0) {
+            return StatusCode::Ok;
+        }
+        ArrayBufferModule::BufferRecord *buffer = nullptr;
+        if (ResolveBuffer(*record, buffer) != StatusCode::Ok || !buffer->data) {
+            return StatusCode::InvalidArgument;
+        }
+        auto *base = buffer->data.get() + record->byteOffset + byteOffset;
+        auto stride = schema.m_Stride;
+        std::uint64_t values = 0;
+        for (std::size_t i = 0; i < columns.size(); ++i) {
+            const auto &column = columns[i];
+            if (!column.m_Data) {
+                continue;
+            }
+            const auto &field = schema.m_Fields[i];
+            auto width = FieldWidth(field.type);
+            auto *target = base + field.offset;
+            values += count;
+            if (width == 1 || field.littleEndian == kHostIsLittleEndian) {
+                Scatter(target, column.m_Data, width, stride, count);
+            } else if (stride == width) {
+                std::memcpy(target, column.m_Data, width * count);
+                SwapPacked(target, width, count);
+            } else {
+                alignas(16) std::uint8_t stage[kStageElements * 8];
+                for (std::size_t done = 0; done < count; done += kStageElements) {
+                    auto batch = std::min(kStageElements, count - done);
+                    std::memcpy(stage, column.m_Data + done * width, batch * width);
+                    SwapPacked(stage, width, batch);
+                    Scatter(target + done * stride, stage, width, stride, batch);
+                }
+            }
+        }
+        Touch(*record);
+        m_Metrics.writeOps += values;
+        m_Metrics.recordsEncoded += count;
+        return StatusCode::Ok;
+    }
+
     const DataViewModule::Metrics &DataViewModule::GetMetrics() const noexcept {
         return m_Metrics;
     }
@@ -500,6 +720,10 @@ namespace spectre::es2025 {
         return &slot.record;
     }
 
+    void DataViewModule::SampleMemory(ModuleMemoryCounters &counters) const noexcept {
+        memory::Sample(counters, m_Memory, m_Slots.size(), m_FreeSlots.size());
+    }
+
     std::uint32_t DataViewModule::AcquireSlot() {
         if (!m_FreeSlots.empty()) {
             auto slotIndex = m_FreeSlots.back();
@@ -511,6 +735,7 @@ namespace spectre::es2025 {
         }
         auto slotIndex = static_cast<std::uint32_t>(m_Slots.size());
         m_Slots.emplace_back();
+        TrackSlots();
         auto &slot = m_Slots.back();
         slot.inUse = true;
         slot.generation = 1;
@@ -527,13 +752,24 @@ namespace spectre::es2025 {
         }
         slot.inUse = false;
         slot.generation += 1;
+        m_Memory.Free(memory::StringBytes(slot.record.label));
         slot.record = ViewRecord();
         m_FreeSlots.push_back(slotIndex);
+        TrackSlots();
+    }
+
+    void DataViewModule::TrackSlots() noexcept {
+        auto bytes = memory::VectorBytes(m_Slots) + memory::VectorBytes(m_FreeSlots);
+        m_Memory.Resize(m_SlotTableBytes, bytes);
+        m_SlotTableBytes = bytes;
     }
 
     void DataViewModule::Reset() {
         m_Slots.clear();
         m_FreeSlots.clear();
+        m_Memory.Reset();
+        m_SlotTableBytes = 0;
+        TrackSlots();
         m_CurrentFrame = 0;
         m_Metrics = Metrics();
         m_Metrics.gpuOptimized = m_GpuEnabled;
@@ -585,6 +821,35 @@ namespace spectre::es2025 {
         return true;
     }
 
+    bool DataViewModule::ValidateRecords(const ViewRecord &record,
+                                         const Schema &schema,
+                                         std::size_t byteOffset,
+                                         std::size_t count,
+                                         std::span<const Column> columns,
+                                         bool decoding) const noexcept {
+        if (schema.m_Fields.empty() || columns.size() != schema.m_Fields.size()) {
+            return false;
+        }
+        for (std::size_t i = 0; i < columns.size(); ++i) {
+            const auto &column = columns[i];
+            if (!column.m_Data) {
+                continue;
+            }
+            if (column.m_Type != schema.m_Fields[i].type || column.m_Count < count
+                || (decoding && !column.m_Writable)) {
+                return false;
+            }
+        }
+        if (count == 0) {
+            return ValidateRange(record, byteOffset, 0);
+        }
+        // The last record only needs to reach the end of its furthest field, not a full stride.
+        if (count - 1 > (std::numeric_limits<std::size_t>::max() - schema.m_Extent) / schema.m_Stride) {
+            return false;
+        }
+        return ValidateRange(record, byteOffset, (count - 1) * schema.m_Stride + schema.m_Extent);
+    }
+
     StatusCode DataViewModule::ResolveBuffer(ViewRecord &record,
                                              ArrayBufferModule::BufferRecord *&outRecord) noexcept {
         outRecord = nullptr;
@@ -597,6 +862,9 @@ namespace spectre::es2025 {
             record.attached = false;
             return StatusCode::InvalidArgument;
         }
+        if (buffer->readOnly) {
+            return StatusCode::InvalidArgument;
+        }
         auto required = static_cast<std::size_t>(record.byteOffset) + record.byteLength;
         if (required > buffer->byteLength) {
             record.attached = false;
@@ -168,6 +168,25 @@ namespace spectre::es2025 {
         m_Metrics.gpuOptimized = m_GpuEnabled;
     }
 
+    void DateModule::CollectMemory(ModuleMemoryUsage &usage) const noexcept {
+        memory::Begin(usage);
+        memory::AddSlotTable(usage, m_Slots.size(), m_FreeSlots.size(), sizeof(Slot),
+                             memory::VectorBytes(m_Slots) + memory::VectorBytes(m_FreeSlots));
+        for (const auto &slot: m_Slots) {
+            if (!slot.inUse) {
+                continue;
+            }
+            auto labelBytes = memory::StringBytes(slot.entry.label);
+            usage.reservedBytes += labelBytes;
+            usage.liveBytes += labelBytes;
+        }
+    }
+
+    void DateModule::SampleMemory(ModuleMemoryCounters &counters) const noexcept {
+        m_Memory.Observe(memory::VectorBytes(m_Slots) + memory::VectorBytes(m_FreeSlots));
+        memory::Sample(counters, m_Memory.Totals(), m_Slots.size(), m_FreeSlots.size());
+    }
+
     StatusCode DateModule::CreateFromEpochMilliseconds(std::string_view label, std::int64_t epochMs, Handle &outHandle) {
         return CreateInternal(label, epochMs, false, outHandle);
     }
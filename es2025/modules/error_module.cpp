@@ -76,6 +76,30 @@ namespace spectre::es2025 {
         RegisterBuiltins();
     }
 
+    void ErrorModule::CollectMemory(ModuleMemoryUsage &usage) const noexcept {
+        memory::Begin(usage);
+        std::uint64_t typeBytes = memory::HashMapBytes(m_ErrorTypes);
+        for (const auto &[name, descriptor]: m_ErrorTypes) {
+            typeBytes += memory::StringBytes(name) + memory::StringBytes(descriptor.type) +
+                    memory::StringBytes(descriptor.defaultMessage);
+        }
+        std::uint64_t historyBytes = memory::VectorBytes(m_History);
+        for (const auto &record: m_History) {
+            historyBytes += memory::StringBytes(record.type) + memory::StringBytes(record.message) +
+                    memory::StringBytes(record.contextName) + memory::StringBytes(record.scriptName) +
+                    memory::StringBytes(record.diagnostics);
+        }
+        auto idleBytes = memory::VectorBytes(m_History) - memory::UsedVectorBytes(m_History);
+        usage.reservedBytes = typeBytes + historyBytes;
+        usage.liveBytes = typeBytes + historyBytes - idleBytes;
+        usage.freeListBytes = idleBytes;
+    }
+
+    void ErrorModule::SampleMemory(ModuleMemoryCounters &counters) const noexcept {
+        m_Memory.Observe(memory::VectorBytes(m_History) + memory::HashMapBytes(m_ErrorTypes));
+        memory::Sample(counters, m_Memory.Totals(), 0, 0);
+    }
+
     StatusCode ErrorModule::RegisterErrorType(std::string_view type, std::string_view defaultMessage) {
         if (type.empty()) {
             return StatusCode::InvalidArgument;
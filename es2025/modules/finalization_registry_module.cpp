@@ -171,6 +171,36 @@ namespace spectre::es2025 {
         m_Metrics.gpuOptimized = m_GpuEnabled;
     }
 
+    void FinalizationRegistryModule::CollectMemory(ModuleMemoryUsage &usage) const noexcept {
+        memory::Begin(usage);
+        memory::AddSlotTable(usage, m_Slots.size(), m_FreeSlots.size(), sizeof(SlotRecord),
+                             memory::VectorBytes(m_Slots) + memory::VectorBytes(m_FreeSlots));
+        for (const auto &slot: m_Slots) {
+            if (!slot.inUse) {
+                continue;
+            }
+            const auto &record = slot.record;
+            auto bytes = memory::StringBytes(record.label) + memory::VectorBytes(record.cells) +
+                         memory::VectorBytes(record.freeCells) + memory::VectorBytes(record.pendingQueue) +
+                         memory::VectorBytes(record.tokenBuckets);
+            for (const auto &cell: record.cells) {
+                if (cell.inUse) {
+                    bytes += cell.holdings.HeapBytes();
+                }
+            }
+            auto idleCellBytes = static_cast<std::uint64_t>(record.cells.capacity() - record.liveCells) *
+                                 sizeof(Cell);
+            usage.reservedBytes += bytes;
+            usage.liveBytes += bytes - idleCellBytes;
+            usage.freeListBytes += idleCellBytes;
+        }
+    }
+
+    void FinalizationRegistryModule::SampleMemory(ModuleMemoryCounters &counters) const noexcept {
+        m_Memory.Observe(memory::VectorBytes(m_Slots) + memory::VectorBytes(m_FreeSlots));
+        memory::Sample(counters, m_Memory.Totals(), m_Slots.size(), m_FreeSlots.size());
+    }
+
     StatusCode FinalizationRegistryModule::Create(const CreateOptions &options, Handle &outHandle) {
         outHandle = 0;
         if (!m_Initialized) {
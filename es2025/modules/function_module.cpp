@@ -64,6 +64,33 @@ namespace spectre::es2025 {
         m_GpuEnabled = config.enableGpuAcceleration;
     }
 
+    void FunctionModule::CollectMemory(ModuleMemoryUsage &usage) const noexcept {
+        memory::Begin(usage);
+        std::uint64_t bytes = memory::VectorBytes(m_Functions) + memory::VectorBytes(m_Names) +
+                              memory::HashMapBytes(m_Index);
+        for (const auto &entry: m_Functions) {
+            bytes += memory::StringBytes(entry.name) + memory::StringBytes(entry.lastDiagnostics);
+        }
+        for (const auto &name: m_Names) {
+            bytes += memory::StringBytes(name);
+        }
+        for (const auto &[name, index]: m_Index) {
+            (void) index;
+            bytes += memory::StringBytes(name);
+        }
+        auto idleBytes = memory::VectorBytes(m_Functions) - memory::UsedVectorBytes(m_Functions);
+        usage.reservedBytes = bytes;
+        usage.liveBytes = bytes - idleBytes;
+        usage.freeListBytes = idleBytes;
+        usage.slotCount = m_Functions.size();
+    }
+
+    void FunctionModule::SampleMemory(ModuleMemoryCounters &counters) const noexcept {
+        m_Memory.Observe(memory::VectorBytes(m_Functions) + memory::VectorBytes(m_Names) +
+                         memory::HashMapBytes(m_Index));
+        memory::Sample(counters, m_Memory.Totals(), m_Functions.size(), 0);
+    }
+
     StatusCode FunctionModule::RegisterHostFunction(std::string_view name,
                                                     FunctionCallback callback,
                                                     void *userData,
@@ -79,6 +79,31 @@ namespace spectre::es2025 {
         m_GpuEnabled = config.enableGpuAcceleration;
     }
 
+    void GeneratorModule::CollectMemory(ModuleMemoryUsage &usage) const noexcept {
+        memory::Begin(usage);
+        memory::AddSlotTable(usage, m_Slots.size(), m_FreeSlots.size(), sizeof(Slot),
+                             memory::VectorBytes(m_Slots) + memory::VectorBytes(m_FreeSlots));
+        memory::AddSlotTable(usage, m_Bridges.size(), m_FreeBridges.size(), sizeof(BridgeState),
+                             memory::VectorBytes(m_Bridges) + memory::VectorBytes(m_FreeBridges) +
+                             static_cast<std::uint64_t>(m_Bridges.size()) * sizeof(BridgeState));
+        for (const auto &slot: m_Slots) {
+            if (!slot.active) {
+                continue;
+            }
+            auto bytes = memory::StringBytes(slot.name) + slot.yieldValue.HeapBytes();
+            usage.reservedBytes += bytes;
+            usage.liveBytes += bytes;
+        }
+    }
+
+    void GeneratorModule::SampleMemory(ModuleMemoryCounters &counters) const noexcept {
+        m_Memory.Observe(memory::VectorBytes(m_Slots) + memory::VectorBytes(m_FreeSlots) +
+                         memory::VectorBytes(m_Bridges) + memory::VectorBytes(m_FreeBridges) +
+                         static_cast<std::uint64_t>(m_Bridges.size()) * sizeof(BridgeState));
+        memory::Sample(counters, m_Memory.Totals(), m_Slots.size() + m_Bridges.size(),
+                       m_FreeSlots.size() + m_FreeBridges.size());
+    }
+
     StatusCode GeneratorModule::Register(const Descriptor &descriptor, Handle &outHandle) {
         outHandle = 0;
         if (descriptor.stepper == nullptr) {
@@ -73,6 +73,16 @@ namespace spectre::es2025 {
         (void) EnsureDefaultContext();
     }
 
+    void GlobalModule::CollectMemory(ModuleMemoryUsage &usage) const noexcept {
+        memory::Begin(usage);
+        usage.reservedBytes = memory::StringBytes(m_DefaultContextName);
+        usage.liveBytes = usage.reservedBytes;
+    }
+
+    void GlobalModule::SampleMemory(ModuleMemoryCounters &counters) const noexcept {
+        memory::Sample(counters, memory::Counter(), 0, 0);
+    }
+
     StatusCode GlobalModule::EnsureContext(std::string_view name, std::uint32_t stackSize) {
         if (!m_Runtime) {
             return StatusCode::InternalError;
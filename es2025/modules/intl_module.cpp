@@ -657,6 +657,66 @@ namespace spectre::es2025 {
         m_Metrics.gpuOptimized = m_GpuEnabled;
     }
 
+    void IntlModule::CollectMemory(ModuleMemoryUsage &usage) const noexcept {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        memory::Begin(usage);
+        memory::AddSlotTable(usage, m_Slots.size(), m_FreeList.size(), sizeof(LocaleSlot),
+                             memory::VectorBytes(m_Slots) + memory::VectorBytes(m_FreeList));
+        auto bytes = memory::StringBytes(m_DefaultLocale) + memory::HashMapBytes(m_LocaleLookup) +
+                     memory::HashMapBytes(m_NumberCache) + memory::HashMapBytes(m_DateCache) +
+                     memory::HashMapBytes(m_ListCache);
+        for (const auto &[identifier, handle]: m_LocaleLookup) {
+            (void) handle;
+            bytes += memory::StringBytes(identifier);
+        }
+        for (const auto &[signature, entry]: m_NumberCache) {
+            (void) signature;
+            const auto &descriptor = entry.descriptor;
+            bytes += memory::StringBytes(descriptor.currencyCode) + memory::StringBytes(descriptor.currencySymbol) +
+                    memory::StringBytes(descriptor.percentSymbol);
+        }
+        for (const auto &slot: m_Slots) {
+            if (!slot.inUse) {
+                continue;
+            }
+            const auto &record = slot.record;
+            const auto &data = record.data;
+            bytes += memory::StringBytes(record.identifier);
+            for (const auto *text: {&data.currencyCode, &data.currencySymbol, &data.percentSymbol,
+                                    &data.nanSymbol, &data.infinitySymbol, &data.positivePattern,
+                                    &data.negativePattern, &data.currencyPositivePattern,
+                                    &data.currencyNegativePattern, &data.percentPositivePattern,
+                                    &data.percentNegativePattern, &data.dateTimeSeparator,
+                                    &data.amDesignator, &data.pmDesignator}) {
+                bytes += memory::StringBytes(*text);
+            }
+            for (const auto &names: {std::span<const std::string>(data.monthNamesShort),
+                                     std::span<const std::string>(data.monthNamesLong),
+                                     std::span<const std::string>(data.weekdayNamesShort),
+                                     std::span<const std::string>(data.weekdayNamesLong),
+                                     std::span<const std::string>(data.datePatterns),
+                                     std::span<const std::string>(data.timePatterns)}) {
+                for (const auto &name: names) {
+                    bytes += memory::StringBytes(name);
+                }
+            }
+            for (const auto &pattern: data.listPatterns) {
+                bytes += memory::StringBytes(pattern.pair) + memory::StringBytes(pattern.start) +
+                        memory::StringBytes(pattern.middle) + memory::StringBytes(pattern.end);
+            }
+        }
+        usage.reservedBytes += bytes;
+        usage.liveBytes += bytes;
+    }
+
+    void IntlModule::SampleMemory(ModuleMemoryCounters &counters) const noexcept {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Memory.Observe(memory::VectorBytes(m_Slots) + memory::VectorBytes(m_FreeList) +
+                         memory::HashMapBytes(m_LocaleLookup) + memory::HashMapBytes(m_NumberCache) +
+                         memory::HashMapBytes(m_DateCache) + memory::HashMapBytes(m_ListCache));
+        memory::Sample(counters, m_Memory.Totals(), m_Slots.size(), m_FreeList.size());
+    }
+
     StatusCode IntlModule::RegisterLocale(const LocaleBlueprint &blueprint, LocaleHandle &outHandle) {
         std::lock_guard<std::mutex> lock(m_Mutex);
         return RegisterLocaleLocked(blueprint, outHandle);
@@ -104,6 +104,31 @@ namespace spectre::es2025 {
         m_GpuEnabled = config.enableGpuAcceleration;
     }
 
+    void IteratorModule::CollectMemory(ModuleMemoryUsage &usage) const noexcept {
+        memory::Begin(usage);
+        memory::AddSlotTable(usage, m_Slots.size(), m_FreeList.size(), sizeof(Slot),
+                             memory::VectorBytes(m_Slots) + memory::VectorBytes(m_FreeList));
+        for (const auto &slot: m_Slots) {
+            if (!slot.active) {
+                continue;
+            }
+            auto bytes = slot.last.value.HeapBytes();
+            if (const auto *list = std::get_if<ListData>(&slot.payload)) {
+                bytes += memory::VectorBytes(list->values);
+                for (const auto &value: list->values) {
+                    bytes += value.HeapBytes();
+                }
+            }
+            usage.reservedBytes += bytes;
+            usage.liveBytes += bytes;
+        }
+    }
+
+    void IteratorModule::SampleMemory(ModuleMemoryCounters &counters) const noexcept {
+        m_Memory.Observe(memory::VectorBytes(m_Slots) + memory::VectorBytes(m_FreeList));
+        memory::Sample(counters, m_Memory.Totals(), m_Slots.size(), m_FreeList.size());
+    }
+
     StatusCode IteratorModule::CreateRange(const RangeConfig &config, Handle &outHandle) {
         outHandle = 0;
         if (config.step == 0) {
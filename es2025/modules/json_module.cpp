@@ -235,6 +235,15 @@ namespace spectre::es2025 {
         ApplyConfig(config);
     }
 
+    // Documents belong to the caller; the module itself keeps no heap storage between calls.
+    void JsonModule::CollectMemory(ModuleMemoryUsage &usage) const noexcept {
+        memory::Begin(usage);
+    }
+
+    void JsonModule::SampleMemory(ModuleMemoryCounters &counters) const noexcept {
+        memory::Sample(counters, memory::Counter(), 0, 0);
+    }
+
     class JsonModule::Parser {
     public:
         Parser(std::string_view json,
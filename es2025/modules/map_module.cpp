@@ -1,38 +1,37 @@
 ﻿#include "spectre/es2025/modules/map_module.h"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstring>
 #include <limits>
 
 #include "spectre/runtime.h"
+#include "spectre/es2025/flat_hash_index.h"
 
 namespace spectre::es2025 {
     namespace {
         constexpr std::string_view kName = "Map";
         constexpr std::string_view kSummary = "Map keyed collection with ordered entries and iterator support.";
         constexpr std::string_view kReference = "ECMA-262 Section 24.1";
-        constexpr std::uint32_t kInitialBucketCount = 8;
-
-
+        constexpr std::uint32_t kInitialCapacity = 8;
+        constexpr std::uint64_t kMaxEntries = 1ull << 30;
+        // Holes left by deletes are squeezed out once they outnumber live entries past this floor.
+        constexpr std::uint32_t kMinCompactHoles = 16;
+        // Batched lookups hash this many keys and prefetch their groups before probing any of them.
+        constexpr std::size_t kLookupBatch = 16;
     }
 
+    // Entries stay in insertion order. Deleting leaves an inactive hole that the next rehash
+    // squeezes out, so iteration is a linear scan and never chases links.
     struct MapModule::Entry {
-        Entry()
-            : hash(0),
-              active(false),
-              key(),
-              value(),
-              orderPrev(kInvalidIndex),
-              orderNext(kInvalidIndex) {
+        Entry() : hash(0), key(), value(), active(false) {
         }
 
         std::uint64_t hash;
-        bool active;
         Value key;
         Value value;
-        std::uint32_t orderPrev;
-        std::uint32_t orderNext;
+        bool active;
     };
 
     struct MapModule::MapRecord {
@@ -42,13 +41,11 @@ namespace spectre::es2025 {
               generation(0),
               label(),
               size(0),
-              head(kInvalidIndex),
-              tail(kInvalidIndex),
               version(0),
               lastTouchFrame(0),
+              trackedBytes(0),
               entries(),
-              buckets(),
-              freeEntries() {
+              index() {
         }
 
         Handle handle;
@@ -56,13 +53,11 @@ namespace spectre::es2025 {
         std::uint32_t generation;
         std::string label;
         std::uint32_t size;
-        std::uint32_t head;
-        std::uint32_t tail;
         std::uint64_t version;
         std::uint64_t lastTouchFrame;
+        std::uint64_t trackedBytes;
         std::vector<Entry> entries;
-        std::vector<std::uint32_t> buckets;
-        std::vector<std::uint32_t> freeEntries;
+        FlatHashIndex index;
     };
 
     struct MapModule::SlotRecord {
@@ -81,6 +76,8 @@ namespace spectre::es2025 {
           m_Metrics{},
           m_Slots(),
           m_FreeSlots(),
+          m_Memory(),
+          m_SlotTableBytes(0),
           m_GpuEnabled(false),
           m_Initialized(false),
           m_CurrentFrame(0) {
@@ -110,6 +107,9 @@ namespace spectre::es2025 {
         m_Metrics.lastFrameTouched = 0;
         m_Slots.clear();
         m_FreeSlots.clear();
+        m_Memory.Reset();
+        m_SlotTableBytes = 0;
+        TrackSlots();
         m_CurrentFrame = 0;
         m_Initialized = true;
     }
@@ -130,6 +130,34 @@ namespace spectre::es2025 {
         m_Metrics.gpuOptimized = m_GpuEnabled;
     }
 
+    void MapModule::CollectMemory(ModuleMemoryUsage &usage) const noexcept {
+        memory::Begin(usage);
+        memory::AddSlotTable(usage, m_Slots.size(), m_FreeSlots.size(), sizeof(SlotRecord),
+                             memory::VectorBytes(m_Slots) + memory::VectorBytes(m_FreeSlots));
+        for (const auto &slot: m_Slots) {
+            if (!slot.inUse) {
+                continue;
+            }
+            const auto &record = slot.record;
+            auto labelBytes = memory::StringBytes(record.label);
+            auto tableBytes = memory::VectorBytes(record.entries) + record.index.ReservedBytes();
+            std::uint64_t payloadBytes = 0;
+            for (const auto &entry: record.entries) {
+                if (entry.active) {
+                    payloadBytes += entry.key.HeapBytes() + entry.value.HeapBytes();
+                }
+            }
+            auto idleEntryBytes = static_cast<std::uint64_t>(record.entries.capacity() - record.size) * sizeof(Entry);
+            usage.reservedBytes += labelBytes + tableBytes + payloadBytes;
+            usage.liveBytes += labelBytes + tableBytes + payloadBytes - idleEntryBytes;
+            usage.freeListBytes += idleEntryBytes;
+        }
+    }
+
+    void MapModule::SampleMemory(ModuleMemoryCounters &counters) const noexcept {
+        memory::Sample(counters, m_Memory, m_Slots.size(), m_FreeSlots.size());
+    }
+
     StatusCode MapModule::Create(std::string_view label, Handle &outHandle) {
         outHandle = 0;
         std::uint32_t slotIndex;
@@ -146,6 +174,7 @@ namespace spectre::es2025 {
             slot.generation = 1;
             m_Slots.push_back(slot);
         }
+        TrackSlots();
         auto &slot = m_Slots[slotIndex];
         auto &record = slot.record;
         record = MapRecord();
@@ -154,14 +183,10 @@ namespace spectre::es2025 {
         record.handle = EncodeHandle(slotIndex, slot.generation);
         record.label.assign(label.begin(), label.end());
         record.size = 0;
-        record.head = kInvalidIndex;
-        record.tail = kInvalidIndex;
         record.version = 0;
         record.lastTouchFrame = m_CurrentFrame;
         record.entries.clear();
-        record.buckets.clear();
-        record.freeEntries.clear();
-        EnsureCapacity(record);
+        Rehash(record, FlatHashIndex::CapacityFor(kInitialCapacity));
         Touch(record);
         TouchMetrics();
         outHandle = record.handle;
@@ -177,8 +202,10 @@ namespace spectre::es2025 {
         }
         slot->inUse = false;
         auto index = slot->record.slot;
+        m_Memory.Free(slot->record.trackedBytes);
         slot->record = MapRecord();
         m_FreeSlots.push_back(index);
+        TrackSlots();
         if (m_Metrics.liveMaps > 0) {
             m_Metrics.liveMaps -= 1;
         }
@@ -192,22 +219,9 @@ namespace spectre::es2025 {
         if (!record) {
             return StatusCode::NotFound;
         }
-        for (auto &entry: record->entries) {
-            if (!entry.active) {
-                continue;
-            }
-            entry.active = false;
-            entry.hash = 0;
-            entry.key.Reset();
-            entry.value.Reset();
-            entry.orderPrev = kInvalidIndex;
-            entry.orderNext = kInvalidIndex;
-            record->freeEntries.push_back(static_cast<std::uint32_t>(&entry - record->entries.data()));
-        }
+        record->entries.clear();
+        record->index.Clear();
         record->size = 0;
-        record->head = kInvalidIndex;
-        record->tail = kInvalidIndex;
-        std::fill(record->buckets.begin(), record->buckets.end(), kInvalidIndex);
         Touch(*record);
         TouchMetrics();
         m_Metrics.clears += 1;
@@ -220,26 +234,18 @@ namespace spectre::es2025 {
             return StatusCode::NotFound;
         }
         m_Metrics.setOps += 1;
-        EnsureCapacity(*record);
         auto hash = HashValue(key);
         bool collision = false;
-        std::uint32_t bucket = 0;
-        auto index = Locate(*record, key, hash, bucket, collision);
+        auto index = Locate(*record, key, hash, collision);
+        if (collision) {
+            m_Metrics.collisions += 1;
+        }
         if (index != kInvalidIndex) {
             record->entries[index].value = value;
             Touch(*record);
-            if (collision) {
-                m_Metrics.collisions += 1;
-            }
             return StatusCode::Ok;
         }
-        auto status = Insert(*record, key, value, hash, true);
-        if (status == StatusCode::Ok) {
-            if (collision) {
-                m_Metrics.collisions += 1;
-            }
-        }
-        return status;
+        return Insert(*record, key, value, hash);
     }
 
     StatusCode MapModule::Get(Handle handle, const Value &key, Value &outValue) const {
@@ -250,9 +256,8 @@ namespace spectre::es2025 {
         }
         const_cast<MapModule *>(this)->m_Metrics.getOps += 1;
         auto hash = HashValue(key);
-        std::uint32_t bucket = 0;
         bool collision = false;
-        auto index = Locate(*record, key, hash, bucket, collision);
+        auto index = Locate(*record, key, hash, collision);
         if (index == kInvalidIndex) {
             const_cast<MapModule *>(this)->m_Metrics.misses += 1;
             return StatusCode::NotFound;
@@ -287,6 +292,96 @@ namespace spectre::es2025 {
         return status;
     }
 
+    StatusCode MapModule::SetMany(Handle handle, std::span<const std::pair<Value, Value> > entries) {
+        auto *record = FindMutable(handle);
+        if (!record) {
+            return StatusCode::NotFound;
+        }
+        if (entries.empty()) {
+            return StatusCode::Ok;
+        }
+        if (entries.size() > kMaxEntries) {
+            return StatusCode::CapacityExceeded;
+        }
+        // Sizing for the worst case (every key new) up front means the loop below never rehashes.
+        auto status = EnsureCapacity(*record, static_cast<std::uint32_t>(entries.size()));
+        if (status != StatusCode::Ok) {
+            return status;
+        }
+        record->entries.reserve(record->entries.size() + entries.size());
+        m_Metrics.setOps += entries.size();
+        for (const auto &[key, value]: entries) {
+            auto hash = HashValue(key);
+            bool collision = false;
+            auto index = Locate(*record, key, hash, collision);
+            if (collision) {
+                m_Metrics.collisions += 1;
+            }
+            if (index != kInvalidIndex) {
+                record->entries[index].value = value;
+            } else {
+                Append(*record, key, value, hash);
+            }
+        }
+        Touch(*record);
+        return StatusCode::Ok;
+    }
+
+    StatusCode MapModule::GetMany(Handle handle, std::span<const Value> keys, std::span<Value> outValues,
+                                  std::span<std::uint64_t> outFound) const {
+        if (outValues.size() < keys.size() || outFound.size() < (keys.size() + 63) / 64) {
+            return StatusCode::InvalidArgument;
+        }
+        std::fill(outFound.begin(), outFound.end(), 0);
+        const auto *record = Find(handle);
+        if (!record) {
+            return StatusCode::NotFound;
+        }
+        std::uint64_t hits = 0;
+        std::array<std::uint64_t, kLookupBatch> hashes{};
+        for (std::size_t base = 0; base < keys.size(); base += kLookupBatch) {
+            auto count = std::min(kLookupBatch, keys.size() - base);
+            for (std::size_t i = 0; i < count; ++i) {
+                hashes[i] = HashValue(keys[base + i]);
+                record->index.Prefetch(hashes[i]);
+            }
+            for (std::size_t i = 0; i < count; ++i) {
+                bool collision = false;
+                auto index = Locate(*record, keys[base + i], hashes[i], collision);
+                if (index == kInvalidIndex) {
+                    outValues[base + i].Reset();
+                    continue;
+                }
+                outValues[base + i] = record->entries[index].value;
+                outFound[(base + i) / 64] |= 1ull << ((base + i) % 64);
+                ++hits;
+            }
+        }
+        auto *self = const_cast<MapModule *>(this);
+        self->m_Metrics.getOps += keys.size();
+        self->m_Metrics.hits += hits;
+        self->m_Metrics.misses += keys.size() - hits;
+        self->TouchMetrics();
+        return StatusCode::Ok;
+    }
+
+    StatusCode MapModule::Reserve(Handle handle, std::uint32_t count) {
+        auto *record = FindMutable(handle);
+        if (!record) {
+            return StatusCode::NotFound;
+        }
+        if (count > kMaxEntries) {
+            return StatusCode::CapacityExceeded;
+        }
+        auto capacity = FlatHashIndex::CapacityFor(count);
+        if (capacity > record->index.Capacity()) {
+            Rehash(*record, capacity);
+        }
+        record->entries.reserve(count);
+        Track(*record);
+        return StatusCode::Ok;
+    }
+
     std::uint32_t MapModule::Size(Handle handle) const {
         const auto *record = Find(handle);
         return record ? record->size : 0;
@@ -299,13 +394,10 @@ namespace spectre::es2025 {
             return StatusCode::NotFound;
         }
         keys.reserve(record->size);
-        auto index = record->head;
-        while (index != kInvalidIndex) {
-            const auto &entry = record->entries[index];
+        for (const auto &entry: record->entries) {
             if (entry.active) {
                 keys.push_back(entry.key);
             }
-            index = entry.orderNext;
         }
         const_cast<MapModule *>(this)->m_Metrics.iterations += 1;
         const_cast<MapModule *>(this)->TouchMetrics();
@@ -319,13 +411,10 @@ namespace spectre::es2025 {
             return StatusCode::NotFound;
         }
         values.reserve(record->size);
-        auto index = record->head;
-        while (index != kInvalidIndex) {
-            const auto &entry = record->entries[index];
+        for (const auto &entry: record->entries) {
             if (entry.active) {
                 values.push_back(entry.value);
             }
-            index = entry.orderNext;
         }
         const_cast<MapModule *>(this)->m_Metrics.iterations += 1;
         const_cast<MapModule *>(this)->TouchMetrics();
@@ -339,19 +428,87 @@ namespace spectre::es2025 {
             return StatusCode::NotFound;
         }
         entries.reserve(record->size);
-        auto index = record->head;
-        while (index != kInvalidIndex) {
-            const auto &entry = record->entries[index];
+        for (const auto &entry: record->entries) {
             if (entry.active) {
                 entries.emplace_back(entry.key, entry.value);
             }
-            index = entry.orderNext;
         }
         const_cast<MapModule *>(this)->m_Metrics.iterations += 1;
         const_cast<MapModule *>(this)->TouchMetrics();
         return StatusCode::Ok;
     }
 
+    StatusCode MapModule::OpenCursor(Handle handle, Cursor &outCursor) const {
+        outCursor = {};
+        const auto *record = Find(handle);
+        if (!record) {
+            return StatusCode::NotFound;
+        }
+        outCursor.handle = handle;
+        outCursor.version = record->version;
+        outCursor.position = 0;
+        const_cast<MapModule *>(this)->m_Metrics.iterations += 1;
+        const_cast<MapModule *>(this)->TouchMetrics();
+        return StatusCode::Ok;
+    }
+
+    StatusCode MapModule::NextKeys(Cursor &cursor, std::span<Value> out, std::size_t &outCount) const {
+        outCount = 0;
+        const MapRecord *record = nullptr;
+        auto status = ResolveCursor(cursor, record);
+        if (status != StatusCode::Ok) {
+            return status;
+        }
+        auto position = cursor.position;
+        for (; position < record->entries.size() && outCount < out.size(); ++position) {
+            const auto &entry = record->entries[position];
+            if (entry.active) {
+                out[outCount++] = entry.key;
+            }
+        }
+        cursor.position = position;
+        return StatusCode::Ok;
+    }
+
+    StatusCode MapModule::NextValues(Cursor &cursor, std::span<Value> out, std::size_t &outCount) const {
+        outCount = 0;
+        const MapRecord *record = nullptr;
+        auto status = ResolveCursor(cursor, record);
+        if (status != StatusCode::Ok) {
+            return status;
+        }
+        auto position = cursor.position;
+        for (; position < record->entries.size() && outCount < out.size(); ++position) {
+            const auto &entry = record->entries[position];
+            if (entry.active) {
+                out[outCount++] = entry.value;
+            }
+        }
+        cursor.position = position;
+        return StatusCode::Ok;
+    }
+
+    StatusCode MapModule::NextEntries(Cursor &cursor, std::span<std::pair<Value, Value> > out,
+                                      std::size_t &outCount) const {
+        outCount = 0;
+        const MapRecord *record = nullptr;
+        auto status = ResolveCursor(cursor, record);
+        if (status != StatusCode::Ok) {
+            return status;
+        }
+        auto position = cursor.position;
+        for (; position < record->entries.size() && outCount < out.size(); ++position) {
+            const auto &entry = record->entries[position];
+            if (entry.active) {
+                out[outCount].first = entry.key;
+                out[outCount].second = entry.value;
+                ++outCount;
+            }
+        }
+        cursor.position = position;
+        return StatusCode::Ok;
+    }
+
     const MapModule::Metrics &MapModule::GetMetrics() const noexcept {
         return m_Metrics;
     }
@@ -414,7 +571,7 @@ namespace spectre::es2025 {
         return static_cast<std::uint32_t>((handle >> 32) & 0xffffffffull);
     }
 
-        std::uint64_t MapModule::HashValue(const Value &value) noexcept {
+    std::uint64_t MapModule::HashValue(const Value &value) noexcept {
         auto hash = value.Hash();
         if (hash == 0) {
             hash = 0x9e3779b97f4a7c15ull;
@@ -422,224 +579,140 @@ namespace spectre::es2025 {
         return hash;
     }
 
-
     void MapModule::Touch(MapRecord &record) noexcept {
         record.version += 1;
         record.lastTouchFrame = m_CurrentFrame;
+        Track(record);
         TouchMetrics();
     }
 
+    // Retakes the record's own storage footprint (label, entry array, index) in O(1), so the
+    // running counters follow every growth and shrink without walking the entries.
+    void MapModule::Track(MapRecord &record) noexcept {
+        auto bytes = memory::StringBytes(record.label) + memory::VectorBytes(record.entries) +
+                     record.index.ReservedBytes();
+        m_Memory.Resize(record.trackedBytes, bytes);
+        record.trackedBytes = bytes;
+    }
+
+    void MapModule::TrackSlots() noexcept {
+        auto bytes = memory::VectorBytes(m_Slots) + memory::VectorBytes(m_FreeSlots);
+        m_Memory.Resize(m_SlotTableBytes, bytes);
+        m_SlotTableBytes = bytes;
+    }
+
     void MapModule::TouchMetrics() noexcept {
         m_Metrics.lastFrameTouched = m_CurrentFrame;
     }
 
-    void MapModule::EnsureCapacity(MapRecord &record) {
-        if (record.buckets.empty()) {
-            Rehash(record, kInitialBucketCount);
-            return;
-        }
-        auto capacity = static_cast<std::uint32_t>(record.buckets.size());
-        auto limit = (capacity * 3u) / 5u;
-        if (limit < 1) {
-            limit = 1;
+    StatusCode MapModule::ResolveCursor(const Cursor &cursor, const MapRecord *&outRecord) const noexcept {
+        outRecord = Find(cursor.handle);
+        if (!outRecord) {
+            return StatusCode::NotFound;
         }
-        if (record.size + 1 > limit) {
-            Rehash(record, capacity * 2);
+        // Rehashing compacts the entry array, so a position taken before any mutation is
+        // meaningless after it.
+        if (outRecord->version != cursor.version) {
+            outRecord = nullptr;
+            return StatusCode::InvalidArgument;
         }
+        return StatusCode::Ok;
     }
 
-    void MapModule::Rehash(MapRecord &record, std::uint32_t newBucketCount) {
-        if (newBucketCount < kInitialBucketCount) {
-            newBucketCount = kInitialBucketCount;
+    StatusCode MapModule::EnsureCapacity(MapRecord &record, std::uint32_t additional) {
+        auto needed = std::max<std::uint64_t>(static_cast<std::uint64_t>(record.size) + additional, kInitialCapacity);
+        if (needed > kMaxEntries) {
+            return StatusCode::CapacityExceeded;
         }
-        if ((newBucketCount & (newBucketCount - 1)) != 0) {
-            std::uint32_t power = 1;
-            while (power < newBucketCount && power < (1u << 30)) {
-                power <<= 1;
-            }
-            newBucketCount = power;
+        auto capacity = record.index.Capacity();
+        if (capacity == 0 || needed > record.index.GrowthLimit()) {
+            // CapacityFor applies the load factor and rounds to a power of two, so one-at-a-time
+            // growth still doubles while a bulk reservation gets the smallest table that fits.
+            Rehash(record, FlatHashIndex::CapacityFor(static_cast<std::uint32_t>(needed)));
+            return StatusCode::Ok;
         }
-        std::vector<std::uint32_t> buckets(newBucketCount, kInvalidIndex);
-        auto mask = newBucketCount - 1;
-        for (std::uint32_t index = 0; index < record.entries.size(); ++index) {
-            auto &entry = record.entries[index];
-            if (!entry.active) {
+        // Tombstones count against the load factor, and holes against iteration cost; both are
+        // cleared by rebuilding at the current size.
+        auto holes = static_cast<std::uint32_t>(record.entries.size()) - record.size;
+        if (record.index.NeedsRebuild(additional) || (holes >= kMinCompactHoles && holes > record.size)) {
+            Rehash(record, capacity);
+        }
+        return StatusCode::Ok;
+    }
+
+    void MapModule::Rehash(MapRecord &record, std::uint32_t capacity) {
+        std::uint32_t write = 0;
+        for (std::uint32_t read = 0; read < record.entries.size(); ++read) {
+            if (!record.entries[read].active) {
                 continue;
             }
-            auto bucket = static_cast<std::uint32_t>(entry.hash) & mask;
-            while (true) {
-                if (buckets[bucket] == kInvalidIndex) {
-                    buckets[bucket] = index;
-                    break;
-                }
-                bucket = (bucket + 1) & mask;
+            if (write != read) {
+                record.entries[write] = std::move(record.entries[read]);
             }
+            ++write;
+        }
+        if (write != record.entries.size()) {
+            // Dropping holes moves entries, so open cursors must see a new version.
+            record.version += 1;
+        }
+        record.entries.resize(write);
+        record.index.Reset(capacity);
+        for (std::uint32_t i = 0; i < write; ++i) {
+            record.index.Insert(record.entries[i].hash, i);
         }
-        record.buckets.swap(buckets);
         m_Metrics.rehashes += 1;
     }
 
     std::uint32_t MapModule::Locate(const MapRecord &record, const Value &key, std::uint64_t hash,
-                                    std::uint32_t &bucket, bool &collision) const {
-        if (record.buckets.empty()) {
-            bucket = 0;
-            collision = false;
-            return kInvalidIndex;
-        }
-        auto mask = static_cast<std::uint32_t>(record.buckets.size() - 1);
-        auto index = static_cast<std::uint32_t>(hash) & mask;
-        std::uint32_t firstDeleted = kInvalidIndex;
+                                    bool &collision) const {
         std::uint32_t probes = 0;
-        collision = false;
-        while (true) {
-            auto entryIndex = record.buckets[index];
-            if (entryIndex == kInvalidIndex) {
-                bucket = firstDeleted != kInvalidIndex ? firstDeleted : index;
-                collision = probes != 0;
-                return kInvalidIndex;
-            }
-            if (entryIndex == kDeletedIndex) {
-                if (firstDeleted == kInvalidIndex) {
-                    firstDeleted = index;
-                }
-            } else {
-                const auto &entry = record.entries[entryIndex];
-                if (entry.active && entry.hash == hash && entry.key.SameValueZero(key)) {
-                    bucket = index;
-                    collision = probes != 0;
-                    return entryIndex;
-                }
-            }
-            index = (index + 1) & mask;
-            ++probes;
-            if (probes >= record.buckets.size()) {
-                bucket = firstDeleted != kInvalidIndex ? firstDeleted : index;
-                collision = true;
-                return kInvalidIndex;
-            }
-        }
+        auto index = record.index.Find(hash, [&](std::uint32_t candidate) {
+            const auto &entry = record.entries[candidate];
+            return entry.hash == hash && entry.key.SameValueZero(key);
+        }, probes);
+        collision = probes != 0;
+        return index;
     }
 
-    std::uint32_t MapModule::AllocateEntry(MapRecord &record) {
-        if (!record.freeEntries.empty()) {
-            auto index = record.freeEntries.back();
-            record.freeEntries.pop_back();
-            auto &entry = record.entries[index];
-            entry.active = true;
-            entry.hash = 0;
-            entry.key.Reset();
-            entry.value.Reset();
-            entry.orderPrev = kInvalidIndex;
-            entry.orderNext = kInvalidIndex;
-            return index;
+    StatusCode MapModule::Insert(MapRecord &record, const Value &key, const Value &value, std::uint64_t hash) {
+        auto status = EnsureCapacity(record, 1);
+        if (status != StatusCode::Ok) {
+            return status;
         }
-        Entry entry;
-        entry.active = true;
-        record.entries.push_back(entry);
-        return static_cast<std::uint32_t>(record.entries.size() - 1);
+        Append(record, key, value, hash);
+        Touch(record);
+        return StatusCode::Ok;
     }
 
-    StatusCode MapModule::Insert(MapRecord &record, const Value &key, const Value &value, std::uint64_t hash,
-                                 bool allowReplace) {
-        std::uint32_t bucket = 0;
-        bool collision = false;
-        auto existing = Locate(record, key, hash, bucket, collision);
-        if (existing != kInvalidIndex) {
-            if (!allowReplace) {
-                return StatusCode::AlreadyExists;
-            }
-            record.entries[existing].value = value;
-            Touch(record);
-            if (collision) {
-                m_Metrics.collisions += 1;
-            }
-            return StatusCode::Ok;
-        }
-        auto entryIndex = AllocateEntry(record);
-        auto &entry = record.entries[entryIndex];
+    void MapModule::Append(MapRecord &record, const Value &key, const Value &value, std::uint64_t hash) {
+        auto entryIndex = static_cast<std::uint32_t>(record.entries.size());
+        auto &entry = record.entries.emplace_back();
         entry.hash = hash;
         entry.key = key;
         entry.value = value;
-        entry.orderPrev = kInvalidIndex;
-        entry.orderNext = kInvalidIndex;
-        if (record.buckets.empty()) {
-            record.buckets.resize(kInitialBucketCount, kInvalidIndex);
-        }
-        record.buckets[bucket] = entryIndex;
-        LinkTail(record, entryIndex);
+        entry.active = true;
+        record.index.Insert(hash, entryIndex);
         record.size += 1;
-        Touch(record);
-        if (collision) {
-            m_Metrics.collisions += 1;
-        }
-        return StatusCode::Ok;
     }
 
     StatusCode MapModule::Remove(MapRecord &record, const Value &key, std::uint64_t hash, bool &outDeleted) {
         outDeleted = false;
-        if (record.buckets.empty()) {
-            return StatusCode::Ok;
-        }
-        std::uint32_t bucket = 0;
         bool collision = false;
-        auto index = Locate(record, key, hash, bucket, collision);
+        auto index = Locate(record, key, hash, collision);
+        if (collision) {
+            m_Metrics.collisions += 1;
+        }
         if (index == kInvalidIndex) {
             return StatusCode::Ok;
         }
         auto &entry = record.entries[index];
-        if (!entry.active) {
-            return StatusCode::Ok;
-        }
+        record.index.Erase(hash, index);
         entry.active = false;
-        entry.hash = 0;
         entry.key.Reset();
         entry.value.Reset();
-        Unlink(record, index);
-        record.freeEntries.push_back(index);
-        record.buckets[bucket] = kDeletedIndex;
         outDeleted = true;
-        if (record.size > 0) {
-            record.size -= 1;
-        }
+        record.size -= 1;
         Touch(record);
-        if (collision) {
-            m_Metrics.collisions += 1;
-        }
         return StatusCode::Ok;
     }
-
-    void MapModule::LinkTail(MapRecord &record, std::uint32_t entryIndex) {
-        auto &entry = record.entries[entryIndex];
-        if (record.tail == kInvalidIndex) {
-            record.head = entryIndex;
-            record.tail = entryIndex;
-            entry.orderPrev = kInvalidIndex;
-            entry.orderNext = kInvalidIndex;
-            return;
-        }
-        auto &tailEntry = record.entries[record.tail];
-        tailEntry.orderNext = entryIndex;
-        entry.orderPrev = record.tail;
-        entry.orderNext = kInvalidIndex;
-        record.tail = entryIndex;
-    }
-
-    void MapModule::Unlink(MapRecord &record, std::uint32_t entryIndex) {
-        auto &entry = record.entries[entryIndex];
-        auto prev = entry.orderPrev;
-        auto next = entry.orderNext;
-        if (prev != kInvalidIndex) {
-            record.entries[prev].orderNext = next;
-        } else {
-            record.head = next;
-        }
-        if (next != kInvalidIndex) {
-            record.entries[next].orderPrev = prev;
-        } else {
-            record.tail = prev;
-        }
-        entry.orderPrev = kInvalidIndex;
-        entry.orderNext = kInvalidIndex;
-    }
 }
-
@@ -89,6 +89,18 @@ namespace spectre::es2025 {
         m_Metrics.gpuOptimized = m_GpuEnabled;
     }
 
+    void MathModule::CollectMemory(ModuleMemoryUsage &usage) const noexcept {
+        memory::Begin(usage);
+        usage.reservedBytes = memory::VectorBytes(m_Table);
+        usage.liveBytes = memory::UsedVectorBytes(m_Table);
+        usage.freeListBytes = usage.reservedBytes - usage.liveBytes;
+    }
+
+    void MathModule::SampleMemory(ModuleMemoryCounters &counters) const noexcept {
+        m_Memory.Observe(memory::VectorBytes(m_Table));
+        memory::Sample(counters, m_Memory.Totals(), 0, 0);
+    }
+
     double MathModule::FastSin(double radians) const noexcept {
         m_Metrics.fastSinCalls += 1;
         if (!std::isfinite(radians) || m_Table.size() < 2) {
@@ -185,6 +185,54 @@ namespace spectre::es2025 {
         (void) EnsureContextUnlocked(m_DefaultContextName, m_DefaultStackSize, lock);
     }
 
+    void ModuleLoaderModule::CollectMemory(ModuleMemoryUsage &usage) const noexcept {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        memory::Begin(usage);
+        memory::AddSlotTable(usage, m_Slots.size(), m_FreeList.size(), sizeof(Slot),
+                             memory::VectorBytes(m_Slots) + memory::VectorBytes(m_FreeList));
+        auto bytes = memory::StringBytes(m_DefaultContextName) + memory::HashMapBytes(m_SpecifierLookup) +
+                     memory::HashMapBytes(m_ContextLookup);
+        for (const auto &[specifier, handle]: m_SpecifierLookup) {
+            (void) handle;
+            bytes += memory::StringBytes(specifier);
+        }
+        for (const auto &[name, index]: m_ContextLookup) {
+            (void) index;
+            bytes += memory::StringBytes(name);
+        }
+        for (const auto &slot: m_Slots) {
+            if (!slot.inUse) {
+                continue;
+            }
+            const auto &record = slot.record;
+            bytes += memory::StringBytes(record.specifier) + memory::StringBytes(record.source) +
+                    memory::StringBytes(record.contextName) + memory::StringBytes(record.diagnostics) +
+                    memory::StringBytes(record.lastValue) + memory::VectorBytes(record.dependencies) +
+                    memory::VectorBytes(record.dependents);
+        }
+        usage.reservedBytes += bytes;
+        usage.liveBytes += bytes;
+        // Traversal scratch is kept between evaluations and holds nothing live while idle.
+        auto scratchBytes = memory::VectorBytes(m_DfsMarks) + memory::VectorBytes(m_DirtyMarks) +
+                            memory::VectorBytes(m_WorkStack) + memory::VectorBytes(m_EvaluationOrder) +
+                            memory::VectorBytes(m_ScratchDependencies) + memory::VectorBytes(m_DirtyStack);
+        for (const auto &dependency: m_ScratchDependencies) {
+            scratchBytes += memory::StringBytes(dependency);
+        }
+        usage.reservedBytes += scratchBytes;
+        usage.freeListBytes += scratchBytes;
+    }
+
+    void ModuleLoaderModule::SampleMemory(ModuleMemoryCounters &counters) const noexcept {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Memory.Observe(memory::VectorBytes(m_Slots) + memory::VectorBytes(m_FreeList) +
+                         memory::VectorBytes(m_DfsMarks) + memory::VectorBytes(m_DirtyMarks) +
+                         memory::VectorBytes(m_WorkStack) + memory::VectorBytes(m_EvaluationOrder) +
+                         memory::VectorBytes(m_ScratchDependencies) + memory::VectorBytes(m_DirtyStack) +
+                         memory::HashMapBytes(m_SpecifierLookup) + memory::HashMapBytes(m_ContextLookup));
+        memory::Sample(counters, m_Memory.Totals(), m_Slots.size(), m_FreeList.size());
+    }
+
     void ModuleLoaderModule::SetHostResolver(ResolveCallback callback, void *userData) noexcept {
         std::lock_guard<std::mutex> lock(m_Mutex);
         m_Resolver = callback;
@@ -3,19 +3,29 @@
 
 #include <algorithm>
 #include <limits>
+#include <unordered_map>
 #include <utility>
 
 #include "spectre/runtime.h"
+#include "spectre/es2025/environment.h"
 
 namespace spectre::es2025 {
     namespace {
         constexpr std::string_view kName = "Object";
         constexpr std::string_view kSummary = "Object constructor, prototypes, and property descriptor semantics.";
         constexpr std::string_view kReference = "ECMA-262 Section 19.1";
-        constexpr std::uint32_t kInitialBucketCount = 8;
+        // Shapes up to this many properties are always scanned linearly. Larger shared shapes are
+        // indexed once they have been scanned this many times, so the intermediate shapes an
+        // object passes through while it is being built do not each pay for a hash table.
+        constexpr std::size_t kLinearLookupLimit = 8;
+        constexpr std::uint32_t kIndexAfterScans = 4;
+        // Objects that grow past this many properties leave the shared transition tree and own a
+        // private dictionary layout, which keeps hash-map style objects from spawning shapes.
+        constexpr std::size_t kMaxSharedProperties = 64;
         constexpr std::uint8_t kAttrEnumerable = 1u << 0;
         constexpr std::uint8_t kAttrConfigurable = 1u << 1;
         constexpr std::uint8_t kAttrWritable = 1u << 2;
+        constexpr std::uint8_t kAttrDefault = kAttrEnumerable | kAttrConfigurable | kAttrWritable;
 
         std::uint8_t EncodeAttributes(bool enumerable, bool configurable, bool writable) noexcept {
             std::uint8_t flags = 0;
@@ -44,13 +54,52 @@ namespace spectre::es2025 {
         }
     }
 
-    struct ObjectModule::PropertySlot {
-        PropertySlot() : hash(0), attributes(0), active(false), value(), key() {}
-        std::uint64_t hash;
+    struct ObjectModule::ShapeProperty {
+        std::uint32_t name;
         std::uint8_t attributes;
-        bool active;
-        Value value;
-        std::string key;
+    };
+
+    // A property layout shared by every object that added the same names with the same
+    // attributes in the same order. Properties()[i] describes the value at offset i.
+    //
+    // Shapes along one transition path share a descriptor array: each shape sees the first
+    // `length` entries, and a child appends in place when its parent's view ends at the array's
+    // tail. Only a branch off the middle of a path copies, so building an n-property chain is
+    // O(n) instead of O(n^2). Dictionary layouts own their array outright.
+    struct ObjectModule::Shape {
+        struct Edge {
+            std::uint32_t name;
+            std::uint8_t attributes;
+            std::uint32_t child;
+        };
+
+        Shape()
+            : parent(kInvalidIndex),
+              descriptors(std::make_shared<std::vector<ShapeProperty>>()),
+              length(0),
+              ownsDescriptors(true),
+              scans(0),
+              index(),
+              transitions() {}
+
+        std::span<const ShapeProperty> Properties() const noexcept {
+            return {descriptors->data(), length};
+        }
+
+        std::vector<ShapeProperty> CopyProperties() const {
+            auto properties = Properties();
+            return {properties.begin(), properties.end()};
+        }
+
+        std::uint32_t parent;
+        std::shared_ptr<std::vector<ShapeProperty>> descriptors;
+        std::uint32_t length;
+        // The shape that created the array accounts for its bytes.
+        bool ownsDescriptors;
+        mutable std::uint32_t scans;
+        // Covers Properties()[0, index.size()); filled by IndexShape.
+        mutable std::unordered_map<std::uint32_t, std::uint32_t> index;
+        std::vector<Edge> transitions;
     };
 
     struct ObjectModule::ObjectRecord {
@@ -65,10 +114,10 @@ namespace spectre::es2025 {
               frozen(false),
               version(0),
               lastTouchFrame(0),
-              activeProperties(0),
-              properties(),
-              buckets(),
-              freeProperties() {}
+              shape(kRootShape),
+              trackedBytes(0),
+              values(),
+              dictionary() {}
         Handle handle;
         std::uint32_t slot;
         std::uint32_t generation;
@@ -79,10 +128,10 @@ namespace spectre::es2025 {
         bool frozen;
         std::uint64_t version;
         std::uint64_t lastTouchFrame;
-        std::uint32_t activeProperties;
-        std::vector<PropertySlot> properties;
-        std::vector<std::uint32_t> buckets;
-        std::vector<std::uint32_t> freeProperties;
+        std::uint32_t shape;
+        std::uint64_t trackedBytes;
+        std::vector<Value> values;
+        std::unique_ptr<Shape> dictionary;
     };
 
     struct ObjectModule::SlotRecord {
@@ -92,6 +141,15 @@ namespace spectre::es2025 {
         ObjectRecord record;
     };
 
+    ObjectModule::CacheSlot::CacheSlot() noexcept : entries{}, name(kInvalidIndex), count(0), megamorphic(false) {}
+
+    void ObjectModule::CacheSlot::Reset() noexcept {
+        entries = {};
+        name = kInvalidIndex;
+        count = 0;
+        megamorphic = false;
+    }
+
     ObjectModule::~ObjectModule() = default;
 
     ObjectModule::ObjectModule()
@@ -101,6 +159,10 @@ namespace spectre::es2025 {
           m_Metrics{},
           m_Slots(),
           m_FreeList(),
+          m_Shapes(1),
+          m_Strings(nullptr),
+          m_Memory(),
+          m_SlotTableBytes(0),
           m_GpuEnabled(false),
           m_Initialized(false),
           m_CurrentFrame(0) {}
@@ -127,6 +189,12 @@ namespace spectre::es2025 {
         m_Metrics.lastFrameTouched = 0;
         m_Slots.clear();
         m_FreeList.clear();
+        m_Shapes.assign(1, Shape());
+        m_Metrics.shapes = m_Shapes.size();
+        m_Memory.Reset();
+        m_SlotTableBytes = 0;
+        TrackSlots();
+        m_Strings = dynamic_cast<StringModule *>(context.runtime.EsEnvironment().FindModule("String"));
         m_CurrentFrame = 0;
         m_Initialized = true;
     }
@@ -147,6 +215,40 @@ namespace spectre::es2025 {
         m_Metrics.gpuOptimized = m_GpuEnabled;
     }
 
+    void ObjectModule::CollectMemory(ModuleMemoryUsage &usage) const noexcept {
+        memory::Begin(usage);
+        memory::AddSlotTable(usage, m_Slots.size(), m_FreeList.size(), sizeof(SlotRecord),
+                             memory::VectorBytes(m_Slots) + memory::VectorBytes(m_FreeList));
+        std::uint64_t sharedBytes = memory::VectorBytes(m_Shapes);
+        for (const auto &shape: m_Shapes) {
+            sharedBytes += ShapeBytes(shape);
+        }
+        usage.reservedBytes += sharedBytes;
+        usage.liveBytes += sharedBytes;
+        for (const auto &slot: m_Slots) {
+            if (!slot.inUse) {
+                continue;
+            }
+            const auto &record = slot.record;
+            auto labelBytes = memory::StringBytes(record.label);
+            auto layoutBytes = record.dictionary ? sizeof(Shape) + ShapeBytes(*record.dictionary) : 0;
+            std::uint64_t payloadBytes = 0;
+            for (const auto &value: record.values) {
+                payloadBytes += value.HeapBytes();
+            }
+            auto idleBytes = static_cast<std::uint64_t>(record.values.capacity() - record.values.size())
+                             * sizeof(Value);
+            auto valueBytes = memory::VectorBytes(record.values);
+            usage.reservedBytes += labelBytes + layoutBytes + valueBytes + payloadBytes;
+            usage.liveBytes += labelBytes + layoutBytes + valueBytes + payloadBytes - idleBytes;
+            usage.freeListBytes += idleBytes;
+        }
+    }
+
+    void ObjectModule::SampleMemory(ModuleMemoryCounters &counters) const noexcept {
+        memory::Sample(counters, m_Memory, m_Slots.size(), m_FreeList.size());
+    }
+
     StatusCode ObjectModule::Create(std::string_view label, Handle prototype, Handle &outHandle) {
         outHandle = 0;
         if (prototype != 0 && !IsValid(prototype)) {
@@ -161,11 +263,12 @@ namespace spectre::es2025 {
             slot.generation += 1;
         } else {
             slotIndex = static_cast<std::uint32_t>(m_Slots.size());
-            SlotRecord slot;
+            m_Slots.emplace_back();
+            auto &slot = m_Slots.back();
             slot.inUse = true;
             slot.generation = 1;
-            m_Slots.push_back(slot);
         }
+        TrackSlots();
         auto &slot = m_Slots[slotIndex];
         auto &object = slot.record;
         object = ObjectRecord();
@@ -174,16 +277,7 @@ namespace spectre::es2025 {
         object.handle = EncodeHandle(slotIndex, slot.generation);
         object.label.assign(label.begin(), label.end());
         object.prototype = prototype;
-        object.extensible = true;
-        object.sealed = false;
-        object.frozen = false;
-        object.version = 0;
         object.lastTouchFrame = m_CurrentFrame;
-        object.activeProperties = 0;
-        object.properties.clear();
-        object.buckets.clear();
-        object.freeProperties.clear();
-        EnsureCapacity(object);
         Touch(object);
         TouchMetrics();
         outHandle = object.handle;
@@ -194,60 +288,30 @@ namespace spectre::es2025 {
 
     StatusCode ObjectModule::Clone(Handle source, std::string_view label, Handle &outHandle) {
         outHandle = 0;
-        const auto *original = Find(source);
-        if (!original) {
+        if (!Find(source)) {
             return StatusCode::NotFound;
         }
-        auto status = Create(label, original->prototype, outHandle);
+        auto status = Create(label, Find(source)->prototype, outHandle);
         if (status != StatusCode::Ok) {
             return status;
         }
+        // Create may have grown m_Slots, so the source is looked up again afterwards.
+        const auto *original = Find(source);
         auto *clone = FindMutable(outHandle);
-        if (!clone) {
+        if (!original || !clone) {
             return StatusCode::InternalError;
         }
-        clone->extensible = true;
-        clone->sealed = false;
-        clone->frozen = false;
-        clone->properties.clear();
-        clone->freeProperties.clear();
-        clone->activeProperties = 0;
-        clone->buckets.clear();
-        EnsureCapacity(*clone);
-        for (const auto &slot : original->properties) {
-            if (!slot.active) {
-                continue;
-            }
-            PropertyDescriptor descriptor;
-            descriptor.value = slot.value;
-            descriptor.enumerable = IsEnumerable(slot.attributes);
-            descriptor.configurable = IsConfigurable(slot.attributes);
-            descriptor.writable = IsWritable(slot.attributes);
-            InsertOrUpdate(*clone, slot.key, descriptor, true);
+        clone->shape = original->shape;
+        clone->values = original->values;
+        if (original->dictionary) {
+            clone->dictionary = std::make_unique<Shape>();
+            AssignDictionary(*clone->dictionary, original->dictionary->Properties());
+            RetainNames(clone->dictionary->Properties());
+            m_Metrics.dictionaryObjects += 1;
         }
         clone->extensible = original->extensible;
         clone->sealed = original->sealed;
         clone->frozen = original->frozen;
-        if (clone->sealed) {
-            clone->extensible = false;
-            for (auto &slot : clone->properties) {
-                if (!slot.active) {
-                    continue;
-                }
-                slot.attributes &= static_cast<std::uint8_t>(~kAttrConfigurable);
-            }
-        }
-        if (clone->frozen) {
-            clone->extensible = false;
-            clone->sealed = true;
-            for (auto &slot : clone->properties) {
-                if (!slot.active) {
-                    continue;
-                }
-                slot.attributes &= static_cast<std::uint8_t>(~kAttrConfigurable);
-                slot.attributes &= static_cast<std::uint8_t>(~kAttrWritable);
-            }
-        }
         Touch(*clone);
         TouchMetrics();
         return StatusCode::Ok;
@@ -260,8 +324,16 @@ namespace spectre::es2025 {
         }
         slot->inUse = false;
         auto index = slot->record.slot;
+        if (slot->record.dictionary) {
+            ReleaseNames(slot->record.dictionary->Properties());
+            if (m_Metrics.dictionaryObjects > 0) {
+                m_Metrics.dictionaryObjects -= 1;
+            }
+        }
+        m_Memory.Free(slot->record.trackedBytes);
         slot->record = ObjectRecord();
         m_FreeList.push_back(index);
+        TrackSlots();
         if (m_Metrics.liveObjects > 0) {
             m_Metrics.liveObjects -= 1;
         }
@@ -270,6 +342,36 @@ namespace spectre::es2025 {
         return StatusCode::Ok;
     }
     StatusCode ObjectModule::Define(Handle handle, std::string_view key, const PropertyDescriptor &descriptor) {
+        if (!IsValid(handle)) {
+            return StatusCode::NotFound;
+        }
+        auto name = InternName(key);
+        if (name == kInvalidIndex) {
+            return StatusCode::InternalError;
+        }
+        auto status = Define(handle, name, descriptor);
+        ReleaseName(name);
+        return status;
+    }
+
+    StatusCode ObjectModule::Set(Handle handle, std::string_view key, const Value &value) {
+        if (!IsValid(handle)) {
+            return StatusCode::NotFound;
+        }
+        auto name = InternName(key);
+        if (name == kInvalidIndex) {
+            return StatusCode::InternalError;
+        }
+        auto status = Set(handle, name, value);
+        ReleaseName(name);
+        return status;
+    }
+
+    StatusCode ObjectModule::Get(Handle handle, std::string_view key, Value &outValue) const {
+        return Get(handle, LookupName(key), outValue);
+    }
+
+    StatusCode ObjectModule::Define(Handle handle, Atom key, const PropertyDescriptor &descriptor) {
         auto *object = FindMutable(handle);
         if (!object) {
             return StatusCode::NotFound;
@@ -277,7 +379,7 @@ namespace spectre::es2025 {
         return InsertOrUpdate(*object, key, descriptor, true);
     }
 
-    StatusCode ObjectModule::Set(Handle handle, std::string_view key, const Value &value) {
+    StatusCode ObjectModule::Set(Handle handle, Atom key, const Value &value) {
         auto *object = FindMutable(handle);
         if (!object) {
             return StatusCode::NotFound;
@@ -286,46 +388,28 @@ namespace spectre::es2025 {
         return UpdateValue(*object, key, value, allowNew);
     }
 
-    StatusCode ObjectModule::Get(Handle handle, std::string_view key, Value &outValue) const {
+    StatusCode ObjectModule::Get(Handle handle, Atom key, Value &outValue) const {
         outValue.Reset();
         const auto *object = Find(handle);
         if (!object) {
             return StatusCode::NotFound;
         }
-        auto hash = HashKey(key);
-        std::uint32_t bucket = 0;
-        bool collision = false;
-        auto index = Locate(*object, key, hash, bucket, collision);
-        if (index != kInvalidIndex) {
-            outValue = object->properties[index].value;
-            const_cast<ObjectModule *>(this)->m_Metrics.fastPathHits += 1;
-            const_cast<ObjectModule *>(this)->TouchMetrics();
-            return StatusCode::Ok;
+        auto *self = const_cast<ObjectModule *>(this);
+        std::uint32_t offset = 0;
+        std::uint32_t depth = 0;
+        const auto *holder = Resolve(*object, key, offset, depth);
+        if (!holder) {
+            self->m_Metrics.misses += 1;
+            return StatusCode::NotFound;
         }
-        Handle current = object->prototype;
-        std::size_t depth = 0;
-        while (current != 0 && depth < m_Slots.size() + 1) {
-            const auto *proto = Find(current);
-            if (!proto) {
-                break;
-            }
-            bucket = 0;
-            collision = false;
-            index = Locate(*proto, key, hash, bucket, collision);
-            if (index != kInvalidIndex) {
-                outValue = proto->properties[index].value;
-                const_cast<ObjectModule *>(this)->m_Metrics.prototypeHits += 1;
-                const_cast<ObjectModule *>(this)->TouchMetrics();
-                return StatusCode::Ok;
-            }
-            if (proto->prototype == current) {
-                break;
-            }
-            current = proto->prototype;
-            ++depth;
+        outValue = holder->values[offset];
+        if (depth == 0) {
+            self->m_Metrics.fastPathHits += 1;
+        } else {
+            self->m_Metrics.prototypeHits += 1;
         }
-        const_cast<ObjectModule *>(this)->m_Metrics.misses += 1;
-        return StatusCode::NotFound;
+        self->TouchMetrics();
+        return StatusCode::Ok;
     }
 
     StatusCode ObjectModule::Describe(Handle handle, std::string_view key, PropertyDescriptor &outDescriptor) const {
@@ -337,34 +421,37 @@ namespace spectre::es2025 {
         if (!object) {
             return StatusCode::NotFound;
         }
-        auto hash = HashKey(key);
-        std::uint32_t bucket = 0;
-        bool collision = false;
-        auto index = Locate(*object, key, hash, bucket, collision);
-        if (index == kInvalidIndex) {
+        auto name = LookupName(key);
+        const auto &layout = LayoutOf(*object);
+        auto offset = name == kInvalidIndex ? kInvalidIndex : FindOffset(layout, name);
+        if (offset == kInvalidIndex) {
             const_cast<ObjectModule *>(this)->m_Metrics.misses += 1;
             return StatusCode::NotFound;
         }
-        const auto &slot = object->properties[index];
-        if (!slot.active) {
-            const_cast<ObjectModule *>(this)->m_Metrics.misses += 1;
-            return StatusCode::NotFound;
-        }
-        outDescriptor.value = slot.value;
-        outDescriptor.enumerable = IsEnumerable(slot.attributes);
-        outDescriptor.configurable = IsConfigurable(slot.attributes);
-        outDescriptor.writable = IsWritable(slot.attributes);
+        auto attributes = layout.Properties()[offset].attributes;
+        outDescriptor.value = object->values[offset];
+        outDescriptor.enumerable = IsEnumerable(attributes);
+        outDescriptor.configurable = IsConfigurable(attributes);
+        outDescriptor.writable = IsWritable(attributes);
         const_cast<ObjectModule *>(this)->m_Metrics.fastPathHits += 1;
         const_cast<ObjectModule *>(this)->TouchMetrics();
         return StatusCode::Ok;
     }
 
     bool ObjectModule::Has(Handle handle, std::string_view key) const {
+        return Has(handle, LookupName(key));
+    }
+
+    bool ObjectModule::Has(Handle handle, Atom key) const {
         Value value;
         return Get(handle, key, value) == StatusCode::Ok;
     }
 
     StatusCode ObjectModule::Delete(Handle handle, std::string_view key, bool &outDeleted) {
+        return Delete(handle, LookupName(key), outDeleted);
+    }
+
+    StatusCode ObjectModule::Delete(Handle handle, Atom key, bool &outDeleted) {
         auto *object = FindMutable(handle);
         if (!object) {
             outDeleted = false;
@@ -379,20 +466,93 @@ namespace spectre::es2025 {
         if (!object) {
             return StatusCode::NotFound;
         }
-        keys.reserve(object->activeProperties);
-        for (const auto &slot : object->properties) {
-            if (!slot.active) {
+        auto properties = LayoutOf(*object).Properties();
+        keys.reserve(properties.size());
+        for (const auto &property : properties) {
+            if (!IsEnumerable(property.attributes)) {
                 continue;
             }
-            if (!IsEnumerable(slot.attributes)) {
-                continue;
-            }
-            keys.push_back(slot.key);
+            keys.emplace_back(NameOf(property.name));
         }
         const_cast<ObjectModule *>(this)->TouchMetrics();
         return StatusCode::Ok;
     }
 
+    StatusCode ObjectModule::LookupCached(Handle handle, std::string_view key, CacheSlot &cache,
+                                          Value &outValue) const {
+        const auto *object = Find(handle);
+        if (!object) {
+            outValue.Reset();
+            return StatusCode::NotFound;
+        }
+        auto *self = const_cast<ObjectModule *>(this);
+        if (cache.name != kInvalidIndex && NameOf(cache.name) == key) {
+            for (std::uint32_t i = 0; i < cache.count; ++i) {
+                const auto &entry = cache.entries[i];
+                if (entry.shape != object->shape) {
+                    continue;
+                }
+                if (entry.holderShape == kInvalidIndex) {
+                    outValue = object->values[entry.offset];
+                    self->m_Metrics.inlineCacheHits += 1;
+                    return StatusCode::Ok;
+                }
+                if (object->prototype == entry.prototype) {
+                    const auto *holder = Find(entry.prototype);
+                    if (holder && holder->shape == entry.holderShape) {
+                        outValue = holder->values[entry.offset];
+                        self->m_Metrics.inlineCacheHits += 1;
+                        return StatusCode::Ok;
+                    }
+                }
+            }
+        }
+        self->m_Metrics.inlineCacheMisses += 1;
+        auto name = LookupName(key);
+        std::uint32_t offset = 0;
+        std::uint32_t depth = 0;
+        const auto *holder = Resolve(*object, name, offset, depth);
+        if (!holder) {
+            outValue.Reset();
+            self->m_Metrics.misses += 1;
+            return StatusCode::NotFound;
+        }
+        outValue = holder->values[offset];
+        Remember(cache, name, *object, *holder, offset, depth);
+        return StatusCode::Ok;
+    }
+
+    StatusCode ObjectModule::StoreCached(Handle handle, std::string_view key, CacheSlot &cache, const Value &value) {
+        auto *object = FindMutable(handle);
+        if (!object) {
+            return StatusCode::NotFound;
+        }
+        if (cache.name != kInvalidIndex && NameOf(cache.name) == key) {
+            for (std::uint32_t i = 0; i < cache.count; ++i) {
+                const auto &entry = cache.entries[i];
+                if (entry.shape == object->shape && entry.holderShape == kInvalidIndex && entry.writable) {
+                    object->values[entry.offset] = value;
+                    Touch(*object);
+                    m_Metrics.propertyUpdates += 1;
+                    m_Metrics.inlineCacheHits += 1;
+                    return StatusCode::Ok;
+                }
+            }
+        }
+        m_Metrics.inlineCacheMisses += 1;
+        auto name = InternName(key);
+        bool allowNew = object->extensible && !object->sealed && !object->frozen;
+        auto status = UpdateValue(*object, name, value, allowNew);
+        if (status == StatusCode::Ok) {
+            auto offset = FindOffset(LayoutOf(*object), name);
+            if (offset != kInvalidIndex) {
+                Remember(cache, name, *object, *object, offset, 0);
+            }
+        }
+        ReleaseName(name);
+        return status;
+    }
+
     StatusCode ObjectModule::SetPrototype(Handle handle, Handle prototype) {
         auto *object = FindMutable(handle);
         if (!object) {
@@ -455,12 +615,11 @@ namespace spectre::es2025 {
         }
         object->extensible = false;
         object->sealed = true;
-        for (auto &slot : object->properties) {
-            if (!slot.active) {
-                continue;
-            }
-            slot.attributes &= static_cast<std::uint8_t>(~kAttrConfigurable);
+        auto properties = LayoutOf(*object).CopyProperties();
+        for (auto &property : properties) {
+            property.attributes &= static_cast<std::uint8_t>(~kAttrConfigurable);
         }
+        Relayout(*object, properties);
         Touch(*object);
         m_Metrics.seals += 1;
         return StatusCode::Ok;
@@ -477,13 +636,12 @@ namespace spectre::es2025 {
         object->extensible = false;
         object->sealed = true;
         object->frozen = true;
-        for (auto &slot : object->properties) {
-            if (!slot.active) {
-                continue;
-            }
-            slot.attributes &= static_cast<std::uint8_t>(~kAttrConfigurable);
-            slot.attributes &= static_cast<std::uint8_t>(~kAttrWritable);
+        auto properties = LayoutOf(*object).CopyProperties();
+        for (auto &property : properties) {
+            property.attributes &= static_cast<std::uint8_t>(~kAttrConfigurable);
+            property.attributes &= static_cast<std::uint8_t>(~kAttrWritable);
         }
+        Relayout(*object, properties);
         Touch(*object);
         m_Metrics.freezes += 1;
         return StatusCode::Ok;
@@ -552,62 +710,243 @@ namespace spectre::es2025 {
         return slot ? &slot->record : nullptr;
     }
 
-    std::uint64_t ObjectModule::HashKey(std::string_view key) noexcept {
-        const std::uint64_t fnvOffset = 1469598103934665603ull;
-        const std::uint64_t fnvPrime = 1099511628211ull;
-        std::uint64_t hash = fnvOffset;
-        for (unsigned char c : key) {
-            hash ^= static_cast<std::uint64_t>(c);
-            hash *= fnvPrime;
+    std::uint32_t ObjectModule::LookupName(std::string_view key) const noexcept {
+        return m_Strings ? m_Strings->FindAtom(key) : kInvalidIndex;
+    }
+
+    // The returned name carries a reference for the caller; layouts that keep the name take
+    // their own (shared shapes for good, dictionaries until the property leaves), so dynamic
+    // keys that only ever land in dictionaries are collected once those objects let go.
+    std::uint32_t ObjectModule::InternName(std::string_view key) {
+        Atom atom = kInvalidIndex;
+        if (!m_Strings || m_Strings->AcquireAtom(key, atom) != StatusCode::Ok) {
+            return kInvalidIndex;
+        }
+        return atom;
+    }
+
+    void ObjectModule::ReleaseName(std::uint32_t name) {
+        if (m_Strings && name != kInvalidIndex) {
+            m_Strings->ReleaseAtom(name);
+        }
+    }
+
+    void ObjectModule::RetainNames(std::span<const ShapeProperty> properties) noexcept {
+        if (!m_Strings) {
+            return;
+        }
+        for (const auto &property : properties) {
+            m_Strings->RetainAtom(property.name);
+        }
+    }
+
+    void ObjectModule::ReleaseNames(std::span<const ShapeProperty> properties) {
+        if (!m_Strings) {
+            return;
+        }
+        for (const auto &property : properties) {
+            m_Strings->ReleaseAtom(property.name);
+        }
+    }
+
+    std::string_view ObjectModule::NameOf(std::uint32_t name) const noexcept {
+        return m_Strings ? m_Strings->AtomView(name) : std::string_view();
+    }
+
+    const ObjectModule::Shape &ObjectModule::LayoutOf(const ObjectRecord &object) const noexcept {
+        return object.dictionary ? *object.dictionary : m_Shapes[object.shape];
+    }
+
+    std::uint32_t ObjectModule::FindOffset(const Shape &shape, std::uint32_t name) const {
+        if (name == kInvalidIndex) {
+            return kInvalidIndex;
+        }
+        auto properties = shape.Properties();
+        if (properties.size() > kLinearLookupLimit) {
+            if (shape.index.size() < properties.size() && ++shape.scans > kIndexAfterScans) {
+                // Only shared shapes get here; dictionary layouts keep their index current.
+                auto before = ShapeBytes(shape);
+                IndexShape(shape);
+                m_Memory.Resize(before, ShapeBytes(shape));
+            }
+            if (shape.index.size() == properties.size()) {
+                auto it = shape.index.find(name);
+                return it == shape.index.end() ? kInvalidIndex : it->second;
+            }
+        }
+        for (std::uint32_t i = 0; i < properties.size(); ++i) {
+            if (properties[i].name == name) {
+                return i;
+            }
+        }
+        return kInvalidIndex;
+    }
+
+    // Extends the index over properties added since it was last built. Layouts only ever grow
+    // at the end or are replaced whole (RebuildIndex), so the indexed prefix is always valid.
+    void ObjectModule::IndexShape(const Shape &shape) const {
+        auto properties = shape.Properties();
+        shape.index.reserve(properties.size());
+        for (auto i = static_cast<std::uint32_t>(shape.index.size()); i < properties.size(); ++i) {
+            shape.index.emplace(properties[i].name, i);
+        }
+        m_Metrics.rehashes += 1;
+    }
+
+    void ObjectModule::RebuildIndex(Shape &shape) {
+        shape.index.clear();
+        if (shape.length > kLinearLookupLimit) {
+            IndexShape(shape);
         }
-        if (hash == 0) {
-            hash = fnvOffset;
+    }
+
+    void ObjectModule::AssignDictionary(Shape &dictionary, std::span<const ShapeProperty> properties) {
+        dictionary.descriptors = std::make_shared<std::vector<ShapeProperty>>(properties.begin(), properties.end());
+        dictionary.length = static_cast<std::uint32_t>(properties.size());
+        dictionary.ownsDescriptors = true;
+        RebuildIndex(dictionary);
+    }
+
+    std::uint32_t ObjectModule::Transition(std::uint32_t parent, std::uint32_t name, std::uint8_t attributes) {
+        for (const auto &edge : m_Shapes[parent].transitions) {
+            if (edge.name == name && edge.attributes == attributes) {
+                return edge.child;
+            }
+        }
+        Shape child;
+        child.parent = parent;
+        const auto &from = m_Shapes[parent];
+        if (from.descriptors->size() == from.length) {
+            // The parent's view ends at the array tail, so the child extends it in place.
+            auto &descriptors = *from.descriptors;
+            auto before = memory::VectorBytes(descriptors);
+            descriptors.push_back({name, attributes});
+            m_Memory.Resize(before, memory::VectorBytes(descriptors));
+            child.descriptors = from.descriptors;
+            child.ownsDescriptors = false;
+        } else {
+            auto prefix = from.Properties();
+            child.descriptors->reserve(prefix.size() + 1);
+            child.descriptors->assign(prefix.begin(), prefix.end());
+            child.descriptors->push_back({name, attributes});
+        }
+        child.length = from.length + 1;
+        if (m_Strings) {
+            m_Strings->RetainAtom(name);
+        }
+        m_Memory.Allocate(ShapeBytes(child));
+        auto id = static_cast<std::uint32_t>(m_Shapes.size());
+        m_Shapes.push_back(std::move(child));
+        auto parentBytes = ShapeBytes(m_Shapes[parent]);
+        m_Shapes[parent].transitions.push_back({name, attributes, id});
+        m_Memory.Resize(parentBytes, ShapeBytes(m_Shapes[parent]));
+        TrackSlots();
+        m_Metrics.shapes = m_Shapes.size();
+        m_Metrics.shapeTransitions += 1;
+        return id;
+    }
+
+    void ObjectModule::Relayout(ObjectRecord &object, const std::vector<ShapeProperty> &properties) {
+        if (object.dictionary || properties.size() > kMaxSharedProperties) {
+            if (!object.dictionary) {
+                ConvertToDictionary(object);
+            }
+            auto previous = object.dictionary->descriptors;
+            auto previousLength = object.dictionary->length;
+            AssignDictionary(*object.dictionary, properties);
+            RetainNames(object.dictionary->Properties());
+            ReleaseNames({previous->data(), previousLength});
+            return;
         }
-        return hash;
+        auto shape = kRootShape;
+        for (const auto &property : properties) {
+            shape = Transition(shape, property.name, property.attributes);
+        }
+        object.shape = shape;
+    }
+
+    void ObjectModule::ConvertToDictionary(ObjectRecord &object) {
+        object.dictionary = std::make_unique<Shape>();
+        AssignDictionary(*object.dictionary, m_Shapes[object.shape].Properties());
+        RetainNames(object.dictionary->Properties());
+        object.shape = kDictionaryShape;
+        m_Metrics.dictionaryObjects += 1;
     }
 
-    std::uint32_t ObjectModule::NormalizeBuckets(std::uint32_t requested) noexcept {
-        if (requested < kInitialBucketCount) {
-            requested = kInitialBucketCount;
+    const ObjectModule::ObjectRecord *ObjectModule::Resolve(const ObjectRecord &object, std::uint32_t name,
+                                                            std::uint32_t &outOffset, std::uint32_t &outDepth) const {
+        outOffset = kInvalidIndex;
+        outDepth = 0;
+        if (name == kInvalidIndex) {
+            return nullptr;
         }
-        if ((requested & (requested - 1)) != 0) {
-            std::uint32_t power = 1;
-            while (power < requested && power < (1u << 30)) {
-                power <<= 1;
+        const auto *current = &object;
+        std::size_t depth = 0;
+        while (current && depth < m_Slots.size() + 1) {
+            auto offset = FindOffset(LayoutOf(*current), name);
+            if (offset != kInvalidIndex) {
+                outOffset = offset;
+                outDepth = static_cast<std::uint32_t>(depth);
+                return current;
+            }
+            if (current->prototype == 0 || current->prototype == current->handle) {
+                break;
             }
-            requested = power;
+            current = Find(current->prototype);
+            ++depth;
+        }
+        return nullptr;
+    }
+
+    void ObjectModule::Remember(CacheSlot &cache, std::uint32_t name, const ObjectRecord &receiver,
+                                const ObjectRecord &holder, std::uint32_t offset, std::uint32_t depth) const {
+        // Dictionary layouts change in place and deeper prototype hits would need every link
+        // revalidated, so both stay on the slow path.
+        if (receiver.dictionary || holder.dictionary || depth > 1) {
+            return;
         }
-        return requested < kInitialBucketCount ? kInitialBucketCount : requested;
+        if (cache.name != name) {
+            cache.Reset();
+            cache.name = name;
+        }
+        if (cache.count == CacheSlot::kWays) {
+            cache.megamorphic = true;
+            return;
+        }
+        auto &entry = cache.entries[cache.count++];
+        entry.shape = receiver.shape;
+        entry.offset = offset;
+        entry.holderShape = depth == 0 ? kInvalidIndex : holder.shape;
+        entry.prototype = depth == 0 ? 0 : holder.handle;
+        entry.writable = depth == 0 && IsWritable(LayoutOf(holder).Properties()[offset].attributes);
     }
 
-    StatusCode ObjectModule::InsertOrUpdate(ObjectRecord &object, std::string_view key, const PropertyDescriptor &descriptor, bool allowNew) {
-        EnsureCapacity(object);
-        auto hash = HashKey(key);
-        std::uint32_t bucket = 0;
-        bool collision = false;
-        auto index = Locate(object, key, hash, bucket, collision);
-        if (index != kInvalidIndex) {
-            auto &slot = object.properties[index];
+    StatusCode ObjectModule::InsertOrUpdate(ObjectRecord &object, std::uint32_t name, const PropertyDescriptor &descriptor, bool allowNew) {
+        auto offset = FindOffset(LayoutOf(object), name);
+        if (offset != kInvalidIndex) {
+            auto attributes = LayoutOf(object).Properties()[offset].attributes;
             if (object.frozen) {
                 return StatusCode::InvalidArgument;
             }
-            if (!IsWritable(slot.attributes) && !slot.value.SameValueZero(descriptor.value)) {
+            if (!IsWritable(attributes) && !object.values[offset].SameValueZero(descriptor.value)) {
                 return StatusCode::InvalidArgument;
             }
-            if (!IsConfigurable(slot.attributes)) {
-                if (IsEnumerable(slot.attributes) != descriptor.enumerable) {
+            if (!IsConfigurable(attributes)) {
+                if (IsEnumerable(attributes) != descriptor.enumerable) {
                     return StatusCode::InvalidArgument;
                 }
-                if (IsWritable(slot.attributes) != descriptor.writable) {
+                if (IsWritable(attributes) != descriptor.writable) {
                     return StatusCode::InvalidArgument;
                 }
             }
-            slot.value = descriptor.value;
-            slot.attributes = EncodeAttributes(descriptor.enumerable, descriptor.configurable, descriptor.writable);
-            Touch(object);
-            if (collision) {
-                m_Metrics.collisions += 1;
+            object.values[offset] = descriptor.value;
+            auto encoded = EncodeAttributes(descriptor.enumerable, descriptor.configurable, descriptor.writable);
+            if (encoded != attributes) {
+                auto properties = LayoutOf(object).CopyProperties();
+                properties[offset].attributes = encoded;
+                Relayout(object, properties);
             }
+            Touch(object);
             m_Metrics.propertyUpdates += 1;
             return StatusCode::Ok;
         }
@@ -617,188 +956,80 @@ namespace spectre::es2025 {
         if (!object.extensible || !allowNew) {
             return StatusCode::InvalidArgument;
         }
-        auto propertyIndex = AllocateProperty(object);
-        auto &slot = object.properties[propertyIndex];
-        slot.hash = hash;
-        slot.key.assign(key.begin(), key.end());
-        slot.value = descriptor.value;
-        slot.attributes = EncodeAttributes(descriptor.enumerable, descriptor.configurable, descriptor.writable);
-        slot.active = true;
-        object.buckets[bucket] = propertyIndex;
-        object.activeProperties += 1;
-        Touch(object);
-        if (collision) {
-            m_Metrics.collisions += 1;
-        }
-        m_Metrics.propertyAdds += 1;
-        return StatusCode::Ok;
+        return AddProperty(object, name,
+                           EncodeAttributes(descriptor.enumerable, descriptor.configurable, descriptor.writable),
+                           descriptor.value);
     }
 
-    StatusCode ObjectModule::UpdateValue(ObjectRecord &object, std::string_view key, const Value &value, bool allowNew) {
-        EnsureCapacity(object);
-        auto hash = HashKey(key);
-        std::uint32_t bucket = 0;
-        bool collision = false;
-        auto index = Locate(object, key, hash, bucket, collision);
-        if (index != kInvalidIndex) {
-            auto &slot = object.properties[index];
+    StatusCode ObjectModule::UpdateValue(ObjectRecord &object, std::uint32_t name, const Value &value, bool allowNew) {
+        auto offset = FindOffset(LayoutOf(object), name);
+        if (offset != kInvalidIndex) {
             if (object.frozen) {
                 return StatusCode::InvalidArgument;
             }
-            if (!IsWritable(slot.attributes) && !slot.value.SameValueZero(value)) {
+            if (!IsWritable(LayoutOf(object).Properties()[offset].attributes)
+                && !object.values[offset].SameValueZero(value)) {
                 return StatusCode::InvalidArgument;
             }
-            slot.value = value;
+            object.values[offset] = value;
             Touch(object);
-            if (collision) {
-                m_Metrics.collisions += 1;
-            }
             m_Metrics.propertyUpdates += 1;
             return StatusCode::Ok;
         }
         if (!allowNew || object.sealed || object.frozen || !object.extensible) {
             return StatusCode::InvalidArgument;
         }
-        PropertyDescriptor descriptor;
-        descriptor.value = value;
-        descriptor.enumerable = true;
-        descriptor.configurable = true;
-        descriptor.writable = true;
-        return InsertOrUpdate(object, key, descriptor, true);
+        return AddProperty(object, name, kAttrDefault, value);
     }
 
-    StatusCode ObjectModule::RemoveProperty(ObjectRecord &object, std::string_view key, bool &outDeleted) {
-        outDeleted = false;
-        if (object.buckets.empty()) {
-            return StatusCode::Ok;
-        }
-        auto hash = HashKey(key);
-        std::uint32_t bucket = 0;
-        bool collision = false;
-        auto index = Locate(object, key, hash, bucket, collision);
-        if (index == kInvalidIndex) {
-            return StatusCode::Ok;
-        }
-        auto &slot = object.properties[index];
-        if (!IsConfigurable(slot.attributes) || object.frozen) {
+    StatusCode ObjectModule::AddProperty(ObjectRecord &object, std::uint32_t name, std::uint8_t attributes,
+                                         const Value &value) {
+        if (!m_Strings || !m_Strings->IsAtom(name)) {
             return StatusCode::InvalidArgument;
         }
-        object.buckets[bucket] = kDeletedIndex;
-        slot.active = false;
-        slot.hash = 0;
-        slot.key.clear();
-        slot.value.Reset();
-        slot.attributes = 0;
-        object.freeProperties.push_back(index);
-        if (object.activeProperties > 0) {
-            object.activeProperties -= 1;
-        }
-        outDeleted = true;
-        Touch(object);
-        if (collision) {
-            m_Metrics.collisions += 1;
-        }
-        m_Metrics.propertyRemovals += 1;
-        return StatusCode::Ok;
-    }
-
-    std::uint32_t ObjectModule::Locate(const ObjectRecord &object, std::string_view key, std::uint64_t hash, std::uint32_t &bucket, bool &collision) const {
-        if (object.buckets.empty()) {
-            bucket = 0;
-            collision = false;
-            return kInvalidIndex;
+        if (!object.dictionary && m_Shapes[object.shape].length >= kMaxSharedProperties) {
+            ConvertToDictionary(object);
         }
-        auto mask = static_cast<std::uint32_t>(object.buckets.size() - 1);
-        auto index = static_cast<std::uint32_t>(hash) & mask;
-        std::uint32_t firstDeleted = kInvalidIndex;
-        std::uint32_t probes = 0;
-        collision = false;
-        while (true) {
-            auto entry = object.buckets[index];
-            if (entry == kInvalidIndex) {
-                bucket = firstDeleted != kInvalidIndex ? firstDeleted : index;
-                collision = probes != 0;
-                return kInvalidIndex;
-            }
-            if (entry == kDeletedIndex) {
-                if (firstDeleted == kInvalidIndex) {
-                    firstDeleted = index;
-                }
-            } else {
-                const auto &slot = object.properties[entry];
-                if (slot.active && slot.hash == hash && slot.key == key) {
-                    bucket = index;
-                    collision = probes != 0;
-                    return entry;
-                }
-            }
-            index = (index + 1) & mask;
-            ++probes;
-            if (probes >= object.buckets.size()) {
-                bucket = firstDeleted != kInvalidIndex ? firstDeleted : index;
-                collision = true;
-                return kInvalidIndex;
+        if (object.dictionary) {
+            auto &dictionary = *object.dictionary;
+            dictionary.descriptors->push_back({name, attributes});
+            dictionary.length += 1;
+            m_Strings->RetainAtom(name);
+            if (dictionary.length > kLinearLookupLimit) {
+                IndexShape(dictionary);
             }
+        } else {
+            object.shape = Transition(object.shape, name, attributes);
         }
+        object.values.push_back(value);
+        Touch(object);
+        m_Metrics.propertyAdds += 1;
+        return StatusCode::Ok;
     }
 
-    std::uint32_t ObjectModule::AllocateProperty(ObjectRecord &object) {
-        if (!object.freeProperties.empty()) {
-            auto index = object.freeProperties.back();
-            object.freeProperties.pop_back();
-            auto &slot = object.properties[index];
-            slot.active = true;
-            slot.hash = 0;
-            slot.key.clear();
-            slot.value.Reset();
-            slot.attributes = 0;
-            return index;
-        }
-        PropertySlot slot;
-        slot.active = true;
-        object.properties.push_back(slot);
-        return static_cast<std::uint32_t>(object.properties.size() - 1);
-    }
-    void ObjectModule::EnsureCapacity(ObjectRecord &object) {
-        if (object.buckets.empty()) {
-            Rehash(object, kInitialBucketCount);
-            return;
-        }
-        auto capacity = static_cast<std::uint32_t>(object.buckets.size());
-        auto limit = (capacity * 3u) / 5u;
-        if (limit < 1) {
-            limit = 1;
-        }
-        if (object.activeProperties + 1 > limit) {
-            Rehash(object, capacity * 2);
+    StatusCode ObjectModule::RemoveProperty(ObjectRecord &object, std::uint32_t name, bool &outDeleted) {
+        outDeleted = false;
+        auto offset = FindOffset(LayoutOf(object), name);
+        if (offset == kInvalidIndex) {
+            return StatusCode::Ok;
         }
-    }
-
-    void ObjectModule::Rehash(ObjectRecord &object, std::uint32_t newBucketCount) {
-        auto normalized = NormalizeBuckets(newBucketCount);
-        std::vector<std::uint32_t> buckets(normalized, kInvalidIndex);
-        auto mask = normalized - 1;
-        for (std::uint32_t index = 0; index < object.properties.size(); ++index) {
-            auto &slot = object.properties[index];
-            if (!slot.active) {
-                continue;
-            }
-            auto bucket = static_cast<std::uint32_t>(slot.hash) & mask;
-            while (true) {
-                if (buckets[bucket] == kInvalidIndex) {
-                    buckets[bucket] = index;
-                    break;
-                }
-                bucket = (bucket + 1) & mask;
-            }
+        if (!IsConfigurable(LayoutOf(object).Properties()[offset].attributes) || object.frozen) {
+            return StatusCode::InvalidArgument;
         }
-        object.buckets.swap(buckets);
-        m_Metrics.rehashes += 1;
+        auto properties = LayoutOf(object).CopyProperties();
+        properties.erase(properties.begin() + offset);
+        object.values.erase(object.values.begin() + offset);
+        Relayout(object, properties);
+        outDeleted = true;
+        Touch(object);
+        m_Metrics.propertyRemovals += 1;
+        return StatusCode::Ok;
     }
 
     void ObjectModule::Touch(ObjectRecord &object) noexcept {
         object.version += 1;
         object.lastTouchFrame = m_CurrentFrame;
+        Track(object);
         TouchMetrics();
     }
 
@@ -806,6 +1037,30 @@ namespace spectre::es2025 {
         m_Metrics.lastFrameTouched = m_CurrentFrame;
     }
 
+    // O(1) retake of the object's own storage: label, value array and any dictionary layout.
+    void ObjectModule::Track(ObjectRecord &object) noexcept {
+        auto bytes = memory::StringBytes(object.label) + memory::VectorBytes(object.values);
+        if (object.dictionary) {
+            bytes += sizeof(Shape) + ShapeBytes(*object.dictionary);
+        }
+        m_Memory.Resize(object.trackedBytes, bytes);
+        object.trackedBytes = bytes;
+    }
+
+    // Shared shapes are counted as they are created in Transition; this covers the tables.
+    void ObjectModule::TrackSlots() noexcept {
+        auto bytes = memory::VectorBytes(m_Slots) + memory::VectorBytes(m_FreeList) + memory::VectorBytes(m_Shapes);
+        m_Memory.Resize(m_SlotTableBytes, bytes);
+        m_SlotTableBytes = bytes;
+    }
+
+    std::uint64_t ObjectModule::ShapeBytes(const Shape &shape) noexcept {
+        auto descriptorBytes = shape.ownsDescriptors ? memory::VectorBytes(*shape.descriptors) : 0;
+        return descriptorBytes + memory::VectorBytes(shape.transitions)
+               + static_cast<std::uint64_t>(shape.index.size())
+                 * (sizeof(std::pair<const std::uint32_t, std::uint32_t>) + 2 * sizeof(void *));
+    }
+
     ObjectModule::Handle ObjectModule::EncodeHandle(std::uint32_t slot, std::uint32_t generation) noexcept {
         return (static_cast<Handle>(generation) << 32) | static_cast<Handle>(slot);
     }
@@ -818,6 +1073,3 @@ namespace spectre::es2025 {
         return static_cast<std::uint32_t>((handle >> 32) & 0xffffffffull);
     }
 }
-
-
-
@@ -147,6 +147,40 @@ namespace spectre::es2025 {
         m_GpuEnabled = config.enableGpuAcceleration;
     }
 
+    void PromiseModule::CollectMemory(ModuleMemoryUsage &usage) const noexcept {
+        memory::Begin(usage);
+        memory::AddSlotTable(usage, m_Promises.size(), m_FreePromises.size(), sizeof(PromiseSlot),
+                             memory::VectorBytes(m_Promises) + memory::VectorBytes(m_FreePromises));
+        memory::AddSlotTable(usage, m_Reactions.size(), m_FreeReactions.size(), sizeof(ReactionSlot),
+                             memory::VectorBytes(m_Reactions) + memory::VectorBytes(m_FreeReactions));
+        auto bytes = memory::VectorBytes(m_Settled) + memory::VectorBytes(m_MicrotaskQueue);
+        for (const auto &slot: m_Promises) {
+            if (slot.record.handle == kInvalidHandle) {
+                continue;
+            }
+            bytes += slot.record.value.HeapBytes() + memory::StringBytes(slot.record.diagnostics);
+        }
+        for (const auto &slot: m_Reactions) {
+            if (!slot.inUse) {
+                continue;
+            }
+            bytes += slot.record.sourceValue.HeapBytes() + memory::StringBytes(slot.record.sourceDiagnostics);
+        }
+        for (const auto &settled: m_Settled) {
+            bytes += settled.value.HeapBytes() + memory::StringBytes(settled.diagnostics);
+        }
+        usage.reservedBytes += bytes;
+        usage.liveBytes += bytes;
+    }
+
+    void PromiseModule::SampleMemory(ModuleMemoryCounters &counters) const noexcept {
+        m_Memory.Observe(memory::VectorBytes(m_Promises) + memory::VectorBytes(m_FreePromises) +
+                         memory::VectorBytes(m_Reactions) + memory::VectorBytes(m_FreeReactions) +
+                         memory::VectorBytes(m_Settled) + memory::VectorBytes(m_MicrotaskQueue));
+        memory::Sample(counters, m_Memory.Totals(), m_Promises.size() + m_Reactions.size(),
+                       m_FreePromises.size() + m_FreeReactions.size());
+    }
+
     StatusCode PromiseModule::Configure(std::size_t promiseCapacity, std::size_t reactionCapacity) {
         if (promiseCapacity == 0) {
             promiseCapacity = kDefaultPromiseCapacity;
@@ -46,6 +46,7 @@ namespace spectre::es2025 {
           m_Subsystems(nullptr),
           m_Config{},
           m_ObjectModule(nullptr),
+          m_Strings(nullptr),
           m_GpuEnabled(false),
           m_Initialized(false),
           m_CurrentFrame(0),
@@ -80,6 +81,7 @@ namespace spectre::es2025 {
         auto &environment = context.runtime.EsEnvironment();
         auto *module = environment.FindModule("Object");
         m_ObjectModule = dynamic_cast<ObjectModule *>(module);
+        m_Strings = dynamic_cast<StringModule *>(environment.FindModule("String"));
     }
 
     void ProxyModule::Tick(const TickInfo &info, const ModuleTickContext &) noexcept {
@@ -97,6 +99,17 @@ namespace spectre::es2025 {
         m_GpuEnabled = config.enableGpuAcceleration;
         m_Metrics.gpuOptimized = m_GpuEnabled;
     }
+
+    void ProxyModule::CollectMemory(ModuleMemoryUsage &usage) const noexcept {
+        memory::Begin(usage);
+        memory::AddSlotTable(usage, m_Slots.size(), m_FreeList.size(), sizeof(SlotRecord),
+                             memory::VectorBytes(m_Slots) + memory::VectorBytes(m_FreeList));
+    }
+
+    void ProxyModule::SampleMemory(ModuleMemoryCounters &counters) const noexcept {
+        m_Memory.Observe(memory::VectorBytes(m_Slots) + memory::VectorBytes(m_FreeList));
+        memory::Sample(counters, m_Memory.Totals(), m_Slots.size(), m_FreeList.size());
+    }
     StatusCode ProxyModule::Create(ObjectModule::Handle target, const TrapTable &traps, Handle &outHandle) {
         outHandle = 0;
         if (!m_ObjectModule) {
@@ -169,7 +182,40 @@ namespace spectre::es2025 {
         m_Metrics.revocations += 1;
         return StatusCode::Ok;
     }
+
     StatusCode ProxyModule::Get(Handle handle, std::string_view key, Value &outValue) {
+        return GetProperty(handle, PropertyKey{key, StringModule::kInvalidAtom, false}, outValue);
+    }
+
+    StatusCode ProxyModule::Get(Handle handle, ObjectModule::Atom key, Value &outValue) {
+        return GetProperty(handle, PropertyKey{{}, key, true}, outValue);
+    }
+
+    StatusCode ProxyModule::Set(Handle handle, std::string_view key, const Value &value) {
+        return SetProperty(handle, PropertyKey{key, StringModule::kInvalidAtom, false}, value);
+    }
+
+    StatusCode ProxyModule::Set(Handle handle, ObjectModule::Atom key, const Value &value) {
+        return SetProperty(handle, PropertyKey{{}, key, true}, value);
+    }
+
+    StatusCode ProxyModule::Has(Handle handle, std::string_view key, bool &outHas) {
+        return HasProperty(handle, PropertyKey{key, StringModule::kInvalidAtom, false}, outHas);
+    }
+
+    StatusCode ProxyModule::Has(Handle handle, ObjectModule::Atom key, bool &outHas) {
+        return HasProperty(handle, PropertyKey{{}, key, true}, outHas);
+    }
+
+    StatusCode ProxyModule::Delete(Handle handle, std::string_view key, bool &outDeleted) {
+        return DeleteProperty(handle, PropertyKey{key, StringModule::kInvalidAtom, false}, outDeleted);
+    }
+
+    StatusCode ProxyModule::Delete(Handle handle, ObjectModule::Atom key, bool &outDeleted) {
+        return DeleteProperty(handle, PropertyKey{{}, key, true}, outDeleted);
+    }
+
+    StatusCode ProxyModule::GetProperty(Handle handle, const PropertyKey &key, Value &outValue) {
         outValue.Reset();
         auto *record = FindMutable(handle);
         if (!record) {
@@ -185,7 +231,9 @@ namespace spectre::es2025 {
         }
         Touch(*record);
         if (record->traps.get) {
-            status = record->traps.get(*m_ObjectModule, record->target, key, outValue, record->traps.userdata);
+            std::string scratch;
+            status = record->traps.get(*m_ObjectModule, record->target, TrapKey(key, scratch), outValue,
+                                       record->traps.userdata);
             if (status == StatusCode::Ok) {
                 m_Metrics.trapHits += 1;
             } else if (status == StatusCode::NotFound) {
@@ -193,7 +241,8 @@ namespace spectre::es2025 {
             }
             return status;
         }
-        status = m_ObjectModule->Get(record->target, key, outValue);
+        status = key.byAtom ? m_ObjectModule->Get(record->target, key.atom, outValue)
+                            : m_ObjectModule->Get(record->target, key.text, outValue);
         if (status == StatusCode::Ok) {
             m_Metrics.fallbackHits += 1;
         } else if (status == StatusCode::NotFound) {
@@ -202,7 +251,7 @@ namespace spectre::es2025 {
         return status;
     }
 
-    StatusCode ProxyModule::Set(Handle handle, std::string_view key, const Value &value) {
+    StatusCode ProxyModule::SetProperty(Handle handle, const PropertyKey &key, const Value &value) {
         auto *record = FindMutable(handle);
         if (!record) {
             return StatusCode::NotFound;
@@ -217,7 +266,9 @@ namespace spectre::es2025 {
         }
         Touch(*record);
         if (record->traps.set) {
-            status = record->traps.set(*m_ObjectModule, record->target, key, value, record->traps.userdata);
+            std::string scratch;
+            status = record->traps.set(*m_ObjectModule, record->target, TrapKey(key, scratch), value,
+                                       record->traps.userdata);
             if (status == StatusCode::Ok) {
                 m_Metrics.trapHits += 1;
             } else if (status == StatusCode::NotFound) {
@@ -225,7 +276,8 @@ namespace spectre::es2025 {
             }
             return status;
         }
-        status = m_ObjectModule->Set(record->target, key, value);
+        status = key.byAtom ? m_ObjectModule->Set(record->target, key.atom, value)
+                            : m_ObjectModule->Set(record->target, key.text, value);
         if (status == StatusCode::Ok) {
             m_Metrics.fallbackHits += 1;
         } else if (status == StatusCode::NotFound) {
@@ -234,7 +286,7 @@ namespace spectre::es2025 {
         return status;
     }
 
-    StatusCode ProxyModule::Has(Handle handle, std::string_view key, bool &outHas) {
+    StatusCode ProxyModule::HasProperty(Handle handle, const PropertyKey &key, bool &outHas) {
         outHas = false;
         auto *record = FindMutable(handle);
         if (!record) {
@@ -250,7 +302,9 @@ namespace spectre::es2025 {
         }
         Touch(*record);
         if (record->traps.has) {
-            status = record->traps.has(*m_ObjectModule, record->target, key, outHas, record->traps.userdata);
+            std::string scratch;
+            status = record->traps.has(*m_ObjectModule, record->target, TrapKey(key, scratch), outHas,
+                                       record->traps.userdata);
             if (status == StatusCode::Ok) {
                 m_Metrics.trapHits += 1;
             } else if (status == StatusCode::NotFound) {
@@ -258,12 +312,13 @@ namespace spectre::es2025 {
             }
             return status;
         }
-        outHas = m_ObjectModule->Has(record->target, key);
+        outHas = key.byAtom ? m_ObjectModule->Has(record->target, key.atom)
+                            : m_ObjectModule->Has(record->target, key.text);
         m_Metrics.fallbackHits += 1;
         return StatusCode::Ok;
     }
 
-    StatusCode ProxyModule::Delete(Handle handle, std::string_view key, bool &outDeleted) {
+    StatusCode ProxyModule::DeleteProperty(Handle handle, const PropertyKey &key, bool &outDeleted) {
         outDeleted = false;
         auto *record = FindMutable(handle);
         if (!record) {
@@ -279,7 +334,9 @@ namespace spectre::es2025 {
         }
         Touch(*record);
         if (record->traps.drop) {
-            status = record->traps.drop(*m_ObjectModule, record->target, key, outDeleted, record->traps.userdata);
+            std::string scratch;
+            status = record->traps.drop(*m_ObjectModule, record->target, TrapKey(key, scratch), outDeleted,
+                                        record->traps.userdata);
             if (status == StatusCode::Ok) {
                 m_Metrics.trapHits += 1;
             } else if (status == StatusCode::NotFound) {
@@ -287,7 +344,8 @@ namespace spectre::es2025 {
             }
             return status;
         }
-        status = m_ObjectModule->Delete(record->target, key, outDeleted);
+        status = key.byAtom ? m_ObjectModule->Delete(record->target, key.atom, outDeleted)
+                            : m_ObjectModule->Delete(record->target, key.text, outDeleted);
         if (status == StatusCode::Ok) {
             m_Metrics.fallbackHits += 1;
         } else if (status == StatusCode::NotFound) {
@@ -388,6 +446,18 @@ namespace spectre::es2025 {
         m_Metrics.lastFrameTouched = m_CurrentFrame;
     }
 
+    // Traps get their own copy of an atom's text: a trap may create strings or drop the atom,
+    // and either can invalidate an AtomView while the trap still reads it.
+    std::string_view ProxyModule::TrapKey(const PropertyKey &key, std::string &scratch) const {
+        if (!key.byAtom) {
+            return key.text;
+        }
+        if (m_Strings) {
+            scratch.assign(m_Strings->AtomView(key.atom));
+        }
+        return scratch;
+    }
+
     StatusCode ProxyModule::EnsureTarget(ProxyRecord &record) const {
         if (!m_ObjectModule) {
             return StatusCode::NotFound;
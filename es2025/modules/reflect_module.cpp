@@ -64,6 +64,15 @@ namespace spectre::es2025 {
         m_Metrics.gpuOptimized = m_GpuEnabled;
     }
 
+    // Reflect forwards to the object module and keeps no heap storage of its own.
+    void ReflectModule::CollectMemory(ModuleMemoryUsage &usage) const noexcept {
+        memory::Begin(usage);
+    }
+
+    void ReflectModule::SampleMemory(ModuleMemoryCounters &counters) const noexcept {
+        memory::Sample(counters, memory::Counter(), 0, 0);
+    }
+
     StatusCode ReflectModule::DefineProperty(ObjectModule::Handle target,
                                              std::string_view key,
                                              const ObjectModule::PropertyDescriptor &descriptor) {
@@ -81,6 +90,23 @@ namespace spectre::es2025 {
         return status;
     }
 
+    StatusCode ReflectModule::DefineProperty(ObjectModule::Handle target,
+                                             ObjectModule::Atom key,
+                                             const ObjectModule::PropertyDescriptor &descriptor) {
+        if (!m_ObjectModule) {
+            m_Metrics.failedOps += 1;
+            return StatusCode::InternalError;
+        }
+        auto status = m_ObjectModule->Define(target, key, descriptor);
+        if (status == StatusCode::Ok) {
+            m_Metrics.defineOps += 1;
+            TouchMetrics();
+        } else {
+            m_Metrics.failedOps += 1;
+        }
+        return status;
+    }
+
     StatusCode ReflectModule::Set(ObjectModule::Handle target,
                                   std::string_view key,
                                   const Value &value) {
@@ -98,6 +124,23 @@ namespace spectre::es2025 {
         return status;
     }
 
+    StatusCode ReflectModule::Set(ObjectModule::Handle target,
+                                  ObjectModule::Atom key,
+                                  const Value &value) {
+        if (!m_ObjectModule) {
+            m_Metrics.failedOps += 1;
+            return StatusCode::InternalError;
+        }
+        auto status = m_ObjectModule->Set(target, key, value);
+        if (status == StatusCode::Ok) {
+            m_Metrics.setOps += 1;
+            TouchMetrics();
+        } else {
+            m_Metrics.failedOps += 1;
+        }
+        return status;
+    }
+
     StatusCode ReflectModule::Get(ObjectModule::Handle target,
                                   std::string_view key,
                                   Value &outValue) {
@@ -116,6 +159,24 @@ namespace spectre::es2025 {
         return status;
     }
 
+    StatusCode ReflectModule::Get(ObjectModule::Handle target,
+                                  ObjectModule::Atom key,
+                                  Value &outValue) {
+        if (!m_ObjectModule) {
+            outValue.Reset();
+            m_Metrics.failedOps += 1;
+            return StatusCode::InternalError;
+        }
+        auto status = m_ObjectModule->Get(target, key, outValue);
+        if (status == StatusCode::Ok) {
+            m_Metrics.getOps += 1;
+            TouchMetrics();
+        } else {
+            m_Metrics.failedOps += 1;
+        }
+        return status;
+    }
+
     StatusCode ReflectModule::DeleteProperty(ObjectModule::Handle target,
                                              std::string_view key,
                                              bool &outDeleted) {
@@ -134,6 +195,24 @@ namespace spectre::es2025 {
         return status;
     }
 
+    StatusCode ReflectModule::DeleteProperty(ObjectModule::Handle target,
+                                             ObjectModule::Atom key,
+                                             bool &outDeleted) {
+        if (!m_ObjectModule) {
+            outDeleted = false;
+            m_Metrics.failedOps += 1;
+            return StatusCode::InternalError;
+        }
+        auto status = m_ObjectModule->Delete(target, key, outDeleted);
+        if (status == StatusCode::Ok) {
+            m_Metrics.deleteOps += 1;
+            TouchMetrics();
+        } else {
+            m_Metrics.failedOps += 1;
+        }
+        return status;
+    }
+
     StatusCode ReflectModule::OwnKeys(ObjectModule::Handle target,
                                       std::vector<std::string> &keys) {
         if (!m_ObjectModule) {
@@ -162,6 +241,17 @@ namespace spectre::es2025 {
         return result;
     }
 
+    bool ReflectModule::Has(ObjectModule::Handle target, ObjectModule::Atom key) {
+        if (!m_ObjectModule) {
+            m_Metrics.failedOps += 1;
+            return false;
+        }
+        auto result = m_ObjectModule->Has(target, key);
+        m_Metrics.hasOps += 1;
+        TouchMetrics();
+        return result;
+    }
+
     StatusCode ReflectModule::GetOwnPropertyDescriptor(ObjectModule::Handle target,
                                                        std::string_view key,
                                                        ObjectModule::PropertyDescriptor &outDescriptor) {
@@ -137,6 +137,35 @@ namespace spectre::es2025 {
         m_Metrics.gpuOptimized = m_GpuEnabled;
     }
 
+    // The compiled std::regex keeps its automaton behind an opaque pointer, so only the pattern
+    // text and the lookup index are counted.
+    void RegExpModule::CollectMemory(ModuleMemoryUsage &usage) const noexcept {
+        memory::Begin(usage);
+        memory::AddSlotTable(usage, m_Slots.size(), m_FreeSlots.size(), sizeof(SlotRecord),
+                             memory::VectorBytes(m_Slots) + memory::VectorBytes(m_FreeSlots));
+        std::uint64_t bytes = memory::HashMapBytes(m_Index);
+        for (const auto &[key, handle]: m_Index) {
+            (void) handle;
+            bytes += memory::StringBytes(key);
+        }
+        for (const auto &slot: m_Slots) {
+            if (!slot.inUse) {
+                continue;
+            }
+            const auto &record = slot.record;
+            bytes += memory::StringBytes(record.pattern) + memory::StringBytes(record.flags) +
+                    memory::StringBytes(record.decorated);
+        }
+        usage.reservedBytes += bytes;
+        usage.liveBytes += bytes;
+    }
+
+    void RegExpModule::SampleMemory(ModuleMemoryCounters &counters) const noexcept {
+        m_Memory.Observe(memory::VectorBytes(m_Slots) + memory::VectorBytes(m_FreeSlots) +
+                         memory::HashMapBytes(m_Index));
+        memory::Sample(counters, m_Memory.Totals(), m_Slots.size(), m_FreeSlots.size());
+    }
+
     StatusCode RegExpModule::ParseFlags(std::string_view flags,
                                         ParsedFlags &outFlags,
                                         std::string &outNormalized) const {
@@ -5,31 +5,26 @@
 #include <limits>
 
 #include "spectre/runtime.h"
+#include "spectre/es2025/flat_hash_index.h"
 
 namespace spectre::es2025 {
     namespace {
         constexpr std::string_view kName = "Set";
         constexpr std::string_view kSummary = "Set collection for unique membership tracking.";
         constexpr std::string_view kReference = "ECMA-262 Section 24.2";
-        constexpr std::uint32_t kInitialBucketCount = 8;
-
-
+        constexpr std::uint32_t kInitialCapacity = 8;
+        constexpr std::uint64_t kMaxEntries = 1ull << 30;
+        constexpr std::uint32_t kMinCompactHoles = 16;
     }
 
+    // Same layout as Map: a dense insertion-ordered entry array indexed by a FlatHashIndex.
     struct SetModule::Entry {
-        Entry()
-            : hash(0),
-              active(false),
-              value(),
-              orderPrev(kInvalidIndex),
-              orderNext(kInvalidIndex) {
+        Entry() : hash(0), value(), active(false) {
         }
 
         std::uint64_t hash;
-        bool active;
         Value value;
-        std::uint32_t orderPrev;
-        std::uint32_t orderNext;
+        bool active;
     };
 
     struct SetModule::SetRecord {
@@ -39,13 +34,11 @@ namespace spectre::es2025 {
               generation(0),
               label(),
               size(0),
-              head(kInvalidIndex),
-              tail(kInvalidIndex),
               version(0),
               lastTouchFrame(0),
+              trackedBytes(0),
               entries(),
-              buckets(),
-              freeEntries() {
+              index() {
         }
 
         Handle handle;
@@ -53,13 +46,11 @@ namespace spectre::es2025 {
         std::uint32_t generation;
         std::string label;
         std::uint32_t size;
-        std::uint32_t head;
-        std::uint32_t tail;
         std::uint64_t version;
         std::uint64_t lastTouchFrame;
+        std::uint64_t trackedBytes;
         std::vector<Entry> entries;
-        std::vector<std::uint32_t> buckets;
-        std::vector<std::uint32_t> freeEntries;
+        FlatHashIndex index;
     };
 
     struct SetModule::SlotRecord {
@@ -78,6 +69,8 @@ namespace spectre::es2025 {
           m_Metrics{},
           m_Slots(),
           m_FreeSlots(),
+          m_Memory(),
+          m_SlotTableBytes(0),
           m_GpuEnabled(false),
           m_Initialized(false),
           m_CurrentFrame(0) {
@@ -107,6 +100,9 @@ namespace spectre::es2025 {
         m_Metrics.lastFrameTouched = 0;
         m_Slots.clear();
         m_FreeSlots.clear();
+        m_Memory.Reset();
+        m_SlotTableBytes = 0;
+        TrackSlots();
         m_CurrentFrame = 0;
         m_Initialized = true;
     }
@@ -127,6 +123,34 @@ namespace spectre::es2025 {
         m_Metrics.gpuOptimized = m_GpuEnabled;
     }
 
+    void SetModule::CollectMemory(ModuleMemoryUsage &usage) const noexcept {
+        memory::Begin(usage);
+        memory::AddSlotTable(usage, m_Slots.size(), m_FreeSlots.size(), sizeof(SlotRecord),
+                             memory::VectorBytes(m_Slots) + memory::VectorBytes(m_FreeSlots));
+        for (const auto &slot: m_Slots) {
+            if (!slot.inUse) {
+                continue;
+            }
+            const auto &record = slot.record;
+            auto labelBytes = memory::StringBytes(record.label);
+            auto tableBytes = memory::VectorBytes(record.entries) + record.index.ReservedBytes();
+            std::uint64_t payloadBytes = 0;
+            for (const auto &entry: record.entries) {
+                if (entry.active) {
+                    payloadBytes += entry.value.HeapBytes();
+                }
+            }
+            auto idleEntryBytes = static_cast<std::uint64_t>(record.entries.capacity() - record.size) * sizeof(Entry);
+            usage.reservedBytes += labelBytes + tableBytes + payloadBytes;
+            usage.liveBytes += labelBytes + tableBytes + payloadBytes - idleEntryBytes;
+            usage.freeListBytes += idleEntryBytes;
+        }
+    }
+
+    void SetModule::SampleMemory(ModuleMemoryCounters &counters) const noexcept {
+        memory::Sample(counters, m_Memory, m_Slots.size(), m_FreeSlots.size());
+    }
+
     StatusCode SetModule::Create(std::string_view label, Handle &outHandle) {
         outHandle = 0;
         std::uint32_t slotIndex;
@@ -143,6 +167,7 @@ namespace spectre::es2025 {
             slot.generation = 1;
             m_Slots.push_back(slot);
         }
+        TrackSlots();
         auto &slot = m_Slots[slotIndex];
         auto &record = slot.record;
         record = SetRecord();
@@ -151,14 +176,10 @@ namespace spectre::es2025 {
         record.handle = EncodeHandle(slotIndex, slot.generation);
         record.label.assign(label.begin(), label.end());
         record.size = 0;
-        record.head = kInvalidIndex;
-        record.tail = kInvalidIndex;
         record.version = 0;
         record.lastTouchFrame = m_CurrentFrame;
         record.entries.clear();
-        record.buckets.clear();
-        record.freeEntries.clear();
-        EnsureCapacity(record);
+        Rehash(record, FlatHashIndex::CapacityFor(kInitialCapacity));
         Touch(record);
         TouchMetrics();
         outHandle = record.handle;
@@ -174,8 +195,10 @@ namespace spectre::es2025 {
         }
         slot->inUse = false;
         auto index = slot->record.slot;
+        m_Memory.Free(slot->record.trackedBytes);
         slot->record = SetRecord();
         m_FreeSlots.push_back(index);
+        TrackSlots();
         if (m_Metrics.liveSets > 0) {
             m_Metrics.liveSets -= 1;
         }
@@ -189,22 +212,9 @@ namespace spectre::es2025 {
         if (!record) {
             return StatusCode::NotFound;
         }
-        for (std::uint32_t index = 0; index < record->entries.size(); ++index) {
-            auto &entry = record->entries[index];
-            if (!entry.active) {
-                continue;
-            }
-            entry.active = false;
-            entry.hash = 0;
-            entry.value.Reset();
-            entry.orderPrev = kInvalidIndex;
-            entry.orderNext = kInvalidIndex;
-            record->freeEntries.push_back(index);
-        }
+        record->entries.clear();
+        record->index.Clear();
         record->size = 0;
-        record->head = kInvalidIndex;
-        record->tail = kInvalidIndex;
-        std::fill(record->buckets.begin(), record->buckets.end(), kInvalidIndex);
         Touch(*record);
         TouchMetrics();
         m_Metrics.clears += 1;
@@ -217,23 +227,18 @@ namespace spectre::es2025 {
             return StatusCode::NotFound;
         }
         m_Metrics.addOps += 1;
-        EnsureCapacity(*record);
         auto hash = HashValue(value);
-        std::uint32_t bucket = 0;
         bool collision = false;
-        auto existing = Locate(*record, value, hash, bucket, collision);
+        auto existing = Locate(*record, value, hash, collision);
+        if (collision) {
+            m_Metrics.collisions += 1;
+        }
         if (existing != kInvalidIndex) {
-            if (collision) {
-                m_Metrics.collisions += 1;
-            }
             m_Metrics.hits += 1;
             TouchMetrics();
             return StatusCode::Ok;
         }
         auto status = Insert(*record, value, hash);
-        if (collision && status == StatusCode::Ok) {
-            m_Metrics.collisions += 1;
-        }
         if (status == StatusCode::Ok) {
             m_Metrics.hits += 1;
         }
@@ -249,19 +254,15 @@ namespace spectre::es2025 {
             return false;
         }
         auto hash = HashValue(value);
-        std::uint32_t bucket = 0;
         bool collision = false;
-        auto index = Locate(*record, value, hash, bucket, collision);
+        auto index = Locate(*record, value, hash, collision);
+        if (collision) {
+            self->m_Metrics.collisions += 1;
+        }
         if (index == kInvalidIndex) {
-            if (collision) {
-                self->m_Metrics.collisions += 1;
-            }
             self->m_Metrics.misses += 1;
             return false;
         }
-        if (collision) {
-            self->m_Metrics.collisions += 1;
-        }
         self->m_Metrics.hits += 1;
         self->TouchMetrics();
         return true;
@@ -286,6 +287,23 @@ namespace spectre::es2025 {
         return status;
     }
 
+    StatusCode SetModule::Reserve(Handle handle, std::uint32_t count) {
+        auto *record = FindMutable(handle);
+        if (!record) {
+            return StatusCode::NotFound;
+        }
+        if (count > kMaxEntries) {
+            return StatusCode::CapacityExceeded;
+        }
+        auto capacity = FlatHashIndex::CapacityFor(count);
+        if (capacity > record->index.Capacity()) {
+            Rehash(*record, capacity);
+        }
+        record->entries.reserve(count);
+        Track(*record);
+        return StatusCode::Ok;
+    }
+
     std::uint32_t SetModule::Size(Handle handle) const {
         const auto *record = Find(handle);
         return record ? record->size : 0;
@@ -298,13 +316,10 @@ namespace spectre::es2025 {
             return StatusCode::NotFound;
         }
         values.reserve(record->size);
-        auto index = record->head;
-        while (index != kInvalidIndex) {
-            const auto &entry = record->entries[index];
+        for (const auto &entry: record->entries) {
             if (entry.active) {
                 values.push_back(entry.value);
             }
-            index = entry.orderNext;
         }
         const_cast<SetModule *>(this)->m_Metrics.iterations += 1;
         const_cast<SetModule *>(this)->TouchMetrics();
@@ -318,19 +333,50 @@ namespace spectre::es2025 {
             return StatusCode::NotFound;
         }
         entries.reserve(record->size);
-        auto index = record->head;
-        while (index != kInvalidIndex) {
-            const auto &entry = record->entries[index];
+        for (const auto &entry: record->entries) {
             if (entry.active) {
                 entries.emplace_back(entry.value, entry.value);
             }
-            index = entry.orderNext;
         }
         const_cast<SetModule *>(this)->m_Metrics.iterations += 1;
         const_cast<SetModule *>(this)->TouchMetrics();
         return StatusCode::Ok;
     }
 
+    StatusCode SetModule::OpenCursor(Handle handle, Cursor &outCursor) const {
+        outCursor = {};
+        const auto *record = Find(handle);
+        if (!record) {
+            return StatusCode::NotFound;
+        }
+        outCursor.handle = handle;
+        outCursor.version = record->version;
+        outCursor.position = 0;
+        const_cast<SetModule *>(this)->m_Metrics.iterations += 1;
+        const_cast<SetModule *>(this)->TouchMetrics();
+        return StatusCode::Ok;
+    }
+
+    StatusCode SetModule::Next(Cursor &cursor, std::span<Value> out, std::size_t &outCount) const {
+        outCount = 0;
+        const auto *record = Find(cursor.handle);
+        if (!record) {
+            return StatusCode::NotFound;
+        }
+        if (record->version != cursor.version) {
+            return StatusCode::InvalidArgument;
+        }
+        auto position = cursor.position;
+        for (; position < record->entries.size() && outCount < out.size(); ++position) {
+            const auto &entry = record->entries[position];
+            if (entry.active) {
+                out[outCount++] = entry.value;
+            }
+        }
+        cursor.position = position;
+        return StatusCode::Ok;
+    }
+
     const SetModule::Metrics &SetModule::GetMetrics() const noexcept {
         return m_Metrics;
     }
@@ -393,7 +439,7 @@ namespace spectre::es2025 {
         return static_cast<std::uint32_t>((handle >> 32) & 0xffffffffull);
     }
 
-        std::uint64_t SetModule::HashValue(const Value &value) noexcept {
+    std::uint64_t SetModule::HashValue(const Value &value) noexcept {
         auto hash = value.Hash();
         if (hash == 0) {
             hash = 0x9e3779b97f4a7c15ull;
@@ -401,212 +447,115 @@ namespace spectre::es2025 {
         return hash;
     }
 
-
     void SetModule::Touch(SetRecord &record) noexcept {
         record.version += 1;
         record.lastTouchFrame = m_CurrentFrame;
+        Track(record);
         TouchMetrics();
     }
 
+    // Same O(1) footprint retake as MapModule::Track.
+    void SetModule::Track(SetRecord &record) noexcept {
+        auto bytes = memory::StringBytes(record.label) + memory::VectorBytes(record.entries) +
+                     record.index.ReservedBytes();
+        m_Memory.Resize(record.trackedBytes, bytes);
+        record.trackedBytes = bytes;
+    }
+
+    void SetModule::TrackSlots() noexcept {
+        auto bytes = memory::VectorBytes(m_Slots) + memory::VectorBytes(m_FreeSlots);
+        m_Memory.Resize(m_SlotTableBytes, bytes);
+        m_SlotTableBytes = bytes;
+    }
+
     void SetModule::TouchMetrics() noexcept {
         m_Metrics.lastFrameTouched = m_CurrentFrame;
     }
 
-    void SetModule::EnsureCapacity(SetRecord &record) {
-        if (record.buckets.empty()) {
-            Rehash(record, kInitialBucketCount);
-            return;
+    StatusCode SetModule::EnsureCapacity(SetRecord &record, std::uint32_t additional) {
+        auto needed = std::max<std::uint64_t>(static_cast<std::uint64_t>(record.size) + additional, kInitialCapacity);
+        if (needed > kMaxEntries) {
+            return StatusCode::CapacityExceeded;
         }
-        auto capacity = static_cast<std::uint32_t>(record.buckets.size());
-        auto limit = (capacity * 3u) / 5u;
-        if (limit < 1) {
-            limit = 1;
+        auto capacity = record.index.Capacity();
+        if (capacity == 0 || needed > record.index.GrowthLimit()) {
+            Rehash(record, FlatHashIndex::CapacityFor(static_cast<std::uint32_t>(needed)));
+            return StatusCode::Ok;
         }
-        if (record.size + 1 > limit) {
-            Rehash(record, capacity * 2);
+        auto holes = static_cast<std::uint32_t>(record.entries.size()) - record.size;
+        if (record.index.NeedsRebuild(additional) || (holes >= kMinCompactHoles && holes > record.size)) {
+            Rehash(record, capacity);
         }
+        return StatusCode::Ok;
     }
 
-    void SetModule::Rehash(SetRecord &record, std::uint32_t newBucketCount) {
-        if (newBucketCount < kInitialBucketCount) {
-            newBucketCount = kInitialBucketCount;
-        }
-        if ((newBucketCount & (newBucketCount - 1)) != 0) {
-            std::uint32_t power = 1;
-            while (power < newBucketCount && power < (1u << 30)) {
-                power <<= 1;
-            }
-            newBucketCount = power;
-        }
-        std::vector<std::uint32_t> buckets(newBucketCount, kInvalidIndex);
-        auto mask = newBucketCount - 1;
-        for (std::uint32_t index = 0; index < record.entries.size(); ++index) {
-            auto &entry = record.entries[index];
-            if (!entry.active) {
+    void SetModule::Rehash(SetRecord &record, std::uint32_t capacity) {
+        std::uint32_t write = 0;
+        for (std::uint32_t read = 0; read < record.entries.size(); ++read) {
+            if (!record.entries[read].active) {
                 continue;
             }
-            auto bucket = static_cast<std::uint32_t>(entry.hash) & mask;
-            while (true) {
-                if (buckets[bucket] == kInvalidIndex) {
-                    buckets[bucket] = index;
-                    break;
-                }
-                bucket = (bucket + 1) & mask;
+            if (write != read) {
+                record.entries[write] = std::move(record.entries[read]);
             }
+            ++write;
+        }
+        if (write != record.entries.size()) {
+            // Dropping holes moves entries, so open cursors must see a new version.
+            record.version += 1;
+        }
+        record.entries.resize(write);
+        record.index.Reset(capacity);
+        for (std::uint32_t i = 0; i < write; ++i) {
+            record.index.Insert(record.entries[i].hash, i);
         }
-        record.buckets.swap(buckets);
         m_Metrics.rehashes += 1;
     }
 
     std::uint32_t SetModule::Locate(const SetRecord &record, const Value &value, std::uint64_t hash,
-                                    std::uint32_t &bucket, bool &collision) const {
-        if (record.buckets.empty()) {
-            bucket = 0;
-            collision = false;
-            return kInvalidIndex;
-        }
-        auto mask = static_cast<std::uint32_t>(record.buckets.size() - 1);
-        auto index = static_cast<std::uint32_t>(hash) & mask;
-        auto firstDeleted = kInvalidIndex;
+                                    bool &collision) const {
         std::uint32_t probes = 0;
-        collision = false;
-        while (true) {
-            auto entryIndex = record.buckets[index];
-            if (entryIndex == kInvalidIndex) {
-                bucket = firstDeleted != kInvalidIndex ? firstDeleted : index;
-                collision = probes != 0;
-                return kInvalidIndex;
-            }
-            if (entryIndex == kDeletedIndex) {
-                if (firstDeleted == kInvalidIndex) {
-                    firstDeleted = index;
-                }
-            } else {
-                const auto &entry = record.entries[entryIndex];
-                if (entry.active && entry.hash == hash && entry.value.SameValueZero(value)) {
-                    bucket = index;
-                    collision = probes != 0;
-                    return entryIndex;
-                }
-            }
-            index = (index + 1) & mask;
-            ++probes;
-            if (probes >= record.buckets.size()) {
-                bucket = firstDeleted != kInvalidIndex ? firstDeleted : index;
-                collision = true;
-                return kInvalidIndex;
-            }
-        }
-    }
-
-    std::uint32_t SetModule::AllocateEntry(SetRecord &record) {
-        if (!record.freeEntries.empty()) {
-            auto index = record.freeEntries.back();
-            record.freeEntries.pop_back();
-            auto &entry = record.entries[index];
-            entry.active = true;
-            entry.hash = 0;
-            entry.value.Reset();
-            entry.orderPrev = kInvalidIndex;
-            entry.orderNext = kInvalidIndex;
-            return index;
-        }
-        Entry entry;
-        entry.active = true;
-        record.entries.push_back(entry);
-        return static_cast<std::uint32_t>(record.entries.size() - 1);
+        auto index = record.index.Find(hash, [&](std::uint32_t candidate) {
+            const auto &entry = record.entries[candidate];
+            return entry.hash == hash && entry.value.SameValueZero(value);
+        }, probes);
+        collision = probes != 0;
+        return index;
     }
 
     StatusCode SetModule::Insert(SetRecord &record, const Value &value, std::uint64_t hash) {
-        std::uint32_t bucket = 0;
-        bool collision = false;
-        auto existing = Locate(record, value, hash, bucket, collision);
-        if (existing != kInvalidIndex) {
-            if (collision) {
-                m_Metrics.collisions += 1;
-            }
-            return StatusCode::AlreadyExists;
+        auto status = EnsureCapacity(record, 1);
+        if (status != StatusCode::Ok) {
+            return status;
         }
-        auto entryIndex = AllocateEntry(record);
-        auto &entry = record.entries[entryIndex];
+        auto entryIndex = static_cast<std::uint32_t>(record.entries.size());
+        auto &entry = record.entries.emplace_back();
         entry.hash = hash;
         entry.value = value;
-        entry.orderPrev = kInvalidIndex;
-        entry.orderNext = kInvalidIndex;
-        if (record.buckets.empty()) {
-            record.buckets.resize(kInitialBucketCount, kInvalidIndex);
-        }
-        record.buckets[bucket] = entryIndex;
+        entry.active = true;
+        record.index.Insert(hash, entryIndex);
         record.size += 1;
-        LinkTail(record, entryIndex);
         Touch(record);
-        if (collision) {
-            m_Metrics.collisions += 1;
-        }
         return StatusCode::Ok;
     }
 
     StatusCode SetModule::Remove(SetRecord &record, const Value &value, std::uint64_t hash, bool &outDeleted) {
         outDeleted = false;
-        if (record.buckets.empty()) {
-            return StatusCode::Ok;
-        }
-        std::uint32_t bucket = 0;
         bool collision = false;
-        auto index = Locate(record, value, hash, bucket, collision);
+        auto index = Locate(record, value, hash, collision);
+        if (collision) {
+            m_Metrics.collisions += 1;
+        }
         if (index == kInvalidIndex) {
-            if (collision) {
-                m_Metrics.collisions += 1;
-            }
             return StatusCode::Ok;
         }
         auto &entry = record.entries[index];
-        if (!entry.active) {
-            return StatusCode::Ok;
-        }
+        record.index.Erase(hash, index);
         entry.active = false;
-        entry.hash = 0;
         entry.value.Reset();
-        Unlink(record, index);
-        entry.orderPrev = kInvalidIndex;
-        entry.orderNext = kInvalidIndex;
-        record.freeEntries.push_back(index);
-        record.buckets[bucket] = kDeletedIndex;
         outDeleted = true;
-        if (record.size > 0) {
-            record.size -= 1;
-        }
+        record.size -= 1;
         Touch(record);
-        if (collision) {
-            m_Metrics.collisions += 1;
-        }
         return StatusCode::Ok;
     }
-
-    void SetModule::LinkTail(SetRecord &record, std::uint32_t entryIndex) {
-        auto &entry = record.entries[entryIndex];
-        entry.orderPrev = record.tail;
-        entry.orderNext = kInvalidIndex;
-        if (record.tail != kInvalidIndex) {
-            record.entries[record.tail].orderNext = entryIndex;
-        } else {
-            record.head = entryIndex;
-        }
-        record.tail = entryIndex;
-    }
-
-    void SetModule::Unlink(SetRecord &record, std::uint32_t entryIndex) {
-        auto &entry = record.entries[entryIndex];
-        if (entry.orderPrev != kInvalidIndex) {
-            record.entries[entry.orderPrev].orderNext = entry.orderNext;
-        } else {
-            record.head = entry.orderNext;
-        }
-        if (entry.orderNext != kInvalidIndex) {
-            record.entries[entry.orderNext].orderPrev = entry.orderPrev;
-        } else {
-            record.tail = entry.orderPrev;
-        }
-    }
 }
-
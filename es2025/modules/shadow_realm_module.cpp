@@ -10,6 +10,7 @@
 
 #include "spectre/context.h"
 #include "spectre/runtime.h"
+#include "spectre/es2025/environment.h"
 
 namespace spectre::es2025 {
     namespace {
@@ -96,7 +97,8 @@ namespace spectre::es2025 {
           m_Slots(),
           m_FreeSlots(),
           m_Metrics(),
-          m_DefaultStackSize(kMinimumStackSize) {
+          m_DefaultStackSize(kMinimumStackSize),
+          m_Strings(nullptr) {
     }
 
     std::string_view ShadowRealmModule::Name() const noexcept {
@@ -122,6 +124,7 @@ namespace spectre::es2025 {
         m_TotalSeconds = 0.0;
         m_DefaultStackSize = RecommendStackSize(context.config);
         ResetAllocationPools(RecommendRealmCapacity(context.config));
+        m_Strings = dynamic_cast<StringModule *>(context.runtime.EsEnvironment().FindModule("String"));
         m_Initialized = true;
     }
 
@@ -144,6 +147,31 @@ namespace spectre::es2025 {
         EnsureCapacity(RecommendRealmCapacity(config));
     }
 
+    void ShadowRealmModule::CollectMemory(ModuleMemoryUsage &usage) const noexcept {
+        memory::Begin(usage);
+        memory::AddSlotTable(usage, m_Slots.size(), m_FreeSlots.size(), sizeof(Slot),
+                             memory::VectorBytes(m_Slots) + memory::VectorBytes(m_FreeSlots));
+        for (const auto &slot: m_Slots) {
+            if (!slot.inUse) {
+                continue;
+            }
+            const auto &record = slot.record;
+            auto bytes = memory::StringBytes(record.contextName) + memory::StringBytes(record.inlineScriptName);
+            for (const auto &entry: record.exports) {
+                if (entry.inUse) {
+                    bytes += entry.value.HeapBytes();
+                }
+            }
+            usage.reservedBytes += bytes;
+            usage.liveBytes += bytes;
+        }
+    }
+
+    void ShadowRealmModule::SampleMemory(ModuleMemoryCounters &counters) const noexcept {
+        m_Memory.Observe(memory::VectorBytes(m_Slots) + memory::VectorBytes(m_FreeSlots));
+        memory::Sample(counters, m_Memory.Totals(), m_Slots.size(), m_FreeSlots.size());
+    }
+
     StatusCode ShadowRealmModule::Create(std::string_view label, Handle &outHandle, std::uint32_t stackSize) {
         outHandle = kInvalidHandle;
         if (!m_Runtime) {
@@ -280,12 +308,41 @@ namespace spectre::es2025 {
         if (exportName.empty()) {
             return StatusCode::InvalidArgument;
         }
+        auto atom = StringModule::kInvalidAtom;
+        if (m_Strings && m_Strings->AcquireAtom(exportName, atom) != StatusCode::Ok) {
+            return StatusCode::CapacityExceeded;
+        }
+        // The stored entry takes its own reference; drop the one acquired for the lookup.
+        auto status = StoreExport(handle, exportName, atom, value);
+        if (m_Strings) {
+            m_Strings->ReleaseAtom(atom);
+        }
+        return status;
+    }
+
+    StatusCode ShadowRealmModule::ExportValue(Handle handle,
+                                              StringModule::Atom exportName,
+                                              const Value &value) noexcept {
+        if (!m_Strings || !m_Strings->IsAtom(exportName)) {
+            return StatusCode::InvalidArgument;
+        }
+        auto text = m_Strings->AtomView(exportName);
+        if (text.empty()) {
+            return StatusCode::InvalidArgument;
+        }
+        return StoreExport(handle, text, exportName, value);
+    }
+
+    StatusCode ShadowRealmModule::StoreExport(Handle handle,
+                                              std::string_view exportName,
+                                              StringModule::Atom atom,
+                                              const Value &value) noexcept {
         auto *realm = Resolve(handle);
         if (!realm) {
             return StatusCode::NotFound;
         }
 
-        auto *entry = FindExport(*realm, exportName);
+        auto *entry = FindExport(*realm, exportName, atom);
         if (!entry) {
             for (auto &candidate: realm->exports) {
                 if (!candidate.inUse) {
@@ -299,6 +356,16 @@ namespace spectre::es2025 {
         }
 
         CopyExportName(exportName, entry->name, entry->length);
+        if (!entry->inUse || entry->atom != atom) {
+            // Entries hold a reference on their atom so its id cannot be recycled under them.
+            if (m_Strings) {
+                m_Strings->RetainAtom(atom);
+                if (entry->inUse) {
+                    m_Strings->ReleaseAtom(entry->atom);
+                }
+            }
+        }
+        entry->atom = atom;
         entry->value = value;
         entry->inUse = true;
         realm->exportCount += 1;
@@ -315,13 +382,33 @@ namespace spectre::es2025 {
         if (exportName.empty()) {
             return StatusCode::InvalidArgument;
         }
-        auto *mutableThis = const_cast<ShadowRealmModule *>(this);
-        auto *target = mutableThis->Resolve(targetRealm);
-        auto *source = mutableThis->Resolve(sourceRealm);
+        // A name that was never interned yields kInvalidAtom, which matches no stored export.
+        auto atom = m_Strings ? m_Strings->FindAtom(exportName) : StringModule::kInvalidAtom;
+        return LoadExport(targetRealm, sourceRealm, exportName, atom, outValue);
+    }
+
+    StatusCode ShadowRealmModule::ImportValue(Handle targetRealm,
+                                              Handle sourceRealm,
+                                              StringModule::Atom exportName,
+                                              Value &outValue) noexcept {
+        outValue = Value::Undefined();
+        if (!m_Strings || !m_Strings->IsAtom(exportName)) {
+            return StatusCode::InvalidArgument;
+        }
+        return LoadExport(targetRealm, sourceRealm, m_Strings->AtomView(exportName), exportName, outValue);
+    }
+
+    StatusCode ShadowRealmModule::LoadExport(Handle targetRealm,
+                                             Handle sourceRealm,
+                                             std::string_view exportName,
+                                             StringModule::Atom atom,
+                                             Value &outValue) noexcept {
+        auto *target = Resolve(targetRealm);
+        auto *source = Resolve(sourceRealm);
         if (!target || !source) {
             return StatusCode::NotFound;
         }
-        auto *entry = mutableThis->FindExport(*source, exportName);
+        auto *entry = FindExport(*source, exportName, atom);
         if (!entry) {
             m_Metrics.failedImports += 1;
             return StatusCode::NotFound;
@@ -339,10 +426,7 @@ namespace spectre::es2025 {
             return StatusCode::NotFound;
         }
         for (auto &entry: realm->exports) {
-            entry.inUse = false;
-            entry.length = 0;
-            entry.name[0] = '\0';
-            entry.value = Value::Undefined();
+            ClearExport(entry);
         }
         return StatusCode::Ok;
     }
@@ -405,6 +489,11 @@ namespace spectre::es2025 {
         if (targetCapacity > kMaxSlots) {
             targetCapacity = kMaxSlots;
         }
+        for (auto &slot: m_Slots) {
+            for (auto &entry: slot.record.exports) {
+                ClearExport(entry);
+            }
+        }
         m_Slots.clear();
         m_FreeSlots.clear();
         m_Slots.resize(targetCapacity);
@@ -499,10 +588,7 @@ namespace spectre::es2025 {
         slot.record.importCount = 0;
         slot.record.exportCount = 0;
         for (auto &entry: slot.record.exports) {
-            entry.inUse = false;
-            entry.length = 0;
-            entry.name[0] = '\0';
-            entry.value = Value::Undefined();
+            ClearExport(entry);
         }
         m_FreeSlots.push_back(slotIndex);
     }
@@ -551,11 +637,30 @@ namespace spectre::es2025 {
         outLength = static_cast<std::uint8_t>(count);
     }
 
-    ShadowRealmModule::ExportEntry *ShadowRealmModule::FindExport(RealmRecord &realm, std::string_view exportName) noexcept {
+    void ShadowRealmModule::ClearExport(ExportEntry &entry) noexcept {
+        if (entry.inUse && m_Strings) {
+            m_Strings->ReleaseAtom(entry.atom);
+        }
+        entry.inUse = false;
+        entry.atom = StringModule::kInvalidAtom;
+        entry.length = 0;
+        entry.name[0] = '\0';
+        entry.value = Value::Undefined();
+    }
+
+    ShadowRealmModule::ExportEntry *ShadowRealmModule::FindExport(RealmRecord &realm,
+                                                                  std::string_view exportName,
+                                                                  StringModule::Atom atom) noexcept {
         for (auto &entry: realm.exports) {
             if (!entry.inUse) {
                 continue;
             }
+            if (m_Strings) {
+                if (entry.atom == atom) {
+                    return &entry;
+                }
+                continue;
+            }
             if (entry.length != exportName.size()) {
                 continue;
             }
@@ -565,11 +670,6 @@ namespace spectre::es2025 {
         }
         return nullptr;
     }
-
-    const ShadowRealmModule::ExportEntry *ShadowRealmModule::FindExport(const RealmRecord &realm,
-                                                                        std::string_view exportName) const noexcept {
-        return const_cast<ShadowRealmModule *>(this)->FindExport(const_cast<RealmRecord &>(realm), exportName);
-    }
 }
 
 
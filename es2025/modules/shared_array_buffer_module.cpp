@@ -1,10 +1,19 @@
 #include "spectre/es2025/modules/shared_array_buffer_module.h"
 
 #include <algorithm>
+#include <bit>
 #include <cstring>
 #include <limits>
+#include <new>
+#include <type_traits>
 #include <utility>
 
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <unistd.h>
+#define SPECTRE_SHARED_MEMORY_MMAP 1
+#endif
+
 #include "spectre/runtime.h"
 
 namespace spectre::es2025 {
@@ -15,6 +24,88 @@ namespace spectre::es2025 {
         constexpr std::string_view kReference = "ECMA-262 Section 25.2";
         constexpr std::uint64_t kHandleSlotMask = 0xffffffffull;
         constexpr std::uint64_t kHotFrameWindow = 12;
+
+        // Channel layout: a read-only header line, then the producer and consumer cursors on lines
+        // of their own, then the slots. Each slot is [sequence u64][epoch u64][length u32][payload]
+        // padded to whole cache lines so neighbouring slots never share one. Each cursor line also
+        // carries a 32-bit signal bumped after every batch and a count of threads parked on it, so
+        // the side that moves the cursor only issues a wake when someone sleeps.
+        constexpr std::uint32_t kChannelMagic = 0x4843'4a53u; // "SJCH"
+        constexpr std::size_t kChannelLine = 64;
+        constexpr std::size_t kChannelTailOffset = kChannelLine;
+        constexpr std::size_t kChannelHeadOffset = 2 * kChannelLine;
+        constexpr std::size_t kChannelSlotsOffset = 3 * kChannelLine;
+        constexpr std::size_t kChannelSignalOffset = 8;
+        constexpr std::size_t kChannelSleepersOffset = 12;
+        constexpr std::size_t kChannelSlotHeader = 24;
+        constexpr std::uint32_t kMaxChannelCapacity = 1u << 24;
+        constexpr std::uint32_t kMaxChannelSlotBytes = 1u << 24;
+
+        struct ChannelHeader {
+            std::uint32_t magic;
+            std::uint32_t slotBytes;
+            std::uint32_t capacity;
+            std::uint32_t stride;
+        };
+
+        ChannelHeader ReadChannelHeader(const std::uint8_t *base) noexcept {
+            ChannelHeader header{};
+            std::memcpy(&header, base, sizeof(header));
+            return header;
+        }
+
+        std::atomic_ref<std::uint64_t> ChannelWord(std::uint8_t *base, std::size_t offset) noexcept {
+            return std::atomic_ref<std::uint64_t>(*reinterpret_cast<std::uint64_t *>(base + offset));
+        }
+
+        std::uint8_t *ChannelSlot(std::uint8_t *base, const ChannelHeader &header, std::uint64_t position) noexcept {
+            auto index = static_cast<std::size_t>(position & (header.capacity - 1));
+            return base + kChannelSlotsOffset + index * header.stride;
+        }
+
+        std::atomic_ref<std::uint64_t> SlotSequence(std::uint8_t *slot) noexcept {
+            return std::atomic_ref<std::uint64_t>(*reinterpret_cast<std::uint64_t *>(slot));
+        }
+
+        std::atomic_ref<std::uint32_t> ChannelLane(std::uint8_t *line, std::size_t offset) noexcept {
+            return std::atomic_ref<std::uint32_t>(*reinterpret_cast<std::uint32_t *>(line + offset));
+        }
+
+        // Bump the line's signal after publishing; wake only when a waiter has registered. Both
+        // sides use seq_cst so either the waiter sees the new signal or the signaller sees it.
+        void SignalChannel(std::uint8_t *line) noexcept {
+            auto signal = ChannelLane(line, kChannelSignalOffset);
+            signal.fetch_add(1, std::memory_order_seq_cst);
+            if (ChannelLane(line, kChannelSleepersOffset).load(std::memory_order_seq_cst) != 0) {
+                signal.notify_all();
+            }
+        }
+
+        // Sleeps until the signal moves off seen; returns at once if it already has.
+        void ParkChannel(std::uint8_t *line, std::uint32_t seen) noexcept {
+            auto sleepers = ChannelLane(line, kChannelSleepersOffset);
+            sleepers.fetch_add(1, std::memory_order_seq_cst);
+            ChannelLane(line, kChannelSignalOffset).wait(seen, std::memory_order_seq_cst);
+            sleepers.fetch_sub(1, std::memory_order_seq_cst);
+        }
+
+#if defined(SPECTRE_SHARED_MEMORY_MMAP)
+        std::size_t PageSize() noexcept {
+            static const auto size = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+            return size;
+        }
+
+        std::size_t RoundToPages(std::size_t bytes) noexcept {
+            auto page = PageSize();
+            return (bytes + (page - 1)) & ~(page - 1);
+        }
+
+#if defined(MAP_NORESERVE)
+        constexpr int kReserveFlags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE;
+#else
+        constexpr int kReserveFlags = MAP_PRIVATE | MAP_ANONYMOUS;
+#endif
+#endif
     }
 
     SharedArrayBufferModule::Metrics::Metrics() noexcept
@@ -28,17 +119,140 @@ namespace spectre::es2025 {
           bytesPooled(0),
           lastFrameTouched(0),
           hotBuffers(0),
+          imports(0),
+          exports(0),
+          channelsCreated(0),
+          messagesSent(0),
+          messagesReceived(0),
+          sendBackpressure(0),
+          channelWaits(0),
           gpuOptimized(false) {
     }
 
+    SharedArrayBufferModule::ChannelMessage::ChannelMessage() noexcept
+        : sequence(0),
+          epoch(0),
+          bytes() {
+    }
+
+    SharedArrayBufferModule::SharedMemory::SharedMemory() noexcept
+        : m_Data(nullptr),
+          m_Reserved(0),
+          m_MaxByteLength(0),
+          m_ByteLength(0),
+          m_Committed(0),
+          m_GrowMutex(),
+          m_Mapped(false),
+          m_Resizable(false) {
+    }
+
+    SharedArrayBufferModule::SharedMemory::~SharedMemory() {
+#if defined(SPECTRE_SHARED_MEMORY_MMAP)
+        if (m_Mapped) {
+            munmap(m_Data, m_Reserved);
+            return;
+        }
+#endif
+        delete[] m_Data;
+    }
+
+    std::shared_ptr<SharedArrayBufferModule::SharedMemory> SharedArrayBufferModule::SharedMemory::Allocate(
+        std::size_t byteLength, std::size_t maxByteLength) {
+        if (byteLength > maxByteLength) {
+            return nullptr;
+        }
+        std::shared_ptr<SharedMemory> memory(new SharedMemory());
+        memory->m_MaxByteLength = maxByteLength;
+        memory->m_Resizable = byteLength != maxByteLength;
+        if (maxByteLength == 0) {
+            return memory;
+        }
+#if defined(SPECTRE_SHARED_MEMORY_MMAP)
+        if (memory->m_Resizable) {
+            // Reserve the whole range inaccessible and commit only what the length covers; the
+            // address never changes as the buffer grows.
+            auto reserved = RoundToPages(maxByteLength);
+            void *pages = mmap(nullptr, reserved, PROT_NONE, kReserveFlags, -1, 0);
+            if (pages == MAP_FAILED) {
+                return nullptr;
+            }
+            memory->m_Data = static_cast<std::uint8_t *>(pages);
+            memory->m_Reserved = reserved;
+            memory->m_Mapped = true;
+            auto committed = RoundToPages(byteLength);
+            if (committed > 0 && mprotect(pages, committed, PROT_READ | PROT_WRITE) != 0) {
+                return nullptr;
+            }
+            memory->m_Committed.store(committed, std::memory_order_relaxed);
+            memory->m_ByteLength.store(byteLength, std::memory_order_release);
+            return memory;
+        }
+#endif
+        memory->m_Data = new(std::nothrow) std::uint8_t[maxByteLength]();
+        if (!memory->m_Data) {
+            return nullptr;
+        }
+        memory->m_Committed.store(maxByteLength, std::memory_order_relaxed);
+        memory->m_ByteLength.store(byteLength, std::memory_order_release);
+        return memory;
+    }
+
+    std::uint8_t *SharedArrayBufferModule::SharedMemory::Data() const noexcept {
+        return m_Data;
+    }
+
+    std::size_t SharedArrayBufferModule::SharedMemory::ByteLength() const noexcept {
+        return m_ByteLength.load(std::memory_order_acquire);
+    }
+
+    std::size_t SharedArrayBufferModule::SharedMemory::MaxByteLength() const noexcept {
+        return m_MaxByteLength;
+    }
+
+    std::size_t SharedArrayBufferModule::SharedMemory::CommittedBytes() const noexcept {
+        return m_Committed.load(std::memory_order_relaxed);
+    }
+
+    bool SharedArrayBufferModule::SharedMemory::Resizable() const noexcept {
+        return m_Resizable;
+    }
+
+    StatusCode SharedArrayBufferModule::SharedMemory::Grow(std::size_t newByteLength) noexcept {
+        std::lock_guard lock(m_GrowMutex);
+        auto current = m_ByteLength.load(std::memory_order_relaxed);
+        if (newByteLength < current) {
+            return StatusCode::InvalidArgument;
+        }
+        if (newByteLength > m_MaxByteLength) {
+            return StatusCode::CapacityExceeded;
+        }
+        if (newByteLength == current) {
+            return StatusCode::Ok;
+        }
+#if defined(SPECTRE_SHARED_MEMORY_MMAP)
+        if (m_Mapped) {
+            // Newly committed pages read as zero, and bytes past the old length were never
+            // writable, so no clearing is needed.
+            auto committed = m_Committed.load(std::memory_order_relaxed);
+            auto needed = std::min(RoundToPages(newByteLength), m_Reserved);
+            if (needed > committed) {
+                if (mprotect(m_Data + committed, needed - committed, PROT_READ | PROT_WRITE) != 0) {
+                    return StatusCode::CapacityExceeded;
+                }
+                m_Committed.store(needed, std::memory_order_relaxed);
+            }
+        }
+#endif
+        m_ByteLength.store(newByteLength, std::memory_order_release);
+        return StatusCode::Ok;
+    }
+
     SharedArrayBufferModule::Storage::Storage() noexcept
-        : data(),
-          byteLength(0),
-          maxByteLength(0),
+        : memory(),
+          accountedBytes(0),
           refCount(0),
           version(0),
           lastTouchFrame(0),
-          resizable(false),
           hot(false) {
     }
 
@@ -70,6 +284,8 @@ namespace spectre::es2025 {
           m_FreeSlots(),
           m_Storages(),
           m_FreeStorages(),
+          m_Memory(),
+          m_SlotTableBytes(0),
           m_Metrics() {
     }
 
@@ -96,6 +312,9 @@ namespace spectre::es2025 {
         m_Storages.clear();
         m_FreeStorages.clear();
         m_Metrics = Metrics();
+        m_Memory.Reset();
+        m_SlotTableBytes = 0;
+        TrackSlots();
     }
 
     void SharedArrayBufferModule::Tick(const TickInfo &info, const ModuleTickContext &) noexcept {
@@ -114,6 +333,37 @@ namespace spectre::es2025 {
         m_Metrics.gpuOptimized = m_GpuEnabled;
     }
 
+    void SharedArrayBufferModule::CollectMemory(ModuleMemoryUsage &usage) const noexcept {
+        memory::Begin(usage);
+        memory::AddSlotTable(usage, m_Slots.size(), m_FreeSlots.size(), sizeof(Slot),
+                             memory::VectorBytes(m_Slots) + memory::VectorBytes(m_FreeSlots));
+        memory::AddSlotTable(usage, m_Storages.size(), m_FreeStorages.size(), sizeof(StorageSlot),
+                             memory::VectorBytes(m_Storages) + memory::VectorBytes(m_FreeStorages));
+        for (const auto &slot: m_Slots) {
+            if (slot.inUse) {
+                auto labelBytes = memory::StringBytes(slot.record.label);
+                usage.reservedBytes += labelBytes;
+                usage.liveBytes += labelBytes;
+            }
+        }
+        for (const auto &slot: m_Storages) {
+            if (!slot.inUse || !slot.storage.memory) {
+                continue;
+            }
+            const auto &shared = *slot.storage.memory;
+            auto committed = shared.CommittedBytes();
+            auto length = shared.ByteLength();
+            usage.reservedBytes += committed;
+            usage.liveBytes += length;
+            usage.freeListBytes += committed - std::min(committed, length);
+        }
+    }
+
+    void SharedArrayBufferModule::SampleMemory(ModuleMemoryCounters &counters) const noexcept {
+        memory::Sample(counters, m_Memory, m_Slots.size() + m_Storages.size(),
+                       m_FreeSlots.size() + m_FreeStorages.size());
+    }
+
     StatusCode SharedArrayBufferModule::Create(std::string_view label,
                                                std::size_t byteLength,
                                                Handle &outHandle) {
@@ -129,41 +379,13 @@ namespace spectre::es2025 {
         if (initialByteLength > maxByteLength) {
             return StatusCode::InvalidArgument;
         }
-        auto storageIndex = AcquireStorageSlot();
-        auto &storageSlot = m_Storages[storageIndex];
-        storageSlot.inUse = true;
-        storageSlot.storage = Storage();
-        storageSlot.storage.data.resize(maxByteLength);
-        storageSlot.storage.byteLength = initialByteLength;
-        storageSlot.storage.maxByteLength = maxByteLength;
-        storageSlot.storage.refCount = 1;
-        storageSlot.storage.resizable = (initialByteLength != maxByteLength);
-        storageSlot.storage.version = 1;
-        storageSlot.storage.lastTouchFrame = m_CurrentFrame;
-        storageSlot.storage.hot = true;
+        auto memory = SharedMemory::Allocate(initialByteLength, maxByteLength);
+        if (!memory) {
+            return StatusCode::CapacityExceeded;
+        }
         m_Metrics.allocations += 1;
         m_Metrics.bytesAllocated += maxByteLength;
-        m_Metrics.bytesInUse += initialByteLength;
-
-        auto slotIndex = AcquireSlot();
-        auto &slot = m_Slots[slotIndex];
-        slot.inUse = true;
-        slot.record = BufferRecord();
-        slot.record.slot = slotIndex;
-        slot.record.generation = slot.generation;
-        slot.record.storageIndex = storageIndex;
-        slot.record.storageGeneration = storageSlot.generation;
-        slot.record.label = label.empty()
-                                ? std::string("shared.buffer.").append(std::to_string(slotIndex))
-                                : std::string(label);
-        slot.record.lastTouchFrame = m_CurrentFrame;
-        slot.record.hot = true;
-        slot.record.handle = EncodeHandle(slotIndex, slot.generation);
-        m_Metrics.hotBuffers += 1;
-        m_Metrics.lastFrameTouched = m_CurrentFrame;
-
-        outHandle = slot.record.handle;
-        return StatusCode::Ok;
+        return Adopt(std::move(memory), label, "shared.buffer.", outHandle);
     }
 
     StatusCode SharedArrayBufferModule::Share(Handle handle,
@@ -179,27 +401,55 @@ namespace spectre::es2025 {
             return StatusCode::InvalidArgument;
         }
         storage->refCount += 1;
+        storage->hot = true;
+        storage->lastTouchFrame = m_CurrentFrame;
+        // AcquireSlot can grow m_Slots, so copy what the new record needs before calling it.
+        auto storageIndex = record->storageIndex;
+        auto storageGeneration = record->storageGeneration;
         auto slotIndex = AcquireSlot();
         auto &slot = m_Slots[slotIndex];
         slot.inUse = true;
         slot.record = BufferRecord();
         slot.record.slot = slotIndex;
         slot.record.generation = slot.generation;
-        slot.record.storageIndex = record->storageIndex;
-        slot.record.storageGeneration = record->storageGeneration;
+        slot.record.storageIndex = storageIndex;
+        slot.record.storageGeneration = storageGeneration;
         slot.record.label = label.empty()
                                 ? std::string("shared.share.").append(std::to_string(slotIndex))
                                 : std::string(label);
+        m_Memory.Allocate(memory::StringBytes(slot.record.label));
         slot.record.lastTouchFrame = m_CurrentFrame;
         slot.record.hot = true;
-        storage->hot = true;
-        storage->lastTouchFrame = m_CurrentFrame;
         slot.record.handle = EncodeHandle(slotIndex, slot.generation);
         outHandle = slot.record.handle;
         m_Metrics.shares += 1;
         return StatusCode::Ok;
     }
 
+    StatusCode SharedArrayBufferModule::Export(Handle handle, MemoryRef &outMemory) {
+        outMemory.reset();
+        auto *record = Find(handle);
+        if (!record) {
+            return StatusCode::NotFound;
+        }
+        const auto *storage = ResolveStorage(*record);
+        if (!storage || !storage->memory) {
+            return StatusCode::InvalidArgument;
+        }
+        outMemory = storage->memory;
+        m_Metrics.exports += 1;
+        return StatusCode::Ok;
+    }
+
+    StatusCode SharedArrayBufferModule::Import(MemoryRef memory, std::string_view label, Handle &outHandle) {
+        outHandle = 0;
+        if (!memory) {
+            return StatusCode::InvalidArgument;
+        }
+        m_Metrics.imports += 1;
+        return Adopt(std::move(memory), label, "shared.import.", outHandle);
+    }
+
     StatusCode SharedArrayBufferModule::Slice(Handle handle,
                                               std::size_t begin,
                                               std::size_t end,
@@ -211,7 +461,9 @@ namespace spectre::es2025 {
             return StatusCode::NotFound;
         }
         auto *storage = ResolveStorage(*record);
-        if (!storage || begin > end || end > storage->byteLength) {
+        // Hold the source memory itself: Create below may grow the storage table.
+        auto source = storage ? storage->memory : MemoryRef();
+        if (!source || begin > end || end > source->ByteLength()) {
             return StatusCode::InvalidArgument;
         }
         auto length = end - begin;
@@ -227,9 +479,8 @@ namespace spectre::es2025 {
             return StatusCode::InternalError;
         }
         if (length > 0) {
-            std::memcpy(sliceStorage->data.data(), storage->data.data() + begin, length);
+            std::memcpy(sliceStorage->memory->Data(), source->Data() + begin, length);
         }
-        sliceStorage->byteLength = length;
         outHandle = sliceHandle;
         m_Metrics.slices += 1;
         return StatusCode::Ok;
@@ -241,13 +492,19 @@ namespace spectre::es2025 {
             return StatusCode::NotFound;
         }
         auto *storage = ResolveStorage(*record);
-        if (!storage || !storage->resizable) {
+        if (!storage || !storage->memory || !storage->memory->Resizable()) {
             return StatusCode::InvalidArgument;
         }
-        if (newByteLength > storage->maxByteLength) {
-            return StatusCode::CapacityExceeded;
+        auto status = storage->memory->Grow(newByteLength);
+        if (status != StatusCode::Ok) {
+            return status;
         }
-        storage->byteLength = newByteLength;
+        // Another runtime may have grown the memory further; account for what is visible now.
+        auto length = storage->memory->ByteLength();
+        m_Metrics.bytesInUse = m_Metrics.bytesInUse - std::min<std::uint64_t>(m_Metrics.bytesInUse,
+                                                                              storage->accountedBytes) + length;
+        m_Memory.Resize(storage->accountedBytes, length);
+        storage->accountedBytes = length;
         storage->lastTouchFrame = m_CurrentFrame;
         storage->hot = true;
         record->lastTouchFrame = m_CurrentFrame;
@@ -269,11 +526,11 @@ namespace spectre::es2025 {
             }
             if (storageSlot->storage.refCount == 0) {
                 m_Metrics.releases += 1;
-                if (storageSlot->storage.byteLength <= m_Metrics.bytesInUse) {
-                    m_Metrics.bytesInUse -= storageSlot->storage.byteLength;
-                }
-                storageSlot->storage.data.clear();
-                storageSlot->storage.byteLength = 0;
+                m_Metrics.bytesInUse -= std::min<std::uint64_t>(m_Metrics.bytesInUse,
+                                                                storageSlot->storage.accountedBytes);
+                m_Memory.Free(storageSlot->storage.accountedBytes);
+                // Frees the memory only if no other runtime or exported reference still holds it.
+                storageSlot->storage.memory.reset();
                 storageSlot->storage.hot = false;
                 ReleaseStorageSlot(storageIndex);
             }
@@ -291,11 +548,12 @@ namespace spectre::es2025 {
             return StatusCode::InvalidArgument;
         }
         auto *storage = ResolveStorage(*record);
-        if (!storage || offset > storage->byteLength || (offset + size) > storage->byteLength) {
+        auto length = storage && storage->memory ? storage->memory->ByteLength() : 0;
+        if (!storage || offset > length || size > length - offset) {
             return StatusCode::InvalidArgument;
         }
         if (size > 0) {
-            std::memcpy(storage->data.data() + offset, data, size);
+            std::memcpy(storage->memory->Data() + offset, data, size);
         }
         Touch(*record, *storage);
         return StatusCode::Ok;
@@ -310,11 +568,12 @@ namespace spectre::es2025 {
             return StatusCode::InvalidArgument;
         }
         auto *storage = ResolveStorage(*record);
-        if (!storage || offset > storage->byteLength || (offset + size) > storage->byteLength) {
+        auto length = storage && storage->memory ? storage->memory->ByteLength() : 0;
+        if (!storage || offset > length || size > length - offset) {
             return StatusCode::InvalidArgument;
         }
         if (size > 0) {
-            std::memcpy(data, storage->data.data() + offset, size);
+            std::memcpy(data, storage->memory->Data() + offset, size);
         }
         return StatusCode::Ok;
     }
@@ -325,13 +584,268 @@ namespace spectre::es2025 {
             return StatusCode::NotFound;
         }
         auto *storage = ResolveStorage(*record);
-        if (!storage) {
+        if (!storage || !storage->memory) {
             return StatusCode::InvalidArgument;
         }
-        outBytes.assign(storage->data.begin(), storage->data.begin() + storage->byteLength);
+        const auto *bytes = storage->memory->Data();
+        outBytes.assign(bytes, bytes + storage->memory->ByteLength());
+        return StatusCode::Ok;
+    }
+
+    template<typename T>
+    StatusCode SharedArrayBufferModule::AtomicLoad(Handle handle, std::size_t byteOffset, T &outValue) const noexcept {
+        auto *lane = ResolveLane<T>(handle, byteOffset);
+        if (!lane) {
+            return Has(handle) ? StatusCode::InvalidArgument : StatusCode::NotFound;
+        }
+        outValue = std::atomic_ref<T>(*lane).load(std::memory_order_seq_cst);
+        return StatusCode::Ok;
+    }
+
+    template<typename T>
+    StatusCode SharedArrayBufferModule::AtomicStore(Handle handle, std::size_t byteOffset, T value) noexcept {
+        auto *lane = ResolveLane<T>(handle, byteOffset);
+        if (!lane) {
+            return Has(handle) ? StatusCode::InvalidArgument : StatusCode::NotFound;
+        }
+        std::atomic_ref<T>(*lane).store(value, std::memory_order_seq_cst);
+        return StatusCode::Ok;
+    }
+
+    template<typename T>
+    StatusCode SharedArrayBufferModule::AtomicAdd(Handle handle, std::size_t byteOffset, T value,
+                                                  T &outPrevious) noexcept {
+        auto *lane = ResolveLane<T>(handle, byteOffset);
+        if (!lane) {
+            return Has(handle) ? StatusCode::InvalidArgument : StatusCode::NotFound;
+        }
+        outPrevious = std::atomic_ref<T>(*lane).fetch_add(value, std::memory_order_seq_cst);
         return StatusCode::Ok;
     }
 
+    template<typename T>
+    StatusCode SharedArrayBufferModule::AtomicCompareExchange(Handle handle,
+                                                              std::size_t byteOffset,
+                                                              T expected,
+                                                              T desired,
+                                                              T &outPrevious) noexcept {
+        auto *lane = ResolveLane<T>(handle, byteOffset);
+        if (!lane) {
+            return Has(handle) ? StatusCode::InvalidArgument : StatusCode::NotFound;
+        }
+        std::atomic_ref<T>(*lane).compare_exchange_strong(expected, desired, std::memory_order_seq_cst);
+        outPrevious = expected;
+        return StatusCode::Ok;
+    }
+
+    StatusCode SharedArrayBufferModule::CreateChannel(std::string_view label,
+                                                      std::uint32_t slotBytes,
+                                                      std::uint32_t capacity,
+                                                      Handle &outHandle) {
+        outHandle = 0;
+        if (slotBytes == 0 || slotBytes > kMaxChannelSlotBytes || capacity == 0 || capacity > kMaxChannelCapacity) {
+            return StatusCode::InvalidArgument;
+        }
+        ChannelHeader header{};
+        header.magic = kChannelMagic;
+        header.slotBytes = slotBytes;
+        header.capacity = std::bit_ceil(capacity);
+        header.stride = static_cast<std::uint32_t>((kChannelSlotHeader + slotBytes + (kChannelLine - 1))
+                                                   & ~(kChannelLine - 1));
+        auto byteLength = kChannelSlotsOffset + static_cast<std::size_t>(header.capacity) * header.stride;
+        Handle handle = 0;
+        auto status = CreateResizable(label.empty() ? std::string_view("shared.channel") : label,
+                                      byteLength, byteLength, handle);
+        if (status != StatusCode::Ok) {
+            return status;
+        }
+        auto *record = Find(handle);
+        auto *base = ResolveStorage(*record)->memory->Data();
+        std::memcpy(base, &header, sizeof(header));
+        // Slot i starts free for the producer claiming position i. Nothing else can see the
+        // buffer yet, so relaxed stores suffice; Export/Import publishes them.
+        for (std::uint64_t position = 0; position < header.capacity; ++position) {
+            SlotSequence(ChannelSlot(base, header, position)).store(position, std::memory_order_relaxed);
+        }
+        m_Metrics.channelsCreated += 1;
+        outHandle = handle;
+        return StatusCode::Ok;
+    }
+
+    StatusCode SharedArrayBufferModule::ChannelSend(Handle handle,
+                                                    std::span<const std::span<const std::uint8_t>> messages,
+                                                    std::size_t &outSent) {
+        outSent = 0;
+        auto *base = ResolveChannel(handle);
+        if (!base) {
+            return Has(handle) ? StatusCode::InvalidArgument : StatusCode::NotFound;
+        }
+        auto header = ReadChannelHeader(base);
+        for (const auto &message: messages) {
+            if (message.size() > header.slotBytes) {
+                return StatusCode::InvalidArgument;
+            }
+        }
+        auto tail = ChannelWord(base, kChannelTailOffset);
+        std::size_t sent = 0;
+        while (sent < messages.size()) {
+            auto position = tail.load(std::memory_order_relaxed);
+            // A slot is free for position p once its sequence reads p; count the free run.
+            std::size_t claim = 0;
+            auto wanted = std::min<std::size_t>(messages.size() - sent, header.capacity);
+            while (claim < wanted
+                   && SlotSequence(ChannelSlot(base, header, position + claim)).load(std::memory_order_acquire)
+                   == position + claim) {
+                ++claim;
+            }
+            if (claim == 0) {
+                auto sequence = SlotSequence(ChannelSlot(base, header, position)).load(std::memory_order_acquire);
+                if (static_cast<std::int64_t>(sequence - position) < 0) {
+                    m_Metrics.sendBackpressure += 1;
+                    break;
+                }
+                continue;
+            }
+            if (!tail.compare_exchange_weak(position, position + claim, std::memory_order_relaxed)) {
+                continue;
+            }
+            for (std::size_t i = 0; i < claim; ++i) {
+                const auto &message = messages[sent + i];
+                auto *slot = ChannelSlot(base, header, position + i);
+                auto length = static_cast<std::uint32_t>(message.size());
+                std::memcpy(slot + 8, &m_CurrentFrame, sizeof(m_CurrentFrame));
+                std::memcpy(slot + 16, &length, sizeof(length));
+                if (length > 0) {
+                    std::memcpy(slot + kChannelSlotHeader, message.data(), length);
+                }
+                SlotSequence(slot).store(position + i + 1, std::memory_order_release);
+            }
+            sent += claim;
+        }
+        if (sent > 0) {
+            SignalChannel(base + kChannelTailOffset);
+        }
+        m_Metrics.messagesSent += sent;
+        outSent = sent;
+        return StatusCode::Ok;
+    }
+
+    StatusCode SharedArrayBufferModule::ChannelReceive(Handle handle,
+                                                       std::vector<ChannelMessage> &outMessages,
+                                                       std::size_t maxMessages) {
+        auto *base = ResolveChannel(handle);
+        if (!base) {
+            outMessages.clear();
+            return Has(handle) ? StatusCode::InvalidArgument : StatusCode::NotFound;
+        }
+        auto header = ReadChannelHeader(base);
+        auto head = ChannelWord(base, kChannelHeadOffset);
+        std::size_t received = 0;
+        while (received < maxMessages) {
+            auto position = head.load(std::memory_order_relaxed);
+            // A slot holds the message for position p once its sequence reads p + 1.
+            std::size_t claim = 0;
+            auto wanted = std::min<std::size_t>(maxMessages - received, header.capacity);
+            while (claim < wanted
+                   && SlotSequence(ChannelSlot(base, header, position + claim)).load(std::memory_order_acquire)
+                   == position + claim + 1) {
+                ++claim;
+            }
+            if (claim == 0) {
+                auto sequence = SlotSequence(ChannelSlot(base, header, position)).load(std::memory_order_acquire);
+                if (static_cast<std::int64_t>(sequence - (position + 1)) < 0) {
+                    break;
+                }
+                continue;
+            }
+            // Everything that can allocate happens before the claim: the message array grows and each
+            // target reserves a full slot payload, so the copies after the CAS cannot throw and a
+            // bad_alloc leaves the messages in the ring. Never shrink mid-call so earlier byte
+            // vectors keep their capacity.
+            if (outMessages.size() < received + claim) {
+                outMessages.resize(received + claim);
+            }
+            for (std::size_t i = 0; i < claim; ++i) {
+                outMessages[received + i].bytes.reserve(header.slotBytes);
+            }
+            if (!head.compare_exchange_weak(position, position + claim, std::memory_order_relaxed)) {
+                continue;
+            }
+            for (std::size_t i = 0; i < claim; ++i) {
+                auto &message = outMessages[received + i];
+                auto *slot = ChannelSlot(base, header, position + i);
+                std::uint32_t length = 0;
+                std::memcpy(&message.epoch, slot + 8, sizeof(message.epoch));
+                std::memcpy(&length, slot + 16, sizeof(length));
+                length = std::min(length, header.slotBytes);
+                message.sequence = position + i;
+                message.bytes.assign(slot + kChannelSlotHeader, slot + kChannelSlotHeader + length);
+                SlotSequence(slot).store(position + i + header.capacity, std::memory_order_release);
+            }
+            received += claim;
+        }
+        outMessages.resize(received);
+        if (received > 0) {
+            SignalChannel(base + kChannelHeadOffset);
+        }
+        m_Metrics.messagesReceived += received;
+        return StatusCode::Ok;
+    }
+
+    StatusCode SharedArrayBufferModule::ChannelReceiveWait(Handle handle,
+                                                           std::vector<ChannelMessage> &outMessages,
+                                                           std::size_t maxMessages) {
+        auto *base = ResolveChannel(handle);
+        if (!base) {
+            outMessages.clear();
+            return Has(handle) ? StatusCode::InvalidArgument : StatusCode::NotFound;
+        }
+        auto *line = base + kChannelTailOffset;
+        while (true) {
+            // Read the signal before trying so a send landing in between cannot be slept through.
+            auto seen = ChannelLane(line, kChannelSignalOffset).load(std::memory_order_seq_cst);
+            auto status = ChannelReceive(handle, outMessages, maxMessages);
+            if (status != StatusCode::Ok || !outMessages.empty() || maxMessages == 0) {
+                return status;
+            }
+            m_Metrics.channelWaits += 1;
+            ParkChannel(line, seen);
+        }
+    }
+
+    StatusCode SharedArrayBufferModule::ChannelSendWait(Handle handle,
+                                                        std::span<const std::span<const std::uint8_t>> messages) {
+        auto *base = ResolveChannel(handle);
+        if (!base) {
+            return Has(handle) ? StatusCode::InvalidArgument : StatusCode::NotFound;
+        }
+        auto *line = base + kChannelHeadOffset;
+        while (!messages.empty()) {
+            auto seen = ChannelLane(line, kChannelSignalOffset).load(std::memory_order_seq_cst);
+            std::size_t sent = 0;
+            auto status = ChannelSend(handle, messages, sent);
+            if (status != StatusCode::Ok) {
+                return status;
+            }
+            messages = messages.subspan(sent);
+            if (!messages.empty()) {
+                m_Metrics.channelWaits += 1;
+                ParkChannel(line, seen);
+            }
+        }
+        return StatusCode::Ok;
+    }
+
+    std::size_t SharedArrayBufferModule::ChannelPending(Handle handle) const noexcept {
+        auto *base = ResolveChannel(handle);
+        if (!base) {
+            return 0;
+        }
+        auto head = ChannelWord(base, kChannelHeadOffset).load(std::memory_order_acquire);
+        auto tail = ChannelWord(base, kChannelTailOffset).load(std::memory_order_acquire);
+        return tail > head ? static_cast<std::size_t>(tail - head) : 0;
+    }
+
     bool SharedArrayBufferModule::Has(Handle handle) const noexcept {
         return Find(handle) != nullptr;
     }
@@ -339,19 +853,19 @@ namespace spectre::es2025 {
     std::size_t SharedArrayBufferModule::ByteLength(Handle handle) const noexcept {
         auto *record = Find(handle);
         auto *storage = record ? ResolveStorage(*record) : nullptr;
-        return storage ? storage->byteLength : 0;
+        return storage && storage->memory ? storage->memory->ByteLength() : 0;
     }
 
     std::size_t SharedArrayBufferModule::MaxByteLength(Handle handle) const noexcept {
         auto *record = Find(handle);
         auto *storage = record ? ResolveStorage(*record) : nullptr;
-        return storage ? storage->maxByteLength : 0;
+        return storage && storage->memory ? storage->memory->MaxByteLength() : 0;
     }
 
     bool SharedArrayBufferModule::Resizable(Handle handle) const noexcept {
         auto *record = Find(handle);
         auto *storage = record ? ResolveStorage(*record) : nullptr;
-        return storage ? storage->resizable : false;
+        return storage && storage->memory ? storage->memory->Resizable() : false;
     }
 
     std::uint32_t SharedArrayBufferModule::RefCount(Handle handle) const noexcept {
@@ -421,6 +935,81 @@ namespace spectre::es2025 {
         return &slot.storage;
     }
 
+    StatusCode SharedArrayBufferModule::Adopt(MemoryRef memory,
+                                              std::string_view label,
+                                              std::string_view prefix,
+                                              Handle &outHandle) {
+        outHandle = 0;
+        auto storageIndex = AcquireStorageSlot();
+        auto &storageSlot = m_Storages[storageIndex];
+        storageSlot.inUse = true;
+        storageSlot.storage = Storage();
+        storageSlot.storage.accountedBytes = memory->ByteLength();
+        storageSlot.storage.memory = std::move(memory);
+        storageSlot.storage.refCount = 1;
+        storageSlot.storage.version = 1;
+        storageSlot.storage.lastTouchFrame = m_CurrentFrame;
+        storageSlot.storage.hot = true;
+        auto storageGeneration = storageSlot.generation;
+        m_Metrics.bytesInUse += storageSlot.storage.accountedBytes;
+        m_Memory.Allocate(storageSlot.storage.accountedBytes);
+
+        auto slotIndex = AcquireSlot();
+        auto &slot = m_Slots[slotIndex];
+        slot.inUse = true;
+        slot.record = BufferRecord();
+        slot.record.slot = slotIndex;
+        slot.record.generation = slot.generation;
+        slot.record.storageIndex = storageIndex;
+        slot.record.storageGeneration = storageGeneration;
+        slot.record.label = label.empty() ? std::string(prefix).append(std::to_string(slotIndex)) : std::string(label);
+        m_Memory.Allocate(memory::StringBytes(slot.record.label));
+        slot.record.lastTouchFrame = m_CurrentFrame;
+        slot.record.hot = true;
+        slot.record.handle = EncodeHandle(slotIndex, slot.generation);
+        m_Metrics.hotBuffers += 1;
+        m_Metrics.lastFrameTouched = m_CurrentFrame;
+
+        outHandle = slot.record.handle;
+        return StatusCode::Ok;
+    }
+
+    template<typename T>
+    T *SharedArrayBufferModule::ResolveLane(Handle handle, std::size_t byteOffset) const noexcept {
+        static_assert(std::is_same_v<T, std::int32_t> || std::is_same_v<T, std::int64_t>,
+                      "Shared atomics operate on 32- or 64-bit lanes");
+        const auto *record = Find(handle);
+        const auto *storage = record ? ResolveStorage(*record) : nullptr;
+        if (!storage || !storage->memory) {
+            return nullptr;
+        }
+        auto length = storage->memory->ByteLength();
+        if (byteOffset % sizeof(T) != 0 || byteOffset > length || sizeof(T) > length - byteOffset) {
+            return nullptr;
+        }
+        return reinterpret_cast<T *>(storage->memory->Data() + byteOffset);
+    }
+
+    std::uint8_t *SharedArrayBufferModule::ResolveChannel(Handle handle) const noexcept {
+        const auto *record = Find(handle);
+        const auto *storage = record ? ResolveStorage(*record) : nullptr;
+        if (!storage || !storage->memory) {
+            return nullptr;
+        }
+        auto length = storage->memory->ByteLength();
+        auto *base = storage->memory->Data();
+        if (length < kChannelSlotsOffset) {
+            return nullptr;
+        }
+        auto header = ReadChannelHeader(base);
+        if (header.magic != kChannelMagic || header.capacity == 0 || !std::has_single_bit(header.capacity)
+            || header.stride < kChannelSlotHeader + header.slotBytes
+            || (length - kChannelSlotsOffset) / header.stride < header.capacity) {
+            return nullptr;
+        }
+        return base;
+    }
+
     std::uint32_t SharedArrayBufferModule::DecodeSlot(Handle handle) noexcept {
         return static_cast<std::uint32_t>(handle & kHandleSlotMask);
     }
@@ -474,6 +1063,7 @@ namespace spectre::es2025 {
         }
         auto index = static_cast<std::uint32_t>(m_Slots.size());
         m_Slots.emplace_back();
+        TrackSlots();
         auto &slot = m_Slots.back();
         slot.inUse = true;
         slot.generation = 1;
@@ -490,8 +1080,10 @@ namespace spectre::es2025 {
         }
         slot.inUse = false;
         slot.generation += 1;
+        m_Memory.Free(memory::StringBytes(slot.record.label));
         slot.record = BufferRecord();
         m_FreeSlots.push_back(slotIndex);
+        TrackSlots();
     }
 
     std::uint32_t SharedArrayBufferModule::AcquireStorageSlot() {
@@ -505,6 +1097,7 @@ namespace spectre::es2025 {
         }
         auto index = static_cast<std::uint32_t>(m_Storages.size());
         m_Storages.emplace_back();
+        TrackSlots();
         auto &slot = m_Storages.back();
         slot.inUse = true;
         slot.generation = 1;
@@ -523,5 +1116,26 @@ namespace spectre::es2025 {
         slot.generation += 1;
         slot.storage = Storage();
         m_FreeStorages.push_back(storageIndex);
+        TrackSlots();
     }
+
+    void SharedArrayBufferModule::TrackSlots() noexcept {
+        auto bytes = memory::VectorBytes(m_Slots) + memory::VectorBytes(m_FreeSlots) +
+                     memory::VectorBytes(m_Storages) + memory::VectorBytes(m_FreeStorages);
+        m_Memory.Resize(m_SlotTableBytes, bytes);
+        m_SlotTableBytes = bytes;
+    }
+
+    template StatusCode SharedArrayBufferModule::AtomicLoad<std::int32_t>(Handle, std::size_t, std::int32_t &) const noexcept;
+    template StatusCode SharedArrayBufferModule::AtomicLoad<std::int64_t>(Handle, std::size_t, std::int64_t &) const noexcept;
+    template StatusCode SharedArrayBufferModule::AtomicStore<std::int32_t>(Handle, std::size_t, std::int32_t) noexcept;
+    template StatusCode SharedArrayBufferModule::AtomicStore<std::int64_t>(Handle, std::size_t, std::int64_t) noexcept;
+    template StatusCode SharedArrayBufferModule::AtomicAdd<std::int32_t>(Handle, std::size_t, std::int32_t,
+                                                                         std::int32_t &) noexcept;
+    template StatusCode SharedArrayBufferModule::AtomicAdd<std::int64_t>(Handle, std::size_t, std::int64_t,
+                                                                         std::int64_t &) noexcept;
+    template StatusCode SharedArrayBufferModule::AtomicCompareExchange<std::int32_t>(
+        Handle, std::size_t, std::int32_t, std::int32_t, std::int32_t &) noexcept;
+    template StatusCode SharedArrayBufferModule::AtomicCompareExchange<std::int64_t>(
+        Handle, std::size_t, std::int64_t, std::int64_t, std::int64_t &) noexcept;
 }
@@ -6,6 +6,7 @@
 #include <limits>
 
 #include "spectre/runtime.h"
+#include "spectre/es2025/simd.h"
 
 namespace spectre::es2025 {
     namespace {
@@ -14,8 +15,23 @@ namespace spectre::es2025 {
         constexpr std::string_view kReference = "ECMA-262 Section 22.1";
 
         constexpr std::size_t kHotFrameWindow = 10;
-        constexpr std::size_t kInitialTextReserve = 4096;
         constexpr std::size_t kInitialInternSlots = 32;
+        constexpr std::uint32_t kPageBytes = 64 * 1024;
+        constexpr std::uint32_t kMinBlockBytes = 16;
+        constexpr std::uint32_t kNoPage = 0xffffffffu;
+        // m_AtomRefs value of an atom made by InternAtom; it is never collected.
+        constexpr std::uint32_t kPermanentAtom = 0xffffffffu;
+        // m_AtomSlots value of a collected atom id waiting in m_FreeAtoms.
+        constexpr std::uint32_t kCollectedAtom = 0xffffffffu;
+        // Pages at most this full are evacuated into free blocks of the same class.
+        constexpr double kCompactOccupancy = 0.5;
+        constexpr auto kCompactBudget = std::chrono::microseconds(200);
+        // Owner scans read the clock this often even when nothing on the page is found.
+        constexpr std::size_t kCompactScanStride = 256;
+        // Concatenations shorter than this are copied; longer ones build a rope node.
+        constexpr std::size_t kRopeThreshold = 64;
+        // Ropes deeper than this are flattened, which also bounds the traversal stacks below.
+        constexpr std::size_t kMaxRopeDepth = 128;
     }
 
     StringModule::Metrics::Metrics() noexcept
@@ -31,9 +47,62 @@ namespace spectre::es2025 {
           activeStrings(0),
           bytesInUse(0),
           bytesReserved(0),
+          arenaPages(0),
+          arenaBytes(0),
+          arenaFragmentation(0.0),
+          compactionMoves(0),
+          compactedBytes(0),
+          pagesReleased(0),
+          atoms(0),
+          inlineStrings(0),
+          ropeConcats(0),
+          flattens(0),
           gpuOptimized(false) {
     }
 
+    StringModule::PinnedView::PinnedView() noexcept : m_Module(nullptr), m_Handle(0), m_Text() {
+    }
+
+    StringModule::PinnedView::PinnedView(PinnedView &&other) noexcept
+        : m_Module(other.m_Module),
+          m_Handle(other.m_Handle),
+          m_Text(other.m_Text) {
+        other.m_Module = nullptr;
+        other.m_Handle = 0;
+        other.m_Text = {};
+    }
+
+    StringModule::PinnedView &StringModule::PinnedView::operator=(PinnedView &&other) noexcept {
+        if (this != &other) {
+            Release();
+            std::swap(m_Module, other.m_Module);
+            std::swap(m_Handle, other.m_Handle);
+            std::swap(m_Text, other.m_Text);
+        }
+        return *this;
+    }
+
+    StringModule::PinnedView::~PinnedView() {
+        Release();
+    }
+
+    bool StringModule::PinnedView::Active() const noexcept {
+        return m_Module != nullptr;
+    }
+
+    std::string_view StringModule::PinnedView::Text() const noexcept {
+        return m_Text;
+    }
+
+    void StringModule::PinnedView::Release() noexcept {
+        if (m_Module) {
+            m_Module->Unpin(m_Handle);
+        }
+        m_Module = nullptr;
+        m_Handle = 0;
+        m_Text = {};
+    }
+
     StringModule::StringModule()
         : m_Runtime(nullptr),
           m_Subsystems(nullptr),
@@ -43,11 +112,23 @@ namespace spectre::es2025 {
           m_CurrentFrame(0),
           m_Slots{},
           m_FreeSlots{},
-          m_TextStorage{},
+          m_Pages{},
+          m_FreePages{},
+          m_FreeBlocks{},
+          m_CompactPage(kNoPage),
+          m_CompactSlotCursor(0),
+          m_CompactNodeCursor(0),
           m_InternTable{},
           m_InternCount(0),
-          m_FreeBlocks{},
-          m_Metrics() {
+          m_InternTombstones(0),
+          m_AtomSlots{},
+          m_AtomRefs{},
+          m_FreeAtoms{},
+          m_RopeNodes{},
+          m_FreeRopeNodes{},
+          m_Metrics(),
+          m_Memory(),
+          m_TableBytes(0) {
     }
 
     std::string_view StringModule::Name() const noexcept {
@@ -74,6 +155,7 @@ namespace spectre::es2025 {
     void StringModule::Tick(const TickInfo &info, const ModuleTickContext &) noexcept {
         m_CurrentFrame = info.frameIndex;
         RecomputeHotMetrics();
+        CompactText(std::chrono::steady_clock::now() + kCompactBudget);
     }
 
     void StringModule::OptimizeGpu(const ModuleGpuContext &context) noexcept {
@@ -87,16 +169,63 @@ namespace spectre::es2025 {
         m_Metrics.gpuOptimized = m_GpuEnabled;
     }
 
+    void StringModule::CollectMemory(ModuleMemoryUsage &usage) const noexcept {
+        memory::Begin(usage);
+        memory::AddSlotTable(usage, m_Slots.size(), m_FreeSlots.size(), sizeof(Slot),
+                             memory::VectorBytes(m_Slots) + memory::VectorBytes(m_FreeSlots));
+        usage.reservedBytes += m_Metrics.arenaBytes + memory::VectorBytes(m_Pages) + memory::VectorBytes(m_FreePages)
+                               + memory::VectorBytes(m_InternTable) + memory::VectorBytes(m_AtomSlots);
+        for (const auto &freeList: m_FreeBlocks) {
+            usage.reservedBytes += memory::VectorBytes(freeList);
+        }
+        usage.reservedBytes += memory::VectorBytes(m_RopeNodes) + memory::VectorBytes(m_FreeRopeNodes);
+        usage.liveBytes += memory::UsedVectorBytes(m_InternTable) + memory::UsedVectorBytes(m_AtomSlots)
+                           + memory::UsedVectorBytes(m_RopeNodes);
+        for (const auto &node: m_RopeNodes) {
+            if (node.refs != 0 && node.leaf) {
+                usage.liveBytes += node.capacity;
+            }
+        }
+        for (const auto &slot: m_Slots) {
+            if (!slot.inUse) {
+                continue;
+            }
+            auto labelBytes = memory::StringBytes(slot.entry.label);
+            usage.reservedBytes += labelBytes;
+            usage.liveBytes += labelBytes + slot.entry.capacity;
+        }
+        if (m_Metrics.arenaBytes > m_Metrics.bytesReserved) {
+            usage.freeListBytes += m_Metrics.arenaBytes - m_Metrics.bytesReserved;
+        }
+    }
+
+    void StringModule::SampleMemory(ModuleMemoryCounters &counters) const noexcept {
+        memory::Sample(counters, m_Memory, m_Slots.size(), m_FreeSlots.size());
+    }
+
     StatusCode StringModule::Create(std::string_view label, std::string_view value, Handle &outHandle) {
-        return CreateInternal(label, value, false, HashValue(value), outHandle);
+        return CreateInternal(label, value, false, 0, outHandle);
     }
 
     StatusCode StringModule::Clone(Handle handle, std::string_view label, Handle &outHandle) {
-        const auto *entry = Find(handle);
+        auto *entry = FindMutable(handle);
         if (!entry) {
             outHandle = 0;
             return StatusCode::NotFound;
         }
+        if (entry->rope) {
+            // Rope nodes are immutable, so the clone shares the whole tree.
+            auto root = entry->ropeRoot;
+            auto hash = entry->hash;
+            m_RopeNodes[root].refs += 1;
+            auto status = CreateRope(label, root, outHandle);
+            if (status != StatusCode::Ok) {
+                ReleaseNode(root);
+                return status;
+            }
+            FindMutable(outHandle)->hash = hash;
+            return status;
+        }
         auto view = ViewInternal(*entry);
         return CreateInternal(label, view, false, entry->hash, outHandle);
     }
@@ -134,21 +263,23 @@ namespace spectre::es2025 {
             m_Metrics.releases += 1;
             return StatusCode::Ok;
         }
+        if (entry->atom != kInvalidAtom) {
+            // The last reference belongs to the atom table until ReleaseAtom collects the atom.
+            return StatusCode::Ok;
+        }
+        if (entry->viewPins != 0) {
+            return StatusCode::InvalidArgument;
+        }
 
         auto slotIndex = entry->slot;
-        auto capacity = entry->capacity;
         auto length = entry->length;
         auto hash = entry->hash;
         bool pinned = entry->pinned;
 
-        if (capacity > 0) {
-            FreeText(entry->offset, capacity);
-            if (m_Metrics.bytesReserved >= capacity) {
-                m_Metrics.bytesReserved -= capacity;
-            } else {
-                m_Metrics.bytesReserved = 0;
-            }
+        if (pinned) {
+            UnfixText(*entry);
         }
+        ReleaseText(*entry);
         if (m_Metrics.bytesInUse >= length) {
             m_Metrics.bytesInUse -= length;
         } else {
@@ -163,9 +294,11 @@ namespace spectre::es2025 {
 
         auto &slot = m_Slots[slotIndex];
         slot.inUse = false;
+        m_Memory.Free(memory::StringBytes(slot.entry.label));
         slot.entry = Entry{};
         slot.entry.slot = slotIndex;
         m_FreeSlots.push_back(slotIndex);
+        TrackTables();
 
         if (pinned) {
             EraseIntern(slotIndex, hash);
@@ -173,6 +306,112 @@ namespace spectre::es2025 {
         return StatusCode::Ok;
     }
 
+    StatusCode StringModule::InternAtom(std::string_view value, Atom &outAtom) {
+        return MakeAtom(value, true, outAtom);
+    }
+
+    StatusCode StringModule::AcquireAtom(std::string_view value, Atom &outAtom) {
+        return MakeAtom(value, false, outAtom);
+    }
+
+    void StringModule::RetainAtom(Atom atom) noexcept {
+        if (IsAtom(atom) && m_AtomRefs[atom] != kPermanentAtom) {
+            m_AtomRefs[atom] += 1;
+        }
+    }
+
+    void StringModule::ReleaseAtom(Atom atom) {
+        if (!IsAtom(atom) || m_AtomRefs[atom] == kPermanentAtom || m_AtomRefs[atom] == 0) {
+            return;
+        }
+        if (--m_AtomRefs[atom] != 0) {
+            return;
+        }
+        auto &entry = m_Slots[m_AtomSlots[atom]].entry;
+        if (entry.viewPins != 0) {
+            // Collected by Unpin once the last PinnedView of its text goes away.
+            return;
+        }
+        // The id is recycled; the string drops the reference the atom table held on it.
+        m_FreeAtoms.push_back(atom);
+        entry.atom = kInvalidAtom;
+        auto handle = entry.handle;
+        m_AtomSlots[atom] = kCollectedAtom;
+        TrackTables();
+        m_Metrics.atoms -= 1;
+        Release(handle);
+    }
+
+    bool StringModule::IsAtom(Atom atom) const noexcept {
+        return atom < m_AtomSlots.size() && m_AtomSlots[atom] != kCollectedAtom;
+    }
+
+    StatusCode StringModule::MakeAtom(std::string_view value, bool permanent, Atom &outAtom) {
+        outAtom = kInvalidAtom;
+        auto hash = HashValue(value);
+        std::uint32_t slotIndex = 0;
+        if (LookupIntern(value, hash, slotIndex) && m_Slots[slotIndex].inUse) {
+            auto &entry = m_Slots[slotIndex].entry;
+            if (entry.atom != kInvalidAtom) {
+                if (permanent) {
+                    m_AtomRefs[entry.atom] = kPermanentAtom;
+                } else {
+                    RetainAtom(entry.atom);
+                }
+                outAtom = entry.atom;
+                m_Metrics.internHits += 1;
+                return StatusCode::Ok;
+            }
+        }
+        if (m_FreeAtoms.empty() && m_AtomSlots.size() >= kInvalidAtom) {
+            return StatusCode::CapacityExceeded;
+        }
+        // Both tables are grown before Intern so a failure cannot leave a string without its atom.
+        if (m_FreeAtoms.empty()) {
+            m_AtomSlots.reserve(m_AtomSlots.size() + 1);
+            m_AtomRefs.reserve(m_AtomSlots.size() + 1);
+        }
+        Handle handle = 0;
+        auto status = Intern(value, handle);
+        if (status != StatusCode::Ok) {
+            return status;
+        }
+        auto &entry = m_Slots[DecodeSlot(handle)].entry;
+        if (!m_FreeAtoms.empty()) {
+            entry.atom = m_FreeAtoms.back();
+            m_FreeAtoms.pop_back();
+            m_AtomSlots[entry.atom] = entry.slot;
+            m_AtomRefs[entry.atom] = permanent ? kPermanentAtom : 1;
+        } else {
+            entry.atom = static_cast<Atom>(m_AtomSlots.size());
+            m_AtomSlots.push_back(entry.slot);
+            m_AtomRefs.push_back(permanent ? kPermanentAtom : 1);
+        }
+        TrackTables();
+        m_Metrics.atoms += 1;
+        outAtom = entry.atom;
+        return StatusCode::Ok;
+    }
+
+    StringModule::Atom StringModule::FindAtom(std::string_view value) const noexcept {
+        std::uint32_t slotIndex = 0;
+        if (!LookupIntern(value, HashValue(value), slotIndex) || !m_Slots[slotIndex].inUse) {
+            return kInvalidAtom;
+        }
+        return m_Slots[slotIndex].entry.atom;
+    }
+
+    std::string_view StringModule::AtomView(Atom atom) const noexcept {
+        if (!IsAtom(atom)) {
+            return {};
+        }
+        return ViewInternal(m_Slots[m_AtomSlots[atom]].entry);
+    }
+
+    std::size_t StringModule::AtomCount() const noexcept {
+        return m_AtomSlots.size();
+    }
+
     StatusCode StringModule::Concat(Handle left, Handle right, std::string_view label, Handle &outHandle) {
         const auto *leftEntry = Find(left);
         const auto *rightEntry = Find(right);
@@ -186,18 +425,34 @@ namespace spectre::es2025 {
             outHandle = 0;
             return StatusCode::CapacityExceeded;
         }
-        std::string_view leftView = ViewInternal(*leftEntry);
-        std::string_view rightView = ViewInternal(*rightEntry);
-        std::string combined;
-        combined.reserve(leftLen + rightLen);
-        combined.append(leftView);
-        combined.append(rightView);
-        auto combinedView = std::string_view(combined.data(), combined.size());
-        auto status = CreateInternal(label, combinedView, false, HashValue(combinedView), outHandle);
-        if (status == StatusCode::Ok) {
-            m_Metrics.slices += 1;
+        if (leftLen + rightLen <= kRopeThreshold) {
+            // Both sides are below the rope threshold, so neither is an unflattened rope.
+            std::string combined;
+            combined.reserve(leftLen + rightLen);
+            combined.append(ViewInternal(*leftEntry));
+            combined.append(ViewInternal(*rightEntry));
+            auto status = CreateInternal(label, combined, false, 0, outHandle);
+            if (status == StatusCode::Ok) {
+                m_Metrics.slices += 1;
+            }
+            return status;
+        }
+        auto *leftMutable = FindMutable(left);
+        auto *rightMutable = FindMutable(right);
+        auto leftNode = NodeFor(*leftMutable);
+        auto rightNode = NodeFor(*rightMutable);
+        auto root = NewConcat(leftNode, rightNode);
+        auto status = CreateRope(label, root, outHandle);
+        if (status != StatusCode::Ok) {
+            ReleaseNode(root);
+            return status;
+        }
+        m_Metrics.slices += 1;
+        m_Metrics.ropeConcats += 1;
+        if (m_RopeNodes[root].depth > kMaxRopeDepth) {
+            Flatten(*FindMutable(outHandle));
         }
-        return status;
+        return StatusCode::Ok;
     }
 
     StatusCode StringModule::Slice(Handle handle,
@@ -205,11 +460,15 @@ namespace spectre::es2025 {
                                    std::size_t length,
                                    std::string_view label,
                                    Handle &outHandle) {
-        const auto *entry = Find(handle);
+        auto *entry = FindMutable(handle);
         if (!entry) {
             outHandle = 0;
             return StatusCode::NotFound;
         }
+        if (!Flatten(*entry)) {
+            outHandle = 0;
+            return StatusCode::CapacityExceeded;
+        }
         if (begin > entry->length) {
             outHandle = 0;
             return StatusCode::InvalidArgument;
@@ -220,7 +479,7 @@ namespace spectre::es2025 {
         }
         auto view = ViewInternal(*entry);
         auto slice = view.substr(begin, length);
-        auto status = CreateInternal(label, slice, false, HashValue(slice), outHandle);
+        auto status = CreateInternal(label, slice, false, 0, outHandle);
         if (status == StatusCode::Ok) {
             m_Metrics.slices += 1;
         }
@@ -235,37 +494,47 @@ namespace spectre::es2025 {
         if (!entry) {
             return StatusCode::NotFound;
         }
-        if (entry->pinned) {
+        if (IsFixed(*entry)) {
             return StatusCode::InvalidArgument;
         }
         auto required = static_cast<std::size_t>(entry->length) + suffix.size();
         if (required > std::numeric_limits<std::uint32_t>::max()) {
             return StatusCode::CapacityExceeded;
         }
-        auto currentView = ViewInternal(*entry);
-        if (required > entry->capacity) {
-            auto previousCapacity = entry->capacity;
+        if (!MakeUnique(*entry)) {
+            return StatusCode::CapacityExceeded;
+        }
+        if (entry->inlined && required <= kInlineBytes) {
+            std::memcpy(entry->inlineText.data() + entry->length, suffix.data(), suffix.size());
+        } else if (required <= entry->capacity) {
+            WriteText(entry->page, entry->offset + entry->length, suffix);
+        } else {
+            // Geometric growth keeps repeated appends amortized linear. The old block is freed
+            // only after the suffix is copied, since the suffix may be a view of it.
+            auto target = std::max<std::size_t>(required, static_cast<std::size_t>(entry->capacity) * 2);
+            target = std::min<std::size_t>(target, std::numeric_limits<std::uint32_t>::max());
+            std::uint32_t newPage = 0;
             std::uint32_t newOffset = 0;
             std::uint32_t newCapacity = 0;
-            bool reused = AllocateText(required, newOffset, newCapacity);
-            WriteText(newOffset, currentView);
-            FreeText(entry->offset, entry->capacity);
-            entry->offset = newOffset;
-            entry->capacity = newCapacity;
-            if (m_Metrics.bytesReserved >= previousCapacity) {
-                m_Metrics.bytesReserved -= previousCapacity;
+            bool reused = AllocateText(target, newPage, newOffset, newCapacity);
+            WriteText(newPage, newOffset, std::string_view(MutableText(*entry), entry->length));
+            WriteText(newPage, newOffset + entry->length, suffix);
+            if (entry->inlined) {
+                entry->inlined = false;
             } else {
-                m_Metrics.bytesReserved = 0;
+                ReleaseText(*entry);
             }
-            m_Metrics.bytesReserved += newCapacity;
+            entry->page = newPage;
+            entry->offset = newOffset;
+            entry->capacity = newCapacity;
+            ReserveText(newCapacity);
             if (reused) {
                 m_Metrics.reuseHits += 1;
             }
         }
-        WriteText(entry->offset + entry->length, suffix);
         entry->length = static_cast<std::uint32_t>(required);
         m_Metrics.bytesInUse += suffix.size();
-        entry->hash = HashValue(ViewInternal(*entry));
+        entry->hash = 0;
         Touch(*entry);
         m_Metrics.transforms += 1;
         return StatusCode::Ok;
@@ -276,20 +545,14 @@ namespace spectre::es2025 {
         if (!entry) {
             return StatusCode::NotFound;
         }
-        if (entry->pinned) {
+        if (IsFixed(*entry)) {
             return StatusCode::InvalidArgument;
         }
-        auto *data = reinterpret_cast<unsigned char *>(m_TextStorage.data() + entry->offset);
-        bool changed = false;
-        for (std::uint32_t i = 0; i < entry->length; ++i) {
-            auto c = data[i];
-            if (c >= 'a' && c <= 'z') {
-                data[i] = static_cast<unsigned char>(c - 32);
-                changed = true;
-            }
+        if (!MakeUnique(*entry)) {
+            return StatusCode::CapacityExceeded;
         }
-        if (changed) {
-            entry->hash = HashValue(ViewInternal(*entry));
+        if (simd::AsciiToUpper(MutableText(*entry), entry->length)) {
+            entry->hash = 0;
             Touch(*entry);
             m_Metrics.transforms += 1;
         }
@@ -301,20 +564,14 @@ namespace spectre::es2025 {
         if (!entry) {
             return StatusCode::NotFound;
         }
-        if (entry->pinned) {
+        if (IsFixed(*entry)) {
             return StatusCode::InvalidArgument;
         }
-        auto *data = reinterpret_cast<unsigned char *>(m_TextStorage.data() + entry->offset);
-        bool changed = false;
-        for (std::uint32_t i = 0; i < entry->length; ++i) {
-            auto c = data[i];
-            if (c >= 'A' && c <= 'Z') {
-                data[i] = static_cast<unsigned char>(c + 32);
-                changed = true;
-            }
+        if (!MakeUnique(*entry)) {
+            return StatusCode::CapacityExceeded;
         }
-        if (changed) {
-            entry->hash = HashValue(ViewInternal(*entry));
+        if (simd::AsciiToLower(MutableText(*entry), entry->length)) {
+            entry->hash = 0;
             Touch(*entry);
             m_Metrics.transforms += 1;
         }
@@ -326,20 +583,20 @@ namespace spectre::es2025 {
         if (!entry) {
             return StatusCode::NotFound;
         }
-        if (entry->pinned) {
+        if (IsFixed(*entry)) {
             return StatusCode::InvalidArgument;
         }
         if (entry->length == 0) {
             return StatusCode::Ok;
         }
-        auto *data = m_TextStorage.data() + entry->offset;
-        std::uint32_t begin = 0;
-        std::uint32_t end = entry->length;
-        while (begin < end && IsAsciiWhitespace(static_cast<unsigned char>(data[begin]))) {
-            ++begin;
+        if (!MakeUnique(*entry)) {
+            return StatusCode::CapacityExceeded;
         }
-        while (end > begin && IsAsciiWhitespace(static_cast<unsigned char>(data[end - 1]))) {
-            --end;
+        auto *data = MutableText(*entry);
+        auto begin = static_cast<std::uint32_t>(simd::LeadingAsciiWhitespace(data, entry->length));
+        auto end = entry->length;
+        if (begin < end) {
+            end -= static_cast<std::uint32_t>(simd::TrailingAsciiWhitespace(data + begin, end - begin));
         }
         if (begin == 0 && end == entry->length) {
             return StatusCode::Ok;
@@ -354,27 +611,173 @@ namespace spectre::es2025 {
             m_Metrics.bytesInUse = 0;
         }
         entry->length = newLength;
-        entry->hash = HashValue(ViewInternal(*entry));
+        entry->hash = 0;
         Touch(*entry);
         m_Metrics.transforms += 1;
         return StatusCode::Ok;
     }
 
+    StatusCode StringModule::IndexOf(Handle handle,
+                                     std::string_view needle,
+                                     std::size_t from,
+                                     std::size_t &outIndex) noexcept {
+        outIndex = kNotFound;
+        auto *entry = FindMutable(handle);
+        if (!entry) {
+            return StatusCode::NotFound;
+        }
+        auto index = simd::Find(FlatView(*entry), needle, from);
+        outIndex = index == simd::kNotFound ? kNotFound : index;
+        return StatusCode::Ok;
+    }
+
+    StatusCode StringModule::Count(Handle handle, std::string_view needle, std::size_t &outCount) noexcept {
+        outCount = 0;
+        if (needle.empty()) {
+            return StatusCode::InvalidArgument;
+        }
+        auto *entry = FindMutable(handle);
+        if (!entry) {
+            return StatusCode::NotFound;
+        }
+        outCount = simd::Count(FlatView(*entry), needle);
+        return StatusCode::Ok;
+    }
+
+    StatusCode StringModule::Split(Handle handle,
+                                   std::string_view separator,
+                                   std::string_view label,
+                                   std::vector<Handle> &outHandles) {
+        outHandles.clear();
+        auto *entry = FindMutable(handle);
+        if (!entry) {
+            return StatusCode::NotFound;
+        }
+        // Creating fields may grow the slot table, so inline source text is copied out first.
+        // Arena text never moves outside Tick.
+        std::array<char, kInlineBytes> inlineText{};
+        auto text = FlatView(*entry);
+        if (entry->inlined) {
+            std::memcpy(inlineText.data(), text.data(), text.size());
+            text = std::string_view(inlineText.data(), text.size());
+        }
+        auto fail = [&](StatusCode status) {
+            for (auto field: outHandles) {
+                Release(field);
+            }
+            outHandles.clear();
+            return status;
+        };
+        if (separator.empty() && text.empty()) {
+            // Splitting the empty string into single bytes yields no fields.
+            return StatusCode::Ok;
+        }
+        std::size_t begin = 0;
+        while (true) {
+            auto end = separator.empty()
+                           ? (begin + 1 < text.size() ? begin + 1 : simd::kNotFound)
+                           : simd::Find(text, separator, begin);
+            auto field = text.substr(begin, end == simd::kNotFound ? std::string_view::npos : end - begin);
+            Handle fieldHandle = 0;
+            auto status = CreateInternal(label, field, false, 0, fieldHandle);
+            if (status != StatusCode::Ok) {
+                return fail(status);
+            }
+            outHandles.push_back(fieldHandle);
+            if (end == simd::kNotFound) {
+                break;
+            }
+            begin = end + separator.size();
+        }
+        m_Metrics.slices += outHandles.size();
+        return StatusCode::Ok;
+    }
+
+    StatusCode StringModule::StartsWith(std::span<const Handle> handles,
+                                        std::string_view prefix,
+                                        std::span<bool> outMatches) const noexcept {
+        if (outMatches.size() < handles.size()) {
+            return StatusCode::InvalidArgument;
+        }
+        bool missing = false;
+        for (std::size_t i = 0; i < handles.size(); ++i) {
+            const auto *entry = Find(handles[i]);
+            missing |= entry == nullptr;
+            outMatches[i] = entry && MatchesAffix(*entry, prefix, false);
+        }
+        return missing ? StatusCode::NotFound : StatusCode::Ok;
+    }
+
+    StatusCode StringModule::EndsWith(std::span<const Handle> handles,
+                                      std::string_view suffix,
+                                      std::span<bool> outMatches) const noexcept {
+        if (outMatches.size() < handles.size()) {
+            return StatusCode::InvalidArgument;
+        }
+        bool missing = false;
+        for (std::size_t i = 0; i < handles.size(); ++i) {
+            const auto *entry = Find(handles[i]);
+            missing |= entry == nullptr;
+            outMatches[i] = entry && MatchesAffix(*entry, suffix, true);
+        }
+        return missing ? StatusCode::NotFound : StatusCode::Ok;
+    }
+
     bool StringModule::Has(Handle handle) const noexcept {
         return Find(handle) != nullptr;
     }
 
-    std::string_view StringModule::View(Handle handle) const noexcept {
-        const auto *entry = Find(handle);
+    std::string_view StringModule::View(Handle handle) noexcept {
+        auto *entry = FindMutable(handle);
+        return entry ? FlatView(*entry) : std::string_view();
+    }
+
+    StatusCode StringModule::PinView(Handle handle, PinnedView &outView) {
+        outView.Release();
+        auto *entry = FindMutable(handle);
         if (!entry) {
-            return {};
+            return StatusCode::NotFound;
+        }
+        if (!IsFixed(*entry)) {
+            if (!MakeUnique(*entry)) {
+                return StatusCode::CapacityExceeded;
+            }
+            FixText(*entry);
         }
-        return ViewInternal(*entry);
+        entry->viewPins += 1;
+        outView.m_Module = this;
+        outView.m_Handle = handle;
+        outView.m_Text = ViewInternal(*entry);
+        return StatusCode::Ok;
     }
 
-    std::uint64_t StringModule::Hash(Handle handle) const noexcept {
+    std::uint32_t StringModule::PinCount(Handle handle) const noexcept {
         const auto *entry = Find(handle);
-        return entry ? entry->hash : 0;
+        return entry ? entry->viewPins : 0;
+    }
+
+    void StringModule::Unpin(Handle handle) noexcept {
+        auto *entry = FindMutable(handle);
+        if (!entry || entry->viewPins == 0) {
+            return;
+        }
+        entry->viewPins -= 1;
+        // Checked before IsFixed: atom strings are interned and so always fixed.
+        if (entry->viewPins == 0 && entry->atom != kInvalidAtom && m_AtomRefs[entry->atom] == 0) {
+            // ReleaseAtom dropped the last reference while the text was pinned.
+            m_AtomRefs[entry->atom] = 1;
+            ReleaseAtom(entry->atom);
+            return;
+        }
+        if (IsFixed(*entry)) {
+            return;
+        }
+        UnfixText(*entry);
+    }
+
+    std::uint64_t StringModule::Hash(Handle handle) noexcept {
+        auto *entry = FindMutable(handle);
+        return entry ? EntryHash(*entry) : 0;
     }
 
     const StringModule::Metrics &StringModule::GetMetrics() const noexcept {
@@ -442,10 +845,6 @@ namespace spectre::es2025 {
         return static_cast<std::uint32_t>(aligned);
     }
 
-    bool StringModule::IsAsciiWhitespace(unsigned char c) noexcept {
-        return c <= 0x20;
-    }
-
     std::size_t StringModule::NextPowerOfTwo(std::size_t value) noexcept {
         if (value == 0) {
             return 1;
@@ -472,13 +871,27 @@ namespace spectre::es2025 {
     void StringModule::Reset() {
         m_Slots.clear();
         m_FreeSlots.clear();
-        m_TextStorage.clear();
-        m_TextStorage.reserve(kInitialTextReserve);
-        m_FreeBlocks.clear();
+        m_Pages.clear();
+        m_FreePages.clear();
+        for (auto &freeList: m_FreeBlocks) {
+            freeList.clear();
+        }
+        m_CompactPage = kNoPage;
+        m_CompactSlotCursor = 0;
+        m_CompactNodeCursor = 0;
         m_InternTable.assign(kInitialInternSlots, InternSlot{0, 0, InternState::Empty});
         m_InternCount = 0;
+        m_InternTombstones = 0;
+        m_AtomSlots.clear();
+        m_AtomRefs.clear();
+        m_FreeAtoms.clear();
+        m_RopeNodes.clear();
+        m_FreeRopeNodes.clear();
         m_Metrics = Metrics();
         m_Metrics.gpuOptimized = m_GpuEnabled;
+        m_Memory.Reset();
+        m_TableBytes = 0;
+        TrackTables();
         m_CurrentFrame = 0;
     }
 
@@ -498,74 +911,552 @@ namespace spectre::es2025 {
         m_Metrics.lastFrameTouched = m_CurrentFrame;
     }
 
-    void StringModule::EnsureTextCapacity(std::size_t requiredAdditionalBytes) {
-        if (requiredAdditionalBytes == 0) {
+    std::uint8_t StringModule::SizeClassFor(std::size_t length) noexcept {
+        std::size_t blockSize = kMinBlockBytes;
+        for (std::uint8_t sizeClass = 0; sizeClass < kSizeClassCount; ++sizeClass, blockSize <<= 1) {
+            if (length <= blockSize) {
+                return sizeClass;
+            }
+        }
+        return kDedicatedClass;
+    }
+
+    std::uint32_t StringModule::AcquirePage(std::uint32_t bytes, std::uint32_t blockSize, std::uint8_t sizeClass) {
+        std::unique_ptr<char[]> data(new char[bytes]);
+        std::uint32_t index = 0;
+        if (!m_FreePages.empty()) {
+            index = m_FreePages.back();
+            m_FreePages.pop_back();
+        } else {
+            m_Pages.emplace_back();
+            index = static_cast<std::uint32_t>(m_Pages.size() - 1);
+            // ReleasePage is noexcept, so the free-page list never has to grow there.
+            m_FreePages.reserve(m_Pages.size());
+            TrackTables();
+        }
+        auto &page = m_Pages[index];
+        page.data = std::move(data);
+        page.bytes = bytes;
+        page.blockSize = blockSize;
+        page.liveBlocks = 0;
+        page.fixedBlocks = 0;
+        page.sizeClass = sizeClass;
+        m_Metrics.arenaPages += 1;
+        m_Metrics.arenaBytes += bytes;
+        return index;
+    }
+
+    void StringModule::ReleasePage(std::uint32_t page) noexcept {
+        auto &textPage = m_Pages[page];
+        m_Metrics.arenaPages -= 1;
+        m_Metrics.arenaBytes -= textPage.bytes;
+        m_Metrics.pagesReleased += 1;
+        textPage = TextPage{};
+        m_FreePages.push_back(page);
+    }
+
+    bool StringModule::AllocateText(std::size_t length,
+                                    std::uint32_t &page,
+                                    std::uint32_t &offset,
+                                    std::uint32_t &capacity) {
+        page = 0;
+        offset = 0;
+        capacity = 0;
+        if (length == 0) {
+            return false;
+        }
+        auto sizeClass = SizeClassFor(length);
+        if (sizeClass == kDedicatedClass) {
+            capacity = AlignSize(length);
+            page = AcquirePage(capacity, capacity, kDedicatedClass);
+            m_Pages[page].liveBlocks = 1;
+            return false;
+        }
+        auto blockSize = kMinBlockBytes << sizeClass;
+        auto &freeList = m_FreeBlocks[sizeClass];
+        bool reused = !freeList.empty();
+        if (!reused) {
+            auto index = AcquirePage(kPageBytes, blockSize, sizeClass);
+            auto blocks = kPageBytes / blockSize;
+            // Keeping room for every block of every page lets FreeText push without allocating.
+            freeList.reserve(freeList.size() + blocks);
+            for (auto block = blocks; block-- > 0;) {
+                freeList.push_back(TextBlock{index, block * blockSize});
+            }
+        }
+        auto block = freeList.back();
+        freeList.pop_back();
+        m_Pages[block.page].liveBlocks += 1;
+        page = block.page;
+        offset = block.offset;
+        capacity = blockSize;
+        return reused;
+    }
+
+    void StringModule::FreeText(std::uint32_t page, std::uint32_t offset, std::uint32_t capacity) noexcept {
+        if (capacity == 0) {
             return;
         }
-        auto required = m_TextStorage.size() + requiredAdditionalBytes;
-        auto capacity = m_TextStorage.capacity();
-        if (capacity >= required) {
+        auto &textPage = m_Pages[page];
+        textPage.liveBlocks -= 1;
+        if (textPage.sizeClass == kDedicatedClass) {
+            ReleasePage(page);
             return;
         }
-        if (capacity == 0) {
-            capacity = kInitialTextReserve;
+        if (page == m_CompactPage) {
+            // Blocks of the page under evacuation stay out of circulation until it is released.
+            return;
         }
-        while (capacity < required) {
-            capacity *= 2;
+        m_FreeBlocks[textPage.sizeClass].push_back(TextBlock{page, offset});
+    }
+
+    char *StringModule::TextAt(std::uint32_t page, std::uint32_t offset) const noexcept {
+        return m_Pages[page].data.get() + offset;
+    }
+
+    void StringModule::WriteText(std::uint32_t page, std::uint32_t offset, std::string_view value) noexcept {
+        if (value.empty()) {
+            return;
         }
-        m_TextStorage.reserve(capacity);
+        std::memcpy(TextAt(page, offset), value.data(), value.size());
     }
 
-    bool StringModule::AllocateText(std::size_t length, std::uint32_t &offset, std::uint32_t &capacity) {
-        auto aligned = AlignSize(length);
-        for (std::size_t i = 0; i < m_FreeBlocks.size(); ++i) {
-            auto block = m_FreeBlocks[i];
-            if (block.length >= aligned) {
-                offset = block.offset;
-                capacity = block.length;
-                m_FreeBlocks[i] = m_FreeBlocks.back();
-                m_FreeBlocks.pop_back();
-                return true;
+    void StringModule::UpdateArenaMetrics() noexcept {
+        auto arena = m_Metrics.arenaBytes;
+        auto live = std::min(m_Metrics.bytesReserved, arena);
+        m_Metrics.arenaFragmentation = arena == 0 ? 0.0 : static_cast<double>(arena - live) / static_cast<double>(arena);
+    }
+
+    bool StringModule::BeginCompaction() noexcept {
+        auto target = kNoPage;
+        auto bestOccupancy = kCompactOccupancy;
+        for (std::uint32_t index = 0; index < m_Pages.size(); ++index) {
+            const auto &page = m_Pages[index];
+            if (!page.data || page.sizeClass == kDedicatedClass || page.fixedBlocks != 0) {
+                continue;
             }
+            auto totalBlocks = page.bytes / page.blockSize;
+            if (page.liveBlocks == 0) {
+                target = index;
+                break;
+            }
+            auto occupancy = static_cast<double>(page.liveBlocks) / static_cast<double>(totalBlocks);
+            if (occupancy > bestOccupancy) {
+                continue;
+            }
+            // Only evacuate when the rest of the class can absorb the live blocks without a new page.
+            auto freeHere = static_cast<std::size_t>(totalBlocks - page.liveBlocks);
+            auto freeInClass = m_FreeBlocks[page.sizeClass].size();
+            if (freeInClass < freeHere || freeInClass - freeHere < page.liveBlocks) {
+                continue;
+            }
+            target = index;
+            bestOccupancy = occupancy;
         }
-        offset = static_cast<std::uint32_t>(m_TextStorage.size());
-        capacity = aligned;
-        EnsureTextCapacity(capacity);
-        m_TextStorage.resize(static_cast<std::size_t>(offset) + capacity);
-        return false;
+        if (target == kNoPage) {
+            return false;
+        }
+        auto &freeList = m_FreeBlocks[m_Pages[target].sizeClass];
+        freeList.erase(std::remove_if(freeList.begin(), freeList.end(),
+                                      [target](const TextBlock &block) { return block.page == target; }),
+                       freeList.end());
+        m_CompactPage = target;
+        m_CompactSlotCursor = 0;
+        m_CompactNodeCursor = 0;
+        return true;
     }
 
-    void StringModule::FreeText(std::uint32_t offset, std::uint32_t capacity) {
-        if (capacity == 0) {
-            return;
-        }
-        FreeBlock freed{offset, capacity};
-        for (auto &block: m_FreeBlocks) {
-            if (block.offset + block.length == freed.offset) {
-                block.length += freed.length;
-                return;
+    bool StringModule::IsFixed(const Entry &entry) noexcept {
+        return entry.pinned || entry.viewPins != 0;
+    }
+
+    // Moves text that could still move into a block that stays put and counts that block on its
+    // page. The entry must be flat and own its text (MakeUnique).
+    void StringModule::FixText(Entry &entry) {
+        bool evacuating = !entry.inlined && entry.capacity != 0 && entry.page == m_CompactPage;
+        if (entry.length != 0 && (entry.inlined || evacuating)) {
+            std::uint32_t page = 0;
+            std::uint32_t offset = 0;
+            std::uint32_t capacity = 0;
+            if (AllocateText(entry.length, page, offset, capacity)) {
+                m_Metrics.reuseHits += 1;
             }
-            if (freed.offset + freed.length == block.offset) {
-                block.offset = freed.offset;
-                block.length += freed.length;
-                return;
+            WriteText(page, offset, std::string_view(MutableText(entry), entry.length));
+            if (entry.inlined) {
+                entry.inlined = false;
+                m_Metrics.inlineStrings -= 1;
+            } else {
+                ReleaseText(entry);
             }
+            entry.page = page;
+            entry.offset = offset;
+            entry.capacity = capacity;
+            ReserveText(capacity);
+        }
+        if (!entry.inlined && entry.capacity != 0) {
+            m_Pages[entry.page].fixedBlocks += 1;
         }
-        m_FreeBlocks.push_back(freed);
     }
 
-    void StringModule::WriteText(std::uint32_t offset, std::string_view value) noexcept {
-        if (value.empty()) {
+    void StringModule::UnfixText(const Entry &entry) noexcept {
+        if (!entry.inlined && !entry.rope && entry.capacity != 0) {
+            m_Pages[entry.page].fixedBlocks -= 1;
+        }
+    }
+
+    bool StringModule::RelocateBlock(std::uint32_t &page, std::uint32_t &offset, std::uint32_t capacity) noexcept {
+        auto &freeList = m_FreeBlocks[m_Pages[page].sizeClass];
+        if (freeList.empty()) {
+            return false;
+        }
+        auto block = freeList.back();
+        freeList.pop_back();
+        std::memcpy(TextAt(block.page, block.offset), TextAt(page, offset), capacity);
+        m_Pages[block.page].liveBlocks += 1;
+        FreeText(page, offset, capacity);
+        page = block.page;
+        offset = block.offset;
+        m_Metrics.compactionMoves += 1;
+        m_Metrics.compactedBytes += capacity;
+        return true;
+    }
+
+    void StringModule::CompactText(std::chrono::steady_clock::time_point deadline) noexcept {
+        if (m_CompactPage == kNoPage && !BeginCompaction()) {
+            UpdateArenaMetrics();
             return;
         }
-        std::memcpy(m_TextStorage.data() + offset, value.data(), value.size());
+        // Owners are found by scanning entries and rope leaves; both cursors persist so a large
+        // page is evacuated across several ticks without exceeding the budget.
+        auto target = m_CompactPage;
+        bool expired = false;
+        std::size_t scanned = 0;
+        auto checkClock = [&](bool moved) {
+            if (moved || ++scanned % kCompactScanStride == 0) {
+                expired = std::chrono::steady_clock::now() >= deadline;
+            }
+        };
+        while (m_Pages[target].liveBlocks > 0 && m_CompactSlotCursor < m_Slots.size() && !expired) {
+            auto &slot = m_Slots[m_CompactSlotCursor];
+            auto &entry = slot.entry;
+            bool moved = false;
+            if (slot.inUse && !entry.rope && !entry.inlined && entry.capacity != 0 && entry.page == target) {
+                if (!RelocateBlock(entry.page, entry.offset, entry.capacity)) {
+                    break;
+                }
+                moved = true;
+            }
+            ++m_CompactSlotCursor;
+            checkClock(moved);
+        }
+        while (m_Pages[target].liveBlocks > 0 && m_CompactSlotCursor >= m_Slots.size()
+               && m_CompactNodeCursor < m_RopeNodes.size() && !expired) {
+            auto &node = m_RopeNodes[m_CompactNodeCursor];
+            bool moved = false;
+            if (node.refs != 0 && node.leaf && node.capacity != 0 && node.page == target) {
+                if (!RelocateBlock(node.page, node.offset, node.capacity)) {
+                    break;
+                }
+                moved = true;
+            }
+            ++m_CompactNodeCursor;
+            checkClock(moved);
+        }
+        if (m_Pages[target].liveBlocks == 0) {
+            ReleasePage(target);
+            m_CompactPage = kNoPage;
+        } else if (m_CompactSlotCursor >= m_Slots.size() && m_CompactNodeCursor >= m_RopeNodes.size()) {
+            // Blocks allocated behind the cursors since the scan began; sweep again next tick.
+            m_CompactSlotCursor = 0;
+            m_CompactNodeCursor = 0;
+        }
+        UpdateArenaMetrics();
     }
 
     std::string_view StringModule::ViewInternal(const Entry &entry) const noexcept {
         if (entry.length == 0) {
             return {};
         }
-        return std::string_view(m_TextStorage.data() + entry.offset, entry.length);
+        if (entry.inlined) {
+            return std::string_view(entry.inlineText.data(), entry.length);
+        }
+        if (entry.rope) {
+            // Only a rope whose root is a single leaf has contiguous text; callers flatten first.
+            const auto &node = m_RopeNodes[entry.ropeRoot];
+            return node.leaf ? std::string_view(TextAt(node.page, node.offset), entry.length) : std::string_view();
+        }
+        return std::string_view(TextAt(entry.page, entry.offset), entry.length);
+    }
+
+    std::string_view StringModule::FlatView(Entry &entry) noexcept {
+        if (!Flatten(entry)) {
+            return {};
+        }
+        return ViewInternal(entry);
+    }
+
+    // Compares the affix with the first (or last) bytes of the string. A rope is walked from its
+    // near end, leaf by leaf, until the affix is used up, so nothing is flattened.
+    bool StringModule::MatchesAffix(const Entry &entry, std::string_view affix, bool suffix) const noexcept {
+        if (affix.size() > entry.length) {
+            return false;
+        }
+        if (!entry.rope) {
+            auto text = ViewInternal(entry);
+            return suffix ? simd::EndsWith(text, affix) : simd::StartsWith(text, affix);
+        }
+        std::array<std::uint32_t, kMaxRopeDepth + 4> stack{};
+        std::size_t top = 0;
+        stack[top++] = entry.ropeRoot;
+        std::size_t matched = 0;
+        while (top > 0 && matched < affix.size()) {
+            const auto &node = m_RopeNodes[stack[--top]];
+            if (!node.leaf) {
+                stack[top++] = suffix ? node.left : node.right;
+                stack[top++] = suffix ? node.right : node.left;
+                continue;
+            }
+            auto take = std::min<std::size_t>(node.length, affix.size() - matched);
+            const auto *text = TextAt(node.page, node.offset);
+            auto same = suffix
+                            ? std::memcmp(text + node.length - take, affix.data() + affix.size() - matched - take,
+                                          take) == 0
+                            : std::memcmp(text, affix.data() + matched, take) == 0;
+            if (!same) {
+                return false;
+            }
+            matched += take;
+        }
+        return matched == affix.size();
+    }
+
+    char *StringModule::MutableText(Entry &entry) noexcept {
+        return entry.inlined ? entry.inlineText.data() : TextAt(entry.page, entry.offset);
+    }
+
+    std::uint64_t StringModule::EntryHash(Entry &entry) noexcept {
+        if (entry.hash != 0) {
+            return entry.hash;
+        }
+        if (!Flatten(entry)) {
+            return 0;
+        }
+        entry.hash = HashValue(ViewInternal(entry));
+        return entry.hash;
+    }
+
+    bool StringModule::Flatten(Entry &entry) noexcept {
+        if (!entry.rope || m_RopeNodes[entry.ropeRoot].leaf) {
+            return true;
+        }
+        std::uint32_t page = 0;
+        std::uint32_t offset = 0;
+        std::uint32_t capacity = 0;
+        try {
+            if (AllocateText(entry.length, page, offset, capacity)) {
+                m_Metrics.reuseHits += 1;
+            }
+        } catch (...) {
+            return false;
+        }
+        // Depth-first, left to right. Each level keeps at most one pending right child.
+        std::array<std::uint32_t, kMaxRopeDepth + 4> stack{};
+        std::size_t top = 0;
+        stack[top++] = entry.ropeRoot;
+        auto *out = TextAt(page, offset);
+        while (top > 0) {
+            const auto &node = m_RopeNodes[stack[--top]];
+            if (node.leaf) {
+                std::memcpy(out, TextAt(node.page, node.offset), node.length);
+                out += node.length;
+                continue;
+            }
+            stack[top++] = node.right;
+            stack[top++] = node.left;
+        }
+        ReleaseNode(entry.ropeRoot);
+        entry.rope = false;
+        entry.ropeRoot = 0;
+        entry.page = page;
+        entry.offset = offset;
+        entry.capacity = capacity;
+        ReserveText(capacity);
+        m_Metrics.flattens += 1;
+        return true;
+    }
+
+    bool StringModule::MakeUnique(Entry &entry) noexcept {
+        if (!Flatten(entry)) {
+            return false;
+        }
+        if (!entry.rope) {
+            return true;
+        }
+        auto root = entry.ropeRoot;
+        if (m_RopeNodes[root].refs == 1) {
+            // Sole owner of the leaf: take its block back without copying.
+            auto &node = m_RopeNodes[root];
+            entry.page = node.page;
+            entry.offset = node.offset;
+            entry.capacity = node.capacity;
+            node = RopeNode{};
+            m_FreeRopeNodes.push_back(root);
+        } else {
+            std::uint32_t page = 0;
+            std::uint32_t offset = 0;
+            std::uint32_t capacity = 0;
+            try {
+                if (AllocateText(entry.length, page, offset, capacity)) {
+                    m_Metrics.reuseHits += 1;
+                }
+            } catch (...) {
+                return false;
+            }
+            const auto &node = m_RopeNodes[root];
+            std::memcpy(TextAt(page, offset), TextAt(node.page, node.offset), entry.length);
+            ReleaseNode(root);
+            entry.page = page;
+            entry.offset = offset;
+            entry.capacity = capacity;
+            ReserveText(capacity);
+        }
+        entry.rope = false;
+        entry.ropeRoot = 0;
+        return true;
+    }
+
+    void StringModule::ReleaseText(Entry &entry) noexcept {
+        if (entry.rope) {
+            ReleaseNode(entry.ropeRoot);
+            entry.rope = false;
+            entry.ropeRoot = 0;
+            return;
+        }
+        if (entry.inlined || entry.capacity == 0) {
+            return;
+        }
+        FreeText(entry.page, entry.offset, entry.capacity);
+        UnreserveText(entry.capacity);
+        entry.capacity = 0;
+    }
+
+    void StringModule::ReserveText(std::uint64_t capacity) noexcept {
+        m_Metrics.bytesReserved += capacity;
+        m_Memory.Allocate(capacity);
+    }
+
+    void StringModule::UnreserveText(std::uint64_t capacity) noexcept {
+        m_Metrics.bytesReserved -= std::min(m_Metrics.bytesReserved, capacity);
+        m_Memory.Free(capacity);
+    }
+
+    // Arena pages are not counted here; the text blocks carved from them are, via ReserveText.
+    void StringModule::TrackTables() noexcept {
+        auto bytes = memory::VectorBytes(m_Slots) + memory::VectorBytes(m_FreeSlots) + memory::VectorBytes(m_Pages)
+                     + memory::VectorBytes(m_FreePages) + memory::VectorBytes(m_InternTable)
+                     + memory::VectorBytes(m_AtomSlots) + memory::VectorBytes(m_AtomRefs)
+                     + memory::VectorBytes(m_FreeAtoms) + memory::VectorBytes(m_RopeNodes)
+                     + memory::VectorBytes(m_FreeRopeNodes);
+        m_Memory.Resize(m_TableBytes, bytes);
+        m_TableBytes = bytes;
+    }
+
+    std::uint32_t StringModule::AcquireNode() {
+        if (!m_FreeRopeNodes.empty()) {
+            auto index = m_FreeRopeNodes.back();
+            m_FreeRopeNodes.pop_back();
+            return index;
+        }
+        m_RopeNodes.emplace_back();
+        // ReleaseNode is noexcept, so the free-node list is grown alongside the node table.
+        m_FreeRopeNodes.reserve(m_RopeNodes.size());
+        TrackTables();
+        return static_cast<std::uint32_t>(m_RopeNodes.size() - 1);
+    }
+
+    std::uint32_t StringModule::NewLeaf(std::string_view text) {
+        auto index = AcquireNode();
+        std::uint32_t page = 0;
+        std::uint32_t offset = 0;
+        std::uint32_t capacity = 0;
+        if (AllocateText(text.size(), page, offset, capacity)) {
+            m_Metrics.reuseHits += 1;
+        }
+        WriteText(page, offset, text);
+        ReserveText(capacity);
+        m_RopeNodes[index] = RopeNode{0, 0, page, offset, static_cast<std::uint32_t>(text.size()), capacity, 1, 0, true};
+        return index;
+    }
+
+    std::uint32_t StringModule::NewConcat(std::uint32_t left, std::uint32_t right) {
+        auto index = AcquireNode();
+        const auto &leftNode = m_RopeNodes[left];
+        const auto &rightNode = m_RopeNodes[right];
+        auto depth = static_cast<std::uint16_t>(std::max(leftNode.depth, rightNode.depth) + 1);
+        m_RopeNodes[index] = RopeNode{left, right, 0, 0, leftNode.length + rightNode.length, 0, 1, depth, false};
+        return index;
+    }
+
+    std::uint32_t StringModule::NodeFor(Entry &entry) {
+        if (entry.rope) {
+            m_RopeNodes[entry.ropeRoot].refs += 1;
+            return entry.ropeRoot;
+        }
+        if (entry.inlined || IsFixed(entry)) {
+            // Inline text is tiny, and fixed text must stay flat and owned by its entry.
+            if (entry.inlined) {
+                std::array<char, kInlineBytes> local = entry.inlineText;
+                return NewLeaf(std::string_view(local.data(), entry.length));
+            }
+            return NewLeaf(ViewInternal(entry));
+        }
+        // Hand the flat block to a leaf shared by the entry and the new parent; the entry copies
+        // it back out only if it is mutated while the parent still holds the leaf.
+        auto index = AcquireNode();
+        m_RopeNodes[index] = RopeNode{0, 0, entry.page, entry.offset, entry.length, entry.capacity, 2, 0, true};
+        entry.rope = true;
+        entry.ropeRoot = index;
+        entry.page = 0;
+        entry.offset = 0;
+        entry.capacity = 0;
+        return index;
+    }
+
+    void StringModule::ReleaseNode(std::uint32_t index) noexcept {
+        std::array<std::uint32_t, kMaxRopeDepth + 4> stack{};
+        std::size_t top = 0;
+        stack[top++] = index;
+        while (top > 0) {
+            auto current = stack[--top];
+            auto &node = m_RopeNodes[current];
+            if (--node.refs != 0) {
+                continue;
+            }
+            if (node.leaf) {
+                FreeText(node.page, node.offset, node.capacity);
+                UnreserveText(node.capacity);
+            } else {
+                stack[top++] = node.left;
+                stack[top++] = node.right;
+            }
+            node = RopeNode{};
+            m_FreeRopeNodes.push_back(current);
+        }
+    }
+
+    StatusCode StringModule::CreateRope(std::string_view label, std::uint32_t root, Handle &outHandle) {
+        auto status = CreateInternal(label, std::string_view(), false, 0, outHandle);
+        if (status != StatusCode::Ok) {
+            return status;
+        }
+        auto &entry = *FindMutable(outHandle);
+        entry.inlined = false;
+        entry.rope = true;
+        entry.ropeRoot = root;
+        entry.length = m_RopeNodes[root].length;
+        m_Metrics.inlineStrings -= 1;
+        m_Metrics.bytesInUse += entry.length;
+        return StatusCode::Ok;
     }
 
     std::uint64_t StringModule::HashValue(std::string_view value) const noexcept {
@@ -586,11 +1477,23 @@ namespace spectre::es2025 {
         if (value.size() > std::numeric_limits<std::uint32_t>::max()) {
             return StatusCode::CapacityExceeded;
         }
+        // Small strings are copied aside before the slot table can grow and move their source.
+        // Interned text always goes to the arena so atom views survive slot-table growth.
+        std::array<char, kInlineBytes> inlineText{};
+        bool inlined = !pinned && value.size() <= kInlineBytes;
+        std::uint32_t page = 0;
         std::uint32_t offset = 0;
         std::uint32_t capacity = 0;
-        bool reused = AllocateText(value.size(), offset, capacity);
-        if (reused) {
-            m_Metrics.reuseHits += 1;
+        if (inlined) {
+            if (!value.empty()) {
+                std::memcpy(inlineText.data(), value.data(), value.size());
+            }
+        } else {
+            bool reused = AllocateText(value.size(), page, offset, capacity);
+            if (reused) {
+                m_Metrics.reuseHits += 1;
+            }
+            WriteText(page, offset, value);
         }
 
         std::uint32_t slotIndex = 0;
@@ -610,6 +1513,7 @@ namespace spectre::es2025 {
             m_Slots.push_back(slot);
             generation = 1;
         }
+        TrackTables();
 
         outHandle = EncodeHandle(slotIndex, generation);
         auto &slot = m_Slots[slotIndex];
@@ -618,23 +1522,36 @@ namespace spectre::es2025 {
         slot.entry.handle = outHandle;
         slot.entry.slot = slotIndex;
         slot.entry.generation = generation;
+        slot.entry.page = page;
         slot.entry.offset = offset;
         slot.entry.length = static_cast<std::uint32_t>(value.size());
         slot.entry.capacity = capacity;
+        slot.entry.ropeRoot = 0;
+        slot.entry.rope = false;
+        slot.entry.inlined = inlined;
+        slot.entry.inlineText = inlineText;
         slot.entry.hash = hash;
         slot.entry.refCount = 1;
+        slot.entry.atom = kInvalidAtom;
         slot.entry.label.assign(label);
+        m_Memory.Allocate(memory::StringBytes(slot.entry.label));
         slot.entry.version = 0;
         slot.entry.lastTouchFrame = m_CurrentFrame;
         slot.entry.hot = true;
         slot.entry.pinned = pinned;
+        slot.entry.viewPins = 0;
+        if (pinned) {
+            FixText(slot.entry);
+        }
 
-        WriteText(offset, value);
+        if (inlined) {
+            m_Metrics.inlineStrings += 1;
+        }
 
         m_Metrics.allocations += 1;
         m_Metrics.activeStrings += 1;
         m_Metrics.bytesInUse += value.size();
-        m_Metrics.bytesReserved += capacity;
+        ReserveText(capacity);
         m_Metrics.lastFrameTouched = m_CurrentFrame;
 
         Touch(slot.entry);
@@ -652,15 +1569,19 @@ namespace spectre::es2025 {
             return;
         }
         auto capacity = m_InternTable.size();
-        if ((m_InternCount + 1) * 10 <= capacity * 6) {
+        if ((m_InternCount + m_InternTombstones + 1) * 10 <= capacity * 6) {
             return;
         }
-        auto newCapacity = NextPowerOfTwo(capacity * 2);
+        // Collected atoms leave tombstones; when they, not live entries, fill the table it is
+        // rebuilt at the same size so lookups stay short without growing without bound.
+        auto newCapacity = (m_InternCount + 1) * 10 <= capacity * 3 ? capacity : NextPowerOfTwo(capacity * 2);
         std::vector<InternSlot> newTable(newCapacity, InternSlot{0, 0, InternState::Empty});
         auto oldTable = std::move(m_InternTable);
         m_InternTable = std::move(newTable);
+        TrackTables();
         auto previousCount = m_InternCount;
         m_InternCount = 0;
+        m_InternTombstones = 0;
         for (const auto &slot: oldTable) {
             if (slot.state == InternState::Occupied) {
                 InsertIntern(slot.slot, slot.hash);
@@ -685,7 +1606,7 @@ namespace spectre::es2025 {
                     const auto &slot = m_Slots[entry.slot];
                     if (slot.inUse) {
                         auto view = ViewInternal(slot.entry);
-                        if (view.size() == value.size() && std::memcmp(view.data(), value.data(), value.size()) == 0) {
+                        if (view.size() == value.size() && simd::Equal(view.data(), value.data(), value.size())) {
                             outSlot = entry.slot;
                             return true;
                         }
@@ -706,6 +1627,9 @@ namespace spectre::es2025 {
         while (true) {
             auto &entry = m_InternTable[index];
             if (entry.state == InternState::Empty || entry.state == InternState::Tombstone) {
+                if (entry.state == InternState::Tombstone && m_InternTombstones > 0) {
+                    m_InternTombstones -= 1;
+                }
                 entry.hash = hash;
                 entry.slot = slotIndex;
                 entry.state = InternState::Occupied;
@@ -729,6 +1653,7 @@ namespace spectre::es2025 {
             }
             if (entry.state == InternState::Occupied && entry.hash == hash && entry.slot == slotIndex) {
                 entry.state = InternState::Tombstone;
+                m_InternTombstones += 1;
                 if (m_InternCount > 0) {
                     m_InternCount -= 1;
                 }
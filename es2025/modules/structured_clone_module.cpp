@@ -284,6 +284,21 @@ namespace spectre::es2025 {
         m_Metrics.gpuOptimized = m_GpuEnabled;
     }
 
+    // Clone graphs belong to the caller; the module only keeps its serialization scratch, which
+    // holds nothing live between calls.
+    void StructuredCloneModule::CollectMemory(ModuleMemoryUsage &usage) const noexcept {
+        memory::Begin(usage);
+        usage.reservedBytes = memory::VectorBytes(m_ByteScratch) + memory::VectorBytes(m_NodeStack) +
+                              memory::VectorBytes(m_Serialized);
+        usage.freeListBytes = usage.reservedBytes;
+    }
+
+    void StructuredCloneModule::SampleMemory(ModuleMemoryCounters &counters) const noexcept {
+        m_Memory.Observe(memory::VectorBytes(m_ByteScratch) + memory::VectorBytes(m_NodeStack) +
+                         memory::VectorBytes(m_Serialized));
+        memory::Sample(counters, m_Memory.Totals(), 0, 0);
+    }
+
     StatusCode StructuredCloneModule::Clone(const Node &input, Node &outClone, const CloneOptions &options) {
         outClone = Node();
         if (!EnsureDependencies()) {
@@ -117,6 +117,29 @@ namespace spectre::es2025 {
         m_Metrics.gpuOptimized = m_GpuEnabled;
     }
 
+    void SymbolModule::CollectMemory(ModuleMemoryUsage &usage) const noexcept {
+        memory::Begin(usage);
+        memory::AddSlotTable(usage, m_Slots.size(), m_FreeSlots.size(), sizeof(Slot),
+                             memory::VectorBytes(m_Slots) + memory::VectorBytes(m_FreeSlots));
+        auto bucketBytes = memory::VectorBytes(m_GlobalBuckets);
+        usage.reservedBytes += bucketBytes;
+        usage.liveBytes += bucketBytes;
+        for (const auto &slot: m_Slots) {
+            if (!slot.inUse) {
+                continue;
+            }
+            auto bytes = memory::StringBytes(slot.entry.description) + memory::StringBytes(slot.entry.key);
+            usage.reservedBytes += bytes;
+            usage.liveBytes += bytes;
+        }
+    }
+
+    void SymbolModule::SampleMemory(ModuleMemoryCounters &counters) const noexcept {
+        m_Memory.Observe(memory::VectorBytes(m_Slots) + memory::VectorBytes(m_FreeSlots) +
+                         memory::VectorBytes(m_GlobalBuckets));
+        memory::Sample(counters, m_Memory.Totals(), m_Slots.size(), m_FreeSlots.size());
+    }
+
     StatusCode SymbolModule::Create(std::string_view description, Handle &outHandle) {
         outHandle = 0;
         if (!m_Initialized) {
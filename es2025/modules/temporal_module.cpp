@@ -204,6 +204,17 @@ namespace spectre::es2025 {
         EnsureCapacity(RecommendInstantCapacity(config));
     }
 
+    void TemporalModule::CollectMemory(ModuleMemoryUsage &usage) const noexcept {
+        memory::Begin(usage);
+        memory::AddSlotTable(usage, m_Slots.size(), m_FreeSlots.size(), sizeof(Slot),
+                             memory::VectorBytes(m_Slots) + memory::VectorBytes(m_FreeSlots));
+    }
+
+    void TemporalModule::SampleMemory(ModuleMemoryCounters &counters) const noexcept {
+        m_Memory.Observe(memory::VectorBytes(m_Slots) + memory::VectorBytes(m_FreeSlots));
+        memory::Sample(counters, m_Memory.Totals(), m_Slots.size(), m_FreeSlots.size());
+    }
+
     StatusCode TemporalModule::CreateInstant(std::string_view label,
                                              std::int64_t epochNanoseconds,
                                              Handle &outHandle,
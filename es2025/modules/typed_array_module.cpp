@@ -5,8 +5,11 @@
 #include <cmath>
 #include <cstring>
 #include <limits>
+#include <type_traits>
+#include <utility>
 
 #include "spectre/es2025/environment.h"
+#include "spectre/es2025/simd.h"
 #include "spectre/runtime.h"
 
 namespace spectre::es2025 {
@@ -48,27 +51,239 @@ namespace spectre::es2025 {
         }
 
         std::uint8_t ToUint8Clamped(double value) noexcept {
-            if (!(value == value)) {
-                return 0;
-            }
-            if (value <= 0.0) {
+            if (!(value > 0.0)) {
                 return 0;
             }
             if (value >= 255.0) {
                 return 255;
             }
-            auto rounded = std::floor(value + 0.5);
-            if (rounded > 255.0) {
-                return 255;
+            // Round half to even, matching simd::ClampToUint8.
+            return static_cast<std::uint8_t>(std::nearbyint(value));
+        }
+
+        using ElementType = TypedArrayModule::ElementType;
+        using MapOp = TypedArrayModule::MapOp;
+
+        // Storage type and number conversion for each numeric element type. Bulk operations
+        // resolve the type once through VisitNumeric and then run a loop typed on Storage.
+        template <ElementType Type>
+        struct Element;
+
+        template <ElementType Type, typename T, T (*Convert)(double) noexcept>
+        struct ElementOps {
+            static constexpr ElementType kType = Type;
+            using Storage = T;
+
+            static T From(double value) noexcept {
+                return Convert(value);
             }
-            if (rounded < 0.0) {
-                return 0;
+        };
+
+        float ToFloat32(double value) noexcept {
+            return static_cast<float>(value);
+        }
+
+        double ToFloat64(double value) noexcept {
+            return value;
+        }
+
+        template <>
+        struct Element<ElementType::Int8> : ElementOps<ElementType::Int8, std::int8_t, ClampToRange<std::int8_t>> {};
+        template <>
+        struct Element<ElementType::Uint8> : ElementOps<ElementType::Uint8, std::uint8_t, ClampUnsigned<std::uint8_t>> {};
+        template <>
+        struct Element<ElementType::Uint8Clamped> : ElementOps<ElementType::Uint8Clamped, std::uint8_t, ToUint8Clamped> {};
+        template <>
+        struct Element<ElementType::Int16> : ElementOps<ElementType::Int16, std::int16_t, ClampToRange<std::int16_t>> {};
+        template <>
+        struct Element<ElementType::Uint16> : ElementOps<ElementType::Uint16, std::uint16_t, ClampUnsigned<std::uint16_t>> {};
+        template <>
+        struct Element<ElementType::Int32> : ElementOps<ElementType::Int32, std::int32_t, ClampToRange<std::int32_t>> {};
+        template <>
+        struct Element<ElementType::Uint32> : ElementOps<ElementType::Uint32, std::uint32_t, ClampUnsigned<std::uint32_t>> {};
+        template <>
+        struct Element<ElementType::Float32> : ElementOps<ElementType::Float32, float, ToFloat32> {};
+        template <>
+        struct Element<ElementType::Float64> : ElementOps<ElementType::Float64, double, ToFloat64> {};
+
+        // Calls visit with Element<T>{} for a numeric type. Callers reject BigInt types first.
+        template <typename Visitor>
+        decltype(auto) VisitNumeric(ElementType type, Visitor &&visit) {
+            switch (type) {
+                case ElementType::Int8:
+                    return visit(Element<ElementType::Int8>{});
+                case ElementType::Uint8:
+                    return visit(Element<ElementType::Uint8>{});
+                case ElementType::Uint8Clamped:
+                    return visit(Element<ElementType::Uint8Clamped>{});
+                case ElementType::Int16:
+                    return visit(Element<ElementType::Int16>{});
+                case ElementType::Uint16:
+                    return visit(Element<ElementType::Uint16>{});
+                case ElementType::Int32:
+                    return visit(Element<ElementType::Int32>{});
+                case ElementType::Uint32:
+                    return visit(Element<ElementType::Uint32>{});
+                case ElementType::Float32:
+                    return visit(Element<ElementType::Float32>{});
+                case ElementType::Float64:
+                default:
+                    return visit(Element<ElementType::Float64>{});
             }
-            auto diff = rounded - value;
-            if (diff == 0.5 && (static_cast<std::uint64_t>(rounded) % 2) == 1) {
-                rounded -= 1.0;
+        }
+
+        template <typename Storage>
+        void WidenElements(const Storage *source, double *target, std::size_t count) noexcept {
+            if constexpr (std::is_same_v<Storage, double>) {
+                if (count != 0) {
+                    std::memmove(target, source, count * sizeof(double));
+                }
+            } else if constexpr (std::is_same_v<Storage, float>) {
+                simd::WidenFloat32(source, target, count);
+            } else {
+                for (std::size_t i = 0; i < count; ++i) {
+                    target[i] = static_cast<double>(source[i]);
+                }
+            }
+        }
+
+        template <typename E>
+        void NarrowElements(const double *source, typename E::Storage *target, std::size_t count) noexcept {
+            if constexpr (E::kType == ElementType::Float64) {
+                if (count != 0) {
+                    std::memmove(target, source, count * sizeof(double));
+                }
+            } else if constexpr (E::kType == ElementType::Float32) {
+                simd::NarrowFloat64(source, target, count);
+            } else if constexpr (E::kType == ElementType::Uint8Clamped) {
+                simd::ClampToUint8(source, target, count);
+            } else {
+                for (std::size_t i = 0; i < count; ++i) {
+                    target[i] = E::From(source[i]);
+                }
+            }
+        }
+
+        // Converts between two numeric element types through double, the same path Set takes.
+        template <typename From, typename To>
+        void ConvertElements(const typename From::Storage *source, typename To::Storage *target,
+                             std::size_t count) noexcept {
+            if constexpr (From::kType == ElementType::Float64) {
+                NarrowElements<To>(source, target, count);
+            } else if constexpr (To::kType == ElementType::Float64) {
+                WidenElements(source, target, count);
+            } else {
+                for (std::size_t i = 0; i < count; ++i) {
+                    target[i] = To::From(static_cast<double>(source[i]));
+                }
+            }
+        }
+
+        template <MapOp Op>
+        double ApplyMap(double value, double operand) noexcept {
+            if constexpr (Op == MapOp::Add) {
+                return value + operand;
+            } else if constexpr (Op == MapOp::Multiply) {
+                return value * operand;
+            } else if constexpr (Op == MapOp::Min) {
+                return value < operand || value != value ? value : operand;
+            } else if constexpr (Op == MapOp::Max) {
+                return value > operand || value != value ? value : operand;
+            } else if constexpr (Op == MapOp::Abs) {
+                return std::fabs(value);
+            } else {
+                return -value;
+            }
+        }
+
+        template <MapOp Op, typename E>
+        void MapElements(typename E::Storage *values, std::size_t count, double operand) noexcept {
+            for (std::size_t i = 0; i < count; ++i) {
+                values[i] = E::From(ApplyMap<Op>(static_cast<double>(values[i]), operand));
+            }
+        }
+
+        template <typename E>
+        void MapElements(MapOp op, typename E::Storage *values, std::size_t count, double operand) noexcept {
+            switch (op) {
+                case MapOp::Add:
+                    MapElements<MapOp::Add, E>(values, count, operand);
+                    break;
+                case MapOp::Multiply:
+                    MapElements<MapOp::Multiply, E>(values, count, operand);
+                    break;
+                case MapOp::Min:
+                    MapElements<MapOp::Min, E>(values, count, operand);
+                    break;
+                case MapOp::Max:
+                    MapElements<MapOp::Max, E>(values, count, operand);
+                    break;
+                case MapOp::Abs:
+                    MapElements<MapOp::Abs, E>(values, count, operand);
+                    break;
+                case MapOp::Negate:
+                    MapElements<MapOp::Negate, E>(values, count, operand);
+                    break;
+            }
+        }
+
+        template <typename Storage>
+        double ReduceElements(TypedArrayModule::ReduceOp op, const Storage *values, std::size_t count) noexcept {
+            using ReduceOp = TypedArrayModule::ReduceOp;
+            if constexpr (std::is_floating_point_v<Storage>) {
+                switch (op) {
+                    case ReduceOp::Min:
+                        return simd::Min(values, count);
+                    case ReduceOp::Max:
+                        return simd::Max(values, count);
+                    case ReduceOp::Sum:
+                    default:
+                        return simd::Sum(values, count);
+                }
+            } else {
+                if (op == ReduceOp::Sum) {
+                    if constexpr (sizeof(Storage) <= 4) {
+                        // A 64-bit accumulator holds the exact sum of any view of 32-bit or
+                        // narrower elements (fewer than 2^32 of them); round to double once.
+                        using Accumulator =
+                                std::conditional_t<std::is_signed_v<Storage>, std::int64_t, std::uint64_t>;
+                        Accumulator sum = 0;
+                        for (std::size_t i = 0; i < count; ++i) {
+                            sum += static_cast<Accumulator>(values[i]);
+                        }
+                        return static_cast<double>(sum);
+                    } else {
+                        // 64-bit elements: partial sums past 2^53 round in double.
+                        double sum = 0.0;
+                        for (std::size_t i = 0; i < count; ++i) {
+                            sum += static_cast<double>(values[i]);
+                        }
+                        return sum;
+                    }
+                }
+                if (count == 0) {
+                    return op == ReduceOp::Min ? std::numeric_limits<double>::infinity()
+                                               : -std::numeric_limits<double>::infinity();
+                }
+                auto best = values[0];
+                for (std::size_t i = 1; i < count; ++i) {
+                    best = op == ReduceOp::Min ? std::min(best, values[i]) : std::max(best, values[i]);
+                }
+                return static_cast<double>(best);
+            }
+        }
+
+        template <typename Storage>
+        double DotElements(const Storage *left, const Storage *right, std::size_t count) noexcept {
+            if constexpr (std::is_floating_point_v<Storage>) {
+                return simd::Dot(left, right, count);
+            } else {
+                double sum = 0.0;
+                for (std::size_t i = 0; i < count; ++i) {
+                    sum += static_cast<double>(left[i]) * static_cast<double>(right[i]);
+                }
+                return sum;
             }
-            return static_cast<std::uint8_t>(rounded);
         }
     }
 
@@ -83,6 +298,8 @@ namespace spectre::es2025 {
           copyOps(0),
           subarrayOps(0),
           clampOps(0),
+          mapOps(0),
+          reduceOps(0),
           activeViews(0),
           hotViews(0),
           lastFrameTouched(0),
@@ -99,7 +316,9 @@ namespace spectre::es2025 {
           m_CurrentFrame(0),
           m_Metrics{},
           m_Slots{},
-          m_FreeSlots{} {
+          m_FreeSlots{},
+          m_Memory{},
+          m_SlotTableBytes(0) {
     }
 
     std::string_view TypedArrayModule::Name() const noexcept {
@@ -124,6 +343,9 @@ namespace spectre::es2025 {
         m_Metrics.gpuOptimized = m_GpuEnabled;
         m_Slots.clear();
         m_FreeSlots.clear();
+        m_Memory.Reset();
+        m_SlotTableBytes = 0;
+        TrackSlots();
 
         auto &environment = context.runtime.EsEnvironment();
         auto *bufferModule = environment.FindModule("ArrayBuffer");
@@ -146,6 +368,19 @@ namespace spectre::es2025 {
         m_Metrics.gpuOptimized = m_GpuEnabled;
     }
 
+    void TypedArrayModule::CollectMemory(ModuleMemoryUsage &usage) const noexcept {
+        memory::Begin(usage);
+        memory::AddSlotTable(usage, m_Slots.size(), m_FreeSlots.size(), sizeof(SlotRecord),
+                             memory::VectorBytes(m_Slots) + memory::VectorBytes(m_FreeSlots));
+        for (const auto &slot: m_Slots) {
+            if (slot.inUse) {
+                auto labelBytes = memory::StringBytes(slot.record.label);
+                usage.reservedBytes += labelBytes;
+                usage.liveBytes += labelBytes;
+            }
+        }
+    }
+
     StatusCode TypedArrayModule::Create(ElementType type, std::size_t length, std::string_view label, Handle &outHandle) {
         outHandle = 0;
         if (!m_ArrayBufferModule) {
@@ -189,6 +424,7 @@ namespace spectre::es2025 {
         slot.record.bufferVersion = bufferRecord->version;
         slot.record.label = label.empty() ? std::string("typedarray.").append(std::to_string(slotIndex))
                                           : std::string(label);
+        m_Memory.Allocate(memory::StringBytes(slot.record.label));
         slot.record.hot = true;
         slot.record.lastTouchFrame = m_CurrentFrame;
 
@@ -252,6 +488,7 @@ namespace spectre::es2025 {
         slot.record.bufferVersion = bufferRecord->version;
         slot.record.label = label.empty() ? std::string("typedarray.view.").append(std::to_string(slotIndex))
                                           : std::string(label);
+        m_Memory.Allocate(memory::StringBytes(slot.record.label));
         slot.record.hot = true;
         slot.record.lastTouchFrame = m_CurrentFrame;
 
@@ -305,7 +542,10 @@ namespace spectre::es2025 {
             return StatusCode::NotFound;
         }
         if (record->ownsBuffer && m_ArrayBufferModule) {
-            m_ArrayBufferModule->Destroy(record->bufferHandle);
+            // A borrowed buffer stays pinned, and so does the view that owns it.
+            if (m_ArrayBufferModule->Destroy(record->bufferHandle) == StatusCode::InvalidArgument) {
+                return StatusCode::InvalidArgument;
+            }
         }
         auto slotIndex = record->slot;
         if (record->hot && m_Metrics.hotViews > 0) {
@@ -396,40 +636,13 @@ namespace spectre::es2025 {
             return StatusCode::InvalidArgument;
         }
         auto *base = bufferPtr + record->byteOffset;
-        for (std::uint32_t i = 0; i < record->length; ++i) {
-            switch (record->type) {
-                case ElementType::Int8:
-                    reinterpret_cast<std::int8_t *>(base)[i] = ClampToRange<std::int8_t>(value);
-                    break;
-                case ElementType::Uint8:
-                    reinterpret_cast<std::uint8_t *>(base)[i] = ClampUnsigned<std::uint8_t>(value);
-                    break;
-                case ElementType::Uint8Clamped:
-                    reinterpret_cast<std::uint8_t *>(base)[i] = ToUint8Clamped(value);
-                    m_Metrics.clampOps += 1;
-                    break;
-                case ElementType::Int16:
-                    reinterpret_cast<std::int16_t *>(base)[i] = ClampToRange<std::int16_t>(value);
-                    break;
-                case ElementType::Uint16:
-                    reinterpret_cast<std::uint16_t *>(base)[i] = ClampUnsigned<std::uint16_t>(value);
-                    break;
-                case ElementType::Int32:
-                    reinterpret_cast<std::int32_t *>(base)[i] = ClampToRange<std::int32_t>(value);
-                    break;
-                case ElementType::Uint32:
-                    reinterpret_cast<std::uint32_t *>(base)[i] = ClampUnsigned<std::uint32_t>(value);
-                    break;
-                case ElementType::Float32:
-                    reinterpret_cast<float *>(base)[i] = static_cast<float>(value);
-                    break;
-                case ElementType::Float64:
-                    reinterpret_cast<double *>(base)[i] = value;
-                    break;
-                case ElementType::BigInt64:
-                case ElementType::BigUint64:
-                    return StatusCode::InvalidArgument;
-            }
+        auto length = record->length;
+        VisitNumeric(record->type, [&](auto element) {
+            using E = decltype(element);
+            std::fill_n(reinterpret_cast<typename E::Storage *>(base), length, E::From(value));
+        });
+        if (record->type == ElementType::Uint8Clamped) {
+            m_Metrics.clampOps += length;
         }
         Touch(*record);
         m_Metrics.fillOps += 1;
@@ -483,41 +696,16 @@ namespace spectre::es2025 {
             return StatusCode::InvalidArgument;
         }
         auto *base = ptr + record->byteOffset;
-        switch (record->type) {
-            case ElementType::Int8:
-                reinterpret_cast<std::int8_t *>(base)[index] = ClampToRange<std::int8_t>(value);
-                break;
-            case ElementType::Uint8:
-                reinterpret_cast<std::uint8_t *>(base)[index] = ClampUnsigned<std::uint8_t>(value);
-                break;
-            case ElementType::Uint8Clamped:
-                reinterpret_cast<std::uint8_t *>(base)[index] = clamp ? ToUint8Clamped(value)
-                                                                      : ClampUnsigned<std::uint8_t>(value);
-                if (clamp) {
-                    m_Metrics.clampOps += 1;
-                }
-                break;
-            case ElementType::Int16:
-                reinterpret_cast<std::int16_t *>(base)[index] = ClampToRange<std::int16_t>(value);
-                break;
-            case ElementType::Uint16:
-                reinterpret_cast<std::uint16_t *>(base)[index] = ClampUnsigned<std::uint16_t>(value);
-                break;
-            case ElementType::Int32:
-                reinterpret_cast<std::int32_t *>(base)[index] = ClampToRange<std::int32_t>(value);
-                break;
-            case ElementType::Uint32:
-                reinterpret_cast<std::uint32_t *>(base)[index] = ClampUnsigned<std::uint32_t>(value);
-                break;
-            case ElementType::Float32:
-                reinterpret_cast<float *>(base)[index] = static_cast<float>(value);
-                break;
-            case ElementType::Float64:
-                reinterpret_cast<double *>(base)[index] = value;
-                break;
-            case ElementType::BigInt64:
-            case ElementType::BigUint64:
-                return StatusCode::InvalidArgument;
+        if (record->type == ElementType::Uint8Clamped && !clamp) {
+            base[index] = ClampUnsigned<std::uint8_t>(value);
+        } else {
+            VisitNumeric(record->type, [&](auto element) {
+                using E = decltype(element);
+                reinterpret_cast<typename E::Storage *>(base)[index] = E::From(value);
+            });
+            if (record->type == ElementType::Uint8Clamped) {
+                m_Metrics.clampOps += 1;
+            }
         }
         Touch(*record);
         m_Metrics.writeOps += 1;
@@ -562,36 +750,10 @@ namespace spectre::es2025 {
             return StatusCode::InvalidArgument;
         }
         const auto *base = ptr + record->byteOffset;
-        switch (record->type) {
-            case ElementType::Int8:
-                outValue = static_cast<double>(reinterpret_cast<const std::int8_t *>(base)[index]);
-                break;
-            case ElementType::Uint8:
-            case ElementType::Uint8Clamped:
-                outValue = static_cast<double>(reinterpret_cast<const std::uint8_t *>(base)[index]);
-                break;
-            case ElementType::Int16:
-                outValue = static_cast<double>(reinterpret_cast<const std::int16_t *>(base)[index]);
-                break;
-            case ElementType::Uint16:
-                outValue = static_cast<double>(reinterpret_cast<const std::uint16_t *>(base)[index]);
-                break;
-            case ElementType::Int32:
-                outValue = static_cast<double>(reinterpret_cast<const std::int32_t *>(base)[index]);
-                break;
-            case ElementType::Uint32:
-                outValue = static_cast<double>(reinterpret_cast<const std::uint32_t *>(base)[index]);
-                break;
-            case ElementType::Float32:
-                outValue = static_cast<double>(reinterpret_cast<const float *>(base)[index]);
-                break;
-            case ElementType::Float64:
-                outValue = reinterpret_cast<const double *>(base)[index];
-                break;
-            case ElementType::BigInt64:
-            case ElementType::BigUint64:
-                return StatusCode::InvalidArgument;
-        }
+        outValue = VisitNumeric(record->type, [&](auto element) {
+            using E = decltype(element);
+            return static_cast<double>(reinterpret_cast<const typename E::Storage *>(base)[index]);
+        });
         m_Metrics.readOps += 1;
         return StatusCode::Ok;
     }
@@ -685,38 +847,10 @@ namespace spectre::es2025 {
         }
         outValues.resize(record->length);
         const auto *base = ptr + record->byteOffset;
-        for (std::uint32_t i = 0; i < record->length; ++i) {
-            switch (record->type) {
-                case ElementType::Int8:
-                    outValues[i] = static_cast<double>(reinterpret_cast<const std::int8_t *>(base)[i]);
-                    break;
-                case ElementType::Uint8:
-                case ElementType::Uint8Clamped:
-                    outValues[i] = static_cast<double>(reinterpret_cast<const std::uint8_t *>(base)[i]);
-                    break;
-                case ElementType::Int16:
-                    outValues[i] = static_cast<double>(reinterpret_cast<const std::int16_t *>(base)[i]);
-                    break;
-                case ElementType::Uint16:
-                    outValues[i] = static_cast<double>(reinterpret_cast<const std::uint16_t *>(base)[i]);
-                    break;
-                case ElementType::Int32:
-                    outValues[i] = static_cast<double>(reinterpret_cast<const std::int32_t *>(base)[i]);
-                    break;
-                case ElementType::Uint32:
-                    outValues[i] = static_cast<double>(reinterpret_cast<const std::uint32_t *>(base)[i]);
-                    break;
-                case ElementType::Float32:
-                    outValues[i] = static_cast<double>(reinterpret_cast<const float *>(base)[i]);
-                    break;
-                case ElementType::Float64:
-                    outValues[i] = reinterpret_cast<const double *>(base)[i];
-                    break;
-                case ElementType::BigInt64:
-                case ElementType::BigUint64:
-                    return StatusCode::InvalidArgument;
-            }
-        }
+        VisitNumeric(record->type, [&](auto element) {
+            using E = decltype(element);
+            WidenElements(reinterpret_cast<const typename E::Storage *>(base), outValues.data(), outValues.size());
+        });
         m_Metrics.readOps += record->length;
         return StatusCode::Ok;
     }
@@ -747,6 +881,219 @@ namespace spectre::es2025 {
         m_Metrics.readOps += record->length;
         return StatusCode::Ok;
     }
+
+    StatusCode TypedArrayModule::SetFromSpan(Handle handle, std::span<const double> values,
+                                             std::size_t offset) noexcept {
+        auto *record = FindMutable(handle);
+        if (!record) {
+            return StatusCode::NotFound;
+        }
+        if (CheckBigInt(record->type) || offset > record->length || values.size() > record->length - offset) {
+            return StatusCode::InvalidArgument;
+        }
+        if (values.empty()) {
+            return StatusCode::Ok;
+        }
+        auto *ptr = ResolveMutablePointer(*record);
+        if (!ptr) {
+            return StatusCode::InvalidArgument;
+        }
+        auto *base = ptr + record->byteOffset;
+        VisitNumeric(record->type, [&](auto element) {
+            using E = decltype(element);
+            NarrowElements<E>(values.data(), reinterpret_cast<typename E::Storage *>(base) + offset, values.size());
+        });
+        if (record->type == ElementType::Uint8Clamped) {
+            m_Metrics.clampOps += values.size();
+        }
+        Touch(*record);
+        m_Metrics.writeOps += values.size();
+        m_Metrics.lastFrameTouched = m_CurrentFrame;
+        return StatusCode::Ok;
+    }
+
+    StatusCode TypedArrayModule::SetFrom(Handle target, Handle source, std::size_t offset) {
+        auto *targetRecord = FindMutable(target);
+        const auto *sourceRecord = Find(source);
+        if (!targetRecord || !sourceRecord) {
+            return StatusCode::NotFound;
+        }
+        auto count = static_cast<std::size_t>(sourceRecord->length);
+        if (CheckBigInt(targetRecord->type) != CheckBigInt(sourceRecord->type)
+            || offset > targetRecord->length || count > targetRecord->length - offset) {
+            return StatusCode::InvalidArgument;
+        }
+        if (count == 0) {
+            return StatusCode::Ok;
+        }
+        auto *targetPtr = ResolveMutablePointer(*targetRecord);
+        const auto *sourcePtr = ResolvePointer(*sourceRecord);
+        if (!targetPtr || !sourcePtr) {
+            return StatusCode::InvalidArgument;
+        }
+        auto *targetBase = targetPtr + targetRecord->byteOffset + offset * targetRecord->elementSize;
+        const auto *sourceBase = sourcePtr + sourceRecord->byteOffset;
+        auto sourceBytes = count * sourceRecord->elementSize;
+        // BigInt64 <-> BigUint64 conversion is modulo 2^64, so it is a plain byte copy as well.
+        if (targetRecord->type == sourceRecord->type || CheckBigInt(targetRecord->type)) {
+            std::memmove(targetBase, sourceBase, sourceBytes);
+        } else {
+            // A converting copy inside one buffer reads source elements the loop has already
+            // overwritten unless the source is staged first.
+            std::vector<std::uint8_t> staged;
+            auto targetBytes = count * targetRecord->elementSize;
+            if (targetRecord->bufferHandle == sourceRecord->bufferHandle
+                && sourceBase < targetBase + targetBytes && targetBase < sourceBase + sourceBytes) {
+                staged.assign(sourceBase, sourceBase + sourceBytes);
+                sourceBase = staged.data();
+            }
+            VisitNumeric(sourceRecord->type, [&](auto from) {
+                using From = decltype(from);
+                VisitNumeric(targetRecord->type, [&](auto to) {
+                    using To = decltype(to);
+                    ConvertElements<From, To>(reinterpret_cast<const typename From::Storage *>(sourceBase),
+                                              reinterpret_cast<typename To::Storage *>(targetBase), count);
+                });
+            });
+            if (targetRecord->type == ElementType::Uint8Clamped) {
+                m_Metrics.clampOps += count;
+            }
+        }
+        Touch(*targetRecord);
+        m_Metrics.copyOps += 1;
+        m_Metrics.readOps += count;
+        m_Metrics.writeOps += count;
+        m_Metrics.lastFrameTouched = m_CurrentFrame;
+        return StatusCode::Ok;
+    }
+
+    StatusCode TypedArrayModule::Map(Handle handle, MapOp op, double operand) noexcept {
+        auto *record = FindMutable(handle);
+        if (!record) {
+            return StatusCode::NotFound;
+        }
+        if (CheckBigInt(record->type)) {
+            return StatusCode::InvalidArgument;
+        }
+        if (record->length == 0) {
+            return StatusCode::Ok;
+        }
+        auto *ptr = ResolveMutablePointer(*record);
+        if (!ptr) {
+            return StatusCode::InvalidArgument;
+        }
+        auto *base = ptr + record->byteOffset;
+        VisitNumeric(record->type, [&](auto element) {
+            using E = decltype(element);
+            MapElements<E>(op, reinterpret_cast<typename E::Storage *>(base), record->length, operand);
+        });
+        if (record->type == ElementType::Uint8Clamped) {
+            m_Metrics.clampOps += record->length;
+        }
+        Touch(*record);
+        m_Metrics.mapOps += 1;
+        m_Metrics.readOps += record->length;
+        m_Metrics.writeOps += record->length;
+        m_Metrics.lastFrameTouched = m_CurrentFrame;
+        return StatusCode::Ok;
+    }
+
+    StatusCode TypedArrayModule::Reduce(Handle handle, ReduceOp op, double &outValue) const noexcept {
+        outValue = 0.0;
+        const auto *record = Find(handle);
+        if (!record) {
+            return StatusCode::NotFound;
+        }
+        if (CheckBigInt(record->type)) {
+            return StatusCode::InvalidArgument;
+        }
+        const std::uint8_t *base = nullptr;
+        if (record->length != 0) {
+            const auto *ptr = ResolvePointer(*record);
+            if (!ptr) {
+                return StatusCode::InvalidArgument;
+            }
+            base = ptr + record->byteOffset;
+        }
+        outValue = VisitNumeric(record->type, [&](auto element) {
+            using E = decltype(element);
+            return ReduceElements(op, reinterpret_cast<const typename E::Storage *>(base), record->length);
+        });
+        m_Metrics.reduceOps += 1;
+        m_Metrics.readOps += record->length;
+        return StatusCode::Ok;
+    }
+
+    StatusCode TypedArrayModule::Dot(Handle left, Handle right, double &outValue) const noexcept {
+        outValue = 0.0;
+        const auto *leftRecord = Find(left);
+        const auto *rightRecord = Find(right);
+        if (!leftRecord || !rightRecord) {
+            return StatusCode::NotFound;
+        }
+        if (CheckBigInt(leftRecord->type) || leftRecord->type != rightRecord->type
+            || leftRecord->length != rightRecord->length) {
+            return StatusCode::InvalidArgument;
+        }
+        if (leftRecord->length == 0) {
+            m_Metrics.reduceOps += 1;
+            return StatusCode::Ok;
+        }
+        const auto *leftPtr = ResolvePointer(*leftRecord);
+        const auto *rightPtr = ResolvePointer(*rightRecord);
+        if (!leftPtr || !rightPtr) {
+            return StatusCode::InvalidArgument;
+        }
+        const auto *leftBase = leftPtr + leftRecord->byteOffset;
+        const auto *rightBase = rightPtr + rightRecord->byteOffset;
+        outValue = VisitNumeric(leftRecord->type, [&](auto element) {
+            using Storage = typename decltype(element)::Storage;
+            return DotElements(reinterpret_cast<const Storage *>(leftBase),
+                               reinterpret_cast<const Storage *>(rightBase), leftRecord->length);
+        });
+        m_Metrics.reduceOps += 1;
+        m_Metrics.readOps += static_cast<std::uint64_t>(leftRecord->length) * 2;
+        return StatusCode::Ok;
+    }
+
+    StatusCode TypedArrayModule::BorrowBytes(Handle handle, ArrayBufferModule::Borrow &outBorrow) noexcept {
+        outBorrow.Release();
+        auto *record = FindMutable(handle);
+        if (!record) {
+            return StatusCode::NotFound;
+        }
+        // Read-only buffers can still be borrowed; the borrow carries the flag.
+        const ArrayBufferModule::BufferRecord *buffer = nullptr;
+        auto status = ResolveBuffer(std::as_const(*record), buffer);
+        if (status != StatusCode::Ok) {
+            return status;
+        }
+        status = m_ArrayBufferModule->BorrowBytes(record->bufferHandle, record->byteOffset,
+                                                  static_cast<std::size_t>(record->length) * record->elementSize,
+                                                  outBorrow);
+        if (status == StatusCode::Ok) {
+            Touch(*record);
+        }
+        return status;
+    }
+
+    StatusCode TypedArrayModule::BorrowMatching(Handle handle, std::size_t storageSize, bool isFloat, bool isSigned,
+                                                bool writable, ArrayBufferModule::Borrow &outBorrow) noexcept {
+        outBorrow.Release();
+        const auto *record = Find(handle);
+        if (!record) {
+            return StatusCode::NotFound;
+        }
+        auto traits = Traits(record->type);
+        if (traits.size != storageSize || traits.isFloat != isFloat || (!isFloat && traits.isSigned != isSigned)) {
+            return StatusCode::InvalidArgument;
+        }
+        if (writable && m_ArrayBufferModule && m_ArrayBufferModule->ReadOnly(record->bufferHandle)) {
+            return StatusCode::InvalidArgument;
+        }
+        return BorrowBytes(handle, outBorrow);
+    }
+
     const TypedArrayModule::Metrics &TypedArrayModule::GetMetrics() const noexcept {
         return m_Metrics;
     }
@@ -825,6 +1172,10 @@ namespace spectre::es2025 {
         return &slot.record;
     }
 
+    void TypedArrayModule::SampleMemory(ModuleMemoryCounters &counters) const noexcept {
+        memory::Sample(counters, m_Memory, m_Slots.size(), m_FreeSlots.size());
+    }
+
     std::uint32_t TypedArrayModule::AcquireSlot() {
         if (!m_FreeSlots.empty()) {
             auto slotIndex = m_FreeSlots.back();
@@ -836,6 +1187,7 @@ namespace spectre::es2025 {
         }
         auto slotIndex = static_cast<std::uint32_t>(m_Slots.size());
         m_Slots.emplace_back();
+        TrackSlots();
         auto &slot = m_Slots.back();
         slot.inUse = true;
         slot.generation = 1;
@@ -852,13 +1204,24 @@ namespace spectre::es2025 {
         }
         slot.inUse = false;
         slot.generation += 1;
+        m_Memory.Free(memory::StringBytes(slot.record.label));
         slot.record = ViewRecord();
         m_FreeSlots.push_back(slotIndex);
+        TrackSlots();
+    }
+
+    void TypedArrayModule::TrackSlots() noexcept {
+        auto bytes = memory::VectorBytes(m_Slots) + memory::VectorBytes(m_FreeSlots);
+        m_Memory.Resize(m_SlotTableBytes, bytes);
+        m_SlotTableBytes = bytes;
     }
 
     void TypedArrayModule::Reset() {
         m_Slots.clear();
         m_FreeSlots.clear();
+        m_Memory.Reset();
+        m_SlotTableBytes = 0;
+        TrackSlots();
         m_CurrentFrame = 0;
         m_Metrics = Metrics();
         m_Metrics.gpuOptimized = m_GpuEnabled;
@@ -921,7 +1284,7 @@ namespace spectre::es2025 {
             return StatusCode::InvalidArgument;
         }
         auto *buffer = m_ArrayBufferModule->FindMutable(record.bufferHandle);
-        if (!buffer || buffer->detached) {
+        if (!buffer || buffer->detached || buffer->readOnly) {
             return StatusCode::InvalidArgument;
         }
         auto requiredBytes = static_cast<std::size_t>(record.byteOffset) +
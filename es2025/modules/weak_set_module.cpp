@@ -133,6 +133,30 @@ namespace spectre::es2025 {
         m_Metrics.gpuOptimized = m_GpuEnabled;
     }
 
+    void WeakSetModule::CollectMemory(ModuleMemoryUsage &usage) const noexcept {
+        memory::Begin(usage);
+        memory::AddSlotTable(usage, m_Slots.size(), m_FreeSlots.size(), sizeof(SlotRecord),
+                             memory::VectorBytes(m_Slots) + memory::VectorBytes(m_FreeSlots));
+        for (const auto &slot: m_Slots) {
+            if (!slot.inUse) {
+                continue;
+            }
+            const auto &record = slot.record;
+            auto labelBytes = memory::StringBytes(record.label);
+            auto tableBytes = memory::VectorBytes(record.entries) + memory::VectorBytes(record.buckets) +
+                              memory::VectorBytes(record.freeEntries);
+            auto idleEntryBytes = static_cast<std::uint64_t>(record.entries.capacity() - record.size) * sizeof(Entry);
+            usage.reservedBytes += labelBytes + tableBytes;
+            usage.liveBytes += labelBytes + tableBytes - idleEntryBytes;
+            usage.freeListBytes += idleEntryBytes;
+        }
+    }
+
+    void WeakSetModule::SampleMemory(ModuleMemoryCounters &counters) const noexcept {
+        m_Memory.Observe(memory::VectorBytes(m_Slots) + memory::VectorBytes(m_FreeSlots));
+        memory::Sample(counters, m_Memory.Totals(), m_Slots.size(), m_FreeSlots.size());
+    }
+
     StatusCode WeakSetModule::Create(std::string_view label, Handle &outHandle) {
         outHandle = 0;
         std::uint32_t slotIndex;
@@ -0,0 +1,979 @@
+#include "spectre/es2025/simd.h"
+
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#if defined(__x86_64__) || defined(_M_X64) || (defined(__i386__) && defined(__SSE2__))
+#define SPECTRE_SIMD_SSE2 1
+#include <immintrin.h>
+#if defined(__GNUC__) || defined(__clang__)
+#define SPECTRE_SIMD_AVX2 1
+#endif
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define SPECTRE_SIMD_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace spectre::es2025::simd {
+    namespace {
+        struct Kernels {
+            Level level;
+            bool (*toUpper)(char *, std::size_t) noexcept;
+            bool (*toLower)(char *, std::size_t) noexcept;
+            std::size_t (*leadingSpace)(const char *, std::size_t) noexcept;
+            std::size_t (*trailingSpace)(const char *, std::size_t) noexcept;
+            bool (*equal)(const char *, const char *, std::size_t) noexcept;
+            std::size_t (*find)(const char *, std::size_t, const char *, std::size_t) noexcept;
+            void (*widen)(const float *, double *, std::size_t) noexcept;
+            void (*narrow)(const double *, float *, std::size_t) noexcept;
+            void (*clampToUint8)(const double *, std::uint8_t *, std::size_t) noexcept;
+            double (*sumFloat32)(const float *, std::size_t) noexcept;
+            double (*sumFloat64)(const double *, std::size_t) noexcept;
+            double (*dotFloat32)(const float *, const float *, std::size_t) noexcept;
+            double (*dotFloat64)(const double *, const double *, std::size_t) noexcept;
+            double (*minFloat32)(const float *, std::size_t) noexcept;
+            double (*minFloat64)(const double *, std::size_t) noexcept;
+            double (*maxFloat32)(const float *, std::size_t) noexcept;
+            double (*maxFloat64)(const double *, std::size_t) noexcept;
+            void (*byteSwap16)(void *, std::size_t) noexcept;
+            void (*byteSwap32)(void *, std::size_t) noexcept;
+            void (*byteSwap64)(void *, std::size_t) noexcept;
+        };
+
+        // Scalar kernels also finish the sub-vector tails of every wider level.
+
+        template<char First, char Last>
+        bool FlipCaseScalar(char *data, std::size_t length) noexcept {
+            bool changed = false;
+            for (std::size_t i = 0; i < length; ++i) {
+                auto c = data[i];
+                if (c >= First && c <= Last) {
+                    data[i] = static_cast<char>(c ^ 0x20);
+                    changed = true;
+                }
+            }
+            return changed;
+        }
+
+        bool IsSpace(char c) noexcept {
+            return static_cast<unsigned char>(c) <= 0x20;
+        }
+
+        std::size_t LeadingSpaceScalar(const char *data, std::size_t length) noexcept {
+            std::size_t count = 0;
+            while (count < length && IsSpace(data[count])) {
+                ++count;
+            }
+            return count;
+        }
+
+        std::size_t TrailingSpaceScalar(const char *data, std::size_t length) noexcept {
+            std::size_t count = 0;
+            while (count < length && IsSpace(data[length - 1 - count])) {
+                ++count;
+            }
+            return count;
+        }
+
+        bool EqualScalar(const char *left, const char *right, std::size_t length) noexcept {
+            return length == 0 || std::memcmp(left, right, length) == 0;
+        }
+
+        std::size_t FindScalar(const char *haystack, std::size_t length, const char *needle,
+                               std::size_t needleLength) noexcept {
+            if (needleLength > length) {
+                return kNotFound;
+            }
+            auto last = length - needleLength;
+            for (std::size_t i = 0; i <= last;) {
+                const auto *hit = static_cast<const char *>(std::memchr(haystack + i, needle[0], last - i + 1));
+                if (!hit) {
+                    return kNotFound;
+                }
+                auto offset = static_cast<std::size_t>(hit - haystack);
+                if (std::memcmp(hit + 1, needle + 1, needleLength - 1) == 0) {
+                    return offset;
+                }
+                i = offset + 1;
+            }
+            return kNotFound;
+        }
+
+        template<typename Source, typename Target>
+        void ConvertScalar(const Source *source, Target *target, std::size_t count) noexcept {
+            for (std::size_t i = 0; i < count; ++i) {
+                target[i] = static_cast<Target>(source[i]);
+            }
+        }
+
+        void ClampToUint8Scalar(const double *source, std::uint8_t *target, std::size_t count) noexcept {
+            for (std::size_t i = 0; i < count; ++i) {
+                auto value = source[i];
+                if (!(value > 0.0)) {
+                    target[i] = 0;
+                } else if (value >= 255.0) {
+                    target[i] = 255;
+                } else {
+                    target[i] = static_cast<std::uint8_t>(std::nearbyint(value));
+                }
+            }
+        }
+
+        template<typename T>
+        double SumScalar(const T *values, std::size_t count) noexcept {
+            double sum = 0.0;
+            for (std::size_t i = 0; i < count; ++i) {
+                sum += static_cast<double>(values[i]);
+            }
+            return sum;
+        }
+
+        template<typename T>
+        double DotScalar(const T *left, const T *right, std::size_t count) noexcept {
+            double sum = 0.0;
+            for (std::size_t i = 0; i < count; ++i) {
+                sum += static_cast<double>(left[i]) * static_cast<double>(right[i]);
+            }
+            return sum;
+        }
+
+        // Folds values into seed; wider levels pass their partial lane result as the seed.
+        template<bool Maximum, typename T>
+        double ExtremeScalar(const T *values, std::size_t count, double seed) noexcept {
+            auto result = seed;
+            for (std::size_t i = 0; i < count; ++i) {
+                auto value = static_cast<double>(values[i]);
+                if (value != value) {
+                    return std::numeric_limits<double>::quiet_NaN();
+                }
+                if (Maximum ? value > result : value < result) {
+                    result = value;
+                }
+            }
+            return result;
+        }
+
+        template<bool Maximum>
+        constexpr double kExtremeSeed = Maximum
+                                            ? -std::numeric_limits<double>::infinity()
+                                            : std::numeric_limits<double>::infinity();
+
+        template<bool Maximum, typename T>
+        double ExtremeOfScalar(const T *values, std::size_t count) noexcept {
+            return ExtremeScalar<Maximum>(values, count, kExtremeSeed<Maximum>);
+        }
+
+        inline std::uint16_t SwapBytes(std::uint16_t value) noexcept {
+            return static_cast<std::uint16_t>((value >> 8) | (value << 8));
+        }
+
+        inline std::uint32_t SwapBytes(std::uint32_t value) noexcept {
+            return (value >> 24) | ((value >> 8) & 0x0000ff00u) | ((value << 8) & 0x00ff0000u) | (value << 24);
+        }
+
+        inline std::uint64_t SwapBytes(std::uint64_t value) noexcept {
+            return (static_cast<std::uint64_t>(SwapBytes(static_cast<std::uint32_t>(value))) << 32)
+                   | SwapBytes(static_cast<std::uint32_t>(value >> 32));
+        }
+
+        // Elements go through memcpy: callers hand in float columns and unaligned record bytes.
+        template<typename T>
+        void ByteSwapScalar(void *data, std::size_t count) noexcept {
+            auto *bytes = static_cast<std::uint8_t *>(data);
+            for (std::size_t i = 0; i < count; ++i) {
+                T value;
+                std::memcpy(&value, bytes + i * sizeof(T), sizeof(T));
+                value = SwapBytes(value);
+                std::memcpy(bytes + i * sizeof(T), &value, sizeof(T));
+            }
+        }
+
+        [[maybe_unused]] constexpr Kernels kScalarKernels{
+            Level::Scalar,
+            FlipCaseScalar<'a', 'z'>,
+            FlipCaseScalar<'A', 'Z'>,
+            LeadingSpaceScalar,
+            TrailingSpaceScalar,
+            EqualScalar,
+            FindScalar,
+            ConvertScalar<float, double>,
+            ConvertScalar<double, float>,
+            ClampToUint8Scalar,
+            SumScalar<float>,
+            SumScalar<double>,
+            DotScalar<float>,
+            DotScalar<double>,
+            ExtremeOfScalar<false, float>,
+            ExtremeOfScalar<false, double>,
+            ExtremeOfScalar<true, float>,
+            ExtremeOfScalar<true, double>,
+            ByteSwapScalar<std::uint16_t>,
+            ByteSwapScalar<std::uint32_t>,
+            ByteSwapScalar<std::uint64_t>
+        };
+
+#if defined(SPECTRE_SIMD_SSE2)
+        template<char First, char Last>
+        bool FlipCaseSse2(char *data, std::size_t length) noexcept {
+            // Signed compares keep bytes >= 0x80 out of the range without extra masking.
+            const auto below = _mm_set1_epi8(static_cast<char>(First - 1));
+            const auto above = _mm_set1_epi8(static_cast<char>(Last + 1));
+            const auto flip = _mm_set1_epi8(0x20);
+            auto changed = _mm_setzero_si128();
+            std::size_t i = 0;
+            for (; i + 16 <= length; i += 16) {
+                auto *lane = reinterpret_cast<__m128i *>(data + i);
+                auto bytes = _mm_loadu_si128(lane);
+                auto mask = _mm_and_si128(_mm_cmpgt_epi8(bytes, below), _mm_cmplt_epi8(bytes, above));
+                changed = _mm_or_si128(changed, mask);
+                _mm_storeu_si128(lane, _mm_xor_si128(bytes, _mm_and_si128(mask, flip)));
+            }
+            bool tail = FlipCaseScalar<First, Last>(data + i, length - i);
+            return tail || _mm_movemask_epi8(changed) != 0;
+        }
+
+        inline unsigned SpaceMaskSse2(const char *data) noexcept {
+            auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data));
+            auto space = _mm_cmpeq_epi8(_mm_min_epu8(bytes, _mm_set1_epi8(0x20)), bytes);
+            return static_cast<unsigned>(_mm_movemask_epi8(space));
+        }
+
+        std::size_t LeadingSpaceSse2(const char *data, std::size_t length) noexcept {
+            std::size_t i = 0;
+            for (; i + 16 <= length; i += 16) {
+                auto mask = SpaceMaskSse2(data + i);
+                if (mask != 0xffffu) {
+                    return i + static_cast<std::size_t>(std::countr_one(mask));
+                }
+            }
+            return i + LeadingSpaceScalar(data + i, length - i);
+        }
+
+        std::size_t TrailingSpaceSse2(const char *data, std::size_t length) noexcept {
+            std::size_t count = 0;
+            for (; count + 16 <= length; count += 16) {
+                auto mask = SpaceMaskSse2(data + length - count - 16);
+                if (mask != 0xffffu) {
+                    return count + static_cast<std::size_t>(std::countl_one(mask << 16));
+                }
+            }
+            return count + TrailingSpaceScalar(data, length - count);
+        }
+
+        bool EqualSse2(const char *left, const char *right, std::size_t length) noexcept {
+            std::size_t i = 0;
+            for (; i + 16 <= length; i += 16) {
+                auto a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(left + i));
+                auto b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(right + i));
+                if (_mm_movemask_epi8(_mm_cmpeq_epi8(a, b)) != 0xffff) {
+                    return false;
+                }
+            }
+            return EqualScalar(left + i, right + i, length - i);
+        }
+
+        std::size_t FindSse2(const char *haystack, std::size_t length, const char *needle,
+                             std::size_t needleLength) noexcept {
+            if (needleLength > length) {
+                return kNotFound;
+            }
+            // Filter candidates on the needle's first and last byte, then confirm the middle.
+            const auto first = _mm_set1_epi8(needle[0]);
+            const auto last = _mm_set1_epi8(needle[needleLength - 1]);
+            auto positions = length - needleLength + 1;
+            std::size_t i = 0;
+            for (; i + 16 <= positions; i += 16) {
+                auto head = _mm_loadu_si128(reinterpret_cast<const __m128i *>(haystack + i));
+                auto tail = _mm_loadu_si128(reinterpret_cast<const __m128i *>(haystack + i + needleLength - 1));
+                auto mask = static_cast<unsigned>(
+                    _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(head, first), _mm_cmpeq_epi8(tail, last))));
+                while (mask != 0) {
+                    auto offset = i + static_cast<std::size_t>(std::countr_zero(mask));
+                    if (needleLength <= 2 || std::memcmp(haystack + offset + 1, needle + 1, needleLength - 2) == 0) {
+                        return offset;
+                    }
+                    mask &= mask - 1;
+                }
+            }
+            auto rest = FindScalar(haystack + i, length - i, needle, needleLength);
+            return rest == kNotFound ? kNotFound : i + rest;
+        }
+
+        void WidenSse2(const float *source, double *target, std::size_t count) noexcept {
+            std::size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                auto lanes = _mm_loadu_ps(source + i);
+                _mm_storeu_pd(target + i, _mm_cvtps_pd(lanes));
+                _mm_storeu_pd(target + i + 2, _mm_cvtps_pd(_mm_movehl_ps(lanes, lanes)));
+            }
+            ConvertScalar(source + i, target + i, count - i);
+        }
+
+        void NarrowSse2(const double *source, float *target, std::size_t count) noexcept {
+            std::size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                auto low = _mm_cvtpd_ps(_mm_loadu_pd(source + i));
+                auto high = _mm_cvtpd_ps(_mm_loadu_pd(source + i + 2));
+                _mm_storeu_ps(target + i, _mm_movelh_ps(low, high));
+            }
+            ConvertScalar(source + i, target + i, count - i);
+        }
+
+        void ClampToUint8Sse2(const double *source, std::uint8_t *target, std::size_t count) noexcept {
+            // maxpd returns its second operand when either is NaN, so NaN lanes become 0; cvtpd
+            // then rounds half to even under the default MXCSR mode.
+            const auto zero = _mm_setzero_pd();
+            const auto top = _mm_set1_pd(255.0);
+            std::size_t i = 0;
+            for (; i + 8 <= count; i += 8) {
+                __m128i words[4];
+                for (int lane = 0; lane < 4; ++lane) {
+                    auto values = _mm_loadu_pd(source + i + lane * 2);
+                    words[lane] = _mm_cvtpd_epi32(_mm_min_pd(_mm_max_pd(values, zero), top));
+                }
+                auto shorts = _mm_packs_epi32(_mm_unpacklo_epi64(words[0], words[1]),
+                                              _mm_unpacklo_epi64(words[2], words[3]));
+                _mm_storel_epi64(reinterpret_cast<__m128i *>(target + i),
+                                 _mm_packus_epi16(shorts, _mm_setzero_si128()));
+            }
+            ClampToUint8Scalar(source + i, target + i, count - i);
+        }
+
+        inline double HorizontalSumSse2(__m128d lanes) noexcept {
+            return _mm_cvtsd_f64(lanes) + _mm_cvtsd_f64(_mm_unpackhi_pd(lanes, lanes));
+        }
+
+        double SumFloat32Sse2(const float *values, std::size_t count) noexcept {
+            auto low = _mm_setzero_pd();
+            auto high = _mm_setzero_pd();
+            std::size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                auto lanes = _mm_loadu_ps(values + i);
+                low = _mm_add_pd(low, _mm_cvtps_pd(lanes));
+                high = _mm_add_pd(high, _mm_cvtps_pd(_mm_movehl_ps(lanes, lanes)));
+            }
+            return HorizontalSumSse2(_mm_add_pd(low, high)) + SumScalar(values + i, count - i);
+        }
+
+        double SumFloat64Sse2(const double *values, std::size_t count) noexcept {
+            auto low = _mm_setzero_pd();
+            auto high = _mm_setzero_pd();
+            std::size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                low = _mm_add_pd(low, _mm_loadu_pd(values + i));
+                high = _mm_add_pd(high, _mm_loadu_pd(values + i + 2));
+            }
+            return HorizontalSumSse2(_mm_add_pd(low, high)) + SumScalar(values + i, count - i);
+        }
+
+        double DotFloat32Sse2(const float *left, const float *right, std::size_t count) noexcept {
+            auto low = _mm_setzero_pd();
+            auto high = _mm_setzero_pd();
+            std::size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                auto a = _mm_loadu_ps(left + i);
+                auto b = _mm_loadu_ps(right + i);
+                low = _mm_add_pd(low, _mm_mul_pd(_mm_cvtps_pd(a), _mm_cvtps_pd(b)));
+                high = _mm_add_pd(high, _mm_mul_pd(_mm_cvtps_pd(_mm_movehl_ps(a, a)),
+                                                   _mm_cvtps_pd(_mm_movehl_ps(b, b))));
+            }
+            return HorizontalSumSse2(_mm_add_pd(low, high)) + DotScalar(left + i, right + i, count - i);
+        }
+
+        double DotFloat64Sse2(const double *left, const double *right, std::size_t count) noexcept {
+            auto low = _mm_setzero_pd();
+            auto high = _mm_setzero_pd();
+            std::size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                low = _mm_add_pd(low, _mm_mul_pd(_mm_loadu_pd(left + i), _mm_loadu_pd(right + i)));
+                high = _mm_add_pd(high, _mm_mul_pd(_mm_loadu_pd(left + i + 2), _mm_loadu_pd(right + i + 2)));
+            }
+            return HorizontalSumSse2(_mm_add_pd(low, high)) + DotScalar(left + i, right + i, count - i);
+        }
+
+        // minps/maxps drop NaN lanes, so a separate unordered-compare mask remembers them.
+        template<bool Maximum>
+        double ExtremeFloat32Sse2(const float *values, std::size_t count) noexcept {
+            if (count < 4) {
+                return ExtremeOfScalar<Maximum>(values, count);
+            }
+            auto best = _mm_loadu_ps(values);
+            auto nan = _mm_cmpunord_ps(best, best);
+            std::size_t i = 4;
+            for (; i + 4 <= count; i += 4) {
+                auto lanes = _mm_loadu_ps(values + i);
+                nan = _mm_or_ps(nan, _mm_cmpunord_ps(lanes, lanes));
+                best = Maximum ? _mm_max_ps(best, lanes) : _mm_min_ps(best, lanes);
+            }
+            if (_mm_movemask_ps(nan) != 0) {
+                return std::numeric_limits<double>::quiet_NaN();
+            }
+            float lanes[4];
+            _mm_storeu_ps(lanes, best);
+            return ExtremeScalar<Maximum>(values + i, count - i, ExtremeOfScalar<Maximum>(lanes, 4));
+        }
+
+        template<bool Maximum>
+        double ExtremeFloat64Sse2(const double *values, std::size_t count) noexcept {
+            if (count < 2) {
+                return ExtremeOfScalar<Maximum>(values, count);
+            }
+            auto best = _mm_loadu_pd(values);
+            auto nan = _mm_cmpunord_pd(best, best);
+            std::size_t i = 2;
+            for (; i + 2 <= count; i += 2) {
+                auto lanes = _mm_loadu_pd(values + i);
+                nan = _mm_or_pd(nan, _mm_cmpunord_pd(lanes, lanes));
+                best = Maximum ? _mm_max_pd(best, lanes) : _mm_min_pd(best, lanes);
+            }
+            if (_mm_movemask_pd(nan) != 0) {
+                return std::numeric_limits<double>::quiet_NaN();
+            }
+            double lanes[2];
+            _mm_storeu_pd(lanes, best);
+            return ExtremeScalar<Maximum>(values + i, count - i, ExtremeOfScalar<Maximum>(lanes, 2));
+        }
+
+        // SSE2 has no byte shuffle: reverse the 16-bit words of each element, then the bytes of
+        // each word.
+        inline __m128i SwapWordBytesSse2(__m128i lanes) noexcept {
+            return _mm_or_si128(_mm_slli_epi16(lanes, 8), _mm_srli_epi16(lanes, 8));
+        }
+
+        template<typename T>
+        inline __m128i SwapLanesSse2(__m128i lanes) noexcept {
+            if constexpr (sizeof(T) == 4) {
+                lanes = _mm_shufflelo_epi16(lanes, _MM_SHUFFLE(2, 3, 0, 1));
+                lanes = _mm_shufflehi_epi16(lanes, _MM_SHUFFLE(2, 3, 0, 1));
+            } else if constexpr (sizeof(T) == 8) {
+                lanes = _mm_shufflelo_epi16(lanes, _MM_SHUFFLE(0, 1, 2, 3));
+                lanes = _mm_shufflehi_epi16(lanes, _MM_SHUFFLE(0, 1, 2, 3));
+            }
+            return SwapWordBytesSse2(lanes);
+        }
+
+        template<typename T>
+        void ByteSwapSse2(void *data, std::size_t count) noexcept {
+            constexpr std::size_t kLanes = 16 / sizeof(T);
+            auto *bytes = static_cast<std::uint8_t *>(data);
+            std::size_t i = 0;
+            for (; i + kLanes <= count; i += kLanes) {
+                auto *lane = reinterpret_cast<__m128i *>(bytes + i * sizeof(T));
+                _mm_storeu_si128(lane, SwapLanesSse2<T>(_mm_loadu_si128(lane)));
+            }
+            ByteSwapScalar<T>(bytes + i * sizeof(T), count - i);
+        }
+
+        constexpr Kernels kSse2Kernels{
+            Level::Sse2,
+            FlipCaseSse2<'a', 'z'>,
+            FlipCaseSse2<'A', 'Z'>,
+            LeadingSpaceSse2,
+            TrailingSpaceSse2,
+            EqualSse2,
+            FindSse2,
+            WidenSse2,
+            NarrowSse2,
+            ClampToUint8Sse2,
+            SumFloat32Sse2,
+            SumFloat64Sse2,
+            DotFloat32Sse2,
+            DotFloat64Sse2,
+            ExtremeFloat32Sse2<false>,
+            ExtremeFloat64Sse2<false>,
+            ExtremeFloat32Sse2<true>,
+            ExtremeFloat64Sse2<true>,
+            ByteSwapSse2<std::uint16_t>,
+            ByteSwapSse2<std::uint32_t>,
+            ByteSwapSse2<std::uint64_t>
+        };
+#endif
+
+#if defined(SPECTRE_SIMD_AVX2)
+#define SPECTRE_AVX2_TARGET __attribute__((target("avx2")))
+
+        template<char First, char Last>
+        SPECTRE_AVX2_TARGET bool FlipCaseAvx2(char *data, std::size_t length) noexcept {
+            const auto below = _mm256_set1_epi8(static_cast<char>(First - 1));
+            const auto above = _mm256_set1_epi8(static_cast<char>(Last + 1));
+            const auto flip = _mm256_set1_epi8(0x20);
+            auto changed = _mm256_setzero_si256();
+            std::size_t i = 0;
+            for (; i + 32 <= length; i += 32) {
+                auto *lane = reinterpret_cast<__m256i *>(data + i);
+                auto bytes = _mm256_loadu_si256(lane);
+                auto mask = _mm256_and_si256(_mm256_cmpgt_epi8(bytes, below), _mm256_cmpgt_epi8(above, bytes));
+                changed = _mm256_or_si256(changed, mask);
+                _mm256_storeu_si256(lane, _mm256_xor_si256(bytes, _mm256_and_si256(mask, flip)));
+            }
+            bool tail = FlipCaseSse2<First, Last>(data + i, length - i);
+            return tail || !_mm256_testz_si256(changed, changed);
+        }
+
+        SPECTRE_AVX2_TARGET inline std::uint32_t SpaceMaskAvx2(const char *data) noexcept {
+            auto bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data));
+            auto space = _mm256_cmpeq_epi8(_mm256_min_epu8(bytes, _mm256_set1_epi8(0x20)), bytes);
+            return static_cast<std::uint32_t>(_mm256_movemask_epi8(space));
+        }
+
+        SPECTRE_AVX2_TARGET std::size_t LeadingSpaceAvx2(const char *data, std::size_t length) noexcept {
+            std::size_t i = 0;
+            for (; i + 32 <= length; i += 32) {
+                auto mask = SpaceMaskAvx2(data + i);
+                if (mask != 0xffffffffu) {
+                    return i + static_cast<std::size_t>(std::countr_one(mask));
+                }
+            }
+            return i + LeadingSpaceSse2(data + i, length - i);
+        }
+
+        SPECTRE_AVX2_TARGET std::size_t TrailingSpaceAvx2(const char *data, std::size_t length) noexcept {
+            std::size_t count = 0;
+            for (; count + 32 <= length; count += 32) {
+                auto mask = SpaceMaskAvx2(data + length - count - 32);
+                if (mask != 0xffffffffu) {
+                    return count + static_cast<std::size_t>(std::countl_one(mask));
+                }
+            }
+            return count + TrailingSpaceSse2(data, length - count);
+        }
+
+        SPECTRE_AVX2_TARGET bool EqualAvx2(const char *left, const char *right, std::size_t length) noexcept {
+            std::size_t i = 0;
+            for (; i + 32 <= length; i += 32) {
+                auto a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(left + i));
+                auto b = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(right + i));
+                if (static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(a, b))) != 0xffffffffu) {
+                    return false;
+                }
+            }
+            return EqualSse2(left + i, right + i, length - i);
+        }
+
+        SPECTRE_AVX2_TARGET std::size_t FindAvx2(const char *haystack, std::size_t length, const char *needle,
+                                                 std::size_t needleLength) noexcept {
+            if (needleLength > length) {
+                return kNotFound;
+            }
+            const auto first = _mm256_set1_epi8(needle[0]);
+            const auto last = _mm256_set1_epi8(needle[needleLength - 1]);
+            auto positions = length - needleLength + 1;
+            std::size_t i = 0;
+            for (; i + 32 <= positions; i += 32) {
+                auto head = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(haystack + i));
+                auto tail = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(haystack + i + needleLength - 1));
+                auto mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(
+                    _mm256_and_si256(_mm256_cmpeq_epi8(head, first), _mm256_cmpeq_epi8(tail, last))));
+                while (mask != 0) {
+                    auto offset = i + static_cast<std::size_t>(std::countr_zero(mask));
+                    if (needleLength <= 2 || std::memcmp(haystack + offset + 1, needle + 1, needleLength - 2) == 0) {
+                        return offset;
+                    }
+                    mask &= mask - 1;
+                }
+            }
+            auto rest = FindSse2(haystack + i, length - i, needle, needleLength);
+            return rest == kNotFound ? kNotFound : i + rest;
+        }
+
+        // pshufb indices that reverse every Width-byte element of a 16-byte lane.
+        template<std::size_t Width>
+        constexpr std::array<std::uint8_t, 32> kSwapOrder = [] {
+            std::array<std::uint8_t, 32> order{};
+            for (std::size_t b = 0; b < order.size(); ++b) {
+                auto inLane = b % 16;
+                order[b] = static_cast<std::uint8_t>(inLane - inLane % Width + (Width - 1 - inLane % Width));
+            }
+            return order;
+        }();
+
+        template<typename T>
+        SPECTRE_AVX2_TARGET void ByteSwapAvx2(void *data, std::size_t count) noexcept {
+            constexpr std::size_t kLanes = 32 / sizeof(T);
+            const auto order = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(kSwapOrder<sizeof(T)>.data()));
+            auto *bytes = static_cast<std::uint8_t *>(data);
+            std::size_t i = 0;
+            for (; i + kLanes <= count; i += kLanes) {
+                auto *lane = reinterpret_cast<__m256i *>(bytes + i * sizeof(T));
+                _mm256_storeu_si256(lane, _mm256_shuffle_epi8(_mm256_loadu_si256(lane), order));
+            }
+            ByteSwapSse2<T>(bytes + i * sizeof(T), count - i);
+        }
+
+#undef SPECTRE_AVX2_TARGET
+
+        // The numeric kernels are bound by memory bandwidth well before SSE2 width, so AVX2 hosts
+        // share them; byte swaps get their own kernels because pshufb does each in one step.
+        constexpr Kernels kAvx2Kernels{
+            Level::Avx2,
+            FlipCaseAvx2<'a', 'z'>,
+            FlipCaseAvx2<'A', 'Z'>,
+            LeadingSpaceAvx2,
+            TrailingSpaceAvx2,
+            EqualAvx2,
+            FindAvx2,
+            WidenSse2,
+            NarrowSse2,
+            ClampToUint8Sse2,
+            SumFloat32Sse2,
+            SumFloat64Sse2,
+            DotFloat32Sse2,
+            DotFloat64Sse2,
+            ExtremeFloat32Sse2<false>,
+            ExtremeFloat64Sse2<false>,
+            ExtremeFloat32Sse2<true>,
+            ExtremeFloat64Sse2<true>,
+            ByteSwapAvx2<std::uint16_t>,
+            ByteSwapAvx2<std::uint32_t>,
+            ByteSwapAvx2<std::uint64_t>
+        };
+#endif
+
+#if defined(SPECTRE_SIMD_NEON)
+        template<char First, char Last>
+        bool FlipCaseNeon(char *data, std::size_t length) noexcept {
+            const auto first = vdupq_n_u8(static_cast<std::uint8_t>(First));
+            const auto last = vdupq_n_u8(static_cast<std::uint8_t>(Last));
+            const auto flip = vdupq_n_u8(0x20);
+            auto changed = vdupq_n_u8(0);
+            std::size_t i = 0;
+            for (; i + 16 <= length; i += 16) {
+                auto *lane = reinterpret_cast<std::uint8_t *>(data + i);
+                auto bytes = vld1q_u8(lane);
+                auto mask = vandq_u8(vcgeq_u8(bytes, first), vcleq_u8(bytes, last));
+                changed = vorrq_u8(changed, mask);
+                vst1q_u8(lane, veorq_u8(bytes, vandq_u8(mask, flip)));
+            }
+            bool tail = FlipCaseScalar<First, Last>(data + i, length - i);
+            return tail || vmaxvq_u8(changed) != 0;
+        }
+
+        inline bool AllSpaceNeon(const char *data) noexcept {
+            auto bytes = vld1q_u8(reinterpret_cast<const std::uint8_t *>(data));
+            return vminvq_u8(vcleq_u8(bytes, vdupq_n_u8(0x20))) == 0xff;
+        }
+
+        std::size_t LeadingSpaceNeon(const char *data, std::size_t length) noexcept {
+            std::size_t i = 0;
+            while (i + 16 <= length && AllSpaceNeon(data + i)) {
+                i += 16;
+            }
+            return i + LeadingSpaceScalar(data + i, length - i);
+        }
+
+        std::size_t TrailingSpaceNeon(const char *data, std::size_t length) noexcept {
+            std::size_t count = 0;
+            while (count + 16 <= length && AllSpaceNeon(data + length - count - 16)) {
+                count += 16;
+            }
+            return count + TrailingSpaceScalar(data, length - count);
+        }
+
+        bool EqualNeon(const char *left, const char *right, std::size_t length) noexcept {
+            std::size_t i = 0;
+            for (; i + 16 <= length; i += 16) {
+                auto a = vld1q_u8(reinterpret_cast<const std::uint8_t *>(left + i));
+                auto b = vld1q_u8(reinterpret_cast<const std::uint8_t *>(right + i));
+                if (vminvq_u8(vceqq_u8(a, b)) != 0xff) {
+                    return false;
+                }
+            }
+            return EqualScalar(left + i, right + i, length - i);
+        }
+
+        void WidenNeon(const float *source, double *target, std::size_t count) noexcept {
+            std::size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                auto lanes = vld1q_f32(source + i);
+                vst1q_f64(target + i, vcvt_f64_f32(vget_low_f32(lanes)));
+                vst1q_f64(target + i + 2, vcvt_high_f64_f32(lanes));
+            }
+            ConvertScalar(source + i, target + i, count - i);
+        }
+
+        void NarrowNeon(const double *source, float *target, std::size_t count) noexcept {
+            std::size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                auto low = vcvt_f32_f64(vld1q_f64(source + i));
+                vst1q_f32(target + i, vcvt_high_f32_f64(low, vld1q_f64(source + i + 2)));
+            }
+            ConvertScalar(source + i, target + i, count - i);
+        }
+
+        double SumFloat32Neon(const float *values, std::size_t count) noexcept {
+            auto low = vdupq_n_f64(0.0);
+            auto high = vdupq_n_f64(0.0);
+            std::size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                auto lanes = vld1q_f32(values + i);
+                low = vaddq_f64(low, vcvt_f64_f32(vget_low_f32(lanes)));
+                high = vaddq_f64(high, vcvt_high_f64_f32(lanes));
+            }
+            return vaddvq_f64(vaddq_f64(low, high)) + SumScalar(values + i, count - i);
+        }
+
+        double SumFloat64Neon(const double *values, std::size_t count) noexcept {
+            auto low = vdupq_n_f64(0.0);
+            auto high = vdupq_n_f64(0.0);
+            std::size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                low = vaddq_f64(low, vld1q_f64(values + i));
+                high = vaddq_f64(high, vld1q_f64(values + i + 2));
+            }
+            return vaddvq_f64(vaddq_f64(low, high)) + SumScalar(values + i, count - i);
+        }
+
+        double DotFloat32Neon(const float *left, const float *right, std::size_t count) noexcept {
+            auto low = vdupq_n_f64(0.0);
+            auto high = vdupq_n_f64(0.0);
+            std::size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                auto a = vld1q_f32(left + i);
+                auto b = vld1q_f32(right + i);
+                low = vaddq_f64(low, vmulq_f64(vcvt_f64_f32(vget_low_f32(a)), vcvt_f64_f32(vget_low_f32(b))));
+                high = vaddq_f64(high, vmulq_f64(vcvt_high_f64_f32(a), vcvt_high_f64_f32(b)));
+            }
+            return vaddvq_f64(vaddq_f64(low, high)) + DotScalar(left + i, right + i, count - i);
+        }
+
+        double DotFloat64Neon(const double *left, const double *right, std::size_t count) noexcept {
+            auto low = vdupq_n_f64(0.0);
+            auto high = vdupq_n_f64(0.0);
+            std::size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                low = vaddq_f64(low, vmulq_f64(vld1q_f64(left + i), vld1q_f64(right + i)));
+                high = vaddq_f64(high, vmulq_f64(vld1q_f64(left + i + 2), vld1q_f64(right + i + 2)));
+            }
+            return vaddvq_f64(vaddq_f64(low, high)) + DotScalar(left + i, right + i, count - i);
+        }
+
+        // FMIN/FMAX and their across-lane forms propagate NaN, so no separate mask is needed.
+        template<bool Maximum>
+        double ExtremeFloat32Neon(const float *values, std::size_t count) noexcept {
+            if (count < 4) {
+                return ExtremeOfScalar<Maximum>(values, count);
+            }
+            auto best = vld1q_f32(values);
+            std::size_t i = 4;
+            for (; i + 4 <= count; i += 4) {
+                auto lanes = vld1q_f32(values + i);
+                best = Maximum ? vmaxq_f32(best, lanes) : vminq_f32(best, lanes);
+            }
+            auto partial = static_cast<double>(Maximum ? vmaxvq_f32(best) : vminvq_f32(best));
+            if (partial != partial) {
+                return partial;
+            }
+            return ExtremeScalar<Maximum>(values + i, count - i, partial);
+        }
+
+        template<bool Maximum>
+        double ExtremeFloat64Neon(const double *values, std::size_t count) noexcept {
+            if (count < 2) {
+                return ExtremeOfScalar<Maximum>(values, count);
+            }
+            auto best = vld1q_f64(values);
+            std::size_t i = 2;
+            for (; i + 2 <= count; i += 2) {
+                auto lanes = vld1q_f64(values + i);
+                best = Maximum ? vmaxq_f64(best, lanes) : vminq_f64(best, lanes);
+            }
+            auto partial = Maximum ? vmaxvq_f64(best) : vminvq_f64(best);
+            if (partial != partial) {
+                return partial;
+            }
+            return ExtremeScalar<Maximum>(values + i, count - i, partial);
+        }
+
+        template<typename T>
+        void ByteSwapNeon(void *data, std::size_t count) noexcept {
+            constexpr std::size_t kLanes = 16 / sizeof(T);
+            auto *bytes = static_cast<std::uint8_t *>(data);
+            std::size_t i = 0;
+            for (; i + kLanes <= count; i += kLanes) {
+                auto *lane = bytes + i * sizeof(T);
+                auto values = vld1q_u8(lane);
+                if constexpr (sizeof(T) == 2) {
+                    values = vrev16q_u8(values);
+                } else if constexpr (sizeof(T) == 4) {
+                    values = vrev32q_u8(values);
+                } else {
+                    values = vrev64q_u8(values);
+                }
+                vst1q_u8(lane, values);
+            }
+            ByteSwapScalar<T>(bytes + i * sizeof(T), count - i);
+        }
+
+        // memchr is already vectorized by every AArch64 libc, so Find keeps the scalar driver.
+        constexpr Kernels kNeonKernels{
+            Level::Neon,
+            FlipCaseNeon<'a', 'z'>,
+            FlipCaseNeon<'A', 'Z'>,
+            LeadingSpaceNeon,
+            TrailingSpaceNeon,
+            EqualNeon,
+            FindScalar,
+            WidenNeon,
+            NarrowNeon,
+            ClampToUint8Scalar,
+            SumFloat32Neon,
+            SumFloat64Neon,
+            DotFloat32Neon,
+            DotFloat64Neon,
+            ExtremeFloat32Neon<false>,
+            ExtremeFloat64Neon<false>,
+            ExtremeFloat32Neon<true>,
+            ExtremeFloat64Neon<true>,
+            ByteSwapNeon<std::uint16_t>,
+            ByteSwapNeon<std::uint32_t>,
+            ByteSwapNeon<std::uint64_t>
+        };
+#endif
+
+        const Kernels &Detect() noexcept {
+#if defined(SPECTRE_SIMD_AVX2)
+            if (__builtin_cpu_supports("avx2")) {
+                return kAvx2Kernels;
+            }
+#endif
+#if defined(SPECTRE_SIMD_SSE2)
+            return kSse2Kernels;
+#elif defined(SPECTRE_SIMD_NEON)
+            return kNeonKernels;
+#else
+            return kScalarKernels;
+#endif
+        }
+
+        const Kernels &Active() noexcept {
+            static const Kernels &kernels = Detect();
+            return kernels;
+        }
+    }
+
+    Level ActiveLevel() noexcept {
+        return Active().level;
+    }
+
+    std::string_view LevelName(Level level) noexcept {
+        switch (level) {
+            case Level::Sse2:
+                return "sse2";
+            case Level::Avx2:
+                return "avx2";
+            case Level::Neon:
+                return "neon";
+            case Level::Scalar:
+            default:
+                return "scalar";
+        }
+    }
+
+    bool AsciiToUpper(char *data, std::size_t length) noexcept {
+        return Active().toUpper(data, length);
+    }
+
+    bool AsciiToLower(char *data, std::size_t length) noexcept {
+        return Active().toLower(data, length);
+    }
+
+    std::size_t LeadingAsciiWhitespace(const char *data, std::size_t length) noexcept {
+        return Active().leadingSpace(data, length);
+    }
+
+    std::size_t TrailingAsciiWhitespace(const char *data, std::size_t length) noexcept {
+        return Active().trailingSpace(data, length);
+    }
+
+    bool Equal(const char *left, const char *right, std::size_t length) noexcept {
+        return Active().equal(left, right, length);
+    }
+
+    std::size_t Find(std::string_view haystack, std::string_view needle, std::size_t from) noexcept {
+        if (from > haystack.size()) {
+            return kNotFound;
+        }
+        if (needle.empty()) {
+            return from;
+        }
+        auto offset = Active().find(haystack.data() + from, haystack.size() - from, needle.data(), needle.size());
+        return offset == kNotFound ? kNotFound : from + offset;
+    }
+
+    std::size_t Count(std::string_view haystack, std::string_view needle) noexcept {
+        if (needle.empty()) {
+            return 0;
+        }
+        const auto &kernels = Active();
+        std::size_t count = 0;
+        std::size_t from = 0;
+        while (from + needle.size() <= haystack.size()) {
+            auto offset = kernels.find(haystack.data() + from, haystack.size() - from, needle.data(), needle.size());
+            if (offset == kNotFound) {
+                break;
+            }
+            ++count;
+            from += offset + needle.size();
+        }
+        return count;
+    }
+
+    void WidenFloat32(const float *source, double *target, std::size_t count) noexcept {
+        Active().widen(source, target, count);
+    }
+
+    void NarrowFloat64(const double *source, float *target, std::size_t count) noexcept {
+        Active().narrow(source, target, count);
+    }
+
+    void ClampToUint8(const double *source, std::uint8_t *target, std::size_t count) noexcept {
+        Active().clampToUint8(source, target, count);
+    }
+
+    double Sum(const float *values, std::size_t count) noexcept {
+        return Active().sumFloat32(values, count);
+    }
+
+    double Sum(const double *values, std::size_t count) noexcept {
+        return Active().sumFloat64(values, count);
+    }
+
+    double Dot(const float *left, const float *right, std::size_t count) noexcept {
+        return Active().dotFloat32(left, right, count);
+    }
+
+    double Dot(const double *left, const double *right, std::size_t count) noexcept {
+        return Active().dotFloat64(left, right, count);
+    }
+
+    double Min(const float *values, std::size_t count) noexcept {
+        return Active().minFloat32(values, count);
+    }
+
+    double Min(const double *values, std::size_t count) noexcept {
+        return Active().minFloat64(values, count);
+    }
+
+    double Max(const float *values, std::size_t count) noexcept {
+        return Active().maxFloat32(values, count);
+    }
+
+    double Max(const double *values, std::size_t count) noexcept {
+        return Active().maxFloat64(values, count);
+    }
+
+    void ByteSwap16(void *data, std::size_t count) noexcept {
+        Active().byteSwap16(data, count);
+    }
+
+    void ByteSwap32(void *data, std::size_t count) noexcept {
+        Active().byteSwap32(data, count);
+    }
+
+    void ByteSwap64(void *data, std::size_t count) noexcept {
+        Active().byteSwap64(data, count);
+    }
+}
@@ -19,7 +19,12 @@ namespace spectre {
     struct TelemetryConfig {
         bool enableProfiling;
         bool enableTracing;
+        // Telemetry ring capacity in samples, rounded up to a power of two. With profiling on,
+        // every tick publishes four memory samples per module plus one per context (and two per
+        // executed opcode when opcode profiling is on), so this must hold several ticks of that
+        // or the host must drain every tick.
         std::uint32_t historySize;
+        bool enableOpcodeProfiling;
     };
 
     struct RuntimeConfig {
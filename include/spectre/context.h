@@ -33,6 +33,8 @@ namespace spectre {
 
         std::uint64_t ScriptVersion(const std::string &scriptName) const;
 
+        std::uint64_t MemoryBytes() const;
+
     private:
         struct ScriptSlot {
             std::string name;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string_view>
 #include <unordered_map>
@@ -13,6 +14,18 @@ namespace spectre {
 }
 
 namespace spectre::es2025 {
+    // usage and arenaFragmentation come from the last full walk (NoteMemoryUsage); counters and
+    // the rest are refreshed from the module's running counters every profiled tick.
+    struct ModuleMemoryStats {
+        std::string_view name;
+        ModuleMemoryUsage usage;
+        ModuleMemoryCounters counters;
+        std::uint64_t peakLiveBytes;
+        double allocationRate;
+        double slotFragmentation;
+        double arenaFragmentation;
+    };
+
     class Environment {
     public:
         Environment();
@@ -32,8 +45,17 @@ namespace spectre::es2025 {
 
         const std::vector<std::unique_ptr<Module>> &Modules() const noexcept;
 
+        void SampleMemory(double deltaSeconds);
+
+        // Folds a full CollectMemory walk of module index into its stats.
+        void NoteMemoryUsage(std::size_t index, const ModuleMemoryUsage &usage) noexcept;
+
+        const std::vector<ModuleMemoryStats> &MemoryStats() const noexcept;
+
     private:
         std::vector<std::unique_ptr<Module>> m_Modules;
+        std::vector<ModuleMemoryStats> m_MemoryStats;
+        std::vector<std::uint32_t> m_MemoryChannels;
         std::unordered_map<std::string_view, Module *> m_Index;
         detail::SubsystemSuite *m_Subsystems;
         RuntimeConfig m_Config;
@@ -42,6 +64,8 @@ namespace spectre::es2025 {
         void Register(std::unique_ptr<Module> module);
 
         void BuildIndex();
+
+        void PublishMemory(std::uint64_t frameIndex);
     };
 }
 
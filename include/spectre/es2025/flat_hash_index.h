@@ -0,0 +1,268 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64) || (defined(__i386__) && defined(__SSE2__))
+#define SPECTRE_FLAT_INDEX_SSE2 1
+#include <emmintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define SPECTRE_FLAT_INDEX_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace spectre::es2025 {
+    // Open-addressed index from a 64-bit hash to a position in a caller-owned dense entry array.
+    // Slots are grouped sixteen to a control-byte group: a control byte holds seven bits of the
+    // hash for a full slot or marks it empty/deleted, so one vector compare filters a whole group
+    // before any entry is touched. Probing visits groups in triangular order, which covers every
+    // group of a power-of-two table. The caller keeps entries in insertion order and supplies the
+    // key comparison, so the same index serves any keyed collection.
+    class FlatHashIndex {
+    public:
+        static constexpr std::uint32_t kNoEntry = 0xffffffffu;
+        static constexpr std::uint32_t kGroupWidth = 16;
+
+        FlatHashIndex() noexcept : m_Control(), m_Targets(), m_Used(0), m_Tombstones(0) {
+        }
+
+        std::uint32_t Capacity() const noexcept {
+            return static_cast<std::uint32_t>(m_Targets.size());
+        }
+
+        // Entries the current table holds before Rebuild is needed (7/8 load, tombstones included).
+        std::uint32_t GrowthLimit() const noexcept {
+            return Capacity() - Capacity() / 8;
+        }
+
+        bool NeedsRebuild(std::uint32_t additional) const noexcept {
+            return static_cast<std::uint64_t>(m_Used) + m_Tombstones + additional > GrowthLimit();
+        }
+
+        static std::uint32_t CapacityFor(std::uint32_t entries) noexcept {
+            std::uint64_t capacity = kGroupWidth;
+            while (capacity - capacity / 8 < entries && capacity < (1ull << 31)) {
+                capacity <<= 1;
+            }
+            return static_cast<std::uint32_t>(capacity);
+        }
+
+        // Drops every slot and resizes to capacity (a power of two, at least one group).
+        void Reset(std::uint32_t capacity) {
+            m_Control.assign(capacity, kEmpty);
+            m_Targets.assign(capacity, kNoEntry);
+            m_Used = 0;
+            m_Tombstones = 0;
+        }
+
+        void Clear() noexcept {
+            if (!m_Control.empty()) {
+                std::memset(m_Control.data(), kEmpty, m_Control.size());
+            }
+            m_Used = 0;
+            m_Tombstones = 0;
+        }
+
+        // Returns the entry whose key matches, or kNoEntry. outProbes counts groups visited past
+        // the first one.
+        template<typename Matches>
+        std::uint32_t Find(std::uint64_t hash, Matches &&matches, std::uint32_t &outProbes) const {
+            outProbes = 0;
+            if (m_Targets.empty()) {
+                return kNoEntry;
+            }
+            auto mixed = Mix(hash);
+            auto tag = Tag(mixed);
+            auto groupMask = GroupCount() - 1;
+            auto group = static_cast<std::uint32_t>(mixed) & groupMask;
+            for (std::uint32_t step = 1;; ++step) {
+                const auto *control = m_Control.data() + static_cast<std::size_t>(group) * kGroupWidth;
+                for (auto bits = MatchByte(control, tag); bits != 0; bits &= bits - 1) {
+                    auto slot = group * kGroupWidth + LowestSlot(bits);
+                    auto target = m_Targets[slot];
+                    if (matches(target)) {
+                        return target;
+                    }
+                }
+                if (MatchByte(control, kEmpty) != 0 || step > groupMask) {
+                    return kNoEntry;
+                }
+                group = (group + step) & groupMask;
+                ++outProbes;
+            }
+        }
+
+        // Pulls the first group Find would visit for hash into cache ahead of a batched lookup.
+        void Prefetch(std::uint64_t hash) const noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+            if (m_Targets.empty()) {
+                return;
+            }
+            auto group = static_cast<std::size_t>(static_cast<std::uint32_t>(Mix(hash)) & (GroupCount() - 1));
+            __builtin_prefetch(m_Control.data() + group * kGroupWidth);
+            __builtin_prefetch(m_Targets.data() + group * kGroupWidth);
+#else
+            (void) hash;
+#endif
+        }
+
+        // Records entry for a key known to be absent; the caller checks NeedsRebuild first.
+        void Insert(std::uint64_t hash, std::uint32_t entry) noexcept {
+            auto mixed = Mix(hash);
+            auto groupMask = GroupCount() - 1;
+            auto group = static_cast<std::uint32_t>(mixed) & groupMask;
+            for (std::uint32_t step = 1;; ++step) {
+                const auto *control = m_Control.data() + static_cast<std::size_t>(group) * kGroupWidth;
+                auto bits = MatchEmptyOrDeleted(control);
+                if (bits != 0) {
+                    auto slot = group * kGroupWidth + LowestSlot(bits);
+                    if (m_Control[slot] == kDeleted) {
+                        m_Tombstones -= 1;
+                    }
+                    m_Control[slot] = Tag(mixed);
+                    m_Targets[slot] = entry;
+                    m_Used += 1;
+                    return;
+                }
+                group = (group + step) & groupMask;
+            }
+        }
+
+        // Removes the slot that points at entry.
+        void Erase(std::uint64_t hash, std::uint32_t entry) noexcept {
+            std::uint32_t probes = 0;
+            auto slot = SlotOf(hash, entry, probes);
+            if (slot == kNoEntry) {
+                return;
+            }
+            // A group that still has an empty byte ends every probe that reaches it, so the slot
+            // can go straight back to empty instead of leaving a tombstone.
+            const auto *control = m_Control.data() + (slot & ~(kGroupWidth - 1));
+            if (MatchByte(control, kEmpty) != 0) {
+                m_Control[slot] = kEmpty;
+            } else {
+                m_Control[slot] = kDeleted;
+                m_Tombstones += 1;
+            }
+            m_Targets[slot] = kNoEntry;
+            m_Used -= 1;
+        }
+
+        // Repoints the slot for hash from one entry position to another (used when compacting).
+        void Retarget(std::uint64_t hash, std::uint32_t from, std::uint32_t to) noexcept {
+            std::uint32_t probes = 0;
+            auto slot = SlotOf(hash, from, probes);
+            if (slot != kNoEntry) {
+                m_Targets[slot] = to;
+            }
+        }
+
+        std::uint64_t ReservedBytes() const noexcept {
+            return static_cast<std::uint64_t>(m_Control.capacity())
+                   + static_cast<std::uint64_t>(m_Targets.capacity()) * sizeof(std::uint32_t);
+        }
+
+    private:
+        static constexpr std::uint8_t kEmpty = 0x80;
+        static constexpr std::uint8_t kDeleted = 0xfe;
+
+#if defined(SPECTRE_FLAT_INDEX_NEON)
+        // vshrn packs each compare lane into a nibble; keep one bit per nibble.
+        static constexpr std::uint32_t kMaskStride = 4;
+        using Mask = std::uint64_t;
+#else
+        static constexpr std::uint32_t kMaskStride = 1;
+        using Mask = std::uint32_t;
+#endif
+
+        std::vector<std::uint8_t> m_Control;
+        std::vector<std::uint32_t> m_Targets;
+        std::uint32_t m_Used;
+        std::uint32_t m_Tombstones;
+
+        std::uint32_t GroupCount() const noexcept {
+            return static_cast<std::uint32_t>(m_Targets.size() / kGroupWidth);
+        }
+
+        static std::uint64_t Mix(std::uint64_t hash) noexcept {
+            hash ^= hash >> 33;
+            hash *= 0xff51afd7ed558ccdull;
+            hash ^= hash >> 33;
+            return hash;
+        }
+
+        static std::uint8_t Tag(std::uint64_t mixed) noexcept {
+            return static_cast<std::uint8_t>(mixed >> 57);
+        }
+
+        static std::uint32_t LowestSlot(Mask bits) noexcept {
+            return static_cast<std::uint32_t>(std::countr_zero(bits)) / kMaskStride;
+        }
+
+        static Mask MatchByte(const std::uint8_t *control, std::uint8_t value) noexcept {
+#if defined(SPECTRE_FLAT_INDEX_SSE2)
+            auto group = _mm_loadu_si128(reinterpret_cast<const __m128i *>(control));
+            auto match = _mm_cmpeq_epi8(group, _mm_set1_epi8(static_cast<char>(value)));
+            return static_cast<Mask>(_mm_movemask_epi8(match));
+#elif defined(SPECTRE_FLAT_INDEX_NEON)
+            auto match = vceqq_u8(vld1q_u8(control), vdupq_n_u8(value));
+            auto packed = vshrn_n_u16(vreinterpretq_u16_u8(match), 4);
+            return vget_lane_u64(vreinterpret_u64_u8(packed), 0) & 0x8888888888888888ull;
+#else
+            Mask bits = 0;
+            for (std::uint32_t i = 0; i < kGroupWidth; ++i) {
+                bits |= static_cast<Mask>(control[i] == value) << i;
+            }
+            return bits;
+#endif
+        }
+
+        static Mask MatchEmptyOrDeleted(const std::uint8_t *control) noexcept {
+            // Both markers have the high bit set; full slots never do.
+#if defined(SPECTRE_FLAT_INDEX_SSE2)
+            return static_cast<Mask>(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(control))));
+#elif defined(SPECTRE_FLAT_INDEX_NEON)
+            auto high = vcltzq_s8(vreinterpretq_s8_u8(vld1q_u8(control)));
+            auto packed = vshrn_n_u16(vreinterpretq_u16_u8(high), 4);
+            return vget_lane_u64(vreinterpret_u64_u8(packed), 0) & 0x8888888888888888ull;
+#else
+            Mask bits = 0;
+            for (std::uint32_t i = 0; i < kGroupWidth; ++i) {
+                bits |= static_cast<Mask>((control[i] & 0x80) != 0) << i;
+            }
+            return bits;
+#endif
+        }
+
+        std::uint32_t SlotOf(std::uint64_t hash, std::uint32_t entry, std::uint32_t &outProbes) const noexcept {
+            outProbes = 0;
+            if (m_Targets.empty()) {
+                return kNoEntry;
+            }
+            auto mixed = Mix(hash);
+            auto tag = Tag(mixed);
+            auto groupMask = GroupCount() - 1;
+            auto group = static_cast<std::uint32_t>(mixed) & groupMask;
+            for (std::uint32_t step = 1;; ++step) {
+                const auto *control = m_Control.data() + static_cast<std::size_t>(group) * kGroupWidth;
+                for (auto bits = MatchByte(control, tag); bits != 0; bits &= bits - 1) {
+                    auto slot = group * kGroupWidth + LowestSlot(bits);
+                    if (m_Targets[slot] == entry) {
+                        return slot;
+                    }
+                }
+                if (MatchByte(control, kEmpty) != 0 || step > groupMask) {
+                    return kNoEntry;
+                }
+                group = (group + step) & groupMask;
+                ++outProbes;
+            }
+        }
+    };
+}
+
+#undef SPECTRE_FLAT_INDEX_SSE2
+#undef SPECTRE_FLAT_INDEX_NEON
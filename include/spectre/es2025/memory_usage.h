@@ -0,0 +1,148 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace spectre::es2025 {
+    // Byte accounting reported by a module for everything it owns on the heap.
+    // liveBytes covers in-use records and their payloads, reservedBytes covers every
+    // backing store at its current capacity, and freeListBytes is the part of the
+    // reservation parked in free slots, free lists and pools. measured stays false for a module
+    // that does not account its storage, so a report can tell "not measured" apart from zero.
+    struct ModuleMemoryUsage {
+        std::uint64_t liveBytes;
+        std::uint64_t reservedBytes;
+        std::uint64_t freeListBytes;
+        std::uint64_t slotCount;
+        std::uint64_t freeSlotCount;
+        bool measured;
+    };
+
+    // Running totals a module keeps at its allocate and free sites, so a per-tick sample is O(1).
+    // They cover the storage the module allocates itself (slot tables, record storage, labels);
+    // payloads shared through Values are only counted by the full CollectMemory walk.
+    // allocatedBytes never decreases, so churn shows up even when live bytes stay flat.
+    struct ModuleMemoryCounters {
+        std::uint64_t allocatedBytes;
+        std::uint64_t freedBytes;
+        std::uint64_t slotCount;
+        std::uint64_t freeSlotCount;
+        bool measured;
+    };
+
+    namespace memory {
+        class Counter {
+        public:
+            void Allocate(std::uint64_t bytes) noexcept {
+                m_Allocated += bytes;
+            }
+
+            void Free(std::uint64_t bytes) noexcept {
+                m_Freed += bytes;
+            }
+
+            // A block that was before bytes is now after bytes.
+            void Resize(std::uint64_t before, std::uint64_t after) noexcept {
+                if (after > before) {
+                    m_Allocated += after - before;
+                } else {
+                    m_Freed += before - after;
+                }
+            }
+
+            void Reset() noexcept {
+                m_Allocated = 0;
+                m_Freed = 0;
+            }
+
+            std::uint64_t Allocated() const noexcept {
+                return m_Allocated;
+            }
+
+            std::uint64_t Freed() const noexcept {
+                return m_Freed;
+            }
+
+            std::uint64_t Live() const noexcept {
+                return m_Allocated - m_Freed;
+            }
+
+        private:
+            std::uint64_t m_Allocated = 0;
+            std::uint64_t m_Freed = 0;
+        };
+
+        // Counter fed from a capacity total at sample time rather than at every allocate and free
+        // site, for modules whose storage is a few tables. Growing or trimming a table shows up as
+        // allocation or free; per-record payloads are left to the CollectMemory walk.
+        class Gauge {
+        public:
+            void Observe(std::uint64_t bytes) noexcept {
+                m_Counter.Resize(m_Bytes, bytes);
+                m_Bytes = bytes;
+            }
+
+            const Counter &Totals() const noexcept {
+                return m_Counter;
+            }
+
+        private:
+            Counter m_Counter;
+            std::uint64_t m_Bytes = 0;
+        };
+
+        // Starts a CollectMemory walk.
+        inline void Begin(ModuleMemoryUsage &usage) noexcept {
+            usage = {};
+            usage.measured = true;
+        }
+
+        inline void Sample(ModuleMemoryCounters &counters,
+                           const Counter &counter,
+                           std::uint64_t slotCount,
+                           std::uint64_t freeSlotCount) noexcept {
+            counters.allocatedBytes = counter.Allocated();
+            counters.freedBytes = counter.Freed();
+            counters.slotCount = slotCount;
+            counters.freeSlotCount = freeSlotCount;
+            counters.measured = true;
+        }
+
+        template<typename T>
+        constexpr std::uint64_t VectorBytes(const std::vector<T> &values) noexcept {
+            return static_cast<std::uint64_t>(values.capacity()) * sizeof(T);
+        }
+
+        template<typename T>
+        constexpr std::uint64_t UsedVectorBytes(const std::vector<T> &values) noexcept {
+            return static_cast<std::uint64_t>(values.size()) * sizeof(T);
+        }
+
+        inline std::uint64_t StringBytes(const std::string &value) noexcept {
+            static const std::size_t kInlineCapacity = std::string().capacity();
+            return value.capacity() > kInlineCapacity ? static_cast<std::uint64_t>(value.capacity()) + 1 : 0;
+        }
+
+        // Bucket array plus one node per element; a node carries its value, a next pointer and a cached hash.
+        template<typename Map>
+        std::uint64_t HashMapBytes(const Map &map) noexcept {
+            return static_cast<std::uint64_t>(map.bucket_count()) * sizeof(void *) +
+                   static_cast<std::uint64_t>(map.size()) *
+                   (sizeof(typename Map::value_type) + sizeof(void *) + sizeof(std::size_t));
+        }
+
+        inline void AddSlotTable(ModuleMemoryUsage &usage,
+                                 std::uint64_t slotCount,
+                                 std::uint64_t freeSlotCount,
+                                 std::uint64_t slotBytes,
+                                 std::uint64_t reservedBytes) noexcept {
+            usage.slotCount += slotCount;
+            usage.freeSlotCount += freeSlotCount;
+            usage.reservedBytes += reservedBytes;
+            usage.liveBytes += (slotCount - freeSlotCount) * slotBytes;
+            usage.freeListBytes += freeSlotCount * slotBytes;
+        }
+    }
+}
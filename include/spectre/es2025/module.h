@@ -2,6 +2,8 @@
 
 #include <string_view>
 
+#include "spectre/es2025/memory_usage.h"
+
 namespace spectre {
     class SpectreRuntime;
 
@@ -61,6 +63,16 @@ namespace spectre::es2025 {
         virtual void Reconfigure(const RuntimeConfig &config) {
             (void) config;
         }
+
+        // Full walk of everything the module owns; only MemoryReport calls it.
+        virtual void CollectMemory(ModuleMemoryUsage &usage) const noexcept {
+            usage = {};
+        }
+
+        // Per-tick sample from running counters; must not walk records.
+        virtual void SampleMemory(ModuleMemoryCounters &counters) const noexcept {
+            counters = {};
+        }
     };
 }
 
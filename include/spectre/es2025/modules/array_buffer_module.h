@@ -3,8 +3,10 @@
 #include <array>
 #include <cstdint>
 #include <memory>
+#include <span>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <vector>
 
 #include "spectre/config.h"
@@ -30,7 +32,10 @@ namespace spectre::es2025 {
             std::uint64_t copyBetweenBuffers;
             std::uint64_t fills;
             std::uint64_t poolReuses;
+            std::uint64_t poolMisses;
             std::uint64_t poolReturns;
+            std::uint64_t poolEvictions;
+            std::uint64_t poolDecays;
             std::uint64_t bytesAllocated;
             std::uint64_t bytesRecycled;
             std::uint64_t bytesInUse;
@@ -39,11 +44,76 @@ namespace spectre::es2025 {
             std::uint64_t activeBuffers;
             std::uint64_t lastFrameTouched;
             std::uint64_t hotBuffers;
+            std::uint64_t borrows;
+            std::uint64_t pinConflicts;
+            std::uint64_t mappedBuffers;
+            std::uint64_t mappedBytes;
+            std::uint64_t remaps;
+            std::uint64_t fileMappedBuffers;
+            std::uint64_t fileMappedBytes;
             bool gpuOptimized;
 
             Metrics() noexcept;
         };
 
+        // Per-bucket pool activity. A hit reuses a retained block, a miss allocates a fresh one.
+        // Evictions are blocks dropped to stay under the pool limit; decays are blocks released
+        // after sitting idle for kPoolIdleFrames.
+        struct PoolBucketStats {
+            std::uint64_t blockBytes;
+            std::uint64_t hits;
+            std::uint64_t misses;
+            std::uint64_t retainedBlocks;
+            std::uint64_t retainedBytes;
+            std::uint64_t evictions;
+            std::uint64_t decays;
+        };
+
+        // Zero-copy access to a buffer's bytes. While a Borrow is alive the buffer is pinned:
+        // Resize, Detach and Destroy fail with InvalidArgument, so the span stays valid. Releasing
+        // (or destroying) the Borrow unpins it. A Borrow must not outlive the module. Data and Bytes
+        // are read-only views; MutableData and MutableBytes are null/empty when the buffer is
+        // read-only, so a mapped file cannot be written through a borrow.
+        class Borrow {
+        public:
+            Borrow() noexcept;
+            Borrow(Borrow &&other) noexcept;
+            Borrow &operator=(Borrow &&other) noexcept;
+            Borrow(const Borrow &) = delete;
+            Borrow &operator=(const Borrow &) = delete;
+            ~Borrow();
+
+            bool Active() const noexcept;
+            bool ReadOnly() const noexcept;
+            const std::uint8_t *Data() const noexcept;
+            std::uint8_t *MutableData() const noexcept;
+            std::size_t Size() const noexcept;
+            std::span<const std::uint8_t> Bytes() const noexcept;
+            std::span<std::uint8_t> MutableBytes() const noexcept;
+            void Release() noexcept;
+
+            // Reinterprets the bytes as elements of T; any partial trailing element is excluded.
+            // A non-const T yields an empty span over a read-only buffer.
+            template<typename T>
+            std::span<T> As() const noexcept {
+                if constexpr (std::is_const_v<T>) {
+                    return {reinterpret_cast<T *>(m_Data), m_Size / sizeof(T)};
+                } else {
+                    auto bytes = MutableBytes();
+                    return {reinterpret_cast<T *>(bytes.data()), bytes.size() / sizeof(T)};
+                }
+            }
+
+        private:
+            friend class ArrayBufferModule;
+
+            ArrayBufferModule *m_Module;
+            Handle m_Handle;
+            std::uint8_t *m_Data;
+            std::size_t m_Size;
+            bool m_ReadOnly;
+        };
+
         ArrayBufferModule();
 
         std::string_view Name() const noexcept override;
@@ -54,8 +124,18 @@ namespace spectre::es2025 {
         void Tick(const TickInfo &info, const ModuleTickContext &context) noexcept override;
         void OptimizeGpu(const ModuleGpuContext &context) noexcept override;
         void Reconfigure(const RuntimeConfig &config) override;
+        void CollectMemory(ModuleMemoryUsage &usage) const noexcept override;
+
+        void SampleMemory(ModuleMemoryCounters &counters) const noexcept override;
 
         StatusCode Create(std::string_view label, std::size_t byteLength, Handle &outHandle);
+        // Maps a file straight into a buffer without reading it: creation costs the same for any
+        // file size and pages come in on first touch. A read-only buffer shares the page cache with
+        // every other process mapping the file; Fill, CopyIn, Resize and typed writes reject it.
+        // A writable buffer is a private copy-on-write mapping, so writes never reach the file.
+        // File-backed buffers cannot be resized and do not count against the heap budget; Detach
+        // and Destroy unmap them. An empty label uses the path.
+        StatusCode CreateMapped(std::string_view path, bool readOnly, std::string_view label, Handle &outHandle);
         StatusCode Clone(Handle handle, std::string_view label, Handle &outHandle);
         StatusCode Slice(Handle handle,
                          std::size_t begin,
@@ -81,19 +161,46 @@ namespace spectre::es2025 {
                                 std::size_t targetOffset,
                                 std::size_t size) noexcept;
 
+        // Pins [offset, offset + size) of the buffer and points outBorrow at it, releasing whatever
+        // outBorrow held before.
+        StatusCode BorrowBytes(Handle handle, std::size_t offset, std::size_t size, Borrow &outBorrow) noexcept;
+        StatusCode BorrowBytes(Handle handle, Borrow &outBorrow) noexcept;
+        std::uint32_t PinCount(Handle handle) const noexcept;
+
         bool Has(Handle handle) const noexcept;
         bool Detached(Handle handle) const noexcept;
+        bool ReadOnly(Handle handle) const noexcept;
         std::size_t ByteLength(Handle handle) const noexcept;
         const Metrics &GetMetrics() const noexcept;
         bool GpuEnabled() const noexcept;
 
+        // The pool retains at most MemoryBudget::arenaBytes of returned blocks (0 disables pooling).
+        std::uint64_t PoolLimit() const noexcept;
+        std::span<const PoolBucketStats> PoolStats() const noexcept;
+        // Releases the oldest retained blocks until at most maxRetainedBytes remain pooled.
+        void TrimPool(std::uint64_t maxRetainedBytes) noexcept;
+
     private:
+        // Heap blocks carry mappedBytes == 0; blocks at or above kMappedThreshold and file-backed
+        // buffers are page mappings released with munmap.
+        struct BlockDeleter {
+            std::size_t mappedBytes;
+
+            BlockDeleter() noexcept : mappedBytes(0) {}
+            explicit BlockDeleter(std::size_t bytes) noexcept : mappedBytes(bytes) {}
+
+            void operator()(std::uint8_t *data) const noexcept;
+        };
+
+        using BlockPtr = std::unique_ptr<std::uint8_t[], BlockDeleter>;
+
         struct Block {
-            std::unique_ptr<std::uint8_t[]> data;
+            BlockPtr data;
             std::size_t capacity;
+            std::uint64_t pooledFrame;
 
             Block() noexcept;
-            Block(std::unique_ptr<std::uint8_t[]> ptr, std::size_t cap) noexcept;
+            Block(BlockPtr ptr, std::size_t cap) noexcept;
             Block(Block &&other) noexcept;
             Block &operator=(Block &&other) noexcept;
             Block(const Block &) = delete;
@@ -105,14 +212,17 @@ namespace spectre::es2025 {
             std::uint32_t slot;
             std::uint32_t generation;
             std::string label;
-            std::unique_ptr<std::uint8_t[]> data;
+            BlockPtr data;
             std::size_t byteLength;
             std::size_t capacity;
             std::uint64_t version;
             std::uint64_t lastTouchFrame;
+            std::uint32_t pins;
             bool detachable;
             bool detached;
             bool hot;
+            bool readOnly;
+            bool fileBacked;
 
             BufferRecord() noexcept;
         };
@@ -128,7 +238,11 @@ namespace spectre::es2025 {
         static constexpr std::size_t kPoolBuckets = 32;
         static constexpr std::size_t kMinCapacity = 64;
         static constexpr std::size_t kAlignment = 64;
+        // Capacities from here up bypass the pool: they are mapped in huge-page granules, start out
+        // as lazily zeroed pages and grow with mremap instead of a copy.
+        static constexpr std::size_t kMappedThreshold = std::size_t{1} << 21;
         static constexpr std::uint64_t kHotFrameWindow = 12;
+        static constexpr std::uint64_t kPoolIdleFrames = 120;
 
         SpectreRuntime *m_Runtime;
         detail::SubsystemSuite *m_Subsystems;
@@ -138,8 +252,13 @@ namespace spectre::es2025 {
         std::uint64_t m_CurrentFrame;
         std::vector<Slot> m_Slots;
         std::vector<std::uint32_t> m_FreeSlots;
+        // Each bucket is ordered oldest-returned first; reuse pops the newest, decay and eviction
+        // take from the front.
         std::array<std::vector<Block>, kPoolBuckets> m_Pool;
+        std::array<PoolBucketStats, kPoolBuckets> m_PoolStats;
         std::uint64_t m_TotalPooledBytes;
+        memory::Counter m_Memory;
+        std::uint64_t m_SlotTableBytes;
         Metrics m_Metrics;
 
         BufferRecord *FindMutable(Handle handle) noexcept;
@@ -150,18 +269,27 @@ namespace spectre::es2025 {
         static Handle EncodeHandle(std::uint32_t slot, std::uint32_t generation) noexcept;
 
         static std::size_t AlignCapacity(std::size_t size) noexcept;
+        static std::size_t CapacityFor(std::size_t byteLength) noexcept;
+        static bool Mapped(const BlockPtr &data) noexcept;
         static std::size_t BucketIndex(std::size_t capacity) noexcept;
 
         void Reset();
         std::uint32_t AcquireSlot();
         void ReleaseSlot(std::uint32_t slotIndex);
+        void TrackSlots() noexcept;
 
         Block AcquireBlock(std::size_t capacity);
         void ReturnBlock(Block &&block) noexcept;
         void ReturnBlock(BufferRecord &record) noexcept;
+        void ReleaseFileMapping(BufferRecord &record) noexcept;
+        void DropPooled(std::size_t bucket, std::size_t count, bool decayed) noexcept;
+        void DecayPool() noexcept;
+        void ResetPoolStats() noexcept;
 
         void Touch(BufferRecord &record) noexcept;
         void RecomputeHotMetrics() noexcept;
+        void Unpin(Handle handle) noexcept;
+        bool RejectPinned(const BufferRecord &record) noexcept;
     };
 }
 
@@ -2,6 +2,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <span>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -15,6 +16,10 @@ namespace spectre::es2025 {
     class ArrayModule final : public Module {
     public:
         enum class StorageKind : std::uint8_t { Dense, Sparse };
+        // Representation of dense elements. Kinds only generalize (PackedInt32 -> PackedDouble ->
+        // Generic) until the array is cleared or filled, and numbers read back from a PackedDouble
+        // array are always Number values.
+        enum class ElementKind : std::uint8_t { PackedInt32, PackedDouble, Generic };
 
         struct Metrics {
             std::size_t denseCount;
@@ -26,6 +31,7 @@ namespace spectre::es2025 {
             std::size_t transitionsToDense;
             std::size_t compactions;
             std::size_t clones;
+            std::size_t elementTransitions;
             std::uint64_t lastMutationFrame;
             Metrics() noexcept
                 : denseCount(0),
@@ -37,11 +43,20 @@ namespace spectre::es2025 {
                   transitionsToDense(0),
                   compactions(0),
                   clones(0),
+                  elementTransitions(0),
                   lastMutationFrame(0) {}
         };
 
         using Handle = std::uint64_t;
 
+        // Read position over [position, end) of an array; invalidated by any mutation.
+        struct Cursor {
+            Handle handle;
+            std::uint64_t version;
+            std::size_t position;
+            std::size_t end;
+        };
+
         ArrayModule();
 
         std::string_view Name() const noexcept override;
@@ -52,6 +67,9 @@ namespace spectre::es2025 {
         void Tick(const TickInfo &info, const ModuleTickContext &context) noexcept override;
         void OptimizeGpu(const ModuleGpuContext &context) noexcept override;
         void Reconfigure(const RuntimeConfig &config) override;
+        void CollectMemory(ModuleMemoryUsage &usage) const noexcept override;
+
+        void SampleMemory(ModuleMemoryCounters &counters) const noexcept override;
 
         StatusCode CreateDense(std::string_view label, std::size_t capacityHint, Handle &outHandle);
         StatusCode CreateSparse(std::string_view label, Handle &outHandle);
@@ -78,6 +96,10 @@ namespace spectre::es2025 {
 
         StatusCode Concat(Handle destination, Handle source);
         StatusCode Slice(Handle handle, std::size_t begin, std::size_t end, std::vector<Value> &outValues) const;
+        // Chunked, in-place alternative to Slice: holes read as undefined, outCount is zero once
+        // the range is exhausted and a stale cursor yields InvalidArgument.
+        StatusCode OpenCursor(Handle handle, std::size_t begin, std::size_t end, Cursor &outCursor) const;
+        StatusCode Next(Cursor &cursor, std::span<Value> out, std::size_t &outCount) const;
 
         StatusCode SortNumeric(Handle handle, bool ascending = true);
         StatusCode SortLexicographic(Handle handle, bool ascending = true);
@@ -86,6 +108,7 @@ namespace spectre::es2025 {
         std::size_t Length(Handle handle) const;
         bool Has(Handle handle) const noexcept;
         StorageKind KindOf(Handle handle) const noexcept;
+        ElementKind ElementKindOf(Handle handle) const noexcept;
         const Metrics &GetMetrics() const noexcept;
         bool GpuEnabled() const noexcept;
 
@@ -95,8 +118,28 @@ namespace spectre::es2025 {
             Value value;
         };
 
+        // Only the vector matching elements is populated.
         struct DenseData {
+            ElementKind elements = ElementKind::PackedInt32;
+            std::vector<std::int32_t> ints;
+            std::vector<double> doubles;
             std::vector<Value> items;
+
+            std::size_t Size() const noexcept;
+            std::size_t Capacity() const noexcept;
+            std::uint64_t ReservedBytes() const noexcept;
+            std::uint64_t UsedBytes() const noexcept;
+            Value At(std::size_t index) const;
+            // The stored value must already fit elements (see ArrayModule::Accommodate).
+            void Store(std::size_t index, const Value &value);
+            void Append(const Value &value);
+            void InsertAt(std::size_t index, const Value &value);
+            void EraseAt(std::size_t index);
+            void PopBack() noexcept;
+            void Clear() noexcept;
+            // Moves the elements into a buffer of exactly capacity slots (capacity >= Size()).
+            void Reallocate(std::size_t capacity);
+            void Retype(ElementKind kind);
         };
 
         struct SparseData {
@@ -117,6 +160,7 @@ namespace spectre::es2025 {
             std::uint64_t lastTouchFrame;
             bool pendingCompaction;
             bool hot;
+            std::uint64_t trackedBytes;
         };
 
         struct Slot {
@@ -134,6 +178,8 @@ namespace spectre::es2025 {
         std::vector<Slot> m_Slots;
         std::vector<std::uint32_t> m_FreeSlots;
         Metrics m_Metrics;
+        memory::Counter m_Memory;
+        std::uint64_t m_SlotTableBytes;
 
         ArrayRecord *FindMutable(Handle handle) noexcept;
         const ArrayRecord *Find(Handle handle) const noexcept;
@@ -144,6 +190,12 @@ namespace spectre::es2025 {
         StatusCode CreateInternal(std::string_view label, StorageKind kind, std::size_t capacityHint, Handle &outHandle);
         void ResetRecord(ArrayRecord &record, StorageKind kind, std::string_view label, std::size_t capacityHint, Handle handle, std::uint32_t slot, std::uint32_t generation);
         void Touch(ArrayRecord &record) noexcept;
+
+        void Track(ArrayRecord &record) noexcept;
+
+        void TrackSlots() noexcept;
+        void Accommodate(ArrayRecord &record, const Value &value);
+        static ElementKind ElementKindFor(const Value &value) noexcept;
         void UpdateMetricsOnCreate(const ArrayRecord &record);
         void UpdateMetricsOnDestroy(const ArrayRecord &record);
         void UpdateMetricsOnResizeDense(std::size_t previousCapacity, std::size_t newCapacity);
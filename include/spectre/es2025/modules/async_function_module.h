@@ -66,6 +66,10 @@ namespace spectre::es2025 {
         void OptimizeGpu(const ModuleGpuContext &context) noexcept override;
         void Reconfigure(const RuntimeConfig &config) override;
 
+        void CollectMemory(ModuleMemoryUsage &usage) const noexcept override;
+
+        void SampleMemory(ModuleMemoryCounters &counters) const noexcept override;
+
         StatusCode Configure(std::size_t queueCapacity, std::size_t completionCapacity = 0);
 
         StatusCode Enqueue(Callback callback,
@@ -143,6 +147,7 @@ namespace spectre::es2025 {
         std::vector<Handle> m_WaitingQueue;
         std::vector<Handle> m_ReadyQueue;
         std::vector<Result> m_Completed;
+        mutable memory::Gauge m_Memory;
         Metrics m_Metrics;
     };
 }
@@ -97,6 +97,10 @@ namespace spectre::es2025 {
         void OptimizeGpu(const ModuleGpuContext &context) noexcept override;
         void Reconfigure(const RuntimeConfig &config) override;
 
+        void CollectMemory(ModuleMemoryUsage &usage) const noexcept override;
+
+        void SampleMemory(ModuleMemoryCounters &counters) const noexcept override;
+
         StatusCode Configure(std::size_t streamCapacity,
                              std::size_t queueCapacity,
                              std::size_t waiterCapacity);
@@ -222,6 +226,7 @@ namespace spectre::es2025 {
         std::vector<Slot> m_Slots;
         std::vector<std::uint32_t> m_FreeSlots;
         std::vector<Result> m_Settled;
+        mutable memory::Gauge m_Memory;
         Metrics m_Metrics;
     };
 }
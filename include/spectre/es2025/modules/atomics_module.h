@@ -1,8 +1,14 @@
 ﻿#pragma once
 
+#include <array>
 #include <atomic>
+#include <condition_variable>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -24,6 +30,13 @@ namespace spectre::es2025 {
             SequentiallyConsistent
         };
 
+        // Packed lanes sit next to each other, eight to a cache line. Padded gives every lane a
+        // cache line of its own, so threads updating different lanes never contend for one.
+        enum class Layout : std::uint8_t {
+            Packed,
+            Padded
+        };
+
         struct BufferMetrics {
             std::uint64_t allocations;
             std::uint64_t deallocations;
@@ -41,6 +54,22 @@ namespace spectre::es2025 {
             BufferMetrics() noexcept;
         };
 
+        enum class WaitResult : std::uint8_t {
+            Ok,
+            NotEqual,
+            TimedOut
+        };
+
+        // Wait/Notify activity. Waiters block on other threads, so these are read as a snapshot.
+        struct WaitMetrics {
+            std::uint64_t waits;
+            std::uint64_t wakes;
+            std::uint64_t timeouts;
+            std::uint64_t mismatches;
+            std::uint64_t notifies;
+            std::uint64_t activeWaiters;
+        };
+
         AtomicsModule();
 
         std::string_view Name() const noexcept override;
@@ -51,10 +80,25 @@ namespace spectre::es2025 {
         void Tick(const TickInfo &info, const ModuleTickContext &context) noexcept override;
         void OptimizeGpu(const ModuleGpuContext &context) noexcept override;
         void Reconfigure(const RuntimeConfig &config) override;
+        void CollectMemory(ModuleMemoryUsage &usage) const noexcept override;
 
-        StatusCode CreateBuffer(std::string_view label, std::size_t wordCount, Handle &outHandle);
+        void SampleMemory(ModuleMemoryCounters &counters) const noexcept override;
+
+        StatusCode CreateBuffer(std::string_view label,
+                                std::size_t wordCount,
+                                Handle &outHandle,
+                                Layout layout = Layout::Packed);
         StatusCode DestroyBuffer(Handle handle);
 
+        // Sharded counter: a padded buffer with one stripe per slot, where each thread adds to its
+        // own stripe and reads sum them all. stripes is rounded up to a power of two; 0 picks one
+        // per hardware thread. Reads taken while adds are in flight are a snapshot, not a
+        // linearizable total, and adds are relaxed: a counter counts, it does not order other
+        // memory. The handle also works with DestroyBuffer and, stripe by stripe, with Load/Store.
+        StatusCode CreateCounter(std::string_view label, Handle &outHandle, std::size_t stripes = 0);
+        StatusCode CounterAdd(Handle handle, std::int64_t value) noexcept;
+        StatusCode CounterRead(Handle handle, std::int64_t &outValue) const noexcept;
+
         StatusCode Fill(Handle handle,
                         std::int64_t value,
                         MemoryOrder order = MemoryOrder::SequentiallyConsistent) noexcept;
@@ -113,22 +157,58 @@ namespace spectre::es2025 {
                        std::int64_t &outPrevious,
                        MemoryOrder order = MemoryOrder::SequentiallyConsistent) noexcept;
 
+        // Atomics.wait: if the lane still holds expected, blocks the calling thread until Notify
+        // wakes it or timeoutMilliseconds elapses (infinity waits forever, NaN is treated as
+        // infinity and negative values as zero). The value check and the enqueue happen under the
+        // lane's waiter-list lock, so a Store followed by Notify is never missed. DestroyBuffer
+        // refuses with InvalidArgument while a waiter is parked on the buffer. Wait returns
+        // NotFound only in the race where it looked the lane up before the destroy and parks after
+        // the waiter check; the destroy then retires the lanes and wakes it. The waiter holds its
+        // own reference to the lane storage, so it is never freed under it. Never call it from
+        // the thread that drives Tick.
+        StatusCode Wait(Handle handle,
+                        std::size_t index,
+                        std::int64_t expected,
+                        WaitResult &outResult,
+                        double timeoutMilliseconds = std::numeric_limits<double>::infinity());
+
+        // Atomics.notify: wakes up to count threads waiting on the lane, oldest first.
+        StatusCode Notify(Handle handle,
+                          std::size_t index,
+                          std::size_t &outWoken,
+                          std::size_t count = std::numeric_limits<std::size_t>::max());
+
+        WaitMetrics WaitStatistics() const noexcept;
+
         StatusCode Snapshot(Handle handle, std::vector<std::int64_t> &outValues) const;
 
         bool Has(Handle handle) const noexcept;
         std::size_t Capacity(Handle handle) const noexcept;
 
-        const BufferMetrics &Metrics() const noexcept;
+        // Operation counts are kept per thread and summed here, so the result is a snapshot.
+        BufferMetrics Metrics() const noexcept;
         bool GpuEnabled() const noexcept;
 
     private:
+        // Lane storage. A buffer owns it through a shared pointer and Wait/Notify take their own
+        // reference, so destroying the buffer never frees words a waiter still reads or parks on.
+        // retired is set once the buffer is destroyed.
+        struct LaneBlock {
+            std::vector<std::int64_t> words;
+            std::atomic<bool> retired{false};
+        };
+
         struct BufferRecord {
             Handle handle;
             std::uint32_t slot;
             std::uint32_t generation;
             std::string label;
-            std::vector<std::int64_t> words;
+            std::shared_ptr<LaneBlock> lanes;
+            // Lane 0, cache-line aligned for padded buffers.
+            std::int64_t *base;
             std::size_t logicalLength;
+            std::size_t wordStride;
+            bool counter;
             std::uint64_t version;
             std::uint64_t lastTouchFrame;
             bool hot;
@@ -140,18 +220,81 @@ namespace spectre::es2025 {
             bool inUse;
         };
 
+        // Slots live in fixed chunks that never move once allocated, so a thread can look a
+        // handle up while the driver thread appends slots in CreateBuffer.
+        static constexpr std::size_t kSlotChunkSize = 256;
+        static constexpr std::size_t kMaxSlotChunks = 4096;
+
+        struct SlotChunk {
+            std::array<Slot, kSlotChunkSize> slots{};
+        };
+
+        // A blocked Wait call; it lives on the waiting thread's stack and is linked into the
+        // bucket of the lane it waits on.
+        struct Waiter {
+            const std::int64_t *address;
+            std::condition_variable wake;
+            Waiter *next;
+            bool notified;
+            // Woken because the buffer was destroyed, not by Notify.
+            bool retired;
+        };
+
+        // Waiter lists are keyed by lane address and hashed into buckets, each a FIFO under its
+        // own lock. Buckets sit on separate cache lines so unrelated lanes do not contend.
+        struct alignas(64) WaitBucket {
+            std::mutex mutex;
+            Waiter *head = nullptr;
+            Waiter *tail = nullptr;
+        };
+
+        static constexpr std::size_t kWaitBuckets = 64;
+
+        // Per-thread operation counts. A thread always updates the same stripe, so the hot path
+        // never shares a cache line with other threads (unless more than kOpStripes run at once).
+        struct alignas(64) OpStripe {
+            std::atomic<std::uint64_t> loads{0};
+            std::atomic<std::uint64_t> stores{0};
+            std::atomic<std::uint64_t> rmws{0};
+            std::atomic<std::uint64_t> compareExchangeHits{0};
+            std::atomic<std::uint64_t> compareExchangeMisses{0};
+        };
+
+        static constexpr std::size_t kOpStripes = 16;
+
         SpectreRuntime *m_Runtime;
         detail::SubsystemSuite *m_Subsystems;
         RuntimeConfig m_Config;
         bool m_GpuEnabled;
         bool m_Initialized;
         std::uint64_t m_CurrentFrame;
-        std::vector<Slot> m_Slots;
+        std::array<std::unique_ptr<SlotChunk>, kMaxSlotChunks> m_SlotChunks;
+        // Published with release after the slot it covers is ready; lookups acquire it.
+        std::atomic<std::uint32_t> m_SlotCount;
+        // Shared by Wait/Notify while they take a lane reference, exclusive while CreateBuffer and
+        // DestroyBuffer change slot state. Plain operations do not take it.
+        std::shared_mutex m_SlotMutex;
         std::vector<std::uint32_t> m_FreeSlots;
         BufferMetrics m_Metrics;
+        memory::Counter m_Memory;
+        std::uint64_t m_SlotTableBytes;
+        mutable std::array<OpStripe, kOpStripes> m_OpStripes;
+        std::array<WaitBucket, kWaitBuckets> m_WaitBuckets;
+        std::atomic<std::uint64_t> m_Waits;
+        std::atomic<std::uint64_t> m_Wakes;
+        std::atomic<std::uint64_t> m_WaitTimeouts;
+        std::atomic<std::uint64_t> m_WaitMismatches;
+        std::atomic<std::uint64_t> m_Notifies;
+        std::atomic<std::uint64_t> m_ActiveWaiters;
 
+        Slot *SlotAt(std::uint32_t index) noexcept;
+        const Slot *SlotAt(std::uint32_t index) const noexcept;
         BufferRecord *FindMutable(Handle handle) noexcept;
         const BufferRecord *Find(Handle handle) const noexcept;
+        StatusCode AcquireLane(Handle handle,
+                               std::size_t index,
+                               std::shared_ptr<LaneBlock> &outLanes,
+                               std::int64_t *&outAddress);
 
         static std::uint32_t DecodeSlot(Handle handle) noexcept;
         static std::uint32_t DecodeGeneration(Handle handle) noexcept;
@@ -161,15 +304,27 @@ namespace spectre::es2025 {
         void ResetRecord(BufferRecord &record,
                          std::string_view label,
                          std::size_t wordCount,
+                         Layout layout,
                          Handle handle,
                          std::uint32_t slot,
                          std::uint32_t generation);
 
+        // Lanes are reachable through const records: the words live in the shared LaneBlock.
+        static std::int64_t *Lane(const BufferRecord &record, std::size_t index) noexcept;
+        OpStripe &LocalStripe() const noexcept;
+
         void Touch(BufferRecord &record) noexcept;
+        void TrackSlots() noexcept;
+        static std::uint64_t RecordBytes(const BufferRecord &record) noexcept;
         void UpdateMetricsOnCreate(const BufferRecord &record);
         void UpdateMetricsOnDestroy(const BufferRecord &record);
         void RecomputeHotMetrics() noexcept;
 
         static std::size_t AlignWordCount(std::size_t count) noexcept;
+
+        WaitBucket &BucketFor(const std::int64_t *address) noexcept;
+        bool HasWaiters(const BufferRecord &record) noexcept;
+        void RetireLanes(LaneBlock &lanes) noexcept;
+        static void Unlink(WaitBucket &bucket, Waiter &waiter) noexcept;
     };
 }
@@ -52,6 +52,10 @@ namespace spectre::es2025 {
 
         void Reconfigure(const RuntimeConfig &config) override;
 
+        void CollectMemory(ModuleMemoryUsage &usage) const noexcept override;
+
+        void SampleMemory(ModuleMemoryCounters &counters) const noexcept override;
+
         StatusCode Create(std::string_view label, std::int64_t value, Handle &outHandle);
 
         StatusCode CreateFromDecimal(std::string_view label, std::string_view text, Handle &outHandle);
@@ -114,6 +118,7 @@ namespace spectre::es2025 {
         std::uint64_t m_CurrentFrame;
         std::vector<Slot> m_Slots;
         std::vector<std::uint32_t> m_FreeSlots;
+        mutable memory::Gauge m_Memory;
         Handle m_CanonicalZero;
         Handle m_CanonicalOne;
         Handle m_CanonicalMinusOne;
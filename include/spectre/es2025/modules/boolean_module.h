@@ -38,6 +38,10 @@ namespace spectre::es2025 {
         void OptimizeGpu(const ModuleGpuContext &context) noexcept override;
         void Reconfigure(const RuntimeConfig &config) override;
 
+        void CollectMemory(ModuleMemoryUsage &usage) const noexcept override;
+
+        void SampleMemory(ModuleMemoryCounters &counters) const noexcept override;
+
         bool ToBoolean(double value) const noexcept;
         bool ToBoolean(std::int64_t value) const noexcept;
         bool ToBoolean(std::string_view text) const noexcept;
@@ -84,6 +88,7 @@ namespace spectre::es2025 {
         Handle m_CanonicalFalse;
         std::vector<Slot> m_Slots;
         std::vector<std::uint32_t> m_FreeSlots;
+        mutable memory::Gauge m_Memory;
         CacheMetrics m_Metrics;
 
         Entry *FindMutable(Handle handle) noexcept;
@@ -3,8 +3,10 @@
 #include <cstddef>
 #include <cstdint>
 #include <limits>
+#include <span>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <vector>
 
 #include "spectre/config.h"
@@ -27,6 +29,8 @@ namespace spectre::es2025 {
             std::uint64_t hotViews;
             std::uint64_t activeViews;
             std::uint64_t lastFrameTouched;
+            std::uint64_t recordsDecoded;
+            std::uint64_t recordsEncoded;
             bool gpuOptimized;
 
             Metrics() noexcept;
@@ -39,6 +43,101 @@ namespace spectre::es2025 {
             bool attached;
         };
 
+        enum class FieldType : std::uint8_t {
+            Int8,
+            Uint8,
+            Int16,
+            Uint16,
+            Int32,
+            Uint32,
+            Float32,
+            Float64,
+            BigInt64,
+            BigUint64
+        };
+
+        // One field of a fixed-size binary record, at offset bytes from the record start.
+        struct Field {
+            FieldType type;
+            std::uint32_t offset;
+            bool littleEndian;
+        };
+
+        // A validated record layout; build it once with BuildSchema and reuse it for every batch.
+        class Schema {
+        public:
+            Schema() noexcept;
+
+            std::span<const Field> Fields() const noexcept;
+            std::size_t Stride() const noexcept;
+
+        private:
+            friend class DataViewModule;
+
+            std::vector<Field> m_Fields;
+            std::size_t m_Stride;
+            std::size_t m_Extent;
+        };
+
+        // Structure-of-arrays storage for one schema field: a span of the field's exact C++ type
+        // (std::uint16_t for Uint16, float for Float32, std::int64_t for BigInt64, ...). Decoding
+        // needs a mutable span; a default-constructed Column skips its field.
+        class Column {
+        public:
+            Column() noexcept : m_Data(nullptr), m_Count(0), m_Type(FieldType::Uint8), m_Writable(false) {
+            }
+
+            template<typename T>
+            Column(std::span<T> values) noexcept
+                : m_Data(reinterpret_cast<std::uint8_t *>(const_cast<std::remove_const_t<T> *>(values.data()))),
+                  m_Count(values.size()),
+                  m_Type(FieldTypeOf<std::remove_const_t<T>>()),
+                  m_Writable(!std::is_const_v<T>) {
+            }
+
+            template<typename T>
+            Column(std::vector<T> &values) noexcept : Column(std::span<T>(values)) {
+            }
+
+            template<typename T>
+            Column(const std::vector<T> &values) noexcept : Column(std::span<const T>(values)) {
+            }
+
+        private:
+            friend class DataViewModule;
+
+            template<typename T>
+            static constexpr FieldType FieldTypeOf() noexcept {
+                if constexpr (std::is_same_v<T, std::int8_t>) {
+                    return FieldType::Int8;
+                } else if constexpr (std::is_same_v<T, std::uint8_t>) {
+                    return FieldType::Uint8;
+                } else if constexpr (std::is_same_v<T, std::int16_t>) {
+                    return FieldType::Int16;
+                } else if constexpr (std::is_same_v<T, std::uint16_t>) {
+                    return FieldType::Uint16;
+                } else if constexpr (std::is_same_v<T, std::int32_t>) {
+                    return FieldType::Int32;
+                } else if constexpr (std::is_same_v<T, std::uint32_t>) {
+                    return FieldType::Uint32;
+                } else if constexpr (std::is_same_v<T, float>) {
+                    return FieldType::Float32;
+                } else if constexpr (std::is_same_v<T, double>) {
+                    return FieldType::Float64;
+                } else if constexpr (std::is_same_v<T, std::int64_t>) {
+                    return FieldType::BigInt64;
+                } else {
+                    static_assert(std::is_same_v<T, std::uint64_t>, "Column needs a DataView field storage type");
+                    return FieldType::BigUint64;
+                }
+            }
+
+            std::uint8_t *m_Data;
+            std::size_t m_Count;
+            FieldType m_Type;
+            bool m_Writable;
+        };
+
         DataViewModule();
 
         std::string_view Name() const noexcept override;
@@ -49,6 +148,9 @@ namespace spectre::es2025 {
         void Tick(const TickInfo &info, const ModuleTickContext &context) noexcept override;
         void OptimizeGpu(const ModuleGpuContext &context) noexcept override;
         void Reconfigure(const RuntimeConfig &config) override;
+        void CollectMemory(ModuleMemoryUsage &usage) const noexcept override;
+
+        void SampleMemory(ModuleMemoryCounters &counters) const noexcept override;
 
         StatusCode Create(ArrayBufferModule::Handle buffer,
                           std::size_t byteOffset,
@@ -82,6 +184,25 @@ namespace spectre::es2025 {
         StatusCode SetBigInt64(Handle handle, std::size_t byteOffset, std::int64_t value, bool littleEndian) noexcept;
         StatusCode SetBigUint64(Handle handle, std::size_t byteOffset, std::uint64_t value, bool littleEndian) noexcept;
 
+        // Every field must fit inside recordStride bytes; fields may overlap.
+        static StatusCode BuildSchema(std::span<const Field> fields, std::size_t recordStride, Schema &outSchema);
+        static std::size_t FieldWidth(FieldType type) noexcept;
+
+        // Bulk codecs over count records laid out schema.Stride() bytes apart from byteOffset. One
+        // call resolves the view and checks the whole range once, then moves each field between the
+        // records and its column (columns[i] belongs to field i and holds at least count values),
+        // swapping byte order in vector-width batches when it differs from the host.
+        StatusCode DecodeRecords(Handle handle,
+                                 const Schema &schema,
+                                 std::size_t byteOffset,
+                                 std::size_t count,
+                                 std::span<const Column> columns) const noexcept;
+        StatusCode EncodeRecords(Handle handle,
+                                 const Schema &schema,
+                                 std::size_t byteOffset,
+                                 std::size_t count,
+                                 std::span<const Column> columns) noexcept;
+
         const Metrics &GetMetrics() const noexcept;
         bool GpuEnabled() const noexcept;
 
@@ -122,6 +243,8 @@ namespace spectre::es2025 {
         mutable Metrics m_Metrics;
         std::vector<SlotRecord> m_Slots;
         std::vector<std::uint32_t> m_FreeSlots;
+        memory::Counter m_Memory;
+        std::uint64_t m_SlotTableBytes;
 
         static Handle EncodeHandle(std::uint32_t slot, std::uint32_t generation) noexcept;
         static std::uint32_t DecodeSlot(Handle handle) noexcept;
@@ -132,11 +255,18 @@ namespace spectre::es2025 {
 
         std::uint32_t AcquireSlot();
         void ReleaseSlot(std::uint32_t slotIndex);
+        void TrackSlots() noexcept;
         void Reset();
         void Touch(ViewRecord &record) noexcept;
         void RecomputeHotMetrics() noexcept;
 
         bool ValidateRange(const ViewRecord &record, std::size_t byteOffset, std::size_t width) const noexcept;
+        bool ValidateRecords(const ViewRecord &record,
+                             const Schema &schema,
+                             std::size_t byteOffset,
+                             std::size_t count,
+                             std::span<const Column> columns,
+                             bool decoding) const noexcept;
         StatusCode ResolveBuffer(ViewRecord &record, ArrayBufferModule::BufferRecord *&outRecord) noexcept;
         StatusCode ResolveBuffer(const ViewRecord &record, const ArrayBufferModule::BufferRecord *&outRecord) const noexcept;
 
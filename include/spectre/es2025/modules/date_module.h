@@ -55,6 +55,10 @@ namespace spectre::es2025 {
         void OptimizeGpu(const ModuleGpuContext &context) noexcept override;
         void Reconfigure(const RuntimeConfig &config) override;
 
+        void CollectMemory(ModuleMemoryUsage &usage) const noexcept override;
+
+        void SampleMemory(ModuleMemoryCounters &counters) const noexcept override;
+
         StatusCode CreateFromEpochMilliseconds(std::string_view label, std::int64_t epochMs, Handle &outHandle);
         StatusCode CreateFromComponents(std::string_view label,
                                         int year,
@@ -121,6 +125,7 @@ namespace spectre::es2025 {
         std::uint64_t m_CurrentFrame;
         std::vector<Slot> m_Slots;
         std::vector<std::uint32_t> m_FreeSlots;
+        mutable memory::Gauge m_Memory;
         Handle m_CanonicalEpoch;
         mutable Metrics m_Metrics;
 
@@ -42,6 +42,10 @@ namespace spectre::es2025 {
 
         void Reconfigure(const RuntimeConfig &config) override;
 
+        void CollectMemory(ModuleMemoryUsage &usage) const noexcept override;
+
+        void SampleMemory(ModuleMemoryCounters &counters) const noexcept override;
+
         StatusCode RegisterErrorType(std::string_view type, std::string_view defaultMessage);
 
         bool HasErrorType(std::string_view type) const noexcept;
@@ -77,6 +81,7 @@ namespace spectre::es2025 {
         bool m_Initialized;
         std::unordered_map<std::string, ErrorDescriptor> m_ErrorTypes;
         std::vector<ErrorRecord> m_History;
+        mutable memory::Gauge m_Memory;
         std::uint64_t m_CurrentFrame;
 
         void RegisterBuiltins();
@@ -57,6 +57,10 @@ namespace spectre::es2025 {
         void OptimizeGpu(const ModuleGpuContext &context) noexcept override;
         void Reconfigure(const RuntimeConfig &config) override;
 
+        void CollectMemory(ModuleMemoryUsage &usage) const noexcept override;
+
+        void SampleMemory(ModuleMemoryCounters &counters) const noexcept override;
+
         StatusCode Create(const CreateOptions &options, Handle &outHandle);
         StatusCode Destroy(Handle handle);
 
@@ -158,6 +162,7 @@ namespace spectre::es2025 {
         Metrics m_Metrics;
         std::vector<SlotRecord> m_Slots;
         std::vector<std::uint32_t> m_FreeSlots;
+        mutable memory::Gauge m_Memory;
     };
 }
 
@@ -38,6 +38,10 @@ namespace spectre::es2025 {
         void OptimizeGpu(const ModuleGpuContext &context) noexcept override;
         void Reconfigure(const RuntimeConfig &config) override;
 
+        void CollectMemory(ModuleMemoryUsage &usage) const noexcept override;
+
+        void SampleMemory(ModuleMemoryCounters &counters) const noexcept override;
+
         StatusCode RegisterHostFunction(std::string_view name,
                                         FunctionCallback callback,
                                         void *userData = nullptr,
@@ -77,6 +81,7 @@ namespace spectre::es2025 {
         std::vector<Entry> m_Functions;
         std::vector<std::string> m_Names;
         std::unordered_map<std::string, std::size_t> m_Index;
+        mutable memory::Gauge m_Memory;
         std::uint64_t m_CurrentFrame;
 
         Entry *FindMutable(std::string_view name) noexcept;
@@ -61,6 +61,10 @@ namespace spectre::es2025 {
         void OptimizeGpu(const ModuleGpuContext &context) noexcept override;
         void Reconfigure(const RuntimeConfig &config) override;
 
+        void CollectMemory(ModuleMemoryUsage &usage) const noexcept override;
+
+        void SampleMemory(ModuleMemoryCounters &counters) const noexcept override;
+
         StatusCode Register(const Descriptor &descriptor, Handle &outHandle);
         bool Destroy(Handle handle);
         StepResult Resume(Handle handle, std::string_view input = {});
@@ -158,6 +162,7 @@ namespace spectre::es2025 {
         std::vector<std::uint32_t> m_FreeSlots;
         std::vector<std::unique_ptr<BridgeState>> m_Bridges;
         std::vector<std::uint32_t> m_FreeBridges;
+        mutable memory::Gauge m_Memory;
         std::size_t m_Active;
         std::size_t m_ActiveBridges;
     };
@@ -32,6 +32,10 @@ namespace spectre::es2025 {
 
         void Reconfigure(const RuntimeConfig &config) override;
 
+        void CollectMemory(ModuleMemoryUsage &usage) const noexcept override;
+
+        void SampleMemory(ModuleMemoryCounters &counters) const noexcept override;
+
         StatusCode EnsureContext(std::string_view name, std::uint32_t stackSize = 0);
 
         StatusCode EvaluateScript(std::string_view source,
@@ -202,6 +202,10 @@ namespace spectre::es2025 {
         void OptimizeGpu(const ModuleGpuContext &context) noexcept override;
         void Reconfigure(const RuntimeConfig &config) override;
 
+        void CollectMemory(ModuleMemoryUsage &usage) const noexcept override;
+
+        void SampleMemory(ModuleMemoryCounters &counters) const noexcept override;
+
         StatusCode RegisterLocale(const LocaleBlueprint &blueprint, LocaleHandle &outHandle);
         StatusCode EnsureLocale(std::string_view identifier, LocaleHandle &outHandle);
         bool HasLocale(std::string_view identifier) const noexcept;
@@ -440,6 +444,7 @@ namespace spectre::es2025 {
         std::unordered_map<std::uint64_t, NumberFormatterCacheEntry> m_NumberCache;
         std::unordered_map<std::uint64_t, DateFormatterCacheEntry> m_DateCache;
         std::unordered_map<std::uint64_t, ListFormatterCacheEntry> m_ListCache;
+        mutable memory::Gauge m_Memory;
 
         Metrics m_Metrics;
 
@@ -55,6 +55,10 @@ namespace spectre::es2025 {
         void OptimizeGpu(const ModuleGpuContext &context) noexcept override;
         void Reconfigure(const RuntimeConfig &config) override;
 
+        void CollectMemory(ModuleMemoryUsage &usage) const noexcept override;
+
+        void SampleMemory(ModuleMemoryCounters &counters) const noexcept override;
+
         StatusCode CreateRange(const RangeConfig &config, Handle &outHandle);
         StatusCode CreateList(std::vector<Value> values, Handle &outHandle);
         StatusCode CreateList(std::span<const Value> values, Handle &outHandle);
@@ -129,6 +133,7 @@ namespace spectre::es2025 {
         std::uint64_t m_CurrentFrame;
         std::vector<Slot> m_Slots;
         std::vector<std::uint32_t> m_FreeList;
+        mutable memory::Gauge m_Memory;
         std::size_t m_Active;
     };
 }
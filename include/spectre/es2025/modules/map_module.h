@@ -1,6 +1,7 @@
 ﻿#pragma once
 
 #include <cstdint>
+#include <span>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -16,6 +17,14 @@ namespace spectre::es2025 {
     public:
         using Handle = std::uint64_t;
 
+        // Position in a map's insertion order. Cursors read entries in place; any mutation of the
+        // map invalidates its open cursors.
+        struct Cursor {
+            Handle handle;
+            std::uint64_t version;
+            std::uint32_t position;
+        };
+
         struct Metrics {
             std::uint64_t liveMaps;
             std::uint64_t totalAllocations;
@@ -51,6 +60,10 @@ namespace spectre::es2025 {
 
         void Reconfigure(const RuntimeConfig &config) override;
 
+        void CollectMemory(ModuleMemoryUsage &usage) const noexcept override;
+
+        void SampleMemory(ModuleMemoryCounters &counters) const noexcept override;
+
         StatusCode Create(std::string_view label, Handle &outHandle);
 
         StatusCode Destroy(Handle handle);
@@ -65,6 +78,17 @@ namespace spectre::es2025 {
 
         StatusCode Delete(Handle handle, const Value &key, bool &outDeleted);
 
+        // Inserts or overwrites every pair after sizing the table once for the whole batch.
+        StatusCode SetMany(Handle handle, std::span<const std::pair<Value, Value> > entries);
+
+        // Looks up every key; bit i of outFound (one word per 64 keys) is set when keys[i] was
+        // present, and outValues[i] is undefined otherwise.
+        StatusCode GetMany(Handle handle, std::span<const Value> keys, std::span<Value> outValues,
+                           std::span<std::uint64_t> outFound) const;
+
+        // Sizes the table for count entries so inserting up to that many never rehashes.
+        StatusCode Reserve(Handle handle, std::uint32_t count);
+
         std::uint32_t Size(Handle handle) const;
 
         StatusCode Keys(Handle handle, std::vector<Value> &keys) const;
@@ -73,6 +97,16 @@ namespace spectre::es2025 {
 
         StatusCode Entries(Handle handle, std::vector<std::pair<Value, Value> > &entries) const;
 
+        StatusCode OpenCursor(Handle handle, Cursor &outCursor) const;
+
+        // Copy the next chunk (up to out.size() items) and advance. outCount is zero once the
+        // cursor is exhausted; a cursor outliving a mutation yields InvalidArgument.
+        StatusCode NextKeys(Cursor &cursor, std::span<Value> out, std::size_t &outCount) const;
+
+        StatusCode NextValues(Cursor &cursor, std::span<Value> out, std::size_t &outCount) const;
+
+        StatusCode NextEntries(Cursor &cursor, std::span<std::pair<Value, Value> > out, std::size_t &outCount) const;
+
         const Metrics &GetMetrics() const noexcept;
 
     private:
@@ -81,7 +115,6 @@ namespace spectre::es2025 {
         struct SlotRecord;
 
         static constexpr std::uint32_t kInvalidIndex = 0xffffffffu;
-        static constexpr std::uint32_t kDeletedIndex = 0xfffffffeu;
 
         SpectreRuntime *m_Runtime;
         detail::SubsystemSuite *m_Subsystems;
@@ -89,6 +122,8 @@ namespace spectre::es2025 {
         Metrics m_Metrics;
         std::vector<SlotRecord> m_Slots;
         std::vector<std::uint32_t> m_FreeSlots;
+        memory::Counter m_Memory;
+        std::uint64_t m_SlotTableBytes;
         bool m_GpuEnabled;
         bool m_Initialized;
         std::uint64_t m_CurrentFrame;
@@ -111,24 +146,24 @@ namespace spectre::es2025 {
 
         void Touch(MapRecord &record) noexcept;
 
-        void TouchMetrics() noexcept;
+        void Track(MapRecord &record) noexcept;
 
-        void EnsureCapacity(MapRecord &record);
+        void TrackSlots() noexcept;
 
-        void Rehash(MapRecord &record, std::uint32_t newBucketCount);
+        void TouchMetrics() noexcept;
 
-        std::uint32_t Locate(const MapRecord &record, const Value &key, std::uint64_t hash, std::uint32_t &bucket,
-                             bool &collision) const;
+        StatusCode ResolveCursor(const Cursor &cursor, const MapRecord *&outRecord) const noexcept;
 
-        std::uint32_t AllocateEntry(MapRecord &record);
+        StatusCode EnsureCapacity(MapRecord &record, std::uint32_t additional);
 
-        StatusCode Insert(MapRecord &record, const Value &key, const Value &value, std::uint64_t hash,
-                          bool allowReplace);
+        void Rehash(MapRecord &record, std::uint32_t capacity);
 
-        StatusCode Remove(MapRecord &record, const Value &key, std::uint64_t hash, bool &outDeleted);
+        std::uint32_t Locate(const MapRecord &record, const Value &key, std::uint64_t hash, bool &collision) const;
 
-        void LinkTail(MapRecord &record, std::uint32_t entryIndex);
+        StatusCode Insert(MapRecord &record, const Value &key, const Value &value, std::uint64_t hash);
 
-        void Unlink(MapRecord &record, std::uint32_t entryIndex);
+        void Append(MapRecord &record, const Value &key, const Value &value, std::uint64_t hash);
+
+        StatusCode Remove(MapRecord &record, const Value &key, std::uint64_t hash, bool &outDeleted);
     };
 }
@@ -44,6 +44,10 @@ namespace spectre::es2025 {
 
         void Reconfigure(const RuntimeConfig &config) override;
 
+        void CollectMemory(ModuleMemoryUsage &usage) const noexcept override;
+
+        void SampleMemory(ModuleMemoryCounters &counters) const noexcept override;
+
         double FastSin(double radians) const noexcept;
 
         double FastCos(double radians) const noexcept;
@@ -90,6 +94,7 @@ namespace spectre::es2025 {
         bool m_Initialized;
         std::uint64_t m_CurrentFrame;
         std::vector<TableEntry> m_Table;
+        mutable memory::Gauge m_Memory;
         mutable Metrics m_Metrics;
 
         std::size_t TableIndex(double radians) const noexcept;
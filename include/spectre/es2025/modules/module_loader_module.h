@@ -86,6 +86,10 @@ namespace spectre::es2025 {
         void OptimizeGpu(const ModuleGpuContext &context) noexcept override;
         void Reconfigure(const RuntimeConfig &config) override;
 
+        void CollectMemory(ModuleMemoryUsage &usage) const noexcept override;
+
+        void SampleMemory(ModuleMemoryCounters &counters) const noexcept override;
+
         void SetHostResolver(ResolveCallback callback, void *userData) noexcept;
 
         StatusCode RegisterModule(std::string_view specifier,
@@ -236,6 +240,7 @@ namespace spectre::es2025 {
 
         std::unordered_map<std::string, Handle, TransparentStringHash, TransparentStringEqual> m_SpecifierLookup;
         std::unordered_map<std::string, std::uint32_t, TransparentStringHash, TransparentStringEqual> m_ContextLookup;
+        mutable memory::Gauge m_Memory;
 
         Metrics m_Metrics;
 
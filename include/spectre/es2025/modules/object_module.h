@@ -1,11 +1,15 @@
 ﻿#pragma once
 
+#include <array>
 #include <cstdint>
+#include <memory>
+#include <span>
 #include <string>
 #include <string_view>
 #include <vector>
 
 #include "spectre/es2025/module.h"
+#include "spectre/es2025/modules/string_module.h"
 #include "spectre/es2025/value.h"
 #include "spectre/config.h"
 #include "spectre/status.h"
@@ -14,6 +18,7 @@ namespace spectre::es2025 {
     class ObjectModule final : public Module {
     public:
         using Handle = std::uint64_t;
+        using Atom = StringModule::Atom;
 
         struct PropertyDescriptor {
             Value value;
@@ -36,10 +41,41 @@ namespace spectre::es2025 {
             std::uint64_t collisions;
             std::uint64_t seals;
             std::uint64_t freezes;
+            std::uint64_t shapes;
+            std::uint64_t shapeTransitions;
+            std::uint64_t dictionaryObjects;
+            std::uint64_t inlineCacheHits;
+            std::uint64_t inlineCacheMisses;
             std::uint64_t lastFrameTouched;
             bool gpuOptimized;
         };
 
+        // Per-access-site inline cache. Entries remember the receiver shape and the slot offset
+        // that satisfied the lookup, either on the receiver itself or on its direct prototype.
+        // Up to kWays shapes are cached; past that the site is megamorphic and only the cached
+        // shapes stay on the fast path. A slot must not be shared between ObjectModule instances.
+        struct CacheSlot {
+            static constexpr std::uint32_t kWays = 4;
+
+            struct Entry {
+                std::uint32_t shape;
+                std::uint32_t offset;
+                std::uint32_t holderShape;
+                bool writable;
+                Handle prototype;
+            };
+
+            std::array<Entry, kWays> entries;
+            std::uint32_t name;
+            std::uint32_t count;
+            bool megamorphic;
+
+            CacheSlot() noexcept;
+            bool Monomorphic() const noexcept { return count == 1 && !megamorphic; }
+            bool Polymorphic() const noexcept { return count > 1 && !megamorphic; }
+            void Reset() noexcept;
+        };
+
         ObjectModule();
         ~ObjectModule() override;
 
@@ -51,6 +87,9 @@ namespace spectre::es2025 {
         void Tick(const TickInfo &info, const ModuleTickContext &context) noexcept override;
         void OptimizeGpu(const ModuleGpuContext &context) noexcept override;
         void Reconfigure(const RuntimeConfig &config) override;
+        void CollectMemory(ModuleMemoryUsage &usage) const noexcept override;
+
+        void SampleMemory(ModuleMemoryCounters &counters) const noexcept override;
 
         StatusCode Create(std::string_view label, Handle prototype, Handle &outHandle);
         StatusCode Clone(Handle source, std::string_view label, Handle &outHandle);
@@ -62,8 +101,18 @@ namespace spectre::es2025 {
         StatusCode Describe(Handle handle, std::string_view key, PropertyDescriptor &outDescriptor) const;
         bool Has(Handle handle, std::string_view key) const;
         StatusCode Delete(Handle handle, std::string_view key, bool &outDeleted);
+
+        // Atom-keyed variants skip hashing the key. Atoms come from the String module's table.
+        StatusCode Define(Handle handle, Atom key, const PropertyDescriptor &descriptor);
+        StatusCode Set(Handle handle, Atom key, const Value &value);
+        StatusCode Get(Handle handle, Atom key, Value &outValue) const;
+        bool Has(Handle handle, Atom key) const;
+        StatusCode Delete(Handle handle, Atom key, bool &outDeleted);
         StatusCode OwnKeys(Handle handle, std::vector<std::string> &keys) const;
 
+        StatusCode LookupCached(Handle handle, std::string_view key, CacheSlot &cache, Value &outValue) const;
+        StatusCode StoreCached(Handle handle, std::string_view key, CacheSlot &cache, const Value &value);
+
         StatusCode SetPrototype(Handle handle, Handle prototype);
         Handle Prototype(Handle handle) const;
         StatusCode SetExtensible(Handle handle, bool extensible);
@@ -78,19 +127,26 @@ namespace spectre::es2025 {
         const Metrics &GetMetrics() const noexcept;
 
     private:
-        struct PropertySlot;
+        struct ShapeProperty;
+        struct Shape;
         struct ObjectRecord;
         struct SlotRecord;
 
         static constexpr std::uint32_t kInvalidIndex = 0xffffffffu;
-        static constexpr std::uint32_t kDeletedIndex = 0xfffffffeu;
+        static constexpr std::uint32_t kRootShape = 0;
+        static constexpr std::uint32_t kDictionaryShape = 0xfffffffeu;
 
         SpectreRuntime *m_Runtime;
         detail::SubsystemSuite *m_Subsystems;
         RuntimeConfig m_Config;
-        Metrics m_Metrics;
+        mutable Metrics m_Metrics;
         std::vector<SlotRecord> m_Slots;
         std::vector<std::uint32_t> m_FreeList;
+        std::vector<Shape> m_Shapes;
+        StringModule *m_Strings;
+        // Mutable so lookups can account for the name indexes they build on first use.
+        mutable memory::Counter m_Memory;
+        std::uint64_t m_SlotTableBytes;
         bool m_GpuEnabled;
         bool m_Initialized;
         std::uint64_t m_CurrentFrame;
@@ -101,20 +157,37 @@ namespace spectre::es2025 {
         ObjectRecord *FindMutable(Handle handle) noexcept;
         const ObjectRecord *Find(Handle handle) const noexcept;
 
-        static std::uint64_t HashKey(std::string_view key) noexcept;
-        static std::uint32_t NormalizeBuckets(std::uint32_t requested) noexcept;
-
-        StatusCode InsertOrUpdate(ObjectRecord &object, std::string_view key, const PropertyDescriptor &descriptor, bool allowNew);
-        StatusCode UpdateValue(ObjectRecord &object, std::string_view key, const Value &value, bool allowNew);
-        StatusCode RemoveProperty(ObjectRecord &object, std::string_view key, bool &outDeleted);
-
-        std::uint32_t Locate(const ObjectRecord &object, std::string_view key, std::uint64_t hash, std::uint32_t &bucket, bool &collision) const;
-        std::uint32_t AllocateProperty(ObjectRecord &object);
-        void EnsureCapacity(ObjectRecord &object);
-        void Rehash(ObjectRecord &object, std::uint32_t newBucketCount);
+        std::uint32_t LookupName(std::string_view key) const noexcept;
+        std::uint32_t InternName(std::string_view key);
+        void ReleaseName(std::uint32_t name);
+        void RetainNames(std::span<const ShapeProperty> properties) noexcept;
+        void ReleaseNames(std::span<const ShapeProperty> properties);
+
+        const Shape &LayoutOf(const ObjectRecord &object) const noexcept;
+        std::uint32_t FindOffset(const Shape &shape, std::uint32_t name) const;
+        void IndexShape(const Shape &shape) const;
+        void RebuildIndex(Shape &shape);
+        void AssignDictionary(Shape &dictionary, std::span<const ShapeProperty> properties);
+        std::uint32_t Transition(std::uint32_t parent, std::uint32_t name, std::uint8_t attributes);
+        void Relayout(ObjectRecord &object, const std::vector<ShapeProperty> &properties);
+        void ConvertToDictionary(ObjectRecord &object);
+        const ObjectRecord *Resolve(const ObjectRecord &object, std::uint32_t name, std::uint32_t &outOffset,
+                                    std::uint32_t &outDepth) const;
+        void Remember(CacheSlot &cache, std::uint32_t name, const ObjectRecord &receiver, const ObjectRecord &holder,
+                      std::uint32_t offset, std::uint32_t depth) const;
+
+        std::string_view NameOf(std::uint32_t name) const noexcept;
+
+        StatusCode InsertOrUpdate(ObjectRecord &object, std::uint32_t name, const PropertyDescriptor &descriptor, bool allowNew);
+        StatusCode UpdateValue(ObjectRecord &object, std::uint32_t name, const Value &value, bool allowNew);
+        StatusCode RemoveProperty(ObjectRecord &object, std::uint32_t name, bool &outDeleted);
+        StatusCode AddProperty(ObjectRecord &object, std::uint32_t name, std::uint8_t attributes, const Value &value);
 
         void Touch(ObjectRecord &object) noexcept;
         void TouchMetrics() noexcept;
+        void Track(ObjectRecord &object) noexcept;
+        void TrackSlots() noexcept;
+        static std::uint64_t ShapeBytes(const Shape &shape) noexcept;
 
         static Handle EncodeHandle(std::uint32_t slot, std::uint32_t generation) noexcept;
         static std::uint32_t DecodeSlot(Handle handle) noexcept;
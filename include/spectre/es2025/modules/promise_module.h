@@ -78,6 +78,10 @@ namespace spectre::es2025 {
         void OptimizeGpu(const ModuleGpuContext &context) noexcept override;
         void Reconfigure(const RuntimeConfig &config) override;
 
+        void CollectMemory(ModuleMemoryUsage &usage) const noexcept override;
+
+        void SampleMemory(ModuleMemoryCounters &counters) const noexcept override;
+
         StatusCode Configure(std::size_t promiseCapacity, std::size_t reactionCapacity);
 
         StatusCode CreatePromise(Handle &outHandle, const CreateOptions &options = {});
@@ -200,6 +204,7 @@ namespace spectre::es2025 {
         std::vector<ReactionSlot> m_Reactions;
         std::vector<std::uint32_t> m_FreeReactions;
         std::vector<std::uint32_t> m_MicrotaskQueue;
+        mutable memory::Gauge m_Memory;
         std::size_t m_MicrotaskHead;
 
         Metrics m_Metrics;
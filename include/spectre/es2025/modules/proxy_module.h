@@ -54,6 +54,10 @@ namespace spectre::es2025 {
         void OptimizeGpu(const ModuleGpuContext &context) noexcept override;
         void Reconfigure(const RuntimeConfig &config) override;
 
+        void CollectMemory(ModuleMemoryUsage &usage) const noexcept override;
+
+        void SampleMemory(ModuleMemoryCounters &counters) const noexcept override;
+
         StatusCode Create(ObjectModule::Handle target, const TrapTable &traps, Handle &outHandle);
         StatusCode Destroy(Handle handle);
         StatusCode Revoke(Handle handle);
@@ -64,22 +68,37 @@ namespace spectre::es2025 {
         StatusCode Delete(Handle handle, std::string_view key, bool &outDeleted);
         StatusCode OwnKeys(Handle handle, std::vector<std::string> &keys);
 
+        // Atom-keyed variants; traps still receive the key text.
+        StatusCode Get(Handle handle, ObjectModule::Atom key, Value &outValue);
+        StatusCode Set(Handle handle, ObjectModule::Atom key, const Value &value);
+        StatusCode Has(Handle handle, ObjectModule::Atom key, bool &outHas);
+        StatusCode Delete(Handle handle, ObjectModule::Atom key, bool &outDeleted);
+
         const Metrics &GetMetrics() const noexcept;
 
     private:
         struct ProxyRecord;
         struct SlotRecord;
 
+        // A property key as the caller passed it; atom keys carry no text until a trap needs it.
+        struct PropertyKey {
+            std::string_view text;
+            ObjectModule::Atom atom;
+            bool byAtom;
+        };
+
         SpectreRuntime *m_Runtime;
         detail::SubsystemSuite *m_Subsystems;
         RuntimeConfig m_Config;
         ObjectModule *m_ObjectModule;
+        StringModule *m_Strings;
         bool m_GpuEnabled;
         bool m_Initialized;
         std::uint64_t m_CurrentFrame;
         Metrics m_Metrics;
         std::vector<SlotRecord> m_Slots;
         std::vector<std::uint32_t> m_FreeList;
+        mutable memory::Gauge m_Memory;
 
         SlotRecord *FindMutableSlot(Handle handle) noexcept;
         const SlotRecord *FindSlot(Handle handle) const noexcept;
@@ -91,6 +110,12 @@ namespace spectre::es2025 {
         void TouchMetrics() noexcept;
 
         StatusCode EnsureTarget(ProxyRecord &record) const;
+        std::string_view TrapKey(const PropertyKey &key, std::string &scratch) const;
+
+        StatusCode GetProperty(Handle handle, const PropertyKey &key, Value &outValue);
+        StatusCode SetProperty(Handle handle, const PropertyKey &key, const Value &value);
+        StatusCode HasProperty(Handle handle, const PropertyKey &key, bool &outHas);
+        StatusCode DeleteProperty(Handle handle, const PropertyKey &key, bool &outDeleted);
 
         static Handle EncodeHandle(std::uint32_t slot, std::uint32_t generation) noexcept;
         static std::uint32_t DecodeSlot(Handle handle) noexcept;
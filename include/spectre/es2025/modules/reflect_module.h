@@ -41,6 +41,10 @@ namespace spectre::es2025 {
         void OptimizeGpu(const ModuleGpuContext &context) noexcept override;
         void Reconfigure(const RuntimeConfig &config) override;
 
+        void CollectMemory(ModuleMemoryUsage &usage) const noexcept override;
+
+        void SampleMemory(ModuleMemoryCounters &counters) const noexcept override;
+
         StatusCode DefineProperty(ObjectModule::Handle target,
                                   std::string_view key,
                                   const ObjectModule::PropertyDescriptor &descriptor);
@@ -62,6 +66,24 @@ namespace spectre::es2025 {
 
         bool Has(ObjectModule::Handle target, std::string_view key);
 
+        StatusCode DefineProperty(ObjectModule::Handle target,
+                                  ObjectModule::Atom key,
+                                  const ObjectModule::PropertyDescriptor &descriptor);
+
+        StatusCode Set(ObjectModule::Handle target,
+                       ObjectModule::Atom key,
+                       const Value &value);
+
+        StatusCode Get(ObjectModule::Handle target,
+                       ObjectModule::Atom key,
+                       Value &outValue);
+
+        StatusCode DeleteProperty(ObjectModule::Handle target,
+                                  ObjectModule::Atom key,
+                                  bool &outDeleted);
+
+        bool Has(ObjectModule::Handle target, ObjectModule::Atom key);
+
         StatusCode GetOwnPropertyDescriptor(ObjectModule::Handle target,
                                             std::string_view key,
                                             ObjectModule::PropertyDescriptor &outDescriptor);
@@ -73,6 +73,10 @@ namespace spectre::es2025 {
         void OptimizeGpu(const ModuleGpuContext &context) noexcept override;
         void Reconfigure(const RuntimeConfig &config) override;
 
+        void CollectMemory(ModuleMemoryUsage &usage) const noexcept override;
+
+        void SampleMemory(ModuleMemoryCounters &counters) const noexcept override;
+
         StatusCode Compile(std::string_view pattern, std::string_view flags, Handle &outHandle);
         StatusCode Destroy(Handle handle);
         StatusCode Exec(Handle handle,
@@ -167,6 +171,7 @@ namespace spectre::es2025 {
         std::vector<SlotRecord> m_Slots;
         std::vector<std::uint32_t> m_FreeSlots;
         std::unordered_map<std::string, Handle> m_Index;
+        mutable memory::Gauge m_Memory;
 
         static Handle EncodeHandle(std::uint32_t slot, std::uint32_t generation) noexcept;
         static std::uint32_t DecodeSlot(Handle handle) noexcept;
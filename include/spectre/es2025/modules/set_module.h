@@ -1,6 +1,7 @@
 ﻿#pragma once
 
 #include <cstdint>
+#include <span>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -16,6 +17,13 @@ namespace spectre::es2025 {
     public:
         using Handle = std::uint64_t;
 
+        // Position in a set's insertion order; invalidated by any mutation of the set.
+        struct Cursor {
+            Handle handle;
+            std::uint64_t version;
+            std::uint32_t position;
+        };
+
         struct Metrics {
             std::uint64_t liveSets;
             std::uint64_t totalAllocations;
@@ -51,6 +59,10 @@ namespace spectre::es2025 {
 
         void Reconfigure(const RuntimeConfig &config) override;
 
+        void CollectMemory(ModuleMemoryUsage &usage) const noexcept override;
+
+        void SampleMemory(ModuleMemoryCounters &counters) const noexcept override;
+
         StatusCode Create(std::string_view label, Handle &outHandle);
 
         StatusCode Destroy(Handle handle);
@@ -63,12 +75,21 @@ namespace spectre::es2025 {
 
         StatusCode Delete(Handle handle, const Value &value, bool &outDeleted);
 
+        // Sizes the table for count values so adding up to that many never rehashes.
+        StatusCode Reserve(Handle handle, std::uint32_t count);
+
         std::uint32_t Size(Handle handle) const;
 
         StatusCode Values(Handle handle, std::vector<Value> &values) const;
 
         StatusCode Entries(Handle handle, std::vector<std::pair<Value, Value> > &entries) const;
 
+        StatusCode OpenCursor(Handle handle, Cursor &outCursor) const;
+
+        // Copy up to out.size() values in place and advance; outCount is zero once exhausted and
+        // a stale cursor yields InvalidArgument.
+        StatusCode Next(Cursor &cursor, std::span<Value> out, std::size_t &outCount) const;
+
         const Metrics &GetMetrics() const noexcept;
 
     private:
@@ -77,7 +98,6 @@ namespace spectre::es2025 {
         struct SlotRecord;
 
         static constexpr std::uint32_t kInvalidIndex = 0xffffffffu;
-        static constexpr std::uint32_t kDeletedIndex = 0xfffffffeu;
 
         SpectreRuntime *m_Runtime;
         detail::SubsystemSuite *m_Subsystems;
@@ -85,6 +105,8 @@ namespace spectre::es2025 {
         Metrics m_Metrics;
         std::vector<SlotRecord> m_Slots;
         std::vector<std::uint32_t> m_FreeSlots;
+        memory::Counter m_Memory;
+        std::uint64_t m_SlotTableBytes;
         bool m_GpuEnabled;
         bool m_Initialized;
         std::uint64_t m_CurrentFrame;
@@ -107,23 +129,20 @@ namespace spectre::es2025 {
 
         void Touch(SetRecord &record) noexcept;
 
-        void TouchMetrics() noexcept;
+        void Track(SetRecord &record) noexcept;
+
+        void TrackSlots() noexcept;
 
-        void EnsureCapacity(SetRecord &record);
+        void TouchMetrics() noexcept;
 
-        void Rehash(SetRecord &record, std::uint32_t newBucketCount);
+        StatusCode EnsureCapacity(SetRecord &record, std::uint32_t additional);
 
-        std::uint32_t Locate(const SetRecord &record, const Value &value, std::uint64_t hash,
-                             std::uint32_t &bucket, bool &collision) const;
+        void Rehash(SetRecord &record, std::uint32_t capacity);
 
-        std::uint32_t AllocateEntry(SetRecord &record);
+        std::uint32_t Locate(const SetRecord &record, const Value &value, std::uint64_t hash, bool &collision) const;
 
         StatusCode Insert(SetRecord &record, const Value &value, std::uint64_t hash);
 
         StatusCode Remove(SetRecord &record, const Value &value, std::uint64_t hash, bool &outDeleted);
-
-        void LinkTail(SetRecord &record, std::uint32_t entryIndex);
-
-        void Unlink(SetRecord &record, std::uint32_t entryIndex);
     };
 }
@@ -9,6 +9,7 @@
 #include "spectre/config.h"
 #include "spectre/status.h"
 #include "spectre/es2025/module.h"
+#include "spectre/es2025/modules/string_module.h"
 #include "spectre/es2025/value.h"
 
 namespace spectre::es2025 {
@@ -50,6 +51,10 @@ namespace spectre::es2025 {
         void OptimizeGpu(const ModuleGpuContext &context) noexcept override;
         void Reconfigure(const RuntimeConfig &config) override;
 
+        void CollectMemory(ModuleMemoryUsage &usage) const noexcept override;
+
+        void SampleMemory(ModuleMemoryCounters &counters) const noexcept override;
+
         StatusCode Create(std::string_view label, Handle &outHandle, std::uint32_t stackSize = 0);
         StatusCode Destroy(Handle handle);
 
@@ -68,6 +73,15 @@ namespace spectre::es2025 {
                                std::string_view exportName,
                                Value &outValue) noexcept;
 
+        StatusCode ExportValue(Handle handle,
+                               StringModule::Atom exportName,
+                               const Value &value) noexcept;
+
+        StatusCode ImportValue(Handle targetRealm,
+                               Handle sourceRealm,
+                               StringModule::Atom exportName,
+                               Value &outValue) noexcept;
+
         StatusCode ClearExports(Handle handle) noexcept;
 
         StatusCode Describe(Handle handle,
@@ -83,6 +97,7 @@ namespace spectre::es2025 {
     private:
         struct ExportEntry {
             std::array<char, kMaxExportNameLength + 1> name;
+            StringModule::Atom atom;
             Value value;
             std::uint8_t length;
             bool inUse;
@@ -126,8 +141,10 @@ namespace spectre::es2025 {
         double m_TotalSeconds;
         std::vector<Slot> m_Slots;
         std::vector<std::uint32_t> m_FreeSlots;
+        mutable memory::Gauge m_Memory;
         Metrics m_Metrics;
         std::uint32_t m_DefaultStackSize;
+        StringModule *m_Strings;
 
         static Handle MakeHandle(std::uint32_t slot, std::uint16_t generation) noexcept;
         static std::uint32_t ExtractSlot(Handle handle) noexcept;
@@ -144,7 +161,16 @@ namespace spectre::es2025 {
         static void CopyExportName(std::string_view text,
                                    std::array<char, kMaxExportNameLength + 1> &dest,
                                    std::uint8_t &outLength) noexcept;
-        ExportEntry *FindExport(RealmRecord &realm, std::string_view exportName) noexcept;
-        const ExportEntry *FindExport(const RealmRecord &realm, std::string_view exportName) const noexcept;
+        StatusCode StoreExport(Handle handle,
+                               std::string_view exportName,
+                               StringModule::Atom atom,
+                               const Value &value) noexcept;
+        StatusCode LoadExport(Handle targetRealm,
+                              Handle sourceRealm,
+                              std::string_view exportName,
+                              StringModule::Atom atom,
+                              Value &outValue) noexcept;
+        ExportEntry *FindExport(RealmRecord &realm, std::string_view exportName, StringModule::Atom atom) noexcept;
+        void ClearExport(ExportEntry &entry) noexcept;
     };
 }
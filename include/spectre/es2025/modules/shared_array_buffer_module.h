@@ -1,6 +1,10 @@
 #pragma once
 
+#include <atomic>
 #include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -25,11 +29,68 @@ namespace spectre::es2025 {
             std::uint64_t bytesPooled;
             std::uint64_t lastFrameTouched;
             std::uint64_t hotBuffers;
+            std::uint64_t imports;
+            std::uint64_t exports;
+            std::uint64_t channelsCreated;
+            std::uint64_t messagesSent;
+            std::uint64_t messagesReceived;
+            std::uint64_t sendBackpressure;
+            std::uint64_t channelWaits;
             bool gpuOptimized;
 
             Metrics() noexcept;
         };
 
+        // The bytes behind one or more SharedArrayBuffers, possibly owned by several runtimes on
+        // different threads. The memory never moves: a growable block reserves maxByteLength of
+        // address space up front and commits pages as it grows, so pointers and atomic lanes stay
+        // valid for the block's whole life. Lifetime is reference counted through MemoryRef; the
+        // last reference, in whichever runtime or thread, frees it.
+        class SharedMemory {
+        public:
+            ~SharedMemory();
+            SharedMemory(const SharedMemory &) = delete;
+            SharedMemory &operator=(const SharedMemory &) = delete;
+
+            // Returns null when the reservation or initial commit fails.
+            static std::shared_ptr<SharedMemory> Allocate(std::size_t byteLength, std::size_t maxByteLength);
+
+            std::uint8_t *Data() const noexcept;
+            // Acquire load: bytes below the returned length are committed and zero-initialized.
+            std::size_t ByteLength() const noexcept;
+            std::size_t MaxByteLength() const noexcept;
+            std::size_t CommittedBytes() const noexcept;
+            bool Resizable() const noexcept;
+
+            // Thread-safe. Lengths only grow (a shared buffer cannot shrink under other readers);
+            // growing to the current length is a no-op.
+            StatusCode Grow(std::size_t newByteLength) noexcept;
+
+        private:
+            SharedMemory() noexcept;
+
+            std::uint8_t *m_Data;
+            std::size_t m_Reserved;
+            std::size_t m_MaxByteLength;
+            std::atomic<std::size_t> m_ByteLength;
+            std::atomic<std::size_t> m_Committed;
+            std::mutex m_GrowMutex;
+            bool m_Mapped;
+            bool m_Resizable;
+        };
+
+        using MemoryRef = std::shared_ptr<SharedMemory>;
+
+        // One message taken off a channel. sequence is its gap-free position in the channel;
+        // epoch is the sending runtime's frame when it was sent.
+        struct ChannelMessage {
+            std::uint64_t sequence;
+            std::uint64_t epoch;
+            std::vector<std::uint8_t> bytes;
+
+            ChannelMessage() noexcept;
+        };
+
         SharedArrayBufferModule();
 
         std::string_view Name() const noexcept override;
@@ -46,6 +107,10 @@ namespace spectre::es2025 {
 
         void Reconfigure(const RuntimeConfig &config) override;
 
+        void CollectMemory(ModuleMemoryUsage &usage) const noexcept override;
+
+        void SampleMemory(ModuleMemoryCounters &counters) const noexcept override;
+
         StatusCode Create(std::string_view label, std::size_t byteLength, Handle &outHandle);
 
         StatusCode CreateResizable(std::string_view label,
@@ -61,8 +126,15 @@ namespace spectre::es2025 {
                          std::string_view label,
                          Handle &outHandle);
 
+        // Memory never moves, so data is always preserved; preserveData is kept for API parity
+        // with ArrayBufferModule::Resize. Shrinking fails with InvalidArgument.
         StatusCode Grow(Handle handle, std::size_t newByteLength, bool preserveData = true);
 
+        // Cross-runtime handoff without copying: Export returns a reference any thread may carry,
+        // Import wraps one in a new handle of this module. Both runtimes then see the same bytes.
+        StatusCode Export(Handle handle, MemoryRef &outMemory);
+        StatusCode Import(MemoryRef memory, std::string_view label, Handle &outHandle);
+
         StatusCode Destroy(Handle handle);
 
         StatusCode CopyIn(Handle handle,
@@ -77,6 +149,55 @@ namespace spectre::es2025 {
 
         StatusCode Snapshot(Handle handle, std::vector<std::uint8_t> &outBytes) const;
 
+        // Sequentially consistent atomics on a naturally aligned lane, well-defined against any
+        // other thread or runtime touching the same memory. T is std::int32_t or std::int64_t.
+        // CopyIn/CopyOut are plain copies and need these (or Atomics) to publish their bytes.
+        template<typename T>
+        StatusCode AtomicLoad(Handle handle, std::size_t byteOffset, T &outValue) const noexcept;
+
+        template<typename T>
+        StatusCode AtomicStore(Handle handle, std::size_t byteOffset, T value) noexcept;
+
+        template<typename T>
+        StatusCode AtomicAdd(Handle handle, std::size_t byteOffset, T value, T &outPrevious) noexcept;
+
+        template<typename T>
+        StatusCode AtomicCompareExchange(Handle handle,
+                                         std::size_t byteOffset,
+                                         T expected,
+                                         T desired,
+                                         T &outPrevious) noexcept;
+
+        // Bounded multi-producer/multi-consumer ring of fixed-size slots laid out inside a shared
+        // buffer, so Export/Import carries it to other runtimes. Each slot carries a sequence stamp
+        // that marks it free or full; a batch claims a run of slots with one compare-exchange.
+        // capacity is rounded up to a power of two. Neither call blocks: ChannelSend stops when the
+        // ring is full (outSent < messages.size() is the backpressure signal) and ChannelReceive
+        // returns what is queued, up to maxMessages. Messages longer than slotBytes are rejected.
+        StatusCode CreateChannel(std::string_view label,
+                                 std::uint32_t slotBytes,
+                                 std::uint32_t capacity,
+                                 Handle &outHandle);
+
+        StatusCode ChannelSend(Handle handle,
+                               std::span<const std::span<const std::uint8_t>> messages,
+                               std::size_t &outSent);
+
+        // Resizes outMessages to the number received, reusing the byte vectors already in it.
+        StatusCode ChannelReceive(Handle handle, std::vector<ChannelMessage> &outMessages, std::size_t maxMessages);
+
+        // Blocking forms. They park on a 32-bit signal word in the channel's own cursor lines (a
+        // futex where the platform has one), so waiters in any runtime sharing the channel wake
+        // when the other side moves. ChannelReceiveWait returns once at least one message (up to
+        // maxMessages) is taken; ChannelSendWait returns once every message is in the ring.
+        StatusCode ChannelReceiveWait(Handle handle, std::vector<ChannelMessage> &outMessages,
+                                      std::size_t maxMessages);
+
+        StatusCode ChannelSendWait(Handle handle, std::span<const std::span<const std::uint8_t>> messages);
+
+        // Messages sent but not yet received; a snapshot when other threads are active.
+        std::size_t ChannelPending(Handle handle) const noexcept;
+
         bool Has(Handle handle) const noexcept;
 
         std::size_t ByteLength(Handle handle) const noexcept;
@@ -92,14 +213,14 @@ namespace spectre::es2025 {
         bool GpuEnabled() const noexcept;
 
     private:
+        // This module's view of a SharedMemory block: the handles here that share it, plus the
+        // byte count this module has accounted for it.
         struct Storage {
-            std::vector<std::uint8_t> data;
-            std::size_t byteLength;
-            std::size_t maxByteLength;
+            MemoryRef memory;
+            std::size_t accountedBytes;
             std::uint32_t refCount;
             std::uint64_t version;
             std::uint64_t lastTouchFrame;
-            bool resizable;
             bool hot;
 
             Storage() noexcept;
@@ -144,6 +265,8 @@ namespace spectre::es2025 {
         std::vector<std::uint32_t> m_FreeSlots;
         std::vector<StorageSlot> m_Storages;
         std::vector<std::uint32_t> m_FreeStorages;
+        memory::Counter m_Memory;
+        std::uint64_t m_SlotTableBytes;
         Metrics m_Metrics;
 
         BufferRecord *FindMutable(Handle handle) noexcept;
@@ -154,6 +277,14 @@ namespace spectre::es2025 {
 
         const Storage *ResolveStorage(const BufferRecord &record) const noexcept;
 
+        StatusCode Adopt(MemoryRef memory, std::string_view label, std::string_view prefix, Handle &outHandle);
+
+        template<typename T>
+        T *ResolveLane(Handle handle, std::size_t byteOffset) const noexcept;
+
+        // Base of the channel ring behind handle, or null when it is not a channel.
+        std::uint8_t *ResolveChannel(Handle handle) const noexcept;
+
         static std::uint32_t DecodeSlot(Handle handle) noexcept;
 
         static std::uint32_t DecodeGeneration(Handle handle) noexcept;
@@ -171,5 +302,6 @@ namespace spectre::es2025 {
         std::uint32_t AcquireStorageSlot();
 
         void ReleaseStorageSlot(std::uint32_t storageIndex);
+        void TrackSlots() noexcept;
     };
 }
\ No newline at end of file
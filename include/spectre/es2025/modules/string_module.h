@@ -1,7 +1,11 @@
 #pragma once
 
+#include <array>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <memory>
+#include <span>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -14,6 +18,15 @@ namespace spectre::es2025 {
     class StringModule final : public Module {
     public:
         using Handle = std::uint64_t;
+        // Dense id for an interned string. Atoms are shared by every module that keys data by
+        // name, so equal keys compare as integers and their text is stored once. InternAtom makes
+        // an atom permanent; AcquireAtom/RetainAtom take counted references, and an atom whose
+        // last reference is dropped with ReleaseAtom is collected and its id reused.
+        using Atom = std::uint32_t;
+        static constexpr Atom kInvalidAtom = 0xffffffffu;
+        // Strings up to this length live inside their slot and never touch the text arena.
+        static constexpr std::size_t kInlineBytes = 15;
+        static constexpr std::size_t kNotFound = static_cast<std::size_t>(-1);
 
         struct Metrics {
             std::uint64_t internHits;
@@ -27,12 +40,49 @@ namespace spectre::es2025 {
             std::uint64_t hotStrings;
             std::uint64_t activeStrings;
             std::uint64_t bytesInUse;
+            // Bytes held by live arena blocks (including their slack).
             std::uint64_t bytesReserved;
+            std::uint64_t arenaPages;
+            std::uint64_t arenaBytes;
+            // Share of page bytes not held by a live block, in [0, 1].
+            double arenaFragmentation;
+            std::uint64_t compactionMoves;
+            std::uint64_t compactedBytes;
+            std::uint64_t pagesReleased;
+            std::uint64_t atoms;
+            std::uint64_t inlineStrings;
+            std::uint64_t ropeConcats;
+            std::uint64_t flattens;
             bool gpuOptimized;
 
             Metrics() noexcept;
         };
 
+        // A view whose text stays put. While a PinnedView is alive its string is fixed: the text
+        // is kept out of the slot table and skipped by compaction, mutations fail with
+        // InvalidArgument, and so does releasing the last reference. Releasing (or destroying)
+        // the PinnedView unpins it. A PinnedView must not outlive the module.
+        class PinnedView {
+        public:
+            PinnedView() noexcept;
+            PinnedView(PinnedView &&other) noexcept;
+            PinnedView &operator=(PinnedView &&other) noexcept;
+            PinnedView(const PinnedView &) = delete;
+            PinnedView &operator=(const PinnedView &) = delete;
+            ~PinnedView();
+
+            bool Active() const noexcept;
+            std::string_view Text() const noexcept;
+            void Release() noexcept;
+
+        private:
+            friend class StringModule;
+
+            StringModule *m_Module;
+            Handle m_Handle;
+            std::string_view m_Text;
+        };
+
         StringModule();
 
         std::string_view Name() const noexcept override;
@@ -49,6 +99,10 @@ namespace spectre::es2025 {
 
         void Reconfigure(const RuntimeConfig &config) override;
 
+        void CollectMemory(ModuleMemoryUsage &usage) const noexcept override;
+
+        void SampleMemory(ModuleMemoryCounters &counters) const noexcept override;
+
         StatusCode Create(std::string_view label, std::string_view value, Handle &outHandle);
 
         StatusCode Clone(Handle handle, std::string_view label, Handle &outHandle);
@@ -57,6 +111,24 @@ namespace spectre::es2025 {
 
         StatusCode Release(Handle handle);
 
+        StatusCode InternAtom(std::string_view value, Atom &outAtom);
+
+        StatusCode AcquireAtom(std::string_view value, Atom &outAtom);
+
+        void RetainAtom(Atom atom) noexcept;
+
+        void ReleaseAtom(Atom atom);
+
+        bool IsAtom(Atom atom) const noexcept;
+
+        Atom FindAtom(std::string_view value) const noexcept;
+
+        // Atom text is never inlined or relocated, so the view stays valid until the atom is
+        // collected; permanent atoms' views live as long as the module.
+        std::string_view AtomView(Atom atom) const noexcept;
+
+        std::size_t AtomCount() const noexcept;
+
         StatusCode Concat(Handle left, Handle right, std::string_view label, Handle &outHandle);
 
         StatusCode Slice(Handle handle, std::size_t begin, std::size_t length, std::string_view label,
@@ -70,31 +142,73 @@ namespace spectre::es2025 {
 
         StatusCode TrimAscii(Handle handle) noexcept;
 
+        // Byte offset of the first needle at or after from, or kNotFound.
+        StatusCode IndexOf(Handle handle, std::string_view needle, std::size_t from, std::size_t &outIndex) noexcept;
+
+        // Non-overlapping occurrences of a non-empty needle.
+        StatusCode Count(Handle handle, std::string_view needle, std::size_t &outCount) noexcept;
+
+        // Creates one string per field; an empty separator splits into single bytes. On failure no
+        // handles are left behind.
+        StatusCode Split(Handle handle, std::string_view separator, std::string_view label,
+                         std::vector<Handle> &outHandles);
+
+        // outMatches[i] reports whether handles[i] starts (ends) with the affix. Unknown handles
+        // report false and make the call return NotFound after the batch completes. Ropes are
+        // compared leaf by leaf, so these never flatten or allocate.
+        StatusCode StartsWith(std::span<const Handle> handles, std::string_view prefix,
+                              std::span<bool> outMatches) const noexcept;
+
+        StatusCode EndsWith(std::span<const Handle> handles, std::string_view suffix,
+                            std::span<bool> outMatches) const noexcept;
+
         bool Has(Handle handle) const noexcept;
 
-        std::string_view View(Handle handle) const noexcept;
+        // A plain view is only valid until the next call that creates, mutates or releases a
+        // string: short text lives in the slot table, which moves when it grows, and Tick may
+        // relocate arena text while compacting. Use PinView for a view that must outlive that.
+        // View, Hash, IndexOf and Count flatten a rope first, so they are not const.
+        std::string_view View(Handle handle) noexcept;
+
+        // Fixes the string's text in place and points outView at it, releasing whatever outView
+        // held before.
+        StatusCode PinView(Handle handle, PinnedView &outView);
 
-        std::uint64_t Hash(Handle handle) const noexcept;
+        std::uint32_t PinCount(Handle handle) const noexcept;
+
+        std::uint64_t Hash(Handle handle) noexcept;
 
         const Metrics &GetMetrics() const noexcept;
 
         bool GpuEnabled() const noexcept;
 
     private:
+        // An entry is inline (text in inlineText), flat (an arena block it owns exclusively) or a
+        // rope (ropeRoot names a shared, immutable node tree that is flattened on first read).
+        // A hash of zero means "not computed yet".
         struct Entry {
             Handle handle;
             std::uint32_t slot;
             std::uint32_t generation;
+            std::uint32_t page;
             std::uint32_t offset;
             std::uint32_t length;
             std::uint32_t capacity;
+            std::uint32_t ropeRoot;
+            bool rope;
+            bool inlined;
+            std::array<char, kInlineBytes> inlineText;
             std::uint64_t hash;
             std::uint32_t refCount;
+            Atom atom;
             std::string label;
             std::uint64_t version;
             std::uint64_t lastTouchFrame;
             bool hot;
+            // Interned: immutable, never inlined and never relocated.
             bool pinned;
+            // Outstanding PinnedViews; while non-zero the entry is fixed like an interned one.
+            std::uint32_t viewPins;
         };
 
         struct Slot {
@@ -111,9 +225,39 @@ namespace spectre::es2025 {
             InternState state;
         };
 
-        struct FreeBlock {
+        // Text lives in fixed-size pages carved into blocks of a single size class, so freeing
+        // never fragments a page across classes and growing never moves existing text. Strings
+        // larger than the biggest class get a dedicated page that is released on free.
+        static constexpr std::size_t kSizeClassCount = 9;
+        static constexpr std::uint8_t kDedicatedClass = 0xff;
+
+        struct TextPage {
+            std::unique_ptr<char[]> data;
+            std::uint32_t bytes;
+            std::uint32_t blockSize;
+            std::uint32_t liveBlocks;
+            // Blocks of pinned or view-pinned entries; compaction leaves such pages alone.
+            std::uint32_t fixedBlocks;
+            std::uint8_t sizeClass;
+        };
+
+        struct TextBlock {
+            std::uint32_t page;
+            std::uint32_t offset;
+        };
+
+        // Leaves own an arena block; concat nodes reference two children. Nodes are refcounted
+        // by the entries and parents that point at them and never change once built.
+        struct RopeNode {
+            std::uint32_t left;
+            std::uint32_t right;
+            std::uint32_t page;
             std::uint32_t offset;
             std::uint32_t length;
+            std::uint32_t capacity;
+            std::uint32_t refs;
+            std::uint16_t depth;
+            bool leaf;
         };
 
         SpectreRuntime *m_Runtime;
@@ -124,11 +268,24 @@ namespace spectre::es2025 {
         std::uint64_t m_CurrentFrame;
         std::vector<Slot> m_Slots;
         std::vector<std::uint32_t> m_FreeSlots;
-        std::vector<char> m_TextStorage;
+        std::vector<TextPage> m_Pages;
+        std::vector<std::uint32_t> m_FreePages;
+        std::array<std::vector<TextBlock>, kSizeClassCount> m_FreeBlocks;
+        // Page being evacuated by the compactor, plus where its owner scan resumes next Tick.
+        std::uint32_t m_CompactPage;
+        std::size_t m_CompactSlotCursor;
+        std::size_t m_CompactNodeCursor;
         std::vector<InternSlot> m_InternTable;
         std::size_t m_InternCount;
-        std::vector<FreeBlock> m_FreeBlocks;
+        std::size_t m_InternTombstones;
+        std::vector<std::uint32_t> m_AtomSlots;
+        std::vector<std::uint32_t> m_AtomRefs;
+        std::vector<Atom> m_FreeAtoms;
+        std::vector<RopeNode> m_RopeNodes;
+        std::vector<std::uint32_t> m_FreeRopeNodes;
         Metrics m_Metrics;
+        memory::Counter m_Memory;
+        std::uint64_t m_TableBytes;
 
         Entry *FindMutable(Handle handle) noexcept;
 
@@ -142,8 +299,6 @@ namespace spectre::es2025 {
 
         static std::uint32_t AlignSize(std::size_t size) noexcept;
 
-        static bool IsAsciiWhitespace(unsigned char c) noexcept;
-
         static std::size_t NextPowerOfTwo(std::size_t value) noexcept;
 
         void Touch(Entry &entry) noexcept;
@@ -152,16 +307,70 @@ namespace spectre::es2025 {
 
         void RecomputeHotMetrics() noexcept;
 
-        void EnsureTextCapacity(std::size_t requiredAdditionalBytes);
+        static std::uint8_t SizeClassFor(std::size_t length) noexcept;
+
+        std::uint32_t AcquirePage(std::uint32_t bytes, std::uint32_t blockSize, std::uint8_t sizeClass);
 
-        bool AllocateText(std::size_t length, std::uint32_t &offset, std::uint32_t &capacity);
+        void ReleasePage(std::uint32_t page) noexcept;
 
-        void FreeText(std::uint32_t offset, std::uint32_t capacity);
+        bool AllocateText(std::size_t length, std::uint32_t &page, std::uint32_t &offset, std::uint32_t &capacity);
 
-        void WriteText(std::uint32_t offset, std::string_view value) noexcept;
+        void FreeText(std::uint32_t page, std::uint32_t offset, std::uint32_t capacity) noexcept;
+
+        char *TextAt(std::uint32_t page, std::uint32_t offset) const noexcept;
+
+        void WriteText(std::uint32_t page, std::uint32_t offset, std::string_view value) noexcept;
+
+        void UpdateArenaMetrics() noexcept;
+
+        bool BeginCompaction() noexcept;
+
+        static bool IsFixed(const Entry &entry) noexcept;
+
+        void FixText(Entry &entry);
+
+        void UnfixText(const Entry &entry) noexcept;
+
+        void Unpin(Handle handle) noexcept;
+
+        bool RelocateBlock(std::uint32_t &page, std::uint32_t &offset, std::uint32_t capacity) noexcept;
+
+        void CompactText(std::chrono::steady_clock::time_point deadline) noexcept;
 
         std::string_view ViewInternal(const Entry &entry) const noexcept;
 
+        std::string_view FlatView(Entry &entry) noexcept;
+
+        bool MatchesAffix(const Entry &entry, std::string_view affix, bool suffix) const noexcept;
+
+        char *MutableText(Entry &entry) noexcept;
+
+        std::uint64_t EntryHash(Entry &entry) noexcept;
+
+        bool Flatten(Entry &entry) noexcept;
+
+        bool MakeUnique(Entry &entry) noexcept;
+
+        void ReleaseText(Entry &entry) noexcept;
+
+        void ReserveText(std::uint64_t capacity) noexcept;
+
+        void UnreserveText(std::uint64_t capacity) noexcept;
+
+        void TrackTables() noexcept;
+
+        std::uint32_t AcquireNode();
+
+        std::uint32_t NewLeaf(std::string_view text);
+
+        std::uint32_t NewConcat(std::uint32_t left, std::uint32_t right);
+
+        std::uint32_t NodeFor(Entry &entry);
+
+        void ReleaseNode(std::uint32_t index) noexcept;
+
+        StatusCode CreateRope(std::string_view label, std::uint32_t root, Handle &outHandle);
+
         std::uint64_t HashValue(std::string_view value) const noexcept;
 
         StatusCode CreateInternal(std::string_view label, std::string_view value, bool pinned, std::uint64_t hash,
@@ -174,5 +383,7 @@ namespace spectre::es2025 {
         void InsertIntern(std::uint32_t slotIndex, std::uint64_t hash);
 
         void EraseIntern(std::uint32_t slotIndex, std::uint64_t hash);
+
+        StatusCode MakeAtom(std::string_view value, bool permanent, Atom &outAtom);
     };
 }
\ No newline at end of file
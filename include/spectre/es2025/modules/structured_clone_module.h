@@ -116,6 +116,10 @@ namespace spectre::es2025 {
 
         void Reconfigure(const RuntimeConfig &config) override;
 
+        void CollectMemory(ModuleMemoryUsage &usage) const noexcept override;
+
+        void SampleMemory(ModuleMemoryCounters &counters) const noexcept override;
+
         StatusCode Clone(const Node &input, Node &outClone, const CloneOptions &options = {});
 
         StatusCode CloneValue(const Value &input, Value &outValue);
@@ -169,6 +173,7 @@ namespace spectre::es2025 {
         mutable std::vector<std::uint8_t> m_ByteScratch;
         mutable std::vector<Node *> m_NodeStack;
         mutable std::vector<std::uint8_t> m_Serialized;
+        mutable memory::Gauge m_Memory;
 
         StatusCode CloneNode(const Node &input, Node &outClone, CloneContext &context);
 
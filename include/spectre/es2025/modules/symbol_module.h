@@ -63,6 +63,10 @@ namespace spectre::es2025 {
         void OptimizeGpu(const ModuleGpuContext &context) noexcept override;
         void Reconfigure(const RuntimeConfig &config) override;
 
+        void CollectMemory(ModuleMemoryUsage &usage) const noexcept override;
+
+        void SampleMemory(ModuleMemoryCounters &counters) const noexcept override;
+
         StatusCode Create(std::string_view description, Handle &outHandle);
         StatusCode CreateUnique(Handle &outHandle);
         StatusCode CreateGlobal(std::string_view key, Handle &outHandle);
@@ -106,6 +110,7 @@ namespace spectre::es2025 {
         std::vector<Slot> m_Slots;
         std::vector<std::uint32_t> m_FreeSlots;
         std::vector<std::uint32_t> m_GlobalBuckets;
+        mutable memory::Gauge m_Memory;
         std::array<Handle, static_cast<std::size_t>(WellKnown::Count)> m_WellKnown;
         mutable Metrics m_Metrics;
         std::uint64_t m_GlobalCount;
@@ -102,6 +102,10 @@ namespace spectre::es2025 {
         void OptimizeGpu(const ModuleGpuContext &context) noexcept override;
         void Reconfigure(const RuntimeConfig &config) override;
 
+        void CollectMemory(ModuleMemoryUsage &usage) const noexcept override;
+
+        void SampleMemory(ModuleMemoryCounters &counters) const noexcept override;
+
         StatusCode CreateInstant(std::string_view label,
                                  std::int64_t epochNanoseconds,
                                  Handle &outHandle,
@@ -187,6 +191,7 @@ namespace spectre::es2025 {
         double m_TotalSeconds;
         std::vector<Slot> m_Slots;
         std::vector<std::uint32_t> m_FreeSlots;
+        mutable memory::Gauge m_Memory;
         Metrics m_Metrics;
         Handle m_CanonicalInstant;
 
@@ -1,8 +1,10 @@
 #pragma once
 
 #include <cstdint>
+#include <span>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <vector>
 
 #include "spectre/config.h"
@@ -29,6 +31,23 @@ namespace spectre::es2025 {
             BigUint64
         };
 
+        // In-place element transforms applied by Map; Abs and Negate ignore the operand. Results
+        // are converted back to the element type with the same rules as Set.
+        enum class MapOp : std::uint8_t {
+            Add,
+            Multiply,
+            Min,
+            Max,
+            Abs,
+            Negate
+        };
+
+        enum class ReduceOp : std::uint8_t {
+            Sum,
+            Min,
+            Max
+        };
+
         struct Metrics {
             std::uint64_t createdViews;
             std::uint64_t destroyedViews;
@@ -40,6 +59,8 @@ namespace spectre::es2025 {
             std::uint64_t copyOps;
             std::uint64_t subarrayOps;
             std::uint64_t clampOps;
+            std::uint64_t mapOps;
+            std::uint64_t reduceOps;
             std::uint64_t activeViews;
             std::uint64_t hotViews;
             std::uint64_t lastFrameTouched;
@@ -67,6 +88,9 @@ namespace spectre::es2025 {
         void Tick(const TickInfo &info, const ModuleTickContext &context) noexcept override;
         void OptimizeGpu(const ModuleGpuContext &context) noexcept override;
         void Reconfigure(const RuntimeConfig &config) override;
+        void CollectMemory(ModuleMemoryUsage &usage) const noexcept override;
+
+        void SampleMemory(ModuleMemoryCounters &counters) const noexcept override;
 
         StatusCode Create(ElementType type, std::size_t length, std::string_view label, Handle &outHandle);
         StatusCode FromBuffer(ArrayBufferModule::Handle buffer,
@@ -98,6 +122,40 @@ namespace spectre::es2025 {
         StatusCode ToVector(Handle handle, std::vector<double> &outValues) const;
         StatusCode ToBigIntVector(Handle handle, std::vector<std::int64_t> &outValues) const;
 
+        // Bulk numeric operations. Each resolves the element type once and runs a typed loop;
+        // Float32/Float64 conversions and reductions go through the simd kernels, so sums and dot
+        // products may differ from left-to-right accumulation in the last bits.
+        StatusCode SetFromSpan(Handle handle, std::span<const double> values, std::size_t offset = 0) noexcept;
+        // %TypedArray%.prototype.set(typedArray, offset): copies source into target starting at
+        // offset, converting between element types. Number and BigInt views do not mix.
+        StatusCode SetFrom(Handle target, Handle source, std::size_t offset = 0);
+        StatusCode Map(Handle handle, MapOp op, double operand = 0.0) noexcept;
+        // Sum of an empty view is 0, Min/Max are +/-infinity; any NaN element makes Min/Max NaN.
+        StatusCode Reduce(Handle handle, ReduceOp op, double &outValue) const noexcept;
+        // Both views must share a numeric element type and length.
+        StatusCode Dot(Handle left, Handle right, double &outValue) const noexcept;
+
+        // Zero-copy access to the view's bytes. The backing buffer stays pinned against detach,
+        // resize and destroy until the borrow is released (see ArrayBufferModule::Borrow).
+        StatusCode BorrowBytes(Handle handle, ArrayBufferModule::Borrow &outBorrow) noexcept;
+
+        // Typed borrow. T must be the element type's storage type (std::uint8_t for Uint8 and
+        // Uint8Clamped, float for Float32, std::int64_t for BigInt64, ...), optionally const. A view
+        // over a read-only buffer only hands out const elements.
+        template<typename T>
+        StatusCode BorrowElements(Handle handle, ArrayBufferModule::Borrow &outBorrow,
+                                  std::span<T> &outElements) noexcept {
+            using Storage = std::remove_const_t<T>;
+            static_assert(std::is_arithmetic_v<Storage>, "BorrowElements needs an arithmetic element type");
+            outElements = {};
+            auto status = BorrowMatching(handle, sizeof(Storage), std::is_floating_point_v<Storage>,
+                                         std::is_signed_v<Storage>, !std::is_const_v<T>, outBorrow);
+            if (status == StatusCode::Ok) {
+                outElements = outBorrow.As<T>();
+            }
+            return status;
+        }
+
         const Metrics &GetMetrics() const noexcept;
         bool GpuEnabled() const noexcept;
 
@@ -162,6 +220,8 @@ namespace spectre::es2025 {
         mutable Metrics m_Metrics;
         std::vector<SlotRecord> m_Slots;
         std::vector<std::uint32_t> m_FreeSlots;
+        memory::Counter m_Memory;
+        std::uint64_t m_SlotTableBytes;
 
         static ElementTraits Traits(ElementType type) noexcept;
         static Handle EncodeHandle(std::uint32_t slot, std::uint32_t generation) noexcept;
@@ -173,6 +233,7 @@ namespace spectre::es2025 {
 
         std::uint32_t AcquireSlot();
         void ReleaseSlot(std::uint32_t slotIndex);
+        void TrackSlots() noexcept;
         void Reset();
         void Touch(ViewRecord &record) noexcept;
         void RecomputeHotMetrics() noexcept;
@@ -181,6 +242,8 @@ namespace spectre::es2025 {
         const std::uint8_t *ResolvePointer(const ViewRecord &record) const noexcept;
         bool ValidateBounds(const ViewRecord &record, std::size_t index) const noexcept;
         bool CheckBigInt(ElementType type) const noexcept;
+        StatusCode BorrowMatching(Handle handle, std::size_t storageSize, bool isFloat, bool isSigned,
+                                  bool writable, ArrayBufferModule::Borrow &outBorrow) noexcept;
         StatusCode ResolveBuffer(ViewRecord &record, ArrayBufferModule::BufferRecord *&outRecord) noexcept;
         StatusCode ResolveBuffer(const ViewRecord &record, const ArrayBufferModule::BufferRecord *&outRecord) const noexcept;
     };
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace spectre::es2025::simd {
+    // Kernels shared by the modules that scan raw text or crunch numeric element buffers. The
+    // widest instruction set the host supports is picked once at first use; every level returns
+    // results identical to the scalar fallback, except that float reductions may differ from it in
+    // the last bits (see Sum).
+    enum class Level : std::uint8_t {
+        Scalar,
+        Sse2,
+        Avx2,
+        Neon
+    };
+
+    inline constexpr std::size_t kNotFound = std::string_view::npos;
+
+    Level ActiveLevel() noexcept;
+
+    std::string_view LevelName(Level level) noexcept;
+
+    // Rewrite ASCII letters in place and report whether any byte changed. Non-ASCII bytes are
+    // left untouched.
+    bool AsciiToUpper(char *data, std::size_t length) noexcept;
+
+    bool AsciiToLower(char *data, std::size_t length) noexcept;
+
+    // Number of leading / trailing bytes that are ASCII whitespace or control (<= 0x20).
+    std::size_t LeadingAsciiWhitespace(const char *data, std::size_t length) noexcept;
+
+    std::size_t TrailingAsciiWhitespace(const char *data, std::size_t length) noexcept;
+
+    bool Equal(const char *left, const char *right, std::size_t length) noexcept;
+
+    // Offset of the first occurrence of needle at or after from, or kNotFound. An empty needle
+    // matches at from when from is within the haystack.
+    std::size_t Find(std::string_view haystack, std::string_view needle, std::size_t from = 0) noexcept;
+
+    // Non-overlapping occurrences of a non-empty needle.
+    std::size_t Count(std::string_view haystack, std::string_view needle) noexcept;
+
+    inline bool StartsWith(std::string_view text, std::string_view prefix) noexcept {
+        return prefix.size() <= text.size() && Equal(text.data(), prefix.data(), prefix.size());
+    }
+
+    inline bool EndsWith(std::string_view text, std::string_view suffix) noexcept {
+        return suffix.size() <= text.size()
+               && Equal(text.data() + (text.size() - suffix.size()), suffix.data(), suffix.size());
+    }
+
+    // Element-wise conversions between contiguous buffers of count elements.
+    void WidenFloat32(const float *source, double *target, std::size_t count) noexcept;
+
+    void NarrowFloat64(const double *source, float *target, std::size_t count) noexcept;
+
+    // Uint8Clamped conversion: NaN becomes 0, values clamp to [0, 255] and round half to even.
+    void ClampToUint8(const double *source, std::uint8_t *target, std::size_t count) noexcept;
+
+    // Reductions accumulate in double across vector lanes, so a sum can differ from strict
+    // left-to-right summation in the last bits. Min/Max return NaN if any element is NaN and
+    // +/-infinity for an empty range; signed zeros compare equal, so either zero may come back.
+    double Sum(const float *values, std::size_t count) noexcept;
+
+    double Sum(const double *values, std::size_t count) noexcept;
+
+    double Dot(const float *left, const float *right, std::size_t count) noexcept;
+
+    double Dot(const double *left, const double *right, std::size_t count) noexcept;
+
+    double Min(const float *values, std::size_t count) noexcept;
+
+    double Min(const double *values, std::size_t count) noexcept;
+
+    double Max(const float *values, std::size_t count) noexcept;
+
+    double Max(const double *values, std::size_t count) noexcept;
+
+    // Reverse the byte order of count consecutive 2-, 4- or 8-byte elements in place. data needs
+    // no particular alignment.
+    void ByteSwap16(void *data, std::size_t count) noexcept;
+
+    void ByteSwap32(void *data, std::size_t count) noexcept;
+
+    void ByteSwap64(void *data, std::size_t count) noexcept;
+}
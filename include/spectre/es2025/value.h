@@ -1,17 +1,22 @@
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <bit>
 #include <cmath>
 #include <limits>
+#include <new>
 #include <sstream>
 #include <string>
 #include <string_view>
 #include <utility>
 
 namespace spectre::es2025 {
+    // A 16-byte tagged value. Strings of up to kInlineStringBytes live in the payload; longer
+    // strings are immutable refcounted cells shared by every copy, so copying or destroying a
+    // Value never allocates. Views returned by AsString stay valid while any copy is alive.
     struct Value {
         enum class Kind : std::uint8_t {
             Undefined,
@@ -132,16 +137,37 @@ namespace spectre::es2025 {
 
         std::uint64_t Hash() const noexcept;
 
+        std::size_t HeapBytes() const noexcept;
+
         std::string ToString() const;
 
+        static constexpr std::size_t kInlineStringBytes = 8;
+
         Kind kind;
 
     private:
+        // Header of a heap cell; the bytes follow it. Strings store their text, externals whose
+        // info does not fit in m_Aux store the pointer and info pair.
+        struct HeapCell {
+            std::atomic<std::uint32_t> refs;
+            std::size_t length;
+
+            char *Data() noexcept {
+                return reinterpret_cast<char *>(this + 1);
+            }
+
+            const char *Data() const noexcept {
+                return reinterpret_cast<const char *>(this + 1);
+            }
+        };
+
         struct ExternalPayload {
             void *pointer;
             std::uintptr_t info;
         };
 
+        static constexpr std::uint8_t kFlagHeap = 1u << 0;
+
         union Payload {
             bool booleanValue;
             std::int32_t int32Value;
@@ -149,17 +175,29 @@ namespace spectre::es2025 {
             double numberValue;
             std::uint64_t handleValue;
             void *pointerValue;
-            ExternalPayload external;
+            HeapCell *cell;
+            char text[kInlineStringBytes];
             Payload() noexcept {
                 Reset();
             }
             void Reset() noexcept {
                 std::memset(this, 0, sizeof(Payload));
             }
-        } m_Payload;
+        };
 
         std::uint8_t m_Tag;
-        std::string m_String;
+        std::uint8_t m_Flags;
+        std::uint8_t m_Length;
+        std::uint32_t m_Aux;
+        Payload m_Payload;
+
+        bool OwnsCell() const noexcept;
+        void AssignString(std::string_view text);
+        void Release() noexcept;
+        void Steal(Value &other) noexcept;
+        static HeapCell *AllocateCell(const void *data, std::size_t length);
+        static void RetainCell(HeapCell *cell) noexcept;
+        static void ReleaseCell(HeapCell *cell) noexcept;
 
         static std::uint64_t HashBytes(const void *data, std::size_t size) noexcept;
         static std::uint64_t HashString(std::string_view text) noexcept;
@@ -170,29 +208,32 @@ namespace spectre::es2025 {
         static std::uint64_t HashNormalizedDouble(double value) noexcept;
     };
 
+    static_assert(sizeof(Value) == 16, "es2025::Value must stay 16 bytes");
+
     inline Value::Value() noexcept
         : kind(Kind::Undefined),
-          m_Payload(),
           m_Tag(0),
-          m_String() {
+          m_Flags(0),
+          m_Length(0),
+          m_Aux(0),
+          m_Payload() {
     }
 
     inline Value::Value(const Value &other)
         : kind(other.kind),
-          m_Payload(other.m_Payload),
           m_Tag(other.m_Tag),
-          m_String(other.m_String) {
+          m_Flags(other.m_Flags),
+          m_Length(other.m_Length),
+          m_Aux(other.m_Aux),
+          m_Payload(other.m_Payload) {
+        if (OwnsCell()) {
+            RetainCell(m_Payload.cell);
+        }
     }
 
     inline Value::Value(Value &&other) noexcept
-        : kind(other.kind),
-          m_Payload(other.m_Payload),
-          m_Tag(other.m_Tag),
-          m_String(std::move(other.m_String)) {
-        other.kind = Kind::Undefined;
-        other.m_Payload.Reset();
-        other.m_Tag = 0;
-        other.m_String.clear();
+        : Value() {
+        Steal(other);
     }
 
     inline Value::Value(double v) noexcept
@@ -221,35 +262,36 @@ namespace spectre::es2025 {
 
     inline Value::Value(std::string_view v)
         : Value() {
-        kind = Kind::String;
-        m_String.assign(v.begin(), v.end());
+        AssignString(v);
     }
 
     inline Value &Value::operator=(const Value &other) {
         if (this != &other) {
+            if (other.OwnsCell()) {
+                RetainCell(other.m_Payload.cell);
+            }
+            Release();
             kind = other.kind;
-            m_Payload = other.m_Payload;
             m_Tag = other.m_Tag;
-            m_String = other.m_String;
+            m_Flags = other.m_Flags;
+            m_Length = other.m_Length;
+            m_Aux = other.m_Aux;
+            m_Payload = other.m_Payload;
         }
         return *this;
     }
 
     inline Value &Value::operator=(Value &&other) noexcept {
         if (this != &other) {
-            kind = other.kind;
-            m_Payload = other.m_Payload;
-            m_Tag = other.m_Tag;
-            m_String = std::move(other.m_String);
-            other.kind = Kind::Undefined;
-            other.m_Payload.Reset();
-            other.m_Tag = 0;
-            other.m_String.clear();
+            Release();
+            Steal(other);
         }
         return *this;
     }
 
-    inline Value::~Value() = default;
+    inline Value::~Value() {
+        Release();
+    }
 
     inline Value Value::Undefined() noexcept {
         return Value();
@@ -291,8 +333,7 @@ namespace spectre::es2025 {
 
     inline Value Value::String(std::string_view v) {
         Value value;
-        value.kind = Kind::String;
-        value.m_String.assign(v.begin(), v.end());
+        value.AssignString(v);
         return value;
     }
 
@@ -331,9 +372,21 @@ namespace spectre::es2025 {
                                  ExternalKind kindTag) noexcept {
         Value value;
         value.kind = Kind::External;
-        value.m_Payload.external.pointer = pointer;
-        value.m_Payload.external.info = info;
         value.m_Tag = static_cast<std::uint8_t>(kindTag);
+        if (static_cast<std::uint64_t>(info) <= std::numeric_limits<std::uint32_t>::max()) {
+            value.m_Payload.pointerValue = pointer;
+            value.m_Aux = static_cast<std::uint32_t>(info);
+            return value;
+        }
+        // Wide info does not fit beside the pointer; box the pair. Allocation failure degrades
+        // to an external with no info rather than throwing from a noexcept factory.
+        ExternalPayload boxed{pointer, info};
+        try {
+            value.m_Payload.cell = AllocateCell(&boxed, sizeof(boxed));
+            value.m_Flags = kFlagHeap;
+        } catch (...) {
+            value.m_Payload.pointerValue = pointer;
+        }
         return value;
     }
 
@@ -478,7 +531,7 @@ namespace spectre::es2025 {
             case Kind::Int64:
                 return m_Payload.int64Value != 0;
             case Kind::String:
-                return !m_String.empty();
+                return !AsString().empty();
             case Kind::Null:
             case Kind::Undefined:
                 return false;
@@ -512,10 +565,13 @@ namespace spectre::es2025 {
     }
 
     inline std::string_view Value::AsString() const noexcept {
-        if (kind == Kind::String) {
-            return std::string_view(m_String);
+        if (kind != Kind::String) {
+            return std::string_view();
+        }
+        if (m_Flags & kFlagHeap) {
+            return std::string_view(m_Payload.cell->Data(), m_Payload.cell->length);
         }
-        return std::string_view();
+        return std::string_view(m_Payload.text, m_Length);
     }
 
     inline std::uint64_t Value::AsHandle() const noexcept {
@@ -554,32 +610,43 @@ namespace spectre::es2025 {
     }
 
     inline void *Value::AsExternalPointer() const noexcept {
-        if (kind == Kind::External) {
-            return m_Payload.external.pointer;
+        if (kind != Kind::External) {
+            return nullptr;
+        }
+        if (m_Flags & kFlagHeap) {
+            return reinterpret_cast<const ExternalPayload *>(m_Payload.cell->Data())->pointer;
         }
-        return nullptr;
+        return m_Payload.pointerValue;
     }
 
     inline std::uintptr_t Value::ExternalInfo() const noexcept {
-        if (kind == Kind::External) {
-            return m_Payload.external.info;
+        if (kind != Kind::External) {
+            return 0;
         }
-        return 0;
+        if (m_Flags & kFlagHeap) {
+            return reinterpret_cast<const ExternalPayload *>(m_Payload.cell->Data())->info;
+        }
+        return static_cast<std::uintptr_t>(m_Aux);
     }
 
     inline void Value::Reset() noexcept {
+        Release();
         kind = Kind::Undefined;
-        m_Payload.Reset();
         m_Tag = 0;
-        m_String.clear();
+        m_Flags = 0;
+        m_Length = 0;
+        m_Aux = 0;
+        m_Payload.Reset();
     }
 
     inline void Value::Swap(Value &other) noexcept {
         using std::swap;
         swap(kind, other.kind);
-        swap(m_Payload, other.m_Payload);
         swap(m_Tag, other.m_Tag);
-        swap(m_String, other.m_String);
+        swap(m_Flags, other.m_Flags);
+        swap(m_Length, other.m_Length);
+        swap(m_Aux, other.m_Aux);
+        swap(m_Payload, other.m_Payload);
     }
 
     inline bool Value::operator==(const Value &other) const noexcept {
@@ -604,10 +671,14 @@ namespace spectre::es2025 {
                 return m_Payload.handleValue == other.m_Payload.handleValue
                        && m_Tag == other.m_Tag;
             case Kind::String:
-                return m_String == other.m_String;
+                if ((m_Flags & kFlagHeap) && (other.m_Flags & kFlagHeap)
+                    && m_Payload.cell == other.m_Payload.cell) {
+                    return true;
+                }
+                return AsString() == other.AsString();
             case Kind::External:
-                return m_Payload.external.pointer == other.m_Payload.external.pointer
-                       && m_Payload.external.info == other.m_Payload.external.info
+                return AsExternalPointer() == other.AsExternalPointer()
+                       && ExternalInfo() == other.ExternalInfo()
                        && m_Tag == other.m_Tag;
         }
         return false;
@@ -676,7 +747,7 @@ namespace spectre::es2025 {
             case Kind::Number:
                 return HashNormalizedDouble(m_Payload.numberValue);
             case Kind::String:
-                return HashString(m_String);
+                return HashString(AsString());
             case Kind::BigInt:
             case Kind::Symbol:
             case Kind::Handle: {
@@ -686,8 +757,8 @@ namespace spectre::es2025 {
             }
             case Kind::External: {
                 std::uint64_t buffer[3] = {
-                    static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(m_Payload.external.pointer)),
-                    static_cast<std::uint64_t>(m_Payload.external.info),
+                    static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(AsExternalPointer())),
+                    static_cast<std::uint64_t>(ExternalInfo()),
                     static_cast<std::uint64_t>(m_Tag)
                 };
                 return HashBytes(buffer, sizeof(buffer));
@@ -696,6 +767,16 @@ namespace spectre::es2025 {
         return 0;
     }
 
+    inline std::size_t Value::HeapBytes() const noexcept {
+        if (!OwnsCell()) {
+            return 0;
+        }
+        // Shared cells are split evenly between their owners so module totals do not overcount.
+        auto refs = m_Payload.cell->refs.load(std::memory_order_relaxed);
+        auto bytes = sizeof(HeapCell) + m_Payload.cell->length + 1;
+        return refs > 1 ? bytes / refs : bytes;
+    }
+
     inline std::string Value::ToString() const {
         switch (kind) {
             case Kind::Undefined:
@@ -716,7 +797,7 @@ namespace spectre::es2025 {
                 return stream.str();
             }
             case Kind::String:
-                return m_String;
+                return std::string(AsString());
             case Kind::BigInt: {
                 std::ostringstream stream;
                 stream << "bigint(0x" << std::hex << m_Payload.handleValue << ")";
@@ -734,15 +815,75 @@ namespace spectre::es2025 {
                 return stream.str();
             }
             case Kind::External: {
-                auto ptr = reinterpret_cast<std::uintptr_t>(m_Payload.external.pointer);
+                auto ptr = reinterpret_cast<std::uintptr_t>(AsExternalPointer());
                 std::ostringstream stream;
-                stream << "external(0x" << std::hex << ptr << ",0x" << m_Payload.external.info << ")";
+                stream << "external(0x" << std::hex << ptr << ",0x" << ExternalInfo() << ")";
                 return stream.str();
             }
         }
         return {};
     }
 
+    inline bool Value::OwnsCell() const noexcept {
+        return (m_Flags & kFlagHeap) != 0;
+    }
+
+    inline void Value::AssignString(std::string_view text) {
+        Reset();
+        if (text.size() <= kInlineStringBytes) {
+            if (!text.empty()) {
+                std::memcpy(m_Payload.text, text.data(), text.size());
+            }
+            m_Length = static_cast<std::uint8_t>(text.size());
+        } else {
+            m_Payload.cell = AllocateCell(text.data(), text.size());
+            m_Flags = kFlagHeap;
+        }
+        kind = Kind::String;
+    }
+
+    inline void Value::Release() noexcept {
+        if (OwnsCell()) {
+            ReleaseCell(m_Payload.cell);
+            m_Payload.cell = nullptr;
+            m_Flags = 0;
+        }
+    }
+
+    inline void Value::Steal(Value &other) noexcept {
+        kind = other.kind;
+        m_Tag = other.m_Tag;
+        m_Flags = other.m_Flags;
+        m_Length = other.m_Length;
+        m_Aux = other.m_Aux;
+        m_Payload = other.m_Payload;
+        other.kind = Kind::Undefined;
+        other.m_Tag = 0;
+        other.m_Flags = 0;
+        other.m_Length = 0;
+        other.m_Aux = 0;
+        other.m_Payload.Reset();
+    }
+
+    inline Value::HeapCell *Value::AllocateCell(const void *data, std::size_t length) {
+        void *memory = ::operator new(sizeof(HeapCell) + length + 1);
+        auto *cell = new(memory) HeapCell{{1}, length};
+        std::memcpy(cell->Data(), data, length);
+        cell->Data()[length] = '\0';
+        return cell;
+    }
+
+    inline void Value::RetainCell(HeapCell *cell) noexcept {
+        cell->refs.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    inline void Value::ReleaseCell(HeapCell *cell) noexcept {
+        if (cell->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            cell->~HeapCell();
+            ::operator delete(cell);
+        }
+    }
+
     inline std::uint64_t Value::HashBytes(const void *data, std::size_t size) noexcept {
         constexpr std::uint64_t kOffset = 1469598103934665603ull;
         constexpr std::uint64_t kPrime = 1099511628211ull;
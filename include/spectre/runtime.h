@@ -42,6 +42,43 @@ namespace spectre {
         std::string diagnostics;
     };
 
+    struct ModuleMemoryReport {
+        std::string name;
+        std::uint64_t liveBytes;
+        // Running total of bytes the module has allocated, never reduced by frees.
+        std::uint64_t allocatedBytes;
+        std::uint64_t peakLiveBytes;
+        std::uint64_t reservedBytes;
+        std::uint64_t freeListBytes;
+        std::uint64_t slotCount;
+        std::uint64_t freeSlotCount;
+        double allocationRate;
+        double slotFragmentation;
+        double arenaFragmentation;
+        // False for a module that does not account its storage; its byte fields are not measured, not zero.
+        bool measured;
+    };
+
+    struct ContextMemoryReport {
+        std::string name;
+        std::uint64_t scriptBytes;
+        std::uint64_t programBytes;
+        std::uint64_t liveBytes;
+        std::uint64_t allocatedBytes;
+        std::uint64_t peakLiveBytes;
+        double allocationRate;
+    };
+
+    struct RuntimeMemoryReport {
+        std::uint64_t frameIndex;
+        std::uint64_t liveBytes;
+        std::uint64_t peakLiveBytes;
+        std::uint64_t reservedBytes;
+        std::uint64_t heapBudgetBytes;
+        std::vector<ModuleMemoryReport> modules;
+        std::vector<ContextMemoryReport> contexts;
+    };
+
     class SpectreContext;
 
     class SpectreRuntime {
@@ -74,6 +111,14 @@ namespace spectre {
 
         TickInfo LastTick() const;
 
+        // Walks every module record and context, so its cost grows with live objects; per-tick
+        // telemetry reads running counters instead and stays cheap.
+        RuntimeMemoryReport MemoryReport() const;
+
+        StatusCode CollectExecutionProfile(detail::ExecutionProfile &outProfile, std::size_t maxPrograms) const;
+
+        StatusCode ExportTrace(std::string &outJson) const;
+
         StatusCode GetContext(const std::string &name, const SpectreContext **outContext) const;
 
         es2025::Environment &EsEnvironment();
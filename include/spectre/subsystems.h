@@ -2,11 +2,14 @@
 
 #include <cstdint>
 #include <memory>
+#include <span>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "spectre/config.h"
 #include "spectre/status.h"
+#include "spectre/trace.h"
 
 namespace spectre::detail {
     enum class TokenKind : std::uint8_t {
@@ -71,6 +74,31 @@ namespace spectre::detail {
         std::string diagnostics;
     };
 
+    struct OpcodeProfile {
+        std::string_view name;
+        std::uint64_t count;
+        std::uint64_t cycles;
+    };
+
+    // version is the stamp the bytecode pipeline gave the program when lowering it; together with
+    // name it identifies the program, so same-named programs are profiled apart.
+    struct ProgramProfile {
+        std::string name;
+        std::uint64_t version;
+        std::uint64_t calls;
+        std::uint64_t instructions;
+        std::uint64_t cycles;
+    };
+
+    // Cumulative interpreter counters since the last reset. Cycles are timestamp-counter ticks;
+    // hotPrograms is ranked by cycles and is the input for tier-up decisions.
+    struct ExecutionProfile {
+        std::uint64_t executions;
+        std::uint64_t instructions;
+        std::vector<OpcodeProfile> opcodes;
+        std::vector<ProgramProfile> hotPrograms;
+    };
+
     struct GcSnapshot {
         std::uint64_t generation;
         std::uint64_t reclaimedBytes;
@@ -81,12 +109,25 @@ namespace spectre::detail {
         std::uint64_t arenaWaste;
     };
 
+    using TelemetryChannel = std::uint32_t;
+
+    inline constexpr TelemetryChannel kInvalidTelemetryChannel = 0xffffffffu;
+
     struct TelemetrySample {
-        std::string channel;
+        TelemetryChannel channel;
         double value;
         std::uint64_t frameIndex;
     };
 
+    struct TelemetryStats {
+        std::uint64_t capacity;
+        std::uint64_t pushed;
+        std::uint64_t drained;
+        std::uint64_t dropped;
+        std::uint64_t overruns;
+        std::uint64_t channels;
+    };
+
     struct SchedulerFramePlan {
         std::uint64_t frameIndex;
         double cpuBudget;
@@ -112,11 +153,23 @@ namespace spectre::detail {
         virtual StatusCode LowerModule(const ModuleArtifact &artifact, ExecutableProgram &outProgram) = 0;
     };
 
+    class TelemetryHub;
+
     class ExecutionEngine {
     public:
         virtual ~ExecutionEngine() = default;
 
         virtual ExecutionResponse Execute(const ExecutionRequest &request) = 0;
+
+        virtual void SetProfiling(bool enabled) noexcept = 0;
+
+        virtual bool Profiling() const noexcept = 0;
+
+        virtual void CollectProfile(ExecutionProfile &outProfile, std::size_t maxPrograms) const = 0;
+
+        virtual void ResetProfile() noexcept = 0;
+
+        virtual void PublishProfile(TelemetryHub &telemetry, std::uint64_t frameIndex) = 0;
     };
 
     class GarbageCollector {
@@ -133,13 +186,21 @@ namespace spectre::detail {
         virtual StatusCode ApplyPlan(const MemoryBudgetPlan &plan) = 0;
     };
 
+    // Producers on any thread may call RegisterChannel and PushSample concurrently; Drain is
+    // single-consumer and must only be called from the thread that owns the hub.
     class TelemetryHub {
     public:
         virtual ~TelemetryHub() = default;
 
-        virtual void PushSample(const TelemetrySample &sample) = 0;
+        virtual TelemetryChannel RegisterChannel(std::string_view name) = 0;
+
+        virtual std::string_view ChannelName(TelemetryChannel channel) const = 0;
+
+        virtual bool PushSample(const TelemetrySample &sample) noexcept = 0;
+
+        virtual std::size_t Drain(std::span<TelemetrySample> out) noexcept = 0;
 
-        virtual std::vector<TelemetrySample> Drain() = 0;
+        virtual TelemetryStats Stats() const noexcept = 0;
     };
 
     class Scheduler {
@@ -165,6 +226,7 @@ namespace spectre::detail {
         std::string telemetryBackend;
         std::string schedulerBackend;
         std::string interopBackend;
+        std::string traceBackend;
     };
 
     struct SubsystemSuite {
@@ -176,6 +238,7 @@ namespace spectre::detail {
         std::unique_ptr<TelemetryHub> telemetry;
         std::unique_ptr<Scheduler> scheduler;
         std::unique_ptr<InteropBridge> interop;
+        std::unique_ptr<TraceRecorder> tracer;
         SubsystemManifest manifest;
     };
 
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "spectre/status.h"
+
+namespace spectre::detail {
+    // A completed span. Names and categories are not copied: they must outlive the recorder,
+    // which holds for string literals and module names.
+    struct TraceEvent {
+        std::string_view name;
+        const char *category;
+        std::uint64_t beginTicks;
+        std::uint64_t endTicks;
+    };
+
+    struct TraceStats {
+        std::uint64_t events;
+        std::uint64_t dropped;
+        std::uint64_t threads;
+        std::uint64_t capacityPerThread;
+    };
+
+    // Records scoped spans into fixed-size per-thread buffers. Any thread may record; each
+    // thread writes only its own buffer, so the hot path takes no lock. Export and Clear run on
+    // the owning thread, and Clear must not overlap with recording threads.
+    class TraceRecorder {
+    public:
+        static constexpr std::uint32_t kDefaultCapacityPerThread = 1u << 14;
+
+        explicit TraceRecorder(std::uint32_t capacityPerThread = kDefaultCapacityPerThread);
+
+        ~TraceRecorder();
+
+        TraceRecorder(const TraceRecorder &) = delete;
+
+        TraceRecorder &operator=(const TraceRecorder &) = delete;
+
+        bool Enabled() const noexcept {
+            return m_Enabled.load(std::memory_order_relaxed);
+        }
+
+        void SetEnabled(bool enabled) noexcept;
+
+        void Record(std::string_view name, const char *category, std::uint64_t beginTicks,
+                    std::uint64_t endTicks) noexcept;
+
+        TraceStats Stats() const;
+
+        void Collect(std::vector<TraceEvent> &outEvents) const;
+
+        void Clear() noexcept;
+
+        // Writes every recorded span as a Chrome trace ("traceEvents" complete events), which
+        // chrome://tracing and Perfetto both load.
+        StatusCode ExportChromeTrace(std::string &outJson) const;
+
+        static std::uint64_t Now() noexcept;
+
+    private:
+        struct ThreadBuffer;
+
+        const std::uint32_t m_CapacityPerThread;
+        const std::uint64_t m_Id;
+        const std::uint64_t m_OriginTicks;
+        const std::int64_t m_OriginNanos;
+        std::atomic<bool> m_Enabled;
+        mutable std::mutex m_Mutex;
+        std::vector<std::unique_ptr<ThreadBuffer> > m_Buffers;
+
+        ThreadBuffer *AcquireBuffer() noexcept;
+
+        double TicksPerMicrosecond() const noexcept;
+    };
+
+    // RAII span. When the recorder is missing or disabled the constructor costs one branch and
+    // the destructor one more; no timestamp is read.
+    class TraceScope {
+    public:
+        TraceScope(TraceRecorder *recorder, std::string_view name, const char *category) noexcept
+            : m_Recorder(recorder != nullptr && recorder->Enabled() ? recorder : nullptr),
+              m_Name(name),
+              m_Category(category),
+              m_Begin(m_Recorder != nullptr ? TraceRecorder::Now() : 0) {
+        }
+
+        ~TraceScope() {
+            if (m_Recorder != nullptr) {
+                m_Recorder->Record(m_Name, m_Category, m_Begin, TraceRecorder::Now());
+            }
+        }
+
+        TraceScope(const TraceScope &) = delete;
+
+        TraceScope &operator=(const TraceScope &) = delete;
+
+    private:
+        TraceRecorder *m_Recorder;
+        std::string_view m_Name;
+        const char *m_Category;
+        std::uint64_t m_Begin;
+    };
+}
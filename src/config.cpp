@@ -5,7 +5,7 @@ namespace spectre {
         RuntimeConfig config{};
         config.mode = RuntimeMode::SingleThread;
         config.memory = MemoryBudget{256 * 1024 * 1024ULL, 128 * 1024 * 1024ULL, 512 * 1024 * 1024ULL};
-        config.telemetry = TelemetryConfig{true, false, 256};
+        config.telemetry = TelemetryConfig{true, false, 4096, false};
         config.enableGpuAcceleration = false;
         return config;
     }
@@ -66,4 +66,14 @@ namespace spectre {
         }
         return m_Slots[it->second].version;
     }
+
+    std::uint64_t SpectreContext::MemoryBytes() const {
+        std::uint64_t bytes = m_Name.capacity() + m_Slots.capacity() * sizeof(ScriptSlot);
+        for (const auto &slot: m_Slots) {
+            const auto &record = slot.record;
+            bytes += slot.name.capacity() + record.source.capacity() + record.bytecode.capacity()
+                    + record.bytecodeHash.capacity();
+        }
+        return bytes + m_Lookup.size() * (sizeof(std::string) + sizeof(std::size_t) + sizeof(void *));
+    }
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "spectre/context.h"
 #include "spectre/runtime.h"
@@ -29,6 +30,16 @@ namespace spectre::detail {
         virtual const RuntimeConfig &Config() const = 0;
 
         virtual StatusCode GetContext(const std::string &name, const SpectreContext **outContext) const = 0;
+
+        // Full walk of every context's scripts and programs.
+        virtual void CollectContextMemory(std::vector<ContextMemoryReport> &outContexts) const = 0;
+
+        // Per-tick sample: name, liveBytes and allocatedBytes from running counters, no walk.
+        virtual void SampleContextMemory(std::vector<ContextMemoryReport> &outContexts) const = 0;
+
+        virtual void AttachTracer(TraceRecorder *tracer) noexcept = 0;
+
+        virtual ExecutionEngine *Execution() noexcept = 0;
     };
 
     std::unique_ptr<ModeAdapter> MakeModeAdapter(const RuntimeConfig &config);
@@ -50,15 +50,24 @@ namespace spectre::detail {
                              BytecodePipeline &bytecode,
                              const ScriptSource &source,
                              ExecutableProgram &outProgram,
-                             std::string &diagnostics) {
+                             std::string &diagnostics,
+                             TraceRecorder *tracer) {
         ScriptUnit unit{source.name, source.source};
         ModuleArtifact artifact{};
-        auto parseStatus = parser.ParseModule(unit, artifact);
+        StatusCode parseStatus;
+        {
+            TraceScope scope(tracer, "script.parse", "compile");
+            parseStatus = parser.ParseModule(unit, artifact);
+        }
         if (parseStatus != StatusCode::Ok) {
             diagnostics = artifact.diagnostics;
             return parseStatus;
         }
-        auto lowerStatus = bytecode.LowerModule(artifact, outProgram);
+        StatusCode lowerStatus;
+        {
+            TraceScope scope(tracer, "script.compile", "compile");
+            lowerStatus = bytecode.LowerModule(artifact, outProgram);
+        }
         if (lowerStatus != StatusCode::Ok) {
             diagnostics = outProgram.diagnostics;
             return lowerStatus;
@@ -67,6 +76,44 @@ namespace spectre::detail {
         return StatusCode::Ok;
     }
 
+    std::uint64_t ProgramBytes(const ExecutableProgram &program) {
+        std::uint64_t bytes = sizeof(ExecutableProgram) + program.name.capacity() + program.code.capacity()
+                              + program.numberConstants.capacity() * sizeof(double)
+                              + program.stringConstants.capacity() * sizeof(std::string)
+                              + program.diagnostics.capacity();
+        for (const auto &value: program.stringConstants) {
+            bytes += value.capacity();
+        }
+        return bytes;
+    }
+
+    std::uint64_t LoadedBytes(const std::string &name, const ScriptRecord &record, const ExecutableProgram &program) {
+        return 2 * name.capacity() + record.source.capacity() + record.bytecode.capacity()
+               + record.bytecodeHash.capacity() + ProgramBytes(program);
+    }
+
+    std::uint64_t ReplacedBytes(const SpectreContext &context,
+                                const std::unordered_map<std::string, ExecutableProgram> &programs,
+                                const std::string &name) {
+        auto it = programs.find(name);
+        const ScriptRecord *record = nullptr;
+        if (it == programs.end() || context.GetScript(name, &record) != StatusCode::Ok) {
+            return 0;
+        }
+        return LoadedBytes(it->first, *record, it->second);
+    }
+
+    void MeasureContext(const SpectreContext &context,
+                        const std::unordered_map<std::string, ExecutableProgram> &programs,
+                        ContextMemoryReport &report) {
+        report.scriptBytes = context.MemoryBytes();
+        report.programBytes = 0;
+        for (const auto &program: programs) {
+            report.programBytes += program.first.capacity() + ProgramBytes(program.second);
+        }
+        report.liveBytes = report.scriptBytes + report.programBytes;
+    }
+
     std::vector<std::uint8_t> SerializeProgram(const ExecutableProgram &program) {
         ProgramHeader header{};
         header.magic[0] = 'S';
@@ -2,8 +2,10 @@
 
 #include <cstdint>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
+#include "spectre/context.h"
 #include "spectre/runtime.h"
 #include "spectre/subsystems.h"
 #include "spectre/status.h"
@@ -17,7 +19,23 @@ namespace spectre::detail {
                              BytecodePipeline &bytecode,
                              const ScriptSource &source,
                              ExecutableProgram &outProgram,
-                             std::string &diagnostics);
+                             std::string &diagnostics,
+                             TraceRecorder *tracer);
+
+    std::uint64_t ProgramBytes(const ExecutableProgram &program);
+
+    // Bytes one load allocates: the stored script record plus its compiled program.
+    std::uint64_t LoadedBytes(const std::string &name, const ScriptRecord &record, const ExecutableProgram &program);
+
+    // Bytes held by the script and program stored under name, which a load of the same name replaces.
+    std::uint64_t ReplacedBytes(const SpectreContext &context,
+                                const std::unordered_map<std::string, ExecutableProgram> &programs,
+                                const std::string &name);
+
+    // Walks one context's scripts and programs into report's byte fields.
+    void MeasureContext(const SpectreContext &context,
+                        const std::unordered_map<std::string, ExecutableProgram> &programs,
+                        ContextMemoryReport &report);
 
     std::vector<std::uint8_t> SerializeProgram(const ExecutableProgram &program);
 
@@ -31,6 +31,7 @@ namespace spectre::detail {
                 return StatusCode::AlreadyExists;
             }
             auto state = std::make_unique<ContextState>(config);
+            Account(*state, state->context.MemoryBytes(), 0);
             auto *ptr = &state->context;
             state->fiberVersion = ++m_DispatchSeed;
             TouchReady(config.name);
@@ -73,7 +74,7 @@ namespace spectre::detail {
             ExecutableProgram program{};
             program.name = script.name;
             std::string diagnostics;
-            auto status = CompileScript(*m_Parser, *m_Bytecode, script, program, diagnostics);
+            auto status = CompileScript(*m_Parser, *m_Bytecode, script, program, diagnostics, m_Tracer);
             if (status != StatusCode::Ok) {
                 result.status = status;
                 result.value.clear();
@@ -81,13 +82,19 @@ namespace spectre::detail {
                 return result;
             }
 
-            auto serialized = SerializeProgram(program);
+            std::vector<std::uint8_t> serialized;
+            {
+                TraceScope scope(m_Tracer, "script.serialize", "compile");
+                serialized = SerializeProgram(program);
+            }
             ScriptRecord record;
             record.source = script.source;
             record.bytecode = std::move(serialized);
             record.bytecodeHash = HashBytes(record.bytecode);
             record.isBytecode = false;
 
+            auto loadedBytes = LoadedBytes(script.name, record, program);
+            auto replacedBytes = ReplacedBytes(state->context, state->programs, script.name);
             status = state->context.StoreScript(script.name, std::move(record));
             if (status != StatusCode::Ok) {
                 result.status = status;
@@ -97,6 +104,7 @@ namespace spectre::detail {
             }
 
             state->programs[script.name] = std::move(program);
+            Account(*state, loadedBytes, replacedBytes);
             state->fiberVersion++;
             TouchReady(contextName);
             result.diagnostics = "Script compiled";
@@ -129,6 +137,8 @@ namespace spectre::detail {
             record.bytecodeHash = HashBytes(record.bytecode);
             record.isBytecode = true;
 
+            auto loadedBytes = LoadedBytes(artifact.name, record, program);
+            auto replacedBytes = ReplacedBytes(state->context, state->programs, artifact.name);
             status = state->context.StoreScript(artifact.name, std::move(record));
             if (status != StatusCode::Ok) {
                 result.status = status;
@@ -138,6 +148,7 @@ namespace spectre::detail {
             }
 
             state->programs[artifact.name] = std::move(program);
+            Account(*state, loadedBytes, replacedBytes);
             state->fiberVersion++;
             TouchReady(contextName);
             result.diagnostics = "Bytecode loaded";
@@ -182,6 +193,9 @@ namespace spectre::detail {
             }
             m_Config = config;
             m_Config.mode = RuntimeMode::MultiThread;
+            if (m_Execution) {
+                m_Execution->SetProfiling(m_Config.telemetry.enableOpcodeProfiling);
+            }
             m_WorkerCount = static_cast<std::uint32_t>(std::max(1u, std::thread::hardware_concurrency()));
             return StatusCode::Ok;
         }
@@ -201,6 +215,39 @@ namespace spectre::detail {
             return StatusCode::Ok;
         }
 
+        void AttachTracer(TraceRecorder *tracer) noexcept override {
+            m_Tracer = tracer;
+        }
+
+        ExecutionEngine *Execution() noexcept override {
+            return m_Execution.get();
+        }
+
+        void CollectContextMemory(std::vector<ContextMemoryReport> &outContexts) const override {
+            outContexts.clear();
+            outContexts.reserve(m_Contexts.size());
+            for (const auto &entry: m_Contexts) {
+                const auto &state = *entry.second;
+                ContextMemoryReport report{};
+                report.name = entry.first;
+                MeasureContext(state.context, state.programs, report);
+                report.allocatedBytes = state.allocatedBytes;
+                outContexts.push_back(std::move(report));
+            }
+        }
+
+        void SampleContextMemory(std::vector<ContextMemoryReport> &outContexts) const override {
+            outContexts.resize(m_Contexts.size());
+            std::size_t index = 0;
+            for (const auto &entry: m_Contexts) {
+                const auto &state = *entry.second;
+                auto &report = outContexts[index++];
+                report.name.assign(entry.first);
+                report.liveBytes = state.liveBytes;
+                report.allocatedBytes = state.allocatedBytes;
+            }
+        }
+
     private:
         struct ContextState {
             explicit ContextState(const ContextConfig &config) : context(config.name, config.initialStackSize) {
@@ -208,6 +255,8 @@ namespace spectre::detail {
 
             SpectreContext context;
             std::unordered_map<std::string, ExecutableProgram> programs;
+            std::uint64_t liveBytes{0};
+            std::uint64_t allocatedBytes{0};
             std::uint64_t fiberVersion{0};
         };
 
@@ -221,6 +270,14 @@ namespace spectre::detail {
             return it == m_Contexts.end() ? nullptr : it->second.get();
         }
 
+        // Loads are the only place a context allocates, so the per-tick counters move here. Only the
+        // load's own bytes and those of the entry it replaces are counted; MemoryReport does the walk.
+        static void Account(ContextState &state, std::uint64_t loadedBytes, std::uint64_t replacedBytes) {
+            state.liveBytes -= std::min(state.liveBytes, replacedBytes);
+            state.liveBytes += loadedBytes;
+            state.allocatedBytes += loadedBytes;
+        }
+
         void TouchReady(const std::string &name) {
             auto it = std::find(m_Ready.begin(), m_Ready.end(), name);
             if (it == m_Ready.end()) {
@@ -234,6 +291,7 @@ namespace spectre::detail {
         std::unique_ptr<ParserFrontend> m_Parser;
         std::unique_ptr<BytecodePipeline> m_Bytecode;
         std::unique_ptr<ExecutionEngine> m_Execution;
+        TraceRecorder *m_Tracer{nullptr};
         std::unordered_map<std::string, std::unique_ptr<ContextState> > m_Contexts;
         std::vector<std::string> m_Ready;
         TickInfo m_LastTick{0.0, 0};
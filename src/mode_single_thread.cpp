@@ -1,6 +1,7 @@
 ﻿#include "mode_adapter.h"
 #include "mode_helpers.h"
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -26,6 +27,7 @@ namespace spectre::detail {
                 return StatusCode::AlreadyExists;
             }
             ContextState state(config);
+            Account(state, state.context.MemoryBytes(), 0);
             auto insert = m_Contexts.emplace(config.name, std::move(state));
             if (outContext != nullptr) {
                 *outContext = &insert.first->second.context;
@@ -56,7 +58,7 @@ namespace spectre::detail {
             ExecutableProgram program{};
             program.name = script.name;
             std::string diagnostics;
-            auto status = CompileScript(*m_Parser, *m_Bytecode, script, program, diagnostics);
+            auto status = CompileScript(*m_Parser, *m_Bytecode, script, program, diagnostics, m_Tracer);
             if (status != StatusCode::Ok) {
                 result.status = status;
                 result.value.clear();
@@ -64,13 +66,19 @@ namespace spectre::detail {
                 return result;
             }
 
-            auto serialized = SerializeProgram(program);
+            std::vector<std::uint8_t> serialized;
+            {
+                TraceScope scope(m_Tracer, "script.serialize", "compile");
+                serialized = SerializeProgram(program);
+            }
             ScriptRecord record;
             record.source = script.source;
             record.bytecode = std::move(serialized);
             record.bytecodeHash = HashBytes(record.bytecode);
             record.isBytecode = false;
 
+            auto loadedBytes = LoadedBytes(script.name, record, program);
+            auto replacedBytes = ReplacedBytes(state->context, state->programs, script.name);
             status = state->context.StoreScript(script.name, std::move(record));
             if (status != StatusCode::Ok) {
                 result.status = status;
@@ -80,6 +88,7 @@ namespace spectre::detail {
             }
 
             state->programs[script.name] = std::move(program);
+            Account(*state, loadedBytes, replacedBytes);
             result.diagnostics = "Script compiled";
             return result;
         }
@@ -110,6 +119,8 @@ namespace spectre::detail {
             record.bytecodeHash = HashBytes(record.bytecode);
             record.isBytecode = true;
 
+            auto loadedBytes = LoadedBytes(artifact.name, record, program);
+            auto replacedBytes = ReplacedBytes(state->context, state->programs, artifact.name);
             status = state->context.StoreScript(artifact.name, std::move(record));
             if (status != StatusCode::Ok) {
                 result.status = status;
@@ -119,6 +130,7 @@ namespace spectre::detail {
             }
 
             state->programs[artifact.name] = std::move(program);
+            Account(*state, loadedBytes, replacedBytes);
             result.diagnostics = "Bytecode loaded";
             return result;
         }
@@ -157,6 +169,9 @@ namespace spectre::detail {
             }
             m_Config = config;
             m_Config.mode = RuntimeMode::SingleThread;
+            if (m_Execution) {
+                m_Execution->SetProfiling(m_Config.telemetry.enableOpcodeProfiling);
+            }
             return StatusCode::Ok;
         }
 
@@ -175,6 +190,39 @@ namespace spectre::detail {
             return StatusCode::Ok;
         }
 
+        void AttachTracer(TraceRecorder *tracer) noexcept override {
+            m_Tracer = tracer;
+        }
+
+        ExecutionEngine *Execution() noexcept override {
+            return m_Execution.get();
+        }
+
+        void CollectContextMemory(std::vector<ContextMemoryReport> &outContexts) const override {
+            outContexts.clear();
+            outContexts.reserve(m_Contexts.size());
+            for (const auto &entry: m_Contexts) {
+                const auto &state = entry.second;
+                ContextMemoryReport report{};
+                report.name = entry.first;
+                MeasureContext(state.context, state.programs, report);
+                report.allocatedBytes = state.allocatedBytes;
+                outContexts.push_back(std::move(report));
+            }
+        }
+
+        void SampleContextMemory(std::vector<ContextMemoryReport> &outContexts) const override {
+            outContexts.resize(m_Contexts.size());
+            std::size_t index = 0;
+            for (const auto &entry: m_Contexts) {
+                const auto &state = entry.second;
+                auto &report = outContexts[index++];
+                report.name.assign(entry.first);
+                report.liveBytes = state.liveBytes;
+                report.allocatedBytes = state.allocatedBytes;
+            }
+        }
+
     private:
         struct ContextState {
             explicit ContextState(const ContextConfig &config) : context(config.name, config.initialStackSize) {
@@ -182,6 +230,8 @@ namespace spectre::detail {
 
             SpectreContext context;
             std::unordered_map<std::string, ExecutableProgram> programs;
+            std::uint64_t liveBytes{0};
+            std::uint64_t allocatedBytes{0};
         };
 
         ContextState *FindContext(const std::string &name) {
@@ -194,10 +244,19 @@ namespace spectre::detail {
             return it == m_Contexts.end() ? nullptr : &it->second;
         }
 
+        // Loads are the only place a context allocates, so the per-tick counters move here. Only the
+        // load's own bytes and those of the entry it replaces are counted; MemoryReport does the walk.
+        static void Account(ContextState &state, std::uint64_t loadedBytes, std::uint64_t replacedBytes) {
+            state.liveBytes -= std::min(state.liveBytes, replacedBytes);
+            state.liveBytes += loadedBytes;
+            state.allocatedBytes += loadedBytes;
+        }
+
         RuntimeConfig m_Config;
         std::unique_ptr<ParserFrontend> m_Parser;
         std::unique_ptr<BytecodePipeline> m_Bytecode;
         std::unique_ptr<ExecutionEngine> m_Execution;
+        TraceRecorder *m_Tracer{nullptr};
         std::unordered_map<std::string, ContextState> m_Contexts;
         TickInfo m_LastTick{0.0, 0};
     };
@@ -3,15 +3,63 @@
 #include "mode_adapter.h"
 #include "spectre/es2025/environment.h"
 
+#include <algorithm>
 #include <memory>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 namespace spectre {
     struct SpectreRuntime::Impl {
+        struct ContextMemoryAccount {
+            std::uint64_t allocatedBytes;
+            std::uint64_t peakLiveBytes;
+            std::uint64_t lastFrame;
+            double allocationRate;
+            detail::TelemetryChannel channel;
+        };
+
         std::unique_ptr<detail::ModeAdapter> mode;
         detail::SubsystemSuite subsystems;
         std::unique_ptr<es2025::Environment> environment;
         TickInfo lastTick{0.0, 0};
+        std::unordered_map<std::string, ContextMemoryAccount> contextMemory;
+        std::vector<ContextMemoryReport> contextScratch;
+
+        // Reads the adapters' running counters; the full walk only happens in MemoryReport.
+        void SampleContextMemory(const TickInfo &info) {
+            mode->SampleContextMemory(contextScratch);
+            for (const auto &report: contextScratch) {
+                auto it = contextMemory.find(report.name);
+                if (it == contextMemory.end()) {
+                    it = contextMemory.emplace(report.name, ContextMemoryAccount{
+                                                   0, 0, 0, 0.0, detail::kInvalidTelemetryChannel
+                                               }).first;
+                }
+                auto &account = it->second;
+                account.peakLiveBytes = std::max(account.peakLiveBytes, report.liveBytes);
+                account.allocationRate = info.deltaSeconds > 0.0 && report.allocatedBytes > account.allocatedBytes
+                                             ? static_cast<double>(report.allocatedBytes - account.allocatedBytes) /
+                                               info.deltaSeconds
+                                             : 0.0;
+                account.allocatedBytes = report.allocatedBytes;
+                account.lastFrame = info.frameIndex;
+                if (subsystems.telemetry) {
+                    if (account.channel == detail::kInvalidTelemetryChannel) {
+                        account.channel = subsystems.telemetry->RegisterChannel(
+                            "memory.context." + report.name + ".live");
+                    }
+                    subsystems.telemetry->PushSample({
+                        account.channel, static_cast<double>(report.liveBytes), info.frameIndex
+                    });
+                }
+            }
+            if (contextMemory.size() > contextScratch.size()) {
+                std::erase_if(contextMemory, [&info](const auto &entry) {
+                    return entry.second.lastFrame != info.frameIndex;
+                });
+            }
+        }
     };
 
     std::unique_ptr<SpectreRuntime> SpectreRuntime::Create(const RuntimeConfig &config) {
@@ -26,6 +74,7 @@ namespace spectre {
             }
         }
         impl->subsystems = detail::CreateCpuSubsystemSuite(impl->mode->Config());
+        impl->mode->AttachTracer(impl->subsystems.tracer.get());
         impl->environment = std::make_unique<es2025::Environment>();
         auto runtime = std::unique_ptr<SpectreRuntime>(new SpectreRuntime(std::move(impl)));
         runtime->InitializeEnvironment(runtime->Config());
@@ -46,6 +95,7 @@ namespace spectre {
     }
 
     EvaluationResult SpectreRuntime::LoadScript(const std::string &contextName, const ScriptSource &script) {
+        detail::TraceScope scope(m_Impl->subsystems.tracer.get(), "LoadScript", "runtime");
         return m_Impl->mode->LoadScript(contextName, script);
     }
 
@@ -54,15 +104,25 @@ namespace spectre {
     }
 
     EvaluationResult SpectreRuntime::EvaluateSync(const std::string &contextName, const std::string &entryPoint) {
+        detail::TraceScope scope(m_Impl->subsystems.tracer.get(), "EvaluateSync", "runtime");
         return m_Impl->mode->EvaluateSync(contextName, entryPoint);
     }
 
     void SpectreRuntime::Tick(const TickInfo &info) {
+        detail::TraceScope scope(m_Impl->subsystems.tracer.get(), "Tick", "frame");
         m_Impl->lastTick = info;
         m_Impl->mode->Tick(info);
         if (m_Impl->environment) {
             m_Impl->environment->Tick(info);
         }
+        const auto &telemetry = m_Impl->mode->Config().telemetry;
+        if (telemetry.enableProfiling) {
+            m_Impl->SampleContextMemory(info);
+        }
+        auto *execution = m_Impl->mode->Execution();
+        if (execution != nullptr && execution->Profiling() && m_Impl->subsystems.telemetry) {
+            execution->PublishProfile(*m_Impl->subsystems.telemetry, info.frameIndex);
+        }
     }
 
     StatusCode SpectreRuntime::Reconfigure(const RuntimeConfig &config) {
@@ -81,6 +141,9 @@ namespace spectre {
                 return memoryStatus;
             }
         }
+        if (m_Impl->subsystems.tracer) {
+            m_Impl->subsystems.tracer->SetEnabled(config.telemetry.enableTracing);
+        }
         if (m_Impl->environment) {
             m_Impl->environment->Reconfigure(config);
         }
@@ -107,6 +170,78 @@ namespace spectre {
         return m_Impl->lastTick;
     }
 
+    StatusCode SpectreRuntime::CollectExecutionProfile(detail::ExecutionProfile &outProfile,
+                                                       std::size_t maxPrograms) const {
+        auto *execution = m_Impl->mode->Execution();
+        if (execution == nullptr) {
+            return StatusCode::InternalError;
+        }
+        execution->CollectProfile(outProfile, maxPrograms);
+        return StatusCode::Ok;
+    }
+
+    StatusCode SpectreRuntime::ExportTrace(std::string &outJson) const {
+        if (!m_Impl->subsystems.tracer) {
+            return StatusCode::InternalError;
+        }
+        return m_Impl->subsystems.tracer->ExportChromeTrace(outJson);
+    }
+
+    RuntimeMemoryReport SpectreRuntime::MemoryReport() const {
+        RuntimeMemoryReport report{};
+        report.frameIndex = m_Impl->lastTick.frameIndex;
+        report.heapBudgetBytes = Config().memory.heapBytes;
+        if (m_Impl->environment) {
+            const auto &modules = m_Impl->environment->Modules();
+            const auto &stats = m_Impl->environment->MemoryStats();
+            report.modules.reserve(modules.size());
+            for (std::size_t i = 0; i < modules.size(); ++i) {
+                es2025::ModuleMemoryUsage usage{};
+                modules[i]->CollectMemory(usage);
+                m_Impl->environment->NoteMemoryUsage(i, usage);
+                ModuleMemoryReport entry{};
+                entry.name.assign(modules[i]->Name());
+                entry.measured = usage.measured;
+                entry.liveBytes = usage.liveBytes;
+                entry.reservedBytes = usage.reservedBytes;
+                entry.freeListBytes = usage.freeListBytes;
+                entry.slotCount = usage.slotCount;
+                entry.freeSlotCount = usage.freeSlotCount;
+                entry.peakLiveBytes = usage.liveBytes;
+                if (i < stats.size()) {
+                    entry.peakLiveBytes = std::max(entry.peakLiveBytes, stats[i].peakLiveBytes);
+                    entry.allocatedBytes = stats[i].counters.allocatedBytes;
+                    entry.allocationRate = stats[i].allocationRate;
+                }
+                entry.slotFragmentation = usage.slotCount == 0
+                                              ? 0.0
+                                              : static_cast<double>(usage.freeSlotCount) /
+                                                static_cast<double>(usage.slotCount);
+                entry.arenaFragmentation = usage.reservedBytes == 0
+                                               ? 0.0
+                                               : static_cast<double>(usage.freeListBytes) /
+                                                 static_cast<double>(usage.reservedBytes);
+                report.liveBytes += entry.liveBytes;
+                report.peakLiveBytes += entry.peakLiveBytes;
+                report.reservedBytes += entry.reservedBytes;
+                report.modules.push_back(std::move(entry));
+            }
+        }
+        m_Impl->mode->CollectContextMemory(report.contexts);
+        for (auto &context: report.contexts) {
+            context.peakLiveBytes = context.liveBytes;
+            auto it = m_Impl->contextMemory.find(context.name);
+            if (it != m_Impl->contextMemory.end()) {
+                context.peakLiveBytes = std::max(context.peakLiveBytes, it->second.peakLiveBytes);
+                context.allocationRate = it->second.allocationRate;
+            }
+            report.liveBytes += context.liveBytes;
+            report.peakLiveBytes += context.peakLiveBytes;
+            report.reservedBytes += context.liveBytes;
+        }
+        return report;
+    }
+
     StatusCode SpectreRuntime::GetContext(const std::string &name, const SpectreContext **outContext) const {
         return m_Impl->mode->GetContext(name, outContext);
     }
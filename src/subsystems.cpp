@@ -2,13 +2,16 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <charconv>
 #include <cctype>
 #include <cmath>
 #include <cstdint>
 #include <cstring>
+#include <deque>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <string_view>
 #include <unordered_map>
 #include <utility>
@@ -625,9 +628,184 @@ namespace spectre::detail {
             std::uint64_t m_Version{0};
         };
 
+        constexpr std::size_t kOpcodeCount = static_cast<std::size_t>(OpCode::Return) + 1;
+        // One extra slot collects bytes that do not decode to a known opcode.
+        constexpr std::size_t kOpcodeSlots = kOpcodeCount + 1;
+        constexpr std::array<std::string_view, kOpcodeSlots> kOpcodeNames{
+            "PushNumber", "PushString", "PushBoolean", "PushNull", "PushUndefined", "Add", "Sub", "Mul", "Div",
+            "Negate", "Return", "Invalid"
+        };
+
         class BaselineExecutionEngine final : public ExecutionEngine {
         public:
             ExecutionResponse Execute(const ExecutionRequest &request) override {
+                return m_Profiling ? Run<ProfileScope>(request) : Run<NullProfileScope>(request);
+            }
+
+            void SetProfiling(bool enabled) noexcept override {
+                m_Profiling = enabled;
+            }
+
+            bool Profiling() const noexcept override {
+                return m_Profiling;
+            }
+
+            void CollectProfile(ExecutionProfile &outProfile, std::size_t maxPrograms) const override {
+                outProfile.executions = m_Executions;
+                outProfile.instructions = m_Instructions;
+                outProfile.opcodes.clear();
+                for (std::size_t i = 0; i < kOpcodeSlots; ++i) {
+                    if (m_OpcodeCounts[i] != 0) {
+                        outProfile.opcodes.push_back({kOpcodeNames[i], m_OpcodeCounts[i], m_OpcodeCycles[i]});
+                    }
+                }
+                outProfile.hotPrograms.clear();
+                outProfile.hotPrograms.reserve(m_Programs.size());
+                for (const auto &entry: m_Programs) {
+                    outProfile.hotPrograms.push_back({
+                        entry.first.second, entry.first.first, entry.second.calls, entry.second.instructions,
+                        entry.second.cycles
+                    });
+                }
+                auto keep = std::min(maxPrograms, outProfile.hotPrograms.size());
+                std::partial_sort(outProfile.hotPrograms.begin(), outProfile.hotPrograms.begin() + keep,
+                                  outProfile.hotPrograms.end(), [](const auto &lhs, const auto &rhs) {
+                                      return lhs.cycles != rhs.cycles ? lhs.cycles > rhs.cycles : lhs.calls > rhs.calls;
+                                  });
+                outProfile.hotPrograms.resize(keep);
+            }
+
+            void ResetProfile() noexcept override {
+                m_OpcodeCounts.fill(0);
+                m_OpcodeCycles.fill(0);
+                m_Programs.clear();
+                m_Executions = 0;
+                m_Instructions = 0;
+            }
+
+            void PublishProfile(TelemetryHub &telemetry, std::uint64_t frameIndex) override {
+                if (m_ChannelOwner != &telemetry) {
+                    std::string channel;
+                    for (std::size_t i = 0; i < kOpcodeSlots; ++i) {
+                        channel.assign("exec.op.").append(kOpcodeNames[i]);
+                        auto prefixLength = channel.size();
+                        m_CountChannels[i] = telemetry.RegisterChannel(channel.append(".count"));
+                        channel.resize(prefixLength);
+                        m_CycleChannels[i] = telemetry.RegisterChannel(channel.append(".cycles"));
+                    }
+                    m_ExecutionsChannel = telemetry.RegisterChannel("exec.executions");
+                    m_ChannelOwner = &telemetry;
+                }
+                telemetry.PushSample({m_ExecutionsChannel, static_cast<double>(m_Executions), frameIndex});
+                for (std::size_t i = 0; i < kOpcodeSlots; ++i) {
+                    if (m_OpcodeCounts[i] == 0) {
+                        continue;
+                    }
+                    telemetry.PushSample({m_CountChannels[i], static_cast<double>(m_OpcodeCounts[i]), frameIndex});
+                    telemetry.PushSample({m_CycleChannels[i], static_cast<double>(m_OpcodeCycles[i]), frameIndex});
+                }
+            }
+
+        private:
+            struct ProgramCounters {
+                std::uint64_t calls;
+                std::uint64_t instructions;
+                std::uint64_t cycles;
+            };
+
+            // Programs are keyed by the version the pipeline stamped when lowering them plus their
+            // name, so two programs that share a name (in different contexts, or across a reload)
+            // keep separate counters. Lookups go through a string_view so a hit never allocates.
+            using ProgramKey = std::pair<std::uint64_t, std::string>;
+            using ProgramKeyView = std::pair<std::uint64_t, std::string_view>;
+
+            struct ProgramKeyHash {
+                using is_transparent = void;
+
+                std::size_t operator()(const ProgramKeyView &key) const noexcept {
+                    auto hash = std::hash<std::string_view>{}(key.second);
+                    return hash ^ (std::hash<std::uint64_t>{}(key.first) + 0x9e3779b97f4a7c15ull + (hash << 6) +
+                                   (hash >> 2));
+                }
+
+                std::size_t operator()(const ProgramKey &key) const noexcept {
+                    return (*this)(ProgramKeyView(key.first, key.second));
+                }
+            };
+
+            struct ProgramKeyEqual {
+                using is_transparent = void;
+
+                template<typename L, typename R>
+                bool operator()(const L &lhs, const R &rhs) const noexcept {
+                    return lhs.first == rhs.first && std::string_view(lhs.second) == std::string_view(rhs.second);
+                }
+            };
+
+            ProgramCounters &CountersFor(const ExecutableProgram &program) {
+                auto it = m_Programs.find(ProgramKeyView(program.version, program.name));
+                if (it == m_Programs.end()) {
+                    it = m_Programs.emplace(ProgramKey(program.version, program.name), ProgramCounters{}).first;
+                }
+                return it->second;
+            }
+
+            class NullProfileScope {
+            public:
+                NullProfileScope(BaselineExecutionEngine &, const ExecutableProgram &) noexcept {
+                }
+
+                void Step(std::uint8_t) noexcept {
+                }
+            };
+
+            // Charges the time between consecutive dispatches to the opcode that was running, so
+            // each instruction costs one timestamp read; the destructor settles the final one on
+            // every exit path.
+            class ProfileScope {
+            public:
+                ProfileScope(BaselineExecutionEngine &engine, const ExecutableProgram &program)
+                    : m_Engine(engine),
+                      m_Program(engine.CountersFor(program)),
+                      m_Start(TraceRecorder::Now()),
+                      m_Last(m_Start) {
+                    ++m_Program.calls;
+                    ++m_Engine.m_Executions;
+                }
+
+                ~ProfileScope() {
+                    auto now = TraceRecorder::Now();
+                    Settle(now);
+                    m_Program.cycles += now - m_Start;
+                    m_Program.instructions += m_Instructions;
+                    m_Engine.m_Instructions += m_Instructions;
+                }
+
+                void Step(std::uint8_t raw) noexcept {
+                    Settle(TraceRecorder::Now());
+                    m_Current = raw < kOpcodeCount ? raw : kOpcodeCount;
+                    ++m_Engine.m_OpcodeCounts[m_Current];
+                    ++m_Instructions;
+                }
+
+            private:
+                void Settle(std::uint64_t now) noexcept {
+                    if (m_Current < kOpcodeSlots) {
+                        m_Engine.m_OpcodeCycles[m_Current] += now - m_Last;
+                    }
+                    m_Last = now;
+                }
+
+                BaselineExecutionEngine &m_Engine;
+                ProgramCounters &m_Program;
+                std::uint64_t m_Start;
+                std::uint64_t m_Last;
+                std::size_t m_Current{kOpcodeSlots};
+                std::uint64_t m_Instructions{0};
+            };
+
+            template<typename Profile>
+            ExecutionResponse Run(const ExecutionRequest &request) {
                 ExecutionResponse response{};
                 if (request.program == nullptr) {
                     response.status = StatusCode::InvalidArgument;
@@ -635,12 +813,15 @@ namespace spectre::detail {
                     return response;
                 }
                 const auto &program = *request.program;
+                Profile profile(*this, program);
                 std::vector<Value> stack;
                 stack.reserve(8);
                 std::size_t ip = 0;
                 const auto &code = program.code;
                 while (ip < code.size()) {
-                    auto opcode = static_cast<OpCode>(code[ip++]);
+                    auto raw = code[ip++];
+                    profile.Step(raw);
+                    auto opcode = static_cast<OpCode>(raw);
                     switch (opcode) {
                         case OpCode::PushNumber: {
                             auto index = ReadOperand(code, ip);
@@ -727,7 +908,6 @@ namespace spectre::detail {
                 return Fail(response, "Program terminated without return");
             }
 
-        private:
             enum class ValueType : std::uint8_t {
                 Number,
                 Boolean,
@@ -837,17 +1017,33 @@ namespace spectre::detail {
                 }
                 return {};
             }
+
+            bool m_Profiling{false};
+            std::array<std::uint64_t, kOpcodeSlots> m_OpcodeCounts{};
+            std::array<std::uint64_t, kOpcodeSlots> m_OpcodeCycles{};
+            std::unordered_map<ProgramKey, ProgramCounters, ProgramKeyHash, ProgramKeyEqual> m_Programs;
+            std::uint64_t m_Executions{0};
+            std::uint64_t m_Instructions{0};
+            const TelemetryHub *m_ChannelOwner{nullptr};
+            std::array<TelemetryChannel, kOpcodeSlots> m_CountChannels{};
+            std::array<TelemetryChannel, kOpcodeSlots> m_CycleChannels{};
+            TelemetryChannel m_ExecutionsChannel{kInvalidTelemetryChannel};
         };
 
         class CpuGarbageCollector final : public GarbageCollector {
         public:
+            explicit CpuGarbageCollector(TraceRecorder *tracer) : m_Tracer(tracer) {
+            }
+
             StatusCode Collect(GcSnapshot &snapshot) override {
+                TraceScope scope(m_Tracer, "gc.slice", "gc");
                 snapshot.generation = ++m_Generation;
                 snapshot.reclaimedBytes = snapshot.generation * 1024;
                 return StatusCode::Ok;
             }
 
         private:
+            TraceRecorder *m_Tracer;
             std::uint64_t m_Generation{0};
         };
 
@@ -877,22 +1073,119 @@ namespace spectre::detail {
 
         class CpuTelemetryHub final : public TelemetryHub {
         public:
-            explicit CpuTelemetryHub(std::size_t capacity) {
-                m_Buffer.reserve(capacity);
+            explicit CpuTelemetryHub(std::size_t capacity)
+                : m_Capacity(RoundCapacity(capacity)),
+                  m_Mask(m_Capacity - 1),
+                  m_Cells(std::make_unique<Cell[]>(m_Capacity)) {
+                for (std::uint64_t i = 0; i < m_Capacity; ++i) {
+                    m_Cells[i].sequence.store(i, std::memory_order_relaxed);
+                }
+            }
+
+            TelemetryChannel RegisterChannel(std::string_view name) override {
+                std::lock_guard<std::mutex> lock(m_ChannelMutex);
+                auto it = m_ChannelLookup.find(name);
+                if (it != m_ChannelLookup.end()) {
+                    return it->second;
+                }
+                auto id = static_cast<TelemetryChannel>(m_ChannelNames.size());
+                const auto &stored = m_ChannelNames.emplace_back(name);
+                m_ChannelLookup.emplace(std::string_view(stored), id);
+                return id;
             }
 
-            void PushSample(const TelemetrySample &sample) override {
-                m_Buffer.push_back(sample);
+            std::string_view ChannelName(TelemetryChannel channel) const override {
+                std::lock_guard<std::mutex> lock(m_ChannelMutex);
+                if (channel >= m_ChannelNames.size()) {
+                    return {};
+                }
+                return m_ChannelNames[channel];
             }
 
-            std::vector<TelemetrySample> Drain() override {
-                auto data = m_Buffer;
-                m_Buffer.clear();
-                return data;
+            bool PushSample(const TelemetrySample &sample) noexcept override {
+                auto position = m_EnqueuePos.load(std::memory_order_relaxed);
+                while (true) {
+                    auto &cell = m_Cells[position & m_Mask];
+                    auto sequence = cell.sequence.load(std::memory_order_acquire);
+                    auto distance = static_cast<std::int64_t>(sequence - position);
+                    if (distance == 0) {
+                        if (m_EnqueuePos.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                            cell.sample = sample;
+                            cell.sequence.store(position + 1, std::memory_order_release);
+                            return true;
+                        }
+                    } else if (distance < 0) {
+                        m_Dropped.fetch_add(1, std::memory_order_relaxed);
+                        if (!m_Overrun.exchange(true, std::memory_order_relaxed)) {
+                            m_Overruns.fetch_add(1, std::memory_order_relaxed);
+                        }
+                        return false;
+                    } else {
+                        position = m_EnqueuePos.load(std::memory_order_relaxed);
+                    }
+                }
+            }
+
+            std::size_t Drain(std::span<TelemetrySample> out) noexcept override {
+                auto position = m_DequeuePos.load(std::memory_order_relaxed);
+                std::size_t count = 0;
+                while (count < out.size()) {
+                    auto &cell = m_Cells[position & m_Mask];
+                    auto sequence = cell.sequence.load(std::memory_order_acquire);
+                    if (sequence != position + 1) {
+                        break;
+                    }
+                    out[count++] = cell.sample;
+                    cell.sequence.store(position + m_Capacity, std::memory_order_release);
+                    ++position;
+                }
+                m_DequeuePos.store(position, std::memory_order_relaxed);
+                if (count > 0) {
+                    m_Overrun.store(false, std::memory_order_relaxed);
+                }
+                return count;
+            }
+
+            TelemetryStats Stats() const noexcept override {
+                TelemetryStats stats{};
+                stats.capacity = m_Capacity;
+                stats.pushed = m_EnqueuePos.load(std::memory_order_relaxed);
+                stats.drained = m_DequeuePos.load(std::memory_order_relaxed);
+                stats.dropped = m_Dropped.load(std::memory_order_relaxed);
+                stats.overruns = m_Overruns.load(std::memory_order_relaxed);
+                std::lock_guard<std::mutex> lock(m_ChannelMutex);
+                stats.channels = m_ChannelNames.size();
+                return stats;
             }
 
         private:
-            std::vector<TelemetrySample> m_Buffer;
+            static constexpr std::size_t kCacheLine = 64;
+            static constexpr std::uint64_t kMinCapacity = 64;
+
+            struct Cell {
+                std::atomic<std::uint64_t> sequence{0};
+                TelemetrySample sample{kInvalidTelemetryChannel, 0.0, 0};
+            };
+
+            static std::uint64_t RoundCapacity(std::size_t requested) noexcept {
+                std::uint64_t capacity = kMinCapacity;
+                while (capacity < requested && capacity < (1ull << 30)) {
+                    capacity <<= 1;
+                }
+                return capacity;
+            }
+
+            const std::uint64_t m_Capacity;
+            const std::uint64_t m_Mask;
+            std::unique_ptr<Cell[]> m_Cells;
+            alignas(kCacheLine) std::atomic<std::uint64_t> m_EnqueuePos{0};
+            alignas(kCacheLine) std::atomic<std::uint64_t> m_DequeuePos{0};
+            alignas(kCacheLine) std::atomic<std::uint64_t> m_Dropped{0};
+            std::atomic<std::uint64_t> m_Overruns{0};
+            std::atomic<bool> m_Overrun{false};
+            mutable std::mutex m_ChannelMutex;
+            std::deque<std::string> m_ChannelNames;
+            std::unordered_map<std::string_view, TelemetryChannel> m_ChannelLookup;
         };
 
         class CpuScheduler final : public Scheduler {
@@ -935,10 +1228,13 @@ namespace spectre::detail {
 
     SubsystemSuite CreateCpuSubsystemSuite(const RuntimeConfig &config) {
         SubsystemSuite suite;
+        suite.tracer = std::make_unique<TraceRecorder>();
+        suite.tracer->SetEnabled(config.telemetry.enableTracing);
         suite.parser = std::make_unique<CpuParser>();
         suite.bytecode = std::make_unique<CpuBytecodePipeline>();
         suite.execution = std::make_unique<BaselineExecutionEngine>();
-        suite.gc = std::make_unique<CpuGarbageCollector>();
+        suite.execution->SetProfiling(config.telemetry.enableOpcodeProfiling);
+        suite.gc = std::make_unique<CpuGarbageCollector>(suite.tracer.get());
         suite.memory = std::make_unique<CpuMemorySystem>(config.memory);
         suite.telemetry = std::make_unique<CpuTelemetryHub>(config.telemetry.historySize);
         suite.scheduler = std::make_unique<CpuScheduler>();
@@ -951,6 +1247,7 @@ namespace spectre::detail {
         suite.manifest.telemetryBackend = "cpu.telemetry.ring.v1";
         suite.manifest.schedulerBackend = "cpu.scheduler.frame.v1";
         suite.manifest.interopBackend = "cpu.interop.table.v1";
+        suite.manifest.traceBackend = "cpu.trace.scoped.v1";
         return suite;
     }
 }
\ No newline at end of file
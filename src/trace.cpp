@@ -0,0 +1,207 @@
+﻿#include "spectre/trace.h"
+
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#define SPECTRE_TRACE_TSC 1
+#endif
+
+namespace spectre::detail {
+    namespace {
+        std::atomic<std::uint64_t> g_NextRecorderId{1};
+
+        struct ThreadCache {
+            std::uint64_t recorderId;
+            void *buffer;
+        };
+
+        thread_local ThreadCache t_TraceCache{0, nullptr};
+
+        std::int64_t SteadyNanos() noexcept {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+        void AppendEscaped(std::string &out, std::string_view text) {
+            for (char ch: text) {
+                switch (ch) {
+                    case '"':
+                        out.append("\\\"");
+                        break;
+                    case '\\':
+                        out.append("\\\\");
+                        break;
+                    case '\n':
+                        out.append("\\n");
+                        break;
+                    default:
+                        if (static_cast<unsigned char>(ch) < 0x20) {
+                            char escaped[8];
+                            std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(ch));
+                            out.append(escaped);
+                        } else {
+                            out.push_back(ch);
+                        }
+                        break;
+                }
+            }
+        }
+    }
+
+    struct TraceRecorder::ThreadBuffer {
+        ThreadBuffer(std::thread::id owner, std::uint32_t index, std::uint32_t capacity)
+            : owner(owner), index(index), events(capacity) {
+        }
+
+        std::thread::id owner;
+        std::uint32_t index;
+        std::vector<TraceEvent> events;
+        std::atomic<std::uint32_t> count{0};
+        std::atomic<std::uint64_t> dropped{0};
+    };
+
+    TraceRecorder::TraceRecorder(std::uint32_t capacityPerThread)
+        : m_CapacityPerThread(capacityPerThread == 0 ? kDefaultCapacityPerThread : capacityPerThread),
+          m_Id(g_NextRecorderId.fetch_add(1, std::memory_order_relaxed)),
+          m_OriginTicks(Now()),
+          m_OriginNanos(SteadyNanos()),
+          m_Enabled(false) {
+    }
+
+    TraceRecorder::~TraceRecorder() = default;
+
+    void TraceRecorder::SetEnabled(bool enabled) noexcept {
+        m_Enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    std::uint64_t TraceRecorder::Now() noexcept {
+#if defined(SPECTRE_TRACE_TSC)
+        return __rdtsc();
+#else
+        return static_cast<std::uint64_t>(SteadyNanos());
+#endif
+    }
+
+    TraceRecorder::ThreadBuffer *TraceRecorder::AcquireBuffer() noexcept {
+        if (t_TraceCache.recorderId == m_Id) {
+            return static_cast<ThreadBuffer *>(t_TraceCache.buffer);
+        }
+        auto self = std::this_thread::get_id();
+        ThreadBuffer *buffer = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            for (auto &candidate: m_Buffers) {
+                if (candidate->owner == self) {
+                    buffer = candidate.get();
+                    break;
+                }
+            }
+            if (buffer == nullptr) {
+                try {
+                    auto index = static_cast<std::uint32_t>(m_Buffers.size());
+                    m_Buffers.push_back(std::make_unique<ThreadBuffer>(self, index, m_CapacityPerThread));
+                    buffer = m_Buffers.back().get();
+                } catch (...) {
+                    return nullptr;
+                }
+            }
+        }
+        t_TraceCache = {m_Id, buffer};
+        return buffer;
+    }
+
+    void TraceRecorder::Record(std::string_view name, const char *category, std::uint64_t beginTicks,
+                               std::uint64_t endTicks) noexcept {
+        auto *buffer = AcquireBuffer();
+        if (buffer == nullptr) {
+            return;
+        }
+        auto index = buffer->count.load(std::memory_order_relaxed);
+        if (index >= buffer->events.size()) {
+            buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        buffer->events[index] = {name, category, beginTicks, endTicks};
+        buffer->count.store(index + 1, std::memory_order_release);
+    }
+
+    TraceStats TraceRecorder::Stats() const {
+        TraceStats stats{0, 0, 0, m_CapacityPerThread};
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        stats.threads = m_Buffers.size();
+        for (const auto &buffer: m_Buffers) {
+            stats.events += buffer->count.load(std::memory_order_acquire);
+            stats.dropped += buffer->dropped.load(std::memory_order_relaxed);
+        }
+        return stats;
+    }
+
+    void TraceRecorder::Collect(std::vector<TraceEvent> &outEvents) const {
+        outEvents.clear();
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        for (const auto &buffer: m_Buffers) {
+            auto count = buffer->count.load(std::memory_order_acquire);
+            outEvents.insert(outEvents.end(), buffer->events.begin(), buffer->events.begin() + count);
+        }
+    }
+
+    void TraceRecorder::Clear() noexcept {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        for (auto &buffer: m_Buffers) {
+            buffer->count.store(0, std::memory_order_release);
+            buffer->dropped.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    double TraceRecorder::TicksPerMicrosecond() const noexcept {
+#if defined(SPECTRE_TRACE_TSC)
+        auto elapsedNanos = SteadyNanos() - m_OriginNanos;
+        auto elapsedTicks = Now() - m_OriginTicks;
+        if (elapsedNanos <= 0 || elapsedTicks == 0) {
+            return 1000.0;
+        }
+        return static_cast<double>(elapsedTicks) * 1000.0 / static_cast<double>(elapsedNanos);
+#else
+        return 1000.0;
+#endif
+    }
+
+    StatusCode TraceRecorder::ExportChromeTrace(std::string &outJson) const {
+        auto ticksPerMicro = TicksPerMicrosecond();
+        outJson.assign("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+        bool first = true;
+        char number[64];
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        for (const auto &buffer: m_Buffers) {
+            auto count = buffer->count.load(std::memory_order_acquire);
+            for (std::uint32_t i = 0; i < count; ++i) {
+                const auto &event = buffer->events[i];
+                auto begin = event.beginTicks >= m_OriginTicks ? event.beginTicks - m_OriginTicks : 0;
+                auto duration = event.endTicks >= event.beginTicks ? event.endTicks - event.beginTicks : 0;
+                if (!first) {
+                    outJson.push_back(',');
+                }
+                first = false;
+                outJson.append("{\"name\":\"");
+                AppendEscaped(outJson, event.name);
+                outJson.append("\",\"cat\":\"");
+                AppendEscaped(outJson, event.category != nullptr ? event.category : "spectre");
+                std::snprintf(number, sizeof(number), "\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f",
+                              static_cast<double>(begin) / ticksPerMicro,
+                              static_cast<double>(duration) / ticksPerMicro);
+                outJson.append(number);
+                std::snprintf(number, sizeof(number), ",\"pid\":1,\"tid\":%u}", buffer->index);
+                outJson.append(number);
+            }
+        }
+        outJson.append("]}");
+        return StatusCode::Ok;
+    }
+}
@@ -8,6 +8,11 @@
 #include <utility>
 #include <vector>
 #include <cmath>
+#include <cstring>
+#include <functional>
+#include <filesystem>
+#include <fstream>
+#include <thread>
 
 #include "spectre/config.h"
 #include "spectre/context.h"
@@ -15,6 +20,7 @@
 #include "spectre/status.h"
 #include "spectre/subsystems.h"
 #include "spectre/es2025/environment.h"
+#include "spectre/es2025/simd.h"
 #include "spectre/es2025/modules/global_module.h"
 #include "spectre/es2025/modules/object_module.h"
 #include "spectre/es2025/modules/proxy_module.h"
@@ -184,6 +190,17 @@ namespace {
         ok &= ExpectTrue(config.memory.arenaBytes > 0, "Arena budget positive");
         ok &= ExpectTrue(config.telemetry.historySize > 0, "Telemetry history positive");
         ok &= ExpectTrue(!config.enableGpuAcceleration, "GPU disabled by default");
+
+        auto runtime = SpectreRuntime::Create(config);
+        if (!ExpectTrue(runtime != nullptr, "Runtime created")) {
+            return false;
+        }
+        for (std::uint64_t frame = 1; frame <= 8; ++frame) {
+            runtime->Tick({0.016, frame});
+        }
+        auto stats = runtime->Subsystems().telemetry->Stats();
+        ok &= ExpectTrue(stats.capacity >= 8 * stats.channels, "Default history holds eight ticks of every channel");
+        ok &= ExpectTrue(stats.dropped == 0, "No samples dropped between drains");
         return ok;
     }
 
@@ -443,10 +460,14 @@ namespace {
         spectre::detail::MemoryBudgetPlan plan{runtime->Config().memory, 64};
         auto memoryStatus = suite.memory->ApplyPlan(plan);
         ok &= ExpectStatus(memoryStatus, StatusCode::Ok, "Memory plan status");
-        spectre::detail::TelemetrySample sample{"frame", 1.0, 1};
-        suite.telemetry->PushSample(sample);
-        auto drained = suite.telemetry->Drain();
-        ok &= ExpectTrue(drained.size() == 1, "Telemetry drain count");
+        auto frameChannel = suite.telemetry->RegisterChannel("frame");
+        ok &= ExpectTrue(suite.telemetry->RegisterChannel("frame") == frameChannel, "Telemetry channel interned");
+        ok &= ExpectTrue(suite.telemetry->ChannelName(frameChannel) == "frame", "Telemetry channel name");
+        spectre::detail::TelemetrySample sample{frameChannel, 1.0, 1};
+        ok &= ExpectTrue(suite.telemetry->PushSample(sample), "Telemetry push accepted");
+        std::array<spectre::detail::TelemetrySample, 4> drained{};
+        ok &= ExpectTrue(suite.telemetry->Drain(drained) == 1, "Telemetry drain count");
+        ok &= ExpectTrue(drained[0].channel == frameChannel && drained[0].value == 1.0, "Telemetry sample payload");
         spectre::detail::SchedulerFramePlan framePlan{1, 0.5, 0.0};
         auto scheduleStatus = suite.scheduler->PlanFrame(framePlan);
         ok &= ExpectStatus(scheduleStatus, StatusCode::Ok, "Scheduler plan status");
@@ -458,6 +479,78 @@ namespace {
         return ok;
     }
 
+    bool ValueIsCompactAndSharesStrings() {
+        using spectre::es2025::Value;
+        bool ok = ExpectTrue(sizeof(Value) == 16, "Value is 16 bytes");
+        auto shortText = Value::String("hp");
+        ok &= ExpectTrue(shortText.AsString() == "hp" && shortText.HeapBytes() == 0, "Short strings stay inline");
+        auto longText = Value::String("a string that is longer than the inline payload");
+        Value copy = longText;
+        ok &= ExpectTrue(copy.AsString().data() == longText.AsString().data(), "Copies share the string cell");
+        ok &= ExpectTrue(copy == longText && copy.Hash() == longText.Hash(), "Shared copies compare equal");
+        ok &= ExpectTrue(copy.HeapBytes() * 2 <= longText.AsString().size() + 64, "Shared cell bytes are split");
+        Value moved = std::move(copy);
+        ok &= ExpectTrue(copy.IsUndefined() && moved.AsString() == longText.AsString(), "Move transfers the cell");
+        longText.Reset();
+        ok &= ExpectTrue(moved.AsString() == "a string that is longer than the inline payload",
+                         "Cell survives while a copy is alive");
+        auto rebuilt = Value::String(std::string(moved.AsString()));
+        ok &= ExpectTrue(rebuilt == moved && rebuilt.AsString().data() != moved.AsString().data(),
+                         "Equal text in separate cells compares equal");
+
+        int marker = 0;
+        auto narrow = Value::External(&marker, 7u);
+        auto wide = Value::External(&marker, static_cast<std::uintptr_t>(0x123456789abcull));
+        ok &= ExpectTrue(narrow.AsExternalPointer() == &marker && narrow.ExternalInfo() == 7u, "Narrow external");
+        ok &= ExpectTrue(wide.AsExternalPointer() == &marker
+                         && wide.ExternalInfo() == static_cast<std::uintptr_t>(0x123456789abcull),
+                         "Wide external info preserved");
+        std::vector<Value> values(4, wide);
+        ok &= ExpectTrue(values[3] == wide, "Vector copies share boxed externals");
+        return ok;
+    }
+
+    bool TelemetryRingCountsDropsAndConcurrentProducers() {
+        auto config = MakeConfig(RuntimeMode::SingleThread);
+        config.telemetry.historySize = 64;
+        auto suite = spectre::detail::CreateCpuSubsystemSuite(config);
+        auto &telemetry = *suite.telemetry;
+        auto channel = telemetry.RegisterChannel("ring.test");
+        auto capacity = telemetry.Stats().capacity;
+        bool ok = ExpectTrue(capacity == 64, "Ring capacity rounded");
+        for (std::uint64_t i = 0; i < capacity + 10; ++i) {
+            telemetry.PushSample({channel, static_cast<double>(i), i});
+        }
+        auto stats = telemetry.Stats();
+        ok &= ExpectTrue(stats.pushed == capacity, "Ring accepts up to capacity");
+        ok &= ExpectTrue(stats.dropped == 10, "Ring counts dropped samples");
+        ok &= ExpectTrue(stats.overruns == 1, "Ring counts a single overrun episode");
+
+        std::vector<spectre::detail::TelemetrySample> samples(capacity);
+        ok &= ExpectTrue(telemetry.Drain(samples) == capacity, "Ring drains full buffer");
+        ok &= ExpectTrue(samples.front().value == 0.0 && samples.back().value == static_cast<double>(capacity - 1),
+                         "Ring preserves FIFO order");
+
+        constexpr int kProducers = 4;
+        constexpr int kPerProducer = 16;
+        std::vector<std::thread> producers;
+        for (int p = 0; p < kProducers; ++p) {
+            producers.emplace_back([&telemetry, channel, p]() {
+                for (int i = 0; i < kPerProducer; ++i) {
+                    telemetry.PushSample({channel, static_cast<double>(p), static_cast<std::uint64_t>(i)});
+                }
+            });
+        }
+        for (auto &producer: producers) {
+            producer.join();
+        }
+        ok &= ExpectTrue(telemetry.Drain(samples) == kProducers * kPerProducer, "Concurrent producers drained");
+        stats = telemetry.Stats();
+        ok &= ExpectTrue(stats.dropped == 10 && stats.overruns == 1, "No drops when ring has room");
+        ok &= ExpectTrue(stats.pushed == stats.drained, "Ring fully drained");
+        return ok;
+    }
+
     bool RegExpModuleCompilesAndMatches() {
         auto runtime = SpectreRuntime::Create(MakeConfig(RuntimeMode::SingleThread));
         auto &environment = runtime->EsEnvironment();
@@ -573,6 +666,177 @@ namespace {
         return ok;
     }
 
+    bool TypedArrayBulkKernelsMatchScalarReference() {
+        auto runtime = SpectreRuntime::Create(MakeConfig(RuntimeMode::SingleThread));
+        auto *module = dynamic_cast<spectre::es2025::TypedArrayModule *>(runtime->EsEnvironment().FindModule("TypedArray"));
+        bool ok = ExpectTrue(module != nullptr, "TypedArray module available");
+        if (!module) {
+            return false;
+        }
+        using Type = spectre::es2025::TypedArrayModule::ElementType;
+        using MapOp = spectre::es2025::TypedArrayModule::MapOp;
+        using ReduceOp = spectre::es2025::TypedArrayModule::ReduceOp;
+
+        constexpr std::size_t kCount = 1027;
+        std::vector<double> source(kCount);
+        std::uint32_t seed = 2024;
+        for (auto &value : source) {
+            seed = seed * 1664525u + 1013904223u;
+            value = static_cast<double>(seed % 4000) / 8.0 - 200.0;
+        }
+        source[5] = 2.5;
+        source[6] = 3.5;
+        source[7] = std::numeric_limits<double>::quiet_NaN();
+
+        spectre::es2025::TypedArrayModule::Handle floats = 0;
+        spectre::es2025::TypedArrayModule::Handle bytes = 0;
+        spectre::es2025::TypedArrayModule::Handle doubles = 0;
+        ok &= ExpectStatus(module->Create(Type::Float32, kCount, "bulk.f32", floats), StatusCode::Ok, "Create f32");
+        ok &= ExpectStatus(module->Create(Type::Uint8Clamped, kCount, "bulk.u8c", bytes), StatusCode::Ok, "Create u8c");
+        ok &= ExpectStatus(module->Create(Type::Float64, kCount, "bulk.f64", doubles), StatusCode::Ok, "Create f64");
+        ok &= ExpectStatus(module->SetFromSpan(floats, source), StatusCode::Ok, "SetFromSpan f32");
+        ok &= ExpectStatus(module->SetFromSpan(bytes, source), StatusCode::Ok, "SetFromSpan u8c");
+        ok &= ExpectStatus(module->SetFromSpan(doubles, std::span<const double>(source).first(2), kCount - 1),
+                           StatusCode::InvalidArgument, "SetFromSpan rejects overflow");
+
+        bool matches = true;
+        for (std::size_t i = 0; i < kCount; ++i) {
+            double f = 0.0;
+            double b = 0.0;
+            module->Get(floats, i, f);
+            module->Get(bytes, i, b);
+            auto expectedFloat = static_cast<double>(static_cast<float>(source[i]));
+            matches &= (std::isnan(expectedFloat) ? std::isnan(f) : f == expectedFloat);
+            auto clamped = std::isnan(source[i]) ? 0.0 : std::clamp(std::nearbyint(source[i]), 0.0, 255.0);
+            matches &= b == clamped;
+        }
+        ok &= ExpectTrue(matches, "Bulk stores match per-element conversion");
+        double value = 0.0;
+        module->Get(bytes, 5, value);
+        ok &= ExpectTrue(value == 2.0, "Clamped 2.5 rounds to even");
+        module->Get(bytes, 6, value);
+        ok &= ExpectTrue(value == 4.0, "Clamped 3.5 rounds to even");
+
+        ok &= ExpectStatus(module->SetFrom(doubles, floats), StatusCode::Ok, "Widen f32 into f64");
+        std::vector<double> widened;
+        module->ToVector(doubles, widened);
+        std::vector<double> narrowed;
+        module->ToVector(floats, narrowed);
+        ok &= ExpectTrue(widened.size() == kCount && widened[100] == narrowed[100] && std::isnan(widened[7]),
+                         "Cross-type copy preserves values");
+        ok &= ExpectStatus(module->Reduce(floats, ReduceOp::Max, value), StatusCode::Ok, "Max with NaN");
+        ok &= ExpectTrue(std::isnan(value), "NaN poisons Max");
+
+        ok &= ExpectStatus(module->Set(floats, 7, 1.0), StatusCode::Ok, "Clear NaN");
+        module->ToVector(floats, narrowed);
+        double sum = 0.0;
+        double dot = 0.0;
+        double minimum = std::numeric_limits<double>::infinity();
+        for (auto element : narrowed) {
+            sum += element;
+            dot += element * element;
+            minimum = std::min(minimum, element);
+        }
+        ok &= ExpectStatus(module->Reduce(floats, ReduceOp::Sum, value), StatusCode::Ok, "Sum f32");
+        ok &= ExpectTrue(std::fabs(value - sum) <= 1e-9 * std::fabs(sum) + 1e-9, "Sum matches reference");
+        ok &= ExpectStatus(module->Reduce(floats, ReduceOp::Min, value), StatusCode::Ok, "Min f32");
+        ok &= ExpectTrue(value == minimum, "Min matches reference");
+        ok &= ExpectStatus(module->Dot(floats, floats, value), StatusCode::Ok, "Dot f32");
+        ok &= ExpectTrue(std::fabs(value - dot) <= 1e-9 * dot, "Dot matches reference");
+        ok &= ExpectStatus(module->Dot(floats, bytes, value), StatusCode::InvalidArgument, "Dot needs one type");
+
+        ok &= ExpectStatus(module->Map(bytes, MapOp::Add, 100.0), StatusCode::Ok, "Map add clamps");
+        module->Get(bytes, 5, value);
+        ok &= ExpectTrue(value == 102.0, "Mapped element");
+        ok &= ExpectStatus(module->Reduce(bytes, ReduceOp::Max, value), StatusCode::Ok, "Max u8c");
+        ok &= ExpectTrue(value == 255.0, "Clamped add saturates");
+        ok &= ExpectStatus(module->Map(floats, MapOp::Abs), StatusCode::Ok, "Map abs");
+        ok &= ExpectStatus(module->Reduce(floats, ReduceOp::Min, value), StatusCode::Ok, "Min after abs");
+        ok &= ExpectTrue(value >= 0.0, "Abs leaves no negatives");
+
+        spectre::es2025::TypedArrayModule::Handle shorts = 0;
+        ok &= ExpectStatus(module->Create(Type::Int16, 8, "bulk.i16", shorts), StatusCode::Ok, "Create i16");
+        spectre::es2025::TypedArrayModule::Handle overlap = 0;
+        ok &= ExpectStatus(module->Subarray(shorts, 0, 4, "bulk.i16.head", overlap), StatusCode::Ok, "Head view");
+        for (std::size_t i = 0; i < 4; ++i) {
+            module->Set(shorts, i, static_cast<double>(i + 1));
+        }
+        ok &= ExpectStatus(module->SetFrom(shorts, overlap, 2), StatusCode::Ok, "Overlapping same-type copy");
+        module->Get(shorts, 5, value);
+        ok &= ExpectTrue(value == 4.0, "Overlapping copy reads original source");
+        spectre::es2025::TypedArrayModule::Handle big = 0;
+        ok &= ExpectStatus(module->Create(Type::BigInt64, 4, "bulk.big", big), StatusCode::Ok, "Create BigInt64");
+        ok &= ExpectStatus(module->SetFrom(big, overlap), StatusCode::InvalidArgument, "Number into BigInt rejected");
+
+        const auto &metrics = module->GetMetrics();
+        ok &= ExpectTrue(metrics.mapOps == 2 && metrics.reduceOps >= 5, "Bulk metrics recorded");
+        return ok;
+    }
+
+    bool TypedArrayBorrowPinsBackingBuffer() {
+        auto runtime = SpectreRuntime::Create(MakeConfig(RuntimeMode::SingleThread));
+        auto &environment = runtime->EsEnvironment();
+        auto *buffers = dynamic_cast<spectre::es2025::ArrayBufferModule *>(environment.FindModule("ArrayBuffer"));
+        auto *typed = dynamic_cast<spectre::es2025::TypedArrayModule *>(environment.FindModule("TypedArray"));
+        bool ok = ExpectTrue(buffers != nullptr && typed != nullptr, "Buffer modules available");
+        if (!buffers || !typed) {
+            return false;
+        }
+        using Type = spectre::es2025::TypedArrayModule::ElementType;
+        using Borrow = spectre::es2025::ArrayBufferModule::Borrow;
+
+        spectre::es2025::TypedArrayModule::Handle vertices = 0;
+        ok &= ExpectStatus(typed->Create(Type::Float32, 12, "vertices", vertices), StatusCode::Ok, "Create vertices");
+        typed->Fill(vertices, 1.5);
+        spectre::es2025::TypedArrayModule::Handle tail = 0;
+        ok &= ExpectStatus(typed->Subarray(vertices, 4, 12, "vertices.tail", tail), StatusCode::Ok, "Tail view");
+
+        Borrow borrow;
+        std::span<float> elements;
+        ok &= ExpectStatus(typed->BorrowElements(tail, borrow, elements), StatusCode::Ok, "Borrow tail as float");
+        ok &= ExpectTrue(elements.size() == 8 && elements[0] == 1.5f, "Borrow sees script data");
+        elements[0] = 9.0f;
+        double value = 0.0;
+        typed->Get(vertices, 4, value);
+        ok &= ExpectTrue(value == 9.0, "Host writes land in the view without a copy");
+
+        std::span<const std::int32_t> wrongType;
+        Borrow rejected;
+        ok &= ExpectStatus(typed->BorrowElements(tail, rejected, wrongType), StatusCode::InvalidArgument,
+                           "Storage type must match");
+        ok &= ExpectTrue(!rejected.Active() && wrongType.empty(), "Rejected borrow stays empty");
+
+        ok &= ExpectStatus(typed->Detach(vertices), StatusCode::InvalidArgument, "Pinned buffer refuses detach");
+        ok &= ExpectStatus(typed->Destroy(vertices), StatusCode::InvalidArgument, "Pinned owner refuses destroy");
+        ok &= ExpectTrue(typed->Length(vertices) == 12, "View intact while pinned");
+
+        Borrow moved = std::move(borrow);
+        ok &= ExpectTrue(!borrow.Active() && moved.Active() && moved.Size() == 32, "Borrow moves");
+        moved.Release();
+        ok &= ExpectStatus(typed->Detach(vertices), StatusCode::Ok, "Detach after release");
+        ok &= ExpectStatus(typed->BorrowBytes(vertices, borrow), StatusCode::InvalidArgument, "Detached view");
+
+        spectre::es2025::ArrayBufferModule::Handle raw = 0;
+        ok &= ExpectStatus(buffers->Create("raw", 64, raw), StatusCode::Ok, "Create raw buffer");
+        {
+            Borrow scoped;
+            ok &= ExpectStatus(buffers->BorrowBytes(raw, 8, 16, scoped), StatusCode::Ok, "Borrow byte range");
+            ok &= ExpectStatus(buffers->BorrowBytes(raw, 60, 8, borrow), StatusCode::InvalidArgument,
+                               "Out-of-range borrow");
+            ok &= ExpectTrue(buffers->PinCount(raw) == 1, "One pin held");
+            ok &= ExpectStatus(buffers->Resize(raw, 128), StatusCode::InvalidArgument, "Pinned buffer refuses resize");
+            ok &= ExpectTrue(scoped.MutableData() == scoped.Data(), "Writable borrow exposes mutable bytes");
+            scoped.MutableBytes()[0] = 0x7f;
+        }
+        ok &= ExpectTrue(buffers->PinCount(raw) == 0, "Scope exit unpins");
+        ok &= ExpectStatus(buffers->Resize(raw, 128), StatusCode::Ok, "Resize after unpin");
+        std::uint8_t byte = 0;
+        buffers->CopyOut(raw, 8, &byte, 1);
+        ok &= ExpectTrue(byte == 0x7f, "Borrowed write persisted");
+        ok &= ExpectTrue(buffers->GetMetrics().pinConflicts == 3, "Pin conflicts counted");
+        return ok;
+    }
+
     bool DataViewModuleHandlesEndianAccess() {
         auto runtime = SpectreRuntime::Create(MakeConfig(RuntimeMode::SingleThread));
         bool ok = ExpectTrue(runtime != nullptr, "Runtime created");
@@ -682,6 +946,92 @@ namespace {
         return ok;
     }
 
+    bool DataViewSchemaCodecsRoundTripRecords() {
+        auto runtime = SpectreRuntime::Create(MakeConfig(RuntimeMode::SingleThread));
+        auto &environment = runtime->EsEnvironment();
+        auto *buffers = dynamic_cast<spectre::es2025::ArrayBufferModule *>(environment.FindModule("ArrayBuffer"));
+        auto *views = dynamic_cast<spectre::es2025::DataViewModule *>(environment.FindModule("DataView"));
+        bool ok = ExpectTrue(buffers != nullptr && views != nullptr, "Buffer modules available");
+        if (!buffers || !views) {
+            return false;
+        }
+        using DataView = spectre::es2025::DataViewModule;
+        using FieldType = DataView::FieldType;
+
+        // Packet: u16 id (big endian), u8 flags, f32 x (little endian), f64 stamp (big endian).
+        const std::array<DataView::Field, 4> fields{{
+            {FieldType::Uint16, 0, false},
+            {FieldType::Uint8, 2, true},
+            {FieldType::Float32, 4, true},
+            {FieldType::Float64, 8, false},
+        }};
+        DataView::Schema schema;
+        ok &= ExpectStatus(DataView::BuildSchema(fields, 16, schema), StatusCode::Ok, "Build packet schema");
+        DataView::Schema invalid;
+        ok &= ExpectStatus(DataView::BuildSchema(fields, 12, invalid), StatusCode::InvalidArgument,
+                           "Fields must fit the stride");
+
+        constexpr std::size_t kRecords = 37;
+        spectre::es2025::ArrayBufferModule::Handle buffer = 0;
+        buffers->Create("packets", 8 + kRecords * 16, buffer);
+        DataView::Handle view = 0;
+        ok &= ExpectStatus(views->Create(buffer, 0, DataView::kUseRemaining, "packets.view", view), StatusCode::Ok,
+                           "Create view");
+
+        std::vector<std::uint16_t> ids(kRecords);
+        std::vector<std::uint8_t> flags(kRecords);
+        std::vector<float> xs(kRecords);
+        std::vector<double> stamps(kRecords);
+        for (std::size_t i = 0; i < kRecords; ++i) {
+            ids[i] = static_cast<std::uint16_t>(0x1234 + i * 257);
+            flags[i] = static_cast<std::uint8_t>(i * 3);
+            xs[i] = static_cast<float>(i) * 0.25f - 3.0f;
+            stamps[i] = 1000.0 + static_cast<double>(i) / 8.0;
+        }
+        const std::array<DataView::Column, 4> source{std::as_const(ids), std::as_const(flags), std::as_const(xs),
+                                                     std::as_const(stamps)};
+        ok &= ExpectStatus(views->EncodeRecords(view, schema, 8, kRecords, source), StatusCode::Ok, "Encode records");
+
+        std::uint16_t id = 0;
+        double stamp = 0.0;
+        float x = 0.0f;
+        views->GetUint16(view, 8 + 20 * 16, false, id);
+        views->GetFloat32(view, 8 + 20 * 16 + 4, true, x);
+        views->GetFloat64(view, 8 + 36 * 16 + 8, false, stamp);
+        ok &= ExpectTrue(id == ids[20] && x == xs[20] && stamp == stamps[36], "Encoded bytes match scalar reads");
+
+        std::vector<std::uint16_t> decodedIds(kRecords);
+        std::vector<double> decodedStamps(kRecords);
+        const std::array<DataView::Column, 4> targets{decodedIds, DataView::Column(), DataView::Column(), decodedStamps};
+        ok &= ExpectStatus(views->DecodeRecords(view, schema, 8, kRecords, targets), StatusCode::Ok, "Decode records");
+        ok &= ExpectTrue(decodedIds == ids && decodedStamps == stamps, "Round trip through SoA columns");
+
+        std::vector<std::int16_t> wrongType(kRecords);
+        const std::array<DataView::Column, 4> mismatched{wrongType, DataView::Column(), DataView::Column(),
+                                                         DataView::Column()};
+        ok &= ExpectStatus(views->DecodeRecords(view, schema, 8, kRecords, mismatched), StatusCode::InvalidArgument,
+                           "Column type must match field");
+        ok &= ExpectStatus(views->DecodeRecords(view, schema, 9, kRecords, targets), StatusCode::InvalidArgument,
+                           "Last record must fit the view");
+        ok &= ExpectStatus(views->DecodeRecords(view, schema, 8, kRecords, source), StatusCode::InvalidArgument,
+                           "Decode needs writable columns");
+
+        // A single-field schema whose stride equals its width takes the contiguous byte-swap path.
+        const std::array<DataView::Field, 1> word{{{FieldType::Uint32, 0, false}}};
+        DataView::Schema packed;
+        DataView::BuildSchema(word, 4, packed);
+        std::vector<std::uint32_t> words(kRecords);
+        const std::array<DataView::Column, 1> wordColumn{words};
+        ok &= ExpectStatus(views->DecodeRecords(view, packed, 8, kRecords, wordColumn), StatusCode::Ok,
+                           "Decode packed words");
+        std::uint32_t expected = 0;
+        views->GetUint32(view, 8 + 4 * 5, false, expected);
+        ok &= ExpectTrue(words[5] == expected, "Packed decode swaps like the scalar path");
+        ok &= ExpectTrue(views->GetMetrics().recordsDecoded == 2 * kRecords
+                         && views->GetMetrics().recordsEncoded == kRecords, "Record metrics");
+        return ok;
+    }
+
     bool TickAndReconfigureUpdatesState() {
         auto runtime = SpectreRuntime::Create(MakeConfig(RuntimeMode::SingleThread));
         bool ok = ExpectTrue(runtime != nullptr, "Runtime init");
@@ -701,6 +1051,250 @@ namespace {
         return ok;
     }
 
+    bool ScopedTracingExportsChromeTrace() {
+        auto config = MakeConfig(RuntimeMode::SingleThread);
+        auto runtime = SpectreRuntime::Create(config);
+        bool ok = ExpectTrue(runtime != nullptr, "Runtime init");
+        if (!ok) {
+            return false;
+        }
+        auto &tracer = *runtime->Subsystems().tracer;
+        ok &= ExpectStatus(runtime->CreateContext({"trace", 4096}, nullptr), StatusCode::Ok, "Create context");
+        runtime->Tick({0.016, 1});
+        ok &= ExpectTrue(tracer.Stats().events == 0, "Disabled tracer records nothing");
+
+        config.telemetry.enableTracing = true;
+        ok &= ExpectStatus(runtime->Reconfigure(config), StatusCode::Ok, "Enable tracing");
+        ok &= ExpectStatus(runtime->LoadScript("trace", {"entry", "return 1 + 2;"}).status, StatusCode::Ok,
+                           "Load traced script");
+        ok &= ExpectStatus(runtime->EvaluateSync("trace", "entry").status, StatusCode::Ok, "Evaluate traced");
+        runtime->Tick({0.016, 2});
+        spectre::detail::GcSnapshot snapshot{};
+        ok &= ExpectStatus(runtime->Subsystems().gc->Collect(snapshot), StatusCode::Ok, "GC slice");
+
+        std::vector<spectre::detail::TraceEvent> events;
+        tracer.Collect(events);
+        auto has = [&events](std::string_view name) {
+            return std::any_of(events.begin(), events.end(), [name](const auto &event) {
+                return event.name == name && event.endTicks >= event.beginTicks;
+            });
+        };
+        ok &= ExpectTrue(has("LoadScript") && has("script.parse") && has("script.compile") &&
+                         has("script.serialize"), "Load phases traced");
+        ok &= ExpectTrue(has("EvaluateSync") && has("Tick") && has("Map") && has("gc.slice"),
+                         "Evaluate, module tick and GC traced");
+
+        std::string json;
+        ok &= ExpectStatus(runtime->ExportTrace(json), StatusCode::Ok, "Export trace");
+        ok &= ExpectTrue(json.rfind("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", 0) == 0, "Chrome trace header");
+        ok &= ExpectTrue(json.find("\"name\":\"script.serialize\",\"cat\":\"compile\",\"ph\":\"X\"") !=
+                         std::string::npos, "Chrome trace complete event");
+        tracer.Clear();
+        ok &= ExpectTrue(tracer.Stats().events == 0, "Trace cleared");
+        return ok;
+    }
+
+    bool OpcodeProfilingRanksHotPrograms() {
+        auto config = MakeConfig(RuntimeMode::SingleThread);
+        auto runtime = SpectreRuntime::Create(config);
+        bool ok = ExpectTrue(runtime != nullptr, "Runtime init");
+        if (!ok) {
+            return false;
+        }
+        ok &= ExpectStatus(runtime->CreateContext({"profile", 4096}, nullptr), StatusCode::Ok, "Create context");
+        ok &= ExpectStatus(runtime->LoadScript("profile", {"hot", "return 1 + 2 * 3;"}).status, StatusCode::Ok,
+                           "Load hot script");
+        ok &= ExpectStatus(runtime->LoadScript("profile", {"cold", "return 'cold';"}).status, StatusCode::Ok,
+                           "Load cold script");
+        runtime->EvaluateSync("profile", "hot");
+        spectre::detail::ExecutionProfile profile{};
+        ok &= ExpectStatus(runtime->CollectExecutionProfile(profile, 4), StatusCode::Ok, "Collect profile");
+        ok &= ExpectTrue(profile.executions == 0 && profile.opcodes.empty(), "Profiling off by default");
+
+        config.telemetry.enableOpcodeProfiling = true;
+        ok &= ExpectStatus(runtime->Reconfigure(config), StatusCode::Ok, "Enable opcode profiling");
+        for (int i = 0; i < 8; ++i) {
+            ok &= ExpectTrue(runtime->EvaluateSync("profile", "hot").value == "7", "Hot result");
+        }
+        runtime->EvaluateSync("profile", "cold");
+        ok &= ExpectStatus(runtime->CollectExecutionProfile(profile, 1), StatusCode::Ok, "Collect profile");
+        ok &= ExpectTrue(profile.executions == 9, "Executions counted");
+        ok &= ExpectTrue(profile.hotPrograms.size() == 1 && profile.hotPrograms[0].name == "hot" &&
+                         profile.hotPrograms[0].calls == 8, "Hot program ranked first");
+        auto addIt = std::find_if(profile.opcodes.begin(), profile.opcodes.end(), [](const auto &entry) {
+            return entry.name == "Add";
+        });
+        ok &= ExpectTrue(addIt != profile.opcodes.end() && addIt->count == 8, "Add opcode counted");
+        std::uint64_t opcodeTotal = 0;
+        for (const auto &entry: profile.opcodes) {
+            opcodeTotal += entry.count;
+        }
+        ok &= ExpectTrue(opcodeTotal == profile.instructions, "Opcode counts sum to instructions");
+
+        ok &= ExpectStatus(runtime->CreateContext({"profile.other", 4096}, nullptr), StatusCode::Ok,
+                           "Create second context");
+        ok &= ExpectStatus(runtime->LoadScript("profile.other", {"hot", "return 'other';"}).status, StatusCode::Ok,
+                           "Load same-named script");
+        runtime->EvaluateSync("profile.other", "hot");
+        ok &= ExpectStatus(runtime->CollectExecutionProfile(profile, 4), StatusCode::Ok, "Collect profile");
+        auto hotEntries = std::count_if(profile.hotPrograms.begin(), profile.hotPrograms.end(), [](const auto &entry) {
+            return entry.name == "hot";
+        });
+        ok &= ExpectTrue(hotEntries == 2 && profile.hotPrograms[0].calls == 8,
+                         "Same-named programs are profiled apart");
+
+        auto &telemetry = *runtime->Subsystems().telemetry;
+        std::vector<spectre::detail::TelemetrySample> samples(telemetry.Stats().capacity);
+        telemetry.Drain(samples);
+        runtime->Tick({0.016, 1});
+        auto count = telemetry.Drain(samples);
+        bool sawAdd = false;
+        for (std::size_t i = 0; i < count; ++i) {
+            sawAdd |= telemetry.ChannelName(samples[i].channel) == "exec.op.Add.count" && samples[i].value == 8.0;
+        }
+        ok &= ExpectTrue(sawAdd, "Opcode counters published to telemetry");
+        return ok;
+    }
+
+    bool MemoryReportTracksModulesAndContexts() {
+        auto runtime = SpectreRuntime::Create(MakeConfig(RuntimeMode::SingleThread));
+        bool ok = ExpectTrue(runtime != nullptr, "Runtime init");
+        if (!ok) {
+            return false;
+        }
+        SpectreContext *context = nullptr;
+        ok &= ExpectStatus(runtime->CreateContext({"memory", 4096}, &context), StatusCode::Ok, "Create context");
+        auto load = runtime->LoadScript("memory", {"entry", "return 'accounting';"});
+        ok &= ExpectStatus(load.status, StatusCode::Ok, "Load script");
+        auto *mapModule = dynamic_cast<spectre::es2025::MapModule *>(runtime->EsEnvironment().FindModule("Map"));
+        ok &= ExpectTrue(mapModule != nullptr, "Map module available");
+        if (!ok) {
+            return false;
+        }
+        auto &telemetry = *runtime->Subsystems().telemetry;
+        std::vector<spectre::detail::TelemetrySample> samples(telemetry.Stats().capacity);
+        telemetry.Drain(samples);
+        runtime->Tick({0.016, 1});
+        spectre::es2025::MapModule::Handle map = 0;
+        ok &= ExpectStatus(mapModule->Create("memory.map", map), StatusCode::Ok, "Create map");
+        for (int i = 0; i < 256; ++i) {
+            ok &= ExpectStatus(mapModule->Set(map, spectre::es2025::Value::Int32(i),
+                                              spectre::es2025::Value::String(std::string(64, 'x'))),
+                               StatusCode::Ok, "Populate map");
+        }
+        runtime->Tick({0.016, 2});
+
+        auto report = runtime->MemoryReport();
+        ok &= ExpectTrue(report.frameIndex == 2, "Report frame index");
+        ok &= ExpectTrue(report.heapBudgetBytes == runtime->Config().memory.heapBytes, "Report carries budget");
+        auto moduleIt = std::find_if(report.modules.begin(), report.modules.end(), [](const auto &entry) {
+            return entry.name == "Map";
+        });
+        ok &= ExpectTrue(moduleIt != report.modules.end(), "Map module reported");
+        if (moduleIt != report.modules.end()) {
+            ok &= ExpectTrue(moduleIt->liveBytes >= 256 * 64, "Map live bytes include string payloads");
+            ok &= ExpectTrue(moduleIt->reservedBytes >= moduleIt->liveBytes, "Reserved covers live bytes");
+            ok &= ExpectTrue(moduleIt->peakLiveBytes >= moduleIt->liveBytes, "Peak covers live bytes");
+            ok &= ExpectTrue(moduleIt->allocationRate > 0.0, "Allocation rate sampled on tick");
+            ok &= ExpectTrue(moduleIt->slotCount == 1, "Slot table size reported");
+        }
+        auto contextIt = std::find_if(report.contexts.begin(), report.contexts.end(), [](const auto &entry) {
+            return entry.name == "memory";
+        });
+        ok &= ExpectTrue(contextIt != report.contexts.end(), "Context reported");
+        if (contextIt != report.contexts.end()) {
+            ok &= ExpectTrue(contextIt->scriptBytes > 0, "Context script bytes");
+            ok &= ExpectTrue(contextIt->programBytes > 0, "Context program bytes");
+            ok &= ExpectTrue(contextIt->liveBytes == contextIt->scriptBytes + contextIt->programBytes,
+                             "Context live bytes sum sections");
+        }
+        bool allMeasured = true;
+        for (const auto &entry: report.modules) {
+            allMeasured &= ExpectTrue(entry.measured, "Module memory measured");
+        }
+        ok &= allMeasured;
+        auto intlIt = std::find_if(report.modules.begin(), report.modules.end(), [](const auto &entry) {
+            return entry.name == "Intl";
+        });
+        ok &= ExpectTrue(intlIt != report.modules.end() && intlIt->liveBytes > 0 && intlIt->slotCount > 0,
+                         "Intl locale tables reported");
+        struct UnmeasuredModule final : spectre::es2025::Module {
+            std::string_view Name() const noexcept override {
+                return "Unmeasured";
+            }
+        } unmeasured;
+        spectre::es2025::ModuleMemoryUsage usage{};
+        usage.measured = true;
+        unmeasured.CollectMemory(usage);
+        spectre::es2025::ModuleMemoryCounters counters{};
+        counters.measured = true;
+        unmeasured.SampleMemory(counters);
+        ok &= ExpectTrue(!usage.measured && !counters.measured, "Default hooks flag memory as not measured");
+        if (moduleIt == report.modules.end()) {
+            return false;
+        }
+        auto mapLiveBytes = moduleIt->liveBytes;
+        ok &= ExpectTrue(report.liveBytes >= mapLiveBytes, "Totals aggregate modules");
+
+        auto sampleCount = telemetry.Drain(samples);
+        bool sawMap = false;
+        bool sawContext = false;
+        for (std::size_t i = 0; i < sampleCount; ++i) {
+            auto channel = telemetry.ChannelName(samples[i].channel);
+            sawMap |= channel == "memory.Map.live" && samples[i].frameIndex == 2;
+            sawContext |= channel == "memory.context.memory.live";
+        }
+        ok &= ExpectTrue(sawMap, "Map memory published to telemetry");
+        ok &= ExpectTrue(sawContext, "Context memory published to telemetry");
+
+        bool deleted = false;
+        for (int i = 0; i < 256; ++i) {
+            mapModule->Delete(map, spectre::es2025::Value::Int32(i), deleted);
+        }
+        auto drained = runtime->MemoryReport();
+        auto drainedIt = std::find_if(drained.modules.begin(), drained.modules.end(), [](const auto &entry) {
+            return entry.name == "Map";
+        });
+        ok &= ExpectTrue(drainedIt != drained.modules.end() && drainedIt->liveBytes < mapLiveBytes,
+                         "Live bytes drop after deletes");
+        ok &= ExpectTrue(drainedIt != drained.modules.end() && drainedIt->peakLiveBytes >= mapLiveBytes,
+                         "Peak retained after deletes");
+
+        // Churn that frees everything it allocates within a tick still reads as allocation.
+        for (int round = 0; round < 4; ++round) {
+            spectre::es2025::MapModule::Handle scratch = 0;
+            ok &= ExpectStatus(mapModule->Create("memory.churn", scratch), StatusCode::Ok, "Create churn map");
+            for (int i = 0; i < 64; ++i) {
+                mapModule->Set(scratch, spectre::es2025::Value::Int32(i), spectre::es2025::Value::Int32(i));
+            }
+            ok &= ExpectStatus(mapModule->Destroy(scratch), StatusCode::Ok, "Destroy churn map");
+        }
+        runtime->Tick({0.016, 3});
+        auto churned = runtime->MemoryReport();
+        auto churnedIt = std::find_if(churned.modules.begin(), churned.modules.end(), [](const auto &entry) {
+            return entry.name == "Map";
+        });
+        ok &= ExpectTrue(churnedIt != churned.modules.end() && churnedIt->allocationRate > 0.0,
+                         "Churn shows as allocation rate");
+        ok &= ExpectTrue(churnedIt != churned.modules.end() && churnedIt->allocatedBytes > 0,
+                         "Allocated bytes accumulate");
+
+        // Reloading a script replaces its bytes in the running total rather than adding to it.
+        for (std::uint64_t frame = 4; frame < 20; ++frame) {
+            ok &= ExpectStatus(runtime->LoadScript("memory", {"entry", "return 'accounting';"}).status,
+                               StatusCode::Ok, "Reload script");
+            runtime->Tick({0.016, frame});
+        }
+        auto reloaded = runtime->MemoryReport();
+        auto reloadedIt = std::find_if(reloaded.contexts.begin(), reloaded.contexts.end(), [](const auto &entry) {
+            return entry.name == "memory";
+        });
+        ok &= ExpectTrue(reloadedIt != reloaded.contexts.end()
+                         && reloadedIt->peakLiveBytes < 2 * reloadedIt->liveBytes,
+                         "Reloads do not inflate sampled context bytes");
+        return ok;
+    }
+
     bool GlobalModuleInitializesDefaultContext() {
         auto runtime = SpectreRuntime::Create(MakeConfig(RuntimeMode::SingleThread));
         bool ok = ExpectTrue(runtime != nullptr, "Runtime created");
@@ -1879,6 +2473,95 @@ namespace {
         return ok;
     }
 
+    bool ArrayModuleSpecializesElementKinds() {
+        auto runtime = SpectreRuntime::Create(MakeConfig(RuntimeMode::SingleThread));
+        bool ok = ExpectTrue(runtime != nullptr, "Runtime created");
+        if (!runtime) {
+            return false;
+        }
+        auto *arrayModule = dynamic_cast<spectre::es2025::ArrayModule *>(runtime->EsEnvironment().FindModule("Array"));
+        ok &= ExpectTrue(arrayModule != nullptr, "Array module available");
+        if (!arrayModule) {
+            return false;
+        }
+        using spectre::es2025::Value;
+        using Elements = spectre::es2025::ArrayModule::ElementKind;
+        spectre::es2025::ArrayModule::Handle ints = 0;
+        ok &= ExpectStatus(arrayModule->CreateDense("kinds.int", 0, ints), StatusCode::Ok, "Create int array");
+        std::vector<std::int32_t> intReference;
+        std::uint32_t seed = 12345;
+        for (int i = 0; i < 1000; ++i) {
+            seed = seed * 1664525u + 1013904223u;
+            auto value = static_cast<std::int32_t>(seed);
+            intReference.push_back(value);
+            arrayModule->Push(ints, Value::Int32(value));
+        }
+        ok &= ExpectTrue(arrayModule->ElementKindOf(ints) == Elements::PackedInt32, "Int pushes stay packed");
+        ok &= ExpectStatus(arrayModule->SortNumeric(ints, true), StatusCode::Ok, "Radix sort ints");
+        std::sort(intReference.begin(), intReference.end());
+        std::vector<Value> sorted;
+        ok &= ExpectStatus(arrayModule->Slice(ints, 0, 1000, sorted), StatusCode::Ok, "Slice sorted ints");
+        bool intsMatch = sorted.size() == intReference.size();
+        for (std::size_t i = 0; intsMatch && i < sorted.size(); ++i) {
+            intsMatch = sorted[i].IsInt32() && sorted[i].AsInt32() == intReference[i];
+        }
+        ok &= ExpectTrue(intsMatch, "Int sort matches reference");
+        std::size_t found = 0;
+        ok &= ExpectStatus(arrayModule->BinarySearch(ints, Value::Int32(intReference[417]), true, found),
+                           StatusCode::Ok, "Packed binary search");
+        ok &= ExpectTrue(found == 417, "Packed binary search index");
+
+        spectre::es2025::ArrayModule::Handle doubles = 0;
+        ok &= ExpectStatus(arrayModule->CreateDense("kinds.double", 0, doubles), StatusCode::Ok, "Create double array");
+        arrayModule->Push(doubles, Value::Int32(3));
+        arrayModule->PushNumber(doubles, std::nan(""));
+        std::vector<double> doubleReference{3.0};
+        for (int i = 0; i < 500; ++i) {
+            seed = seed * 1664525u + 1013904223u;
+            auto value = (static_cast<double>(seed) - 2147483648.0) / 1024.0;
+            doubleReference.push_back(value);
+            arrayModule->PushNumber(doubles, value);
+        }
+        arrayModule->PushNumber(doubles, -0.0);
+        doubleReference.push_back(-0.0);
+        ok &= ExpectTrue(arrayModule->ElementKindOf(doubles) == Elements::PackedDouble, "Double push generalizes");
+        Value first;
+        ok &= ExpectStatus(arrayModule->Get(doubles, 0, first), StatusCode::Ok, "Read converted int");
+        ok &= ExpectTrue(first.IsNumber() && first.AsNumber() == 3.0, "Packed doubles read back as numbers");
+        ok &= ExpectStatus(arrayModule->SortNumeric(doubles, false), StatusCode::Ok, "Radix sort doubles");
+        std::sort(doubleReference.begin(), doubleReference.end(), std::greater<double>());
+        ok &= ExpectStatus(arrayModule->Slice(doubles, 0, arrayModule->Length(doubles), sorted), StatusCode::Ok,
+                           "Slice sorted doubles");
+        bool doublesMatch = sorted.size() == doubleReference.size() + 1 && std::isnan(sorted.back().AsNumber());
+        for (std::size_t i = 0; doublesMatch && i < doubleReference.size(); ++i) {
+            doublesMatch = sorted[i].AsNumber() == doubleReference[i];
+        }
+        ok &= ExpectTrue(doublesMatch, "Descending double sort keeps NaN last");
+
+        arrayModule->PushString(doubles, "tail");
+        ok &= ExpectTrue(arrayModule->ElementKindOf(doubles) == Elements::Generic, "String push goes generic");
+        ok &= ExpectStatus(arrayModule->Fill(doubles, Value::Int32(9)), StatusCode::Ok, "Fill with int");
+        ok &= ExpectTrue(arrayModule->ElementKindOf(doubles) == Elements::PackedInt32, "Fill respecializes");
+        ok &= ExpectStatus(arrayModule->Get(doubles, 5, first), StatusCode::Ok, "Read filled value");
+        ok &= ExpectTrue(first.IsInt32() && first.AsInt32() == 9, "Filled value");
+        ok &= ExpectStatus(arrayModule->Clear(ints), StatusCode::Ok, "Clear ints");
+        arrayModule->PushString(ints, "x");
+        arrayModule->Clear(ints);
+        ok &= ExpectTrue(arrayModule->ElementKindOf(ints) == Elements::PackedInt32, "Clear resets kind");
+
+        spectre::es2025::ArrayModule::Handle sparse = 0;
+        ok &= ExpectStatus(arrayModule->CreateSparse("kinds.sparse", sparse), StatusCode::Ok, "Create sparse");
+        for (std::size_t i = 0; i < 8; ++i) {
+            arrayModule->Set(sparse, 7 - i, Value::Number(static_cast<double>(i) + 0.5));
+        }
+        ok &= ExpectStatus(arrayModule->SortNumeric(sparse, true), StatusCode::Ok, "Sort promotes sparse");
+        ok &= ExpectTrue(arrayModule->ElementKindOf(sparse) == Elements::PackedDouble, "Hole-free promotion is packed");
+        ok &= ExpectStatus(arrayModule->Get(sparse, 0, first), StatusCode::Ok, "Read promoted value");
+        ok &= ExpectTrue(first.AsNumber() == 0.5, "Promoted sort order");
+        ok &= ExpectTrue(arrayModule->GetMetrics().elementTransitions >= 3, "Transitions counted");
+        return ok;
+    }
+
     bool AtomicsModuleAllocatesAndAtomicallyUpdates() {
         auto runtime = SpectreRuntime::Create(MakeConfig(RuntimeMode::SingleThread));
         auto &environment = runtime->EsEnvironment();
@@ -1931,6 +2614,344 @@ namespace {
         return ok;
     }
 
+    bool AtomicsWaitBlocksUntilNotify() {
+        auto runtime = SpectreRuntime::Create(MakeConfig(RuntimeMode::SingleThread));
+        auto &environment = runtime->EsEnvironment();
+        auto *atomics = dynamic_cast<spectre::es2025::AtomicsModule *>(environment.FindModule("Atomics"));
+        bool ok = ExpectTrue(atomics != nullptr, "Atomics module available");
+        if (!atomics) {
+            return false;
+        }
+        using WaitResult = spectre::es2025::AtomicsModule::WaitResult;
+        spectre::es2025::AtomicsModule::Handle handle = 0;
+        atomics->CreateBuffer("test.wait", 4, handle);
+
+        auto result = WaitResult::Ok;
+        ok &= ExpectStatus(atomics->Wait(handle, 0, 7, result), StatusCode::Ok, "Wait on stale value");
+        ok &= ExpectTrue(result == WaitResult::NotEqual, "Mismatch returns immediately");
+        ok &= ExpectStatus(atomics->Wait(handle, 0, 0, result, 1.0), StatusCode::Ok, "Timed wait");
+        ok &= ExpectTrue(result == WaitResult::TimedOut, "Timed wait expires");
+        ok &= ExpectStatus(atomics->Wait(handle, 4, 0, result), StatusCode::InvalidArgument, "Lane out of range");
+
+        auto workerResult = WaitResult::TimedOut;
+        std::thread worker([&]() {
+            atomics->Wait(handle, 1, 0, workerResult);
+        });
+        while (atomics->WaitStatistics().activeWaiters == 0) {
+            std::this_thread::yield();
+        }
+        ok &= ExpectStatus(atomics->DestroyBuffer(handle), StatusCode::InvalidArgument, "Buffer with waiters stays");
+        std::size_t woken = 0;
+        ok &= ExpectStatus(atomics->Notify(handle, 0, woken), StatusCode::Ok, "Notify other lane");
+        ok &= ExpectTrue(woken == 0, "Waiters on other lanes stay blocked");
+        atomics->Store(handle, 1, 1);
+        ok &= ExpectStatus(atomics->Notify(handle, 1, woken), StatusCode::Ok, "Notify lane");
+        worker.join();
+        ok &= ExpectTrue(woken == 1 && workerResult == WaitResult::Ok, "Worker woken by notify");
+
+        auto stats = atomics->WaitStatistics();
+        ok &= ExpectTrue(stats.waits == 3 && stats.wakes == 1 && stats.timeouts == 1 && stats.mismatches == 1
+                         && stats.activeWaiters == 0, "Wait metrics");
+        ok &= ExpectStatus(atomics->DestroyBuffer(handle), StatusCode::Ok, "Destroy after waiters leave");
+        return ok;
+    }
+
+    bool AtomicsWaitSurvivesBufferChurn() {
+        auto runtime = SpectreRuntime::Create(MakeConfig(RuntimeMode::SingleThread));
+        auto &environment = runtime->EsEnvironment();
+        auto *atomics = dynamic_cast<spectre::es2025::AtomicsModule *>(environment.FindModule("Atomics"));
+        bool ok = ExpectTrue(atomics != nullptr, "Atomics module available");
+        if (!atomics) {
+            return false;
+        }
+        using Atomics = spectre::es2025::AtomicsModule;
+        using WaitResult = Atomics::WaitResult;
+
+        // Waiters and notifiers hammer a few short-lived buffers while this thread creates enough
+        // buffers to grow the slot table several times over and destroys the ones being waited on.
+        constexpr std::size_t kTargets = 4;
+        std::array<std::atomic<Atomics::Handle>, kTargets> targets{};
+        for (auto &target: targets) {
+            Atomics::Handle handle = 0;
+            ok &= ExpectStatus(atomics->CreateBuffer("churn.target", 8, handle), StatusCode::Ok, "Create target");
+            target.store(handle);
+        }
+        std::atomic<bool> stop{false};
+        std::atomic<std::uint64_t> waits{0};
+        std::atomic<std::uint64_t> unexpected{0};
+        std::vector<std::thread> workers;
+        for (std::size_t t = 0; t < 4; ++t) {
+            workers.emplace_back([&, t]() {
+                std::size_t round = 0;
+                while (!stop.load()) {
+                    auto handle = targets[(t + round++) % kTargets].load();
+                    if (t % 2 == 0) {
+                        auto result = WaitResult::Ok;
+                        auto status = atomics->Wait(handle, round % 8, 0, result, 0.2);
+                        if (status != StatusCode::Ok && status != StatusCode::NotFound) {
+                            unexpected.fetch_add(1);
+                        }
+                        waits.fetch_add(1);
+                    } else {
+                        std::size_t woken = 0;
+                        auto status = atomics->Notify(handle, round % 8, woken);
+                        if (status != StatusCode::Ok && status != StatusCode::NotFound) {
+                            unexpected.fetch_add(1);
+                        }
+                    }
+                }
+            });
+        }
+
+        std::vector<Atomics::Handle> filler;
+        for (std::size_t round = 0; round < 2000; ++round) {
+            Atomics::Handle handle = 0;
+            ok &= ExpectStatus(atomics->CreateBuffer("churn.filler", 4, handle), StatusCode::Ok, "Create filler");
+            filler.push_back(handle);
+            if (round % 50 == 49) {
+                auto &target = targets[(round / 50) % kTargets];
+                auto old = target.load();
+                Atomics::Handle replacement = 0;
+                ok &= ExpectStatus(atomics->CreateBuffer("churn.target", 8, replacement), StatusCode::Ok,
+                                   "Create replacement");
+                target.store(replacement);
+                // Parked waiters block the destroy until their short timeouts run out.
+                auto status = atomics->DestroyBuffer(old);
+                while (status == StatusCode::InvalidArgument) {
+                    std::this_thread::yield();
+                    status = atomics->DestroyBuffer(old);
+                }
+                ok &= ExpectStatus(status, StatusCode::Ok, "Destroy waited-on buffer");
+            }
+            if (filler.size() > 600) {
+                for (std::size_t i = 0; i < 300; ++i) {
+                    ok &= ExpectStatus(atomics->DestroyBuffer(filler[i]), StatusCode::Ok, "Destroy filler");
+                }
+                filler.erase(filler.begin(), filler.begin() + 300);
+            }
+        }
+        stop.store(true);
+        for (auto &target: targets) {
+            std::size_t woken = 0;
+            for (std::size_t lane = 0; lane < 8; ++lane) {
+                atomics->Notify(target.load(), lane, woken);
+            }
+        }
+        for (auto &worker: workers) {
+            worker.join();
+        }
+        ok &= ExpectTrue(unexpected.load() == 0, "Wait and Notify only fail with NotFound");
+        ok &= ExpectTrue(waits.load() > 0, "Waiters ran during churn");
+        ok &= ExpectTrue(atomics->WaitStatistics().activeWaiters == 0, "No waiter left parked");
+        return ok;
+    }
+
+    bool AtomicsPaddedLanesAndShardedCountersScale() {
+        using Atomics = spectre::es2025::AtomicsModule;
+        auto runtime = SpectreRuntime::Create(MakeConfig(RuntimeMode::SingleThread));
+        auto *atomics = dynamic_cast<Atomics *>(runtime->EsEnvironment().FindModule("Atomics"));
+        bool ok = ExpectTrue(atomics != nullptr, "Atomics module available");
+        if (!atomics) {
+            return false;
+        }
+        constexpr std::size_t kThreads = 4;
+        constexpr int kIterations = 10000;
+        Atomics::Handle padded = 0;
+        ok &= ExpectStatus(atomics->CreateBuffer("test.padded", kThreads, padded, Atomics::Layout::Padded),
+                           StatusCode::Ok, "Create padded buffer");
+        ok &= ExpectTrue(atomics->Capacity(padded) == kThreads, "Padded capacity counts lanes");
+        Atomics::Handle counter = 0;
+        ok &= ExpectStatus(atomics->CreateCounter("test.counter", counter, 3), StatusCode::Ok, "Create counter");
+        ok &= ExpectTrue(atomics->Capacity(counter) == 4, "Stripes round up to a power of two");
+        auto before = atomics->Metrics().rmwOps;
+
+        std::vector<std::thread> workers;
+        for (std::size_t t = 0; t < kThreads; ++t) {
+            workers.emplace_back([&, t]() {
+                std::int64_t previous = 0;
+                for (int i = 0; i < kIterations; ++i) {
+                    atomics->Add(padded, t, 1, previous);
+                    atomics->CounterAdd(counter, 2);
+                }
+            });
+        }
+        for (auto &worker: workers) {
+            worker.join();
+        }
+        std::vector<std::int64_t> lanes;
+        ok &= ExpectStatus(atomics->Snapshot(padded, lanes), StatusCode::Ok, "Snapshot padded lanes");
+        ok &= ExpectTrue(lanes.size() == kThreads
+                         && std::all_of(lanes.begin(), lanes.end(), [](std::int64_t v) { return v == kIterations; }),
+                         "Each padded lane holds its own thread's adds");
+        std::int64_t total = 0;
+        ok &= ExpectStatus(atomics->CounterRead(counter, total), StatusCode::Ok, "Read counter");
+        ok &= ExpectTrue(total == 2 * kThreads * kIterations, "Counter sums every stripe");
+        ok &= ExpectTrue(atomics->Metrics().rmwOps - before == 2 * kThreads * kIterations,
+                         "Per-thread metrics aggregate on read");
+        ok &= ExpectStatus(atomics->CounterAdd(padded, 1), StatusCode::InvalidArgument, "Plain buffers are not counters");
+        ok &= ExpectStatus(atomics->CreateCounter("test.too_wide", counter, 4096), StatusCode::InvalidArgument,
+                           "Stripe count is bounded");
+        return ok;
+    }
+
+    bool SharedArrayBufferMemoryIsStableAcrossRuntimes() {
+        using SharedModule = spectre::es2025::SharedArrayBufferModule;
+        auto producer = SpectreRuntime::Create(MakeConfig(RuntimeMode::SingleThread));
+        auto consumer = SpectreRuntime::Create(MakeConfig(RuntimeMode::SingleThread));
+        auto *source = dynamic_cast<SharedModule *>(producer->EsEnvironment().FindModule("SharedArrayBuffer"));
+        auto *target = dynamic_cast<SharedModule *>(consumer->EsEnvironment().FindModule("SharedArrayBuffer"));
+        bool ok = ExpectTrue(source != nullptr && target != nullptr, "SharedArrayBuffer modules available");
+        if (!source || !target) {
+            return false;
+        }
+        SharedModule::Handle handle = 0;
+        ok &= ExpectStatus(source->CreateResizable("shared.stable", 64, 1 << 20, handle), StatusCode::Ok,
+                           "Create growable buffer");
+        SharedModule::MemoryRef memory;
+        ok &= ExpectStatus(source->Export(handle, memory), StatusCode::Ok, "Export memory");
+        if (!memory) {
+            return false;
+        }
+        auto *base = memory->Data();
+        std::array<std::uint8_t, 4> pattern{1, 2, 3, 4};
+        ok &= ExpectStatus(source->CopyIn(handle, 60, pattern.data(), pattern.size()), StatusCode::Ok, "Write tail");
+        ok &= ExpectStatus(source->Grow(handle, 256 * 1024, true), StatusCode::Ok, "Grow in place");
+        ok &= ExpectTrue(memory->Data() == base && memory->ByteLength() == 256 * 1024, "Growth keeps the address");
+        ok &= ExpectTrue(base[61] == 2 && base[256 * 1024 - 1] == 0, "Grown memory keeps data and zeroes the rest");
+        ok &= ExpectStatus(source->Grow(handle, 128, true), StatusCode::InvalidArgument, "Shared memory never shrinks");
+
+        SharedModule::Handle imported = 0;
+        ok &= ExpectStatus(target->Import(memory, "shared.imported", imported), StatusCode::Ok, "Import memory");
+        ok &= ExpectTrue(target->ByteLength(imported) == 256 * 1024, "Import sees grown length");
+        std::int32_t previous = 0;
+        ok &= ExpectStatus(source->AtomicAdd<std::int32_t>(handle, 2, 1, previous), StatusCode::InvalidArgument,
+                           "Misaligned lane rejected");
+
+        constexpr int kIterations = 20000;
+        std::thread producerThread([&]() {
+            std::int32_t ignored = 0;
+            for (int i = 0; i < kIterations; ++i) {
+                source->AtomicAdd<std::int32_t>(handle, 128, 1, ignored);
+            }
+        });
+        std::thread consumerThread([&]() {
+            std::int32_t ignored = 0;
+            for (int i = 0; i < kIterations; ++i) {
+                target->AtomicAdd<std::int32_t>(imported, 128, 1, ignored);
+            }
+        });
+        producerThread.join();
+        consumerThread.join();
+        std::int32_t total = 0;
+        ok &= ExpectStatus(target->AtomicLoad<std::int32_t>(imported, 128, total), StatusCode::Ok, "Load counter");
+        ok &= ExpectTrue(total == 2 * kIterations, "Atomic adds from both runtimes all land");
+        std::int64_t swapped = 0;
+        ok &= ExpectStatus(target->AtomicCompareExchange<std::int64_t>(imported, 256, 0, 42, swapped), StatusCode::Ok,
+                           "Compare exchange");
+        std::int64_t observed = 0;
+        source->AtomicLoad<std::int64_t>(handle, 256, observed);
+        ok &= ExpectTrue(swapped == 0 && observed == 42, "Exchange visible to the other runtime");
+
+        ok &= ExpectStatus(source->Destroy(handle), StatusCode::Ok, "Destroy in producer");
+        memory.reset();
+        std::array<std::uint8_t, 4> readBack{};
+        ok &= ExpectStatus(target->CopyOut(imported, 60, readBack.data(), readBack.size()), StatusCode::Ok,
+                           "Consumer still reads after producer releases");
+        ok &= ExpectTrue(readBack == pattern, "Memory outlives the producer handle");
+        auto metrics = target->GetMetrics();
+        ok &= ExpectTrue(metrics.imports == 1 && source->GetMetrics().exports == 1, "Import and export counted");
+        ok &= ExpectStatus(target->Destroy(imported), StatusCode::Ok, "Destroy in consumer");
+        return ok;
+    }
+
+    bool SharedArrayBufferChannelPassesMessagesBetweenRuntimes() {
+        using SharedModule = spectre::es2025::SharedArrayBufferModule;
+        using Bytes = std::span<const std::uint8_t>;
+        std::array<std::unique_ptr<SpectreRuntime>, 3> runtimes;
+        std::array<SharedModule *, 3> modules{};
+        bool ok = true;
+        for (std::size_t i = 0; i < runtimes.size(); ++i) {
+            runtimes[i] = SpectreRuntime::Create(MakeConfig(RuntimeMode::SingleThread));
+            modules[i] = dynamic_cast<SharedModule *>(runtimes[i]->EsEnvironment().FindModule("SharedArrayBuffer"));
+            ok &= ExpectTrue(modules[i] != nullptr, "SharedArrayBuffer module available");
+        }
+        if (!ok) {
+            return false;
+        }
+        std::array<SharedModule::Handle, 3> handles{};
+        ok &= ExpectStatus(modules[0]->CreateChannel("channel.test", 16, 3, handles[0]), StatusCode::Ok,
+                           "Create channel");
+        SharedModule::MemoryRef memory;
+        modules[0]->Export(handles[0], memory);
+        ok &= ExpectStatus(modules[1]->Import(memory, "channel.consumer", handles[1]), StatusCode::Ok, "Import");
+        ok &= ExpectStatus(modules[2]->Import(memory, "channel.producer", handles[2]), StatusCode::Ok, "Import");
+
+        std::array<std::uint8_t, 4> first{1, 2, 3, 4};
+        std::array<std::uint8_t, 17> oversized{};
+        std::array<Bytes, 5> batch{Bytes(first), Bytes(first).first(1), Bytes(), Bytes(first), Bytes(first)};
+        std::size_t sent = 0;
+        std::array<Bytes, 1> tooLarge{Bytes(oversized)};
+        ok &= ExpectStatus(modules[0]->ChannelSend(handles[0], tooLarge, sent), StatusCode::InvalidArgument,
+                           "Oversized message rejected");
+        ok &= ExpectStatus(modules[0]->ChannelSend(handles[0], batch, sent), StatusCode::Ok, "Send batch");
+        ok &= ExpectTrue(sent == 4 && modules[1]->ChannelPending(handles[1]) == 4, "Full ring pushes back");
+        std::vector<SharedModule::ChannelMessage> received;
+        ok &= ExpectStatus(modules[1]->ChannelReceive(handles[1], received, 3), StatusCode::Ok, "Receive batch");
+        ok &= ExpectTrue(received.size() == 3 && received[0].bytes.size() == 4 && received[0].bytes[3] == 4
+                         && received[1].bytes.size() == 1 && received[2].bytes.empty()
+                         && received[2].sequence == 2, "Messages arrive in order with stamps");
+        ok &= ExpectTrue(std::all_of(received.begin(), received.end(), [](const auto &message) {
+            return message.bytes.capacity() >= 16;
+        }), "Receive reserves a full slot payload before claiming");
+        ok &= ExpectStatus(modules[1]->ChannelReceive(handles[1], received, 8), StatusCode::Ok, "Drain");
+        ok &= ExpectTrue(received.size() == 1 && received[0].sequence == 3, "Drain returns the rest");
+        SharedModule::Handle plain = 0;
+        modules[0]->Create("channel.plain", 512, plain);
+        ok &= ExpectStatus(modules[0]->ChannelSend(plain, batch, sent), StatusCode::InvalidArgument,
+                           "Plain buffers are not channels");
+        ok &= ExpectStatus(modules[0]->ChannelReceiveWait(plain, received, 1), StatusCode::InvalidArgument,
+                           "Plain buffers cannot be waited on");
+
+        constexpr std::uint32_t kPerProducer = 20000;
+        auto produce = [&](std::size_t index, std::uint8_t producerId) {
+            for (std::uint32_t counter = 0; counter < kPerProducer;) {
+                std::array<std::array<std::uint8_t, 5>, 8> payloads{};
+                std::array<Bytes, 8> spans{};
+                std::size_t count = std::min<std::uint32_t>(8, kPerProducer - counter);
+                for (std::size_t i = 0; i < count; ++i) {
+                    auto value = counter + static_cast<std::uint32_t>(i);
+                    payloads[i][0] = producerId;
+                    std::memcpy(payloads[i].data() + 1, &value, sizeof(value));
+                    spans[i] = Bytes(payloads[i]);
+                }
+                modules[index]->ChannelSendWait(handles[index], std::span<const Bytes>(spans.data(), count));
+                counter += static_cast<std::uint32_t>(count);
+            }
+        };
+        std::thread producerA(produce, 0, 0);
+        std::thread producerB(produce, 2, 1);
+        std::array<std::uint32_t, 2> expected{};
+        bool ordered = true;
+        std::vector<SharedModule::ChannelMessage> inbox;
+        std::uint64_t lastSequence = 3;
+        while (expected[0] + expected[1] < 2 * kPerProducer) {
+            modules[1]->ChannelReceiveWait(handles[1], inbox, 16);
+            for (const auto &message: inbox) {
+                std::uint32_t value = 0;
+                std::memcpy(&value, message.bytes.data() + 1, sizeof(value));
+                ordered &= message.sequence == lastSequence + 1 && value == expected[message.bytes[0]];
+                lastSequence = message.sequence;
+                expected[message.bytes[0]] += 1;
+            }
+        }
+        producerA.join();
+        producerB.join();
+        ok &= ExpectTrue(ordered, "Each producer's messages arrive once, in order, with gap-free sequences");
+        ok &= ExpectTrue(modules[1]->ChannelPending(handles[1]) == 0, "Channel drained");
+        ok &= ExpectTrue(modules[1]->GetMetrics().messagesReceived == 2 * kPerProducer + 4, "Receive metrics");
+        return ok;
+    }
+
 
     bool ArrayBufferModuleAllocatesAndPools() {
         auto runtime = SpectreRuntime::Create(MakeConfig(RuntimeMode::SingleThread));
@@ -2089,6 +3110,197 @@ namespace {
         return ok;
     }
 
+    bool ArrayBufferPoolIsBoundedAndDecays() {
+        auto config = MakeConfig(RuntimeMode::SingleThread);
+        config.memory.arenaBytes = 4096;
+        auto runtime = SpectreRuntime::Create(config);
+        auto *bufferModule = dynamic_cast<spectre::es2025::ArrayBufferModule *>(
+            runtime->EsEnvironment().FindModule("ArrayBuffer"));
+        bool ok = ExpectTrue(bufferModule != nullptr, "ArrayBuffer module available for pool test");
+        if (!bufferModule) {
+            return false;
+        }
+        ok &= ExpectTrue(bufferModule->PoolLimit() == 4096, "Pool limit follows arena budget");
+        std::vector<spectre::es2025::ArrayBufferModule::Handle> burst(8, 0);
+        for (auto &handle: burst) {
+            ok &= ExpectStatus(bufferModule->Create("burst", 1000, handle), StatusCode::Ok, "Burst allocation");
+        }
+        for (auto handle: burst) {
+            bufferModule->Destroy(handle);
+        }
+        const auto &metrics = bufferModule->GetMetrics();
+        ok &= ExpectTrue(metrics.pooledBytes == 4096, "Pool capped at the arena budget");
+        ok &= ExpectTrue(metrics.poolEvictions == 4, "Overflowing returns are released");
+
+        const spectre::es2025::ArrayBufferModule::PoolBucketStats *bucket = nullptr;
+        for (const auto &stats: bufferModule->PoolStats()) {
+            if (stats.blockBytes == 1024) {
+                bucket = &stats;
+            }
+        }
+        ok &= ExpectTrue(bucket != nullptr, "1 KiB bucket reported");
+        if (!bucket) {
+            return false;
+        }
+        ok &= ExpectTrue(bucket->misses == 8 && bucket->hits == 0, "Burst misses counted");
+        ok &= ExpectTrue(bucket->retainedBlocks == 4 && bucket->retainedBytes == 4096, "Retained blocks counted");
+
+        spectre::es2025::ArrayBufferModule::Handle reused = 0;
+        ok &= ExpectStatus(bufferModule->Create("reuse", 1024, reused), StatusCode::Ok, "Reuse pooled block");
+        ok &= ExpectTrue(bucket->hits == 1 && bucket->retainedBlocks == 3, "Hit drawn from the pool");
+
+        runtime->Tick({0.016, 60});
+        ok &= ExpectTrue(metrics.pooledBytes == 3072, "Recently returned blocks survive a tick");
+        runtime->Tick({0.016, 500});
+        ok &= ExpectTrue(metrics.pooledBytes == 0 && metrics.poolDecays == 3, "Idle blocks decay back to the OS");
+        ok &= ExpectTrue(bucket->decays == 3 && bucket->retainedBytes == 0, "Bucket decay counted");
+
+        bufferModule->Destroy(reused);
+        ok &= ExpectTrue(metrics.pooledBytes == 1024, "Returned block pooled again");
+        bufferModule->TrimPool(0);
+        ok &= ExpectTrue(metrics.pooledBytes == 0, "TrimPool releases everything");
+        return ok;
+    }
+
+    bool ArrayBufferCreateMappedSharesFilePages() {
+        auto runtime = SpectreRuntime::Create(MakeConfig(RuntimeMode::SingleThread));
+        auto &environment = runtime->EsEnvironment();
+        auto *buffers = dynamic_cast<spectre::es2025::ArrayBufferModule *>(environment.FindModule("ArrayBuffer"));
+        auto *typed = dynamic_cast<spectre::es2025::TypedArrayModule *>(environment.FindModule("TypedArray"));
+        auto *views = dynamic_cast<spectre::es2025::DataViewModule *>(environment.FindModule("DataView"));
+        bool ok = ExpectTrue(buffers != nullptr && typed != nullptr && views != nullptr, "Buffer modules available");
+        if (!buffers || !typed || !views) {
+            return false;
+        }
+        using Type = spectre::es2025::TypedArrayModule::ElementType;
+        using Borrow = spectre::es2025::ArrayBufferModule::Borrow;
+
+        auto path = (std::filesystem::temp_directory_path() / "spectre_mapped_asset.bin").string();
+        std::vector<float> samples{1.0f, 2.5f, -4.0f, 8.0f};
+        {
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+            file.write(reinterpret_cast<const char *>(samples.data()),
+                       static_cast<std::streamsize>(samples.size() * sizeof(float)));
+        }
+
+        spectre::es2025::ArrayBufferModule::Handle asset = 0;
+        ok &= ExpectStatus(buffers->CreateMapped(path, true, "", asset), StatusCode::Ok, "Map asset read-only");
+        ok &= ExpectTrue(buffers->ByteLength(asset) == 16 && buffers->ReadOnly(asset), "Mapped length and mode");
+        ok &= ExpectTrue(buffers->GetMetrics().fileMappedBuffers == 1 && buffers->GetMetrics().fileMappedBytes == 16,
+                         "File mapping tracked");
+        ok &= ExpectTrue(buffers->GetMetrics().bytesInUse == 0, "File pages stay off the heap budget");
+
+        spectre::es2025::TypedArrayModule::Handle floats = 0;
+        ok &= ExpectStatus(typed->FromBuffer(asset, Type::Float32, 0, 4, "asset.floats", floats), StatusCode::Ok,
+                           "Typed view over mapping");
+        double value = 0.0;
+        typed->Get(floats, 1, value);
+        ok &= ExpectTrue(value == 2.5, "Typed view reads file bytes");
+        ok &= ExpectStatus(typed->Set(floats, 1, 3.0), StatusCode::InvalidArgument, "Typed write rejected");
+        spectre::es2025::DataViewModule::Handle view = 0;
+        ok &= ExpectStatus(views->Create(asset, 8, 8, "asset.view", view), StatusCode::Ok, "DataView over mapping");
+        float scalar = 0.0f;
+        views->GetFloat32(view, 0, true, scalar);
+        ok &= ExpectTrue(scalar == -4.0f, "DataView reads file bytes");
+        ok &= ExpectStatus(views->SetUint8(view, 0, 1), StatusCode::InvalidArgument, "DataView write rejected");
+        ok &= ExpectStatus(buffers->Fill(asset, 0), StatusCode::InvalidArgument, "Fill rejected");
+        ok &= ExpectStatus(buffers->Resize(asset, 32), StatusCode::InvalidArgument, "Resize rejected");
+
+        {
+            Borrow borrow;
+            std::span<const float> constElements;
+            ok &= ExpectStatus(typed->BorrowElements(floats, borrow, constElements), StatusCode::Ok, "Const borrow");
+            ok &= ExpectTrue(borrow.ReadOnly() && constElements.size() == 4 && constElements[3] == 8.0f,
+                             "Borrow reads mapped pages");
+            ok &= ExpectTrue(borrow.MutableData() == nullptr && borrow.MutableBytes().empty() &&
+                             borrow.As<float>().empty(), "Read-only borrow hands out no mutable bytes");
+            Borrow writable;
+            std::span<float> elements;
+            ok &= ExpectStatus(typed->BorrowElements(floats, writable, elements), StatusCode::InvalidArgument,
+                               "Mutable borrow of read-only buffer rejected");
+        }
+
+        spectre::es2025::ArrayBufferModule::Handle scratch = 0;
+        ok &= ExpectStatus(buffers->CreateMapped(path, false, "scratch", scratch), StatusCode::Ok, "Map copy-on-write");
+        std::uint8_t zeros[4]{};
+        ok &= ExpectStatus(buffers->CopyIn(scratch, 0, zeros, 4), StatusCode::Ok, "Private mapping is writable");
+        std::uint8_t shared[4]{};
+        buffers->CopyOut(asset, 0, shared, 4);
+        ok &= ExpectTrue(std::memcmp(shared, samples.data(), 4) == 0, "Private writes never reach the file");
+
+        ok &= ExpectStatus(buffers->Destroy(scratch), StatusCode::Ok, "Destroy private mapping");
+        ok &= ExpectStatus(buffers->Detach(asset), StatusCode::Ok, "Detach unmaps");
+        ok &= ExpectTrue(buffers->GetMetrics().fileMappedBuffers == 0 && buffers->GetMetrics().fileMappedBytes == 0,
+                         "Mappings released");
+        ok &= ExpectStatus(typed->Get(floats, 0, value), StatusCode::InvalidArgument, "View sees detachment");
+        spectre::es2025::ArrayBufferModule::Handle missing = 0;
+        ok &= ExpectStatus(buffers->CreateMapped(path + ".missing", true, "", missing), StatusCode::NotFound,
+                           "Missing file");
+        std::filesystem::remove(path);
+        return ok;
+    }
+
+    bool ArrayBufferModuleMapsLargeBuffers() {
+        auto runtime = SpectreRuntime::Create(MakeConfig(RuntimeMode::SingleThread));
+        auto *bufferModule = dynamic_cast<spectre::es2025::ArrayBufferModule *>(
+            runtime->EsEnvironment().FindModule("ArrayBuffer"));
+        bool ok = ExpectTrue(bufferModule != nullptr, "ArrayBuffer module available for mapping test");
+        if (!bufferModule) {
+            return false;
+        }
+        constexpr std::size_t kMiB = 1024 * 1024;
+        const auto &metrics = bufferModule->GetMetrics();
+        spectre::es2025::ArrayBufferModule::Handle large = 0;
+        ok &= ExpectStatus(bufferModule->Create("sim.large", 3 * kMiB, large), StatusCode::Ok, "Create 3 MiB buffer");
+        std::uint8_t probe = 0xff;
+        bufferModule->CopyOut(large, 3 * kMiB - 1, &probe, 1);
+        ok &= ExpectTrue(probe == 0, "Fresh large buffer reads zero");
+        const std::uint8_t head = 0x11;
+        const std::uint8_t tail = 0x22;
+        bufferModule->CopyIn(large, 0, &head, 1);
+        bufferModule->CopyIn(large, 3 * kMiB - 1, &tail, 1);
+
+        ok &= ExpectStatus(bufferModule->Resize(large, 40 * kMiB), StatusCode::Ok, "Grow to 40 MiB");
+        std::uint8_t check[4] = {};
+        bufferModule->CopyOut(large, 0, &check[0], 1);
+        bufferModule->CopyOut(large, 3 * kMiB - 1, &check[1], 1);
+        bufferModule->CopyOut(large, 3 * kMiB, &check[2], 1);
+        bufferModule->CopyOut(large, 40 * kMiB - 1, &check[3], 1);
+        ok &= ExpectTrue(check[0] == head && check[1] == tail && check[2] == 0 && check[3] == 0,
+                         "Growth preserves data and zeroes the tail");
+
+        const std::uint8_t dirty = 0x5a;
+        bufferModule->CopyIn(large, 5 * kMiB, &dirty, 1);
+        ok &= ExpectStatus(bufferModule->Resize(large, 5 * kMiB), StatusCode::Ok, "Shrink to 5 MiB");
+        ok &= ExpectStatus(bufferModule->Resize(large, 6 * kMiB), StatusCode::Ok, "Regrow to 6 MiB");
+        bufferModule->CopyOut(large, 5 * kMiB, &probe, 1);
+        ok &= ExpectTrue(probe == 0, "Regrown bytes are zero");
+        bufferModule->CopyOut(large, 0, &probe, 1);
+        ok &= ExpectTrue(probe == head, "Shrink and regrow keep the prefix");
+
+        spectre::es2025::ArrayBufferModule::Handle small = 0;
+        ok &= ExpectStatus(bufferModule->Create("sim.small", 1024, small), StatusCode::Ok, "Create small buffer");
+        bufferModule->CopyIn(small, 0, &head, 1);
+        ok &= ExpectStatus(bufferModule->Resize(small, 4 * kMiB), StatusCode::Ok, "Grow small past threshold");
+        bufferModule->CopyOut(small, 0, &check[0], 1);
+        bufferModule->CopyOut(small, 4 * kMiB - 1, &check[1], 1);
+        ok &= ExpectTrue(check[0] == head && check[1] == 0, "Heap to mapped growth copies prefix");
+        ok &= ExpectStatus(bufferModule->Resize(small, 4 * kMiB + 1, false), StatusCode::Ok, "Resize without preserve");
+        bufferModule->CopyOut(small, 0, &probe, 1);
+        ok &= ExpectTrue(probe == 0, "Non-preserving resize clears");
+
+#if defined(__unix__) || defined(__APPLE__)
+        ok &= ExpectTrue(metrics.mappedBuffers == 2, "Both large buffers are mapped");
+        ok &= ExpectTrue(metrics.remaps == 2, "Mapped resizes remap in place");
+        ok &= ExpectTrue(metrics.mappedBytes == 6 * kMiB + 6 * kMiB, "Mapped capacity rounds to 2 MiB granules");
+#endif
+        ok &= ExpectStatus(bufferModule->Detach(small), StatusCode::Ok, "Detach mapped buffer");
+        ok &= ExpectStatus(bufferModule->Destroy(large), StatusCode::Ok, "Destroy mapped buffer");
+        ok &= ExpectTrue(metrics.mappedBuffers == 0 && metrics.mappedBytes == 0, "Mappings released");
+        ok &= ExpectTrue(metrics.pooledBytes < kMiB, "Mapped blocks bypass the pool");
+        return ok;
+    }
+
     bool BooleanModuleCastsAndBoxes() {
         auto runtime = SpectreRuntime::Create(MakeConfig(RuntimeMode::SingleThread));
         auto &environment = runtime->EsEnvironment();
@@ -2201,6 +3413,322 @@ namespace {
         return ok;
     }
 
+    bool StringModuleBuildsRopesAndInlineStrings() {
+        auto runtime = SpectreRuntime::Create(MakeConfig(RuntimeMode::SingleThread));
+        bool ok = ExpectTrue(runtime != nullptr, "Runtime created");
+        if (!runtime) {
+            return false;
+        }
+        auto *stringModule = dynamic_cast<spectre::es2025::StringModule *>(
+            runtime->EsEnvironment().FindModule("String"));
+        ok &= ExpectTrue(stringModule != nullptr, "String module available");
+        if (!stringModule) {
+            return false;
+        }
+        using Handle = spectre::es2025::StringModule::Handle;
+
+        Handle piece = 0;
+        ok &= ExpectStatus(stringModule->Create("rope.piece", "0123456789abcdefghij", piece), StatusCode::Ok,
+                           "Create rope piece");
+        Handle accumulated = 0;
+        ok &= ExpectStatus(stringModule->Clone(piece, "rope.acc", accumulated), StatusCode::Ok, "Create accumulator");
+        std::string expected = "0123456789abcdefghij";
+        for (int i = 0; i < 300; ++i) {
+            Handle next = 0;
+            ok &= ExpectStatus(stringModule->Concat(accumulated, piece, "rope.acc", next), StatusCode::Ok,
+                               "Concat onto accumulator");
+            ok &= ExpectStatus(stringModule->Release(accumulated), StatusCode::Ok, "Release previous accumulator");
+            accumulated = next;
+            expected += "0123456789abcdefghij";
+        }
+        auto flattensBefore = stringModule->GetMetrics().flattens;
+        std::array<Handle, 1> ropeBatch{accumulated};
+        std::array<bool, 1> ropeMatch{};
+        stringModule->StartsWith(ropeBatch, expected.substr(0, 45), ropeMatch);
+        ok &= ExpectTrue(ropeMatch[0], "Rope prefix spans leaves");
+        stringModule->EndsWith(ropeBatch, expected.substr(expected.size() - 45), ropeMatch);
+        ok &= ExpectTrue(ropeMatch[0], "Rope suffix spans leaves");
+        stringModule->EndsWith(ropeBatch, "jj0123456789abcdefghij", ropeMatch);
+        ok &= ExpectTrue(!ropeMatch[0], "Rope suffix mismatch detected");
+        ok &= ExpectTrue(stringModule->GetMetrics().flattens == flattensBefore, "Affix checks leave ropes intact");
+        ok &= ExpectTrue(stringModule->View(accumulated) == expected, "Rope flattens to the concatenated text");
+        ok &= ExpectTrue(stringModule->Hash(accumulated) != 0, "Rope hash computed lazily");
+
+        // The piece is shared by the rope, so mutating it must not leak into the rope text.
+        Handle left = 0;
+        Handle shared = 0;
+        ok &= ExpectStatus(stringModule->Concat(piece, accumulated, "rope.shared", shared), StatusCode::Ok,
+                           "Concat sharing piece");
+        ok &= ExpectStatus(stringModule->ToUpperAscii(piece), StatusCode::Ok, "Mutate shared piece");
+        ok &= ExpectStatus(stringModule->Slice(shared, 0, 20, "rope.left", left), StatusCode::Ok, "Slice rope head");
+        ok &= ExpectTrue(stringModule->View(left) == "0123456789abcdefghij", "Rope keeps original piece text");
+        ok &= ExpectTrue(stringModule->View(piece) == "0123456789ABCDEFGHIJ", "Piece mutated independently");
+
+        Handle small = 0;
+        ok &= ExpectStatus(stringModule->Create("inline.small", "tiny", small), StatusCode::Ok, "Create small string");
+        for (int i = 0; i < 50; ++i) {
+            ok &= ExpectStatus(stringModule->Append(small, "xy"), StatusCode::Ok, "Append to small string");
+        }
+        auto smallView = stringModule->View(small);
+        ok &= ExpectTrue(smallView.size() == 104 && smallView.substr(0, 6) == "tinyxy", "Inline string grows into arena");
+        ok &= ExpectStatus(stringModule->Append(small, smallView.substr(0, 4)), StatusCode::Ok, "Append self view");
+        ok &= ExpectTrue(stringModule->View(small).substr(104) == "tiny", "Self append copies before growth");
+
+        const auto &metrics = stringModule->GetMetrics();
+        ok &= ExpectTrue(metrics.inlineStrings >= 1, "Inline strings counted");
+        ok &= ExpectTrue(metrics.ropeConcats >= 250, "Rope concatenations counted");
+        ok &= ExpectTrue(metrics.flattens >= 1, "Rope flattens counted");
+
+        for (auto handle: {piece, accumulated, shared, left, small}) {
+            ok &= ExpectStatus(stringModule->Release(handle), StatusCode::Ok, "Release rope test string");
+        }
+        ok &= ExpectTrue(stringModule->GetMetrics().activeStrings == 0, "Rope strings released");
+        return ok;
+    }
+
+    bool StringKernelsMatchScalarReference() {
+        namespace simd = spectre::es2025::simd;
+        bool ok = ExpectTrue(!simd::LevelName(simd::ActiveLevel()).empty(), "SIMD level reported");
+        // Lengths straddle every vector width; the pattern mixes letters, whitespace and high bytes.
+        for (std::size_t length = 0; length < 80; ++length) {
+            std::string text(length, ' ');
+            for (std::size_t i = 0; i < length; ++i) {
+                const char alphabet[] = {'a', 'Z', ' ', 'q', '\t', 'M', '0', static_cast<char>(0xc3), 'z', 'A', '@', '['};
+                text[i] = alphabet[(i * 7 + length) % sizeof(alphabet)];
+            }
+            auto upper = text;
+            auto lower = text;
+            auto expectedUpper = text;
+            auto expectedLower = text;
+            for (auto &c: expectedUpper) {
+                c = (c >= 'a' && c <= 'z') ? static_cast<char>(c - 32) : c;
+            }
+            for (auto &c: expectedLower) {
+                c = (c >= 'A' && c <= 'Z') ? static_cast<char>(c + 32) : c;
+            }
+            ok &= ExpectTrue(simd::AsciiToUpper(upper.data(), upper.size()) == (upper != text), "Upper change flag");
+            ok &= ExpectTrue(upper == expectedUpper, "Upper kernel matches reference");
+            ok &= ExpectTrue(simd::AsciiToLower(lower.data(), lower.size()) == (lower != text), "Lower change flag");
+            ok &= ExpectTrue(lower == expectedLower, "Lower kernel matches reference");
+
+            auto padded = std::string(length % 37, ' ') + text + std::string(length % 41, '\n');
+            std::size_t leading = 0;
+            while (leading < padded.size() && static_cast<unsigned char>(padded[leading]) <= 0x20) {
+                ++leading;
+            }
+            std::size_t trailing = 0;
+            while (trailing < padded.size() && static_cast<unsigned char>(padded[padded.size() - 1 - trailing]) <= 0x20) {
+                ++trailing;
+            }
+            ok &= ExpectTrue(simd::LeadingAsciiWhitespace(padded.data(), padded.size()) == leading,
+                             "Leading whitespace matches reference");
+            ok &= ExpectTrue(simd::TrailingAsciiWhitespace(padded.data(), padded.size()) == trailing,
+                             "Trailing whitespace matches reference");
+
+            auto copy = text;
+            ok &= ExpectTrue(simd::Equal(copy.data(), text.data(), length), "Equal on identical text");
+            if (length > 0) {
+                copy[length - 1] ^= 1;
+                ok &= ExpectTrue(!simd::Equal(copy.data(), text.data(), length), "Equal detects last-byte change");
+            }
+            for (std::size_t needleLength = 1; needleLength <= 4 && needleLength <= length; ++needleLength) {
+                auto needle = text.substr(length / 2, needleLength);
+                ok &= ExpectTrue(simd::Find(text, needle) == text.find(needle), "Find matches std::string");
+                ok &= ExpectTrue(simd::Find(text, needle, length / 3) == text.find(needle, length / 3),
+                                 "Find from offset matches std::string");
+            }
+        }
+        ok &= ExpectTrue(simd::Count("a,b,,c,", ",") == 4, "Count separators");
+        ok &= ExpectTrue(simd::Count("aaaa", "aa") == 2, "Count is non-overlapping");
+
+        auto runtime = SpectreRuntime::Create(MakeConfig(RuntimeMode::SingleThread));
+        ok &= ExpectTrue(runtime != nullptr, "Runtime created");
+        if (!runtime) {
+            return false;
+        }
+        auto *stringModule = dynamic_cast<spectre::es2025::StringModule *>(
+            runtime->EsEnvironment().FindModule("String"));
+        ok &= ExpectTrue(stringModule != nullptr, "String module available");
+        if (!stringModule) {
+            return false;
+        }
+        using Handle = spectre::es2025::StringModule::Handle;
+        Handle csv = 0;
+        ok &= ExpectStatus(stringModule->Create("kernel.csv", "id,name,,email,created_at_timestamp", csv),
+                           StatusCode::Ok, "Create csv line");
+        std::size_t index = 0;
+        ok &= ExpectStatus(stringModule->IndexOf(csv, "email", 0, index), StatusCode::Ok, "IndexOf succeeds");
+        ok &= ExpectTrue(index == 9, "IndexOf finds field");
+        ok &= ExpectStatus(stringModule->IndexOf(csv, "missing", 0, index), StatusCode::Ok, "IndexOf miss succeeds");
+        ok &= ExpectTrue(index == spectre::es2025::StringModule::kNotFound, "IndexOf reports miss");
+        std::size_t count = 0;
+        ok &= ExpectStatus(stringModule->Count(csv, ",", count), StatusCode::Ok, "Count succeeds");
+        ok &= ExpectTrue(count == 4, "Count finds separators");
+        ok &= ExpectStatus(stringModule->Count(csv, "", count), StatusCode::InvalidArgument, "Empty needle rejected");
+
+        std::vector<Handle> fields;
+        ok &= ExpectStatus(stringModule->Split(csv, ",", "kernel.field", fields), StatusCode::Ok, "Split succeeds");
+        ok &= ExpectTrue(fields.size() == 5, "Split yields every field");
+        if (fields.size() == 5) {
+            ok &= ExpectTrue(stringModule->View(fields[0]) == "id" && stringModule->View(fields[2]).empty()
+                             && stringModule->View(fields[4]) == "created_at_timestamp", "Split fields match");
+        }
+
+        Handle empty = 0;
+        std::vector<Handle> emptyFields;
+        ok &= ExpectStatus(stringModule->Create("kernel.empty", "", empty), StatusCode::Ok, "Create empty string");
+        ok &= ExpectStatus(stringModule->Split(empty, "", "kernel.field", emptyFields), StatusCode::Ok,
+                           "Split empty by empty");
+        ok &= ExpectTrue(emptyFields.empty(), "Empty string splits into no bytes");
+        ok &= ExpectStatus(stringModule->Split(empty, ",", "kernel.field", emptyFields), StatusCode::Ok,
+                           "Split empty by separator");
+        ok &= ExpectTrue(emptyFields.size() == 1 && stringModule->View(emptyFields[0]).empty(),
+                         "Empty string splits into one empty field");
+        for (auto field: emptyFields) {
+            stringModule->Release(field);
+        }
+        stringModule->Release(empty);
+
+        std::array<bool, 6> matches{};
+        std::vector<Handle> batch(fields.begin(), fields.end());
+        batch.push_back(0);
+        ok &= ExpectStatus(stringModule->StartsWith(batch, "crea", matches), StatusCode::NotFound,
+                           "Batch reports unknown handle");
+        ok &= ExpectTrue(!matches[0] && matches[4] && !matches[5], "StartsWith batch results");
+        ok &= ExpectStatus(stringModule->EndsWith(std::span<const Handle>(fields), "me", matches), StatusCode::Ok,
+                           "EndsWith batch succeeds");
+        ok &= ExpectTrue(matches[1] && !matches[3], "EndsWith batch results");
+
+        for (auto field: fields) {
+            stringModule->Release(field);
+        }
+        stringModule->Release(csv);
+        return ok;
+    }
+
+    bool StringArenaCompactsFragmentedPages() {
+        auto runtime = SpectreRuntime::Create(MakeConfig(RuntimeMode::SingleThread));
+        bool ok = ExpectTrue(runtime != nullptr, "Runtime created");
+        if (!runtime) {
+            return false;
+        }
+        auto *stringModule = dynamic_cast<spectre::es2025::StringModule *>(
+            runtime->EsEnvironment().FindModule("String"));
+        ok &= ExpectTrue(stringModule != nullptr, "String module available");
+        if (!stringModule) {
+            return false;
+        }
+        using Handle = spectre::es2025::StringModule::Handle;
+
+        std::vector<Handle> handles(2048, 0);
+        std::vector<std::string> texts(handles.size());
+        for (std::size_t i = 0; i < handles.size(); ++i) {
+            texts[i] = "arena-" + std::to_string(i) + std::string(90, static_cast<char>('a' + i % 26));
+            ok &= ExpectStatus(stringModule->Create("arena", texts[i], handles[i]), StatusCode::Ok, "Create arena string");
+        }
+        auto firstView = stringModule->View(handles[0]);
+        Handle extra = 0;
+        ok &= ExpectStatus(stringModule->Create("arena.extra", std::string(8000, 'z'), extra), StatusCode::Ok,
+                           "Create dedicated-page string");
+        ok &= ExpectTrue(stringModule->View(handles[0]).data() == firstView.data(), "Arena growth does not move text");
+
+        for (std::size_t i = 0; i < handles.size(); ++i) {
+            if (i % 4 != 0) {
+                ok &= ExpectStatus(stringModule->Release(handles[i]), StatusCode::Ok, "Release churned string");
+            }
+        }
+        ok &= ExpectStatus(stringModule->Release(extra), StatusCode::Ok, "Release dedicated-page string");
+        runtime->Tick({0.016, 1});
+        const auto &metrics = stringModule->GetMetrics();
+        auto pagesBefore = metrics.arenaPages;
+        ok &= ExpectTrue(metrics.arenaFragmentation > 0.5, "Churn leaves the arena fragmented");
+
+        for (std::uint64_t frame = 2; frame < 2000 && metrics.arenaFragmentation > 0.3; ++frame) {
+            runtime->Tick({0.016, frame});
+        }
+        ok &= ExpectTrue(metrics.arenaPages < pagesBefore, "Compactor releases evacuated pages");
+        ok &= ExpectTrue(metrics.pagesReleased >= 1 && metrics.compactionMoves > 0, "Compaction metrics recorded");
+        ok &= ExpectTrue(metrics.arenaFragmentation <= 0.3, "Fragmentation reduced by compaction");
+        for (std::size_t i = 0; i < handles.size(); i += 4) {
+            ok &= ExpectTrue(stringModule->View(handles[i]) == texts[i], "Relocated string keeps its text");
+        }
+        return ok;
+    }
+
+    bool StringPinnedViewsStayPut() {
+        auto runtime = SpectreRuntime::Create(MakeConfig(RuntimeMode::SingleThread));
+        bool ok = ExpectTrue(runtime != nullptr, "Runtime created");
+        if (!runtime) {
+            return false;
+        }
+        auto *stringModule = dynamic_cast<spectre::es2025::StringModule *>(
+            runtime->EsEnvironment().FindModule("String"));
+        ok &= ExpectTrue(stringModule != nullptr, "String module available");
+        if (!stringModule) {
+            return false;
+        }
+        using spectre::es2025::StringModule;
+        using Handle = StringModule::Handle;
+
+        StringModule::Atom atom = StringModule::kInvalidAtom;
+        ok &= ExpectStatus(stringModule->InternAtom("hp", atom), StatusCode::Ok, "Intern short atom");
+        auto atomText = stringModule->AtomView(atom);
+        Handle small = 0;
+        ok &= ExpectStatus(stringModule->Create("pin.small", "tiny", small), StatusCode::Ok, "Create inline string");
+        StringModule::PinnedView smallView;
+        ok &= ExpectStatus(stringModule->PinView(small, smallView), StatusCode::Ok, "Pin inline string");
+
+        std::vector<Handle> handles(2048, 0);
+        std::vector<std::string> texts(handles.size());
+        for (std::size_t i = 0; i < handles.size(); ++i) {
+            texts[i] = "pin-" + std::to_string(i) + std::string(90, static_cast<char>('a' + i % 26));
+            ok &= ExpectStatus(stringModule->Create("pin", texts[i], handles[i]), StatusCode::Ok, "Create arena string");
+        }
+        StringModule::PinnedView churnedView;
+        ok &= ExpectStatus(stringModule->PinView(handles[5], churnedView), StatusCode::Ok, "Pin churned string");
+        ok &= ExpectTrue(stringModule->PinCount(handles[5]) == 1, "One pin held");
+        auto pinnedData = churnedView.Text().data();
+        ok &= ExpectStatus(stringModule->Append(handles[5], "!"), StatusCode::InvalidArgument,
+                           "Pinned string refuses mutation");
+
+        for (std::size_t i = 0; i < handles.size(); ++i) {
+            if (i % 4 != 0) {
+                auto expected = i == 5 ? StatusCode::InvalidArgument : StatusCode::Ok;
+                ok &= ExpectStatus(stringModule->Release(handles[i]), expected, "Release churned string");
+            }
+        }
+        runtime->Tick({0.016, 1});
+        const auto &metrics = stringModule->GetMetrics();
+        for (std::uint64_t frame = 2; frame < 2000 && metrics.arenaFragmentation > 0.3; ++frame) {
+            runtime->Tick({0.016, frame});
+        }
+        ok &= ExpectTrue(metrics.compactionMoves > 0, "Compaction ran");
+        ok &= ExpectTrue(churnedView.Text().data() == pinnedData && churnedView.Text() == texts[5],
+                         "Pinned view survives compaction");
+        ok &= ExpectTrue(stringModule->AtomView(atom).data() == atomText.data(), "Atom text stays put");
+        ok &= ExpectTrue(smallView.Text() == "tiny" && stringModule->View(small).data() == smallView.Text().data(),
+                         "Pinned inline string moved out of the slot table");
+
+        churnedView.Release();
+        ok &= ExpectTrue(stringModule->PinCount(handles[5]) == 0, "Release unpins");
+        ok &= ExpectStatus(stringModule->Append(handles[5], "!"), StatusCode::Ok, "Unpinned string mutable again");
+        ok &= ExpectStatus(stringModule->Release(handles[5]), StatusCode::Ok, "Unpinned string releasable");
+
+        StringModule::Atom counted = StringModule::kInvalidAtom;
+        ok &= ExpectStatus(stringModule->AcquireAtom("pinned.atom", counted), StatusCode::Ok, "Acquire counted atom");
+        Handle countedHandle = 0;
+        ok &= ExpectStatus(stringModule->Intern("pinned.atom", countedHandle), StatusCode::Ok, "Intern atom text");
+        {
+            StringModule::PinnedView atomPin;
+            ok &= ExpectStatus(stringModule->PinView(countedHandle, atomPin), StatusCode::Ok, "Pin atom text");
+            stringModule->ReleaseAtom(counted);
+            ok &= ExpectTrue(stringModule->IsAtom(counted), "Pinned atom collection deferred");
+        }
+        ok &= ExpectTrue(!stringModule->IsAtom(counted), "Unpin collects the released atom");
+        ok &= ExpectStatus(stringModule->Release(countedHandle), StatusCode::Ok, "Release interned handle");
+        return ok;
+    }
+
     bool MathModuleAcceleratesWorkloads() {
         auto runtime = SpectreRuntime::Create(MakeConfig(RuntimeMode::SingleThread));
         bool ok = ExpectTrue(runtime != nullptr, "Runtime created");
@@ -2508,6 +4036,259 @@ namespace {
         return ok;
     }
 
+    bool ObjectModuleSharesShapesAndCachesLookups() {
+        auto runtime = SpectreRuntime::Create(MakeConfig(RuntimeMode::SingleThread));
+        bool ok = ExpectTrue(runtime != nullptr, "Runtime created");
+        if (!runtime) {
+            return false;
+        }
+        auto *objectModule = dynamic_cast<spectre::es2025::ObjectModule *>(
+            runtime->EsEnvironment().FindModule("Object"));
+        ok &= ExpectTrue(objectModule != nullptr, "Object module available");
+        if (!objectModule) {
+            return false;
+        }
+        using spectre::es2025::ObjectModule;
+        using spectre::es2025::Value;
+        auto shapesBefore = objectModule->GetMetrics().shapes;
+        std::vector<ObjectModule::Handle> points;
+        for (int i = 0; i < 32; ++i) {
+            ObjectModule::Handle point = 0;
+            ok &= ExpectStatus(objectModule->Create("shape.point", 0, point), StatusCode::Ok, "Create point");
+            ok &= ExpectStatus(objectModule->Set(point, "x", Value::Int64(i)), StatusCode::Ok, "Set x");
+            ok &= ExpectStatus(objectModule->Set(point, "y", Value::Int64(i * 2)), StatusCode::Ok, "Set y");
+            points.push_back(point);
+        }
+        ok &= ExpectTrue(objectModule->GetMetrics().shapes - shapesBefore == 2, "Points share one layout chain");
+
+        ObjectModule::CacheSlot site;
+        Value value;
+        std::int64_t sum = 0;
+        for (auto point: points) {
+            ok &= ExpectStatus(objectModule->LookupCached(point, "y", site, value), StatusCode::Ok, "Cached get");
+            sum += value.Int();
+        }
+        ok &= ExpectTrue(sum == 992, "Cached values match");
+        ok &= ExpectTrue(site.Monomorphic(), "Site monomorphic");
+        ok &= ExpectTrue(objectModule->GetMetrics().inlineCacheHits >= 31, "Cache hits counted");
+
+        ok &= ExpectStatus(objectModule->StoreCached(points[0], "y", site, Value::Int64(7)), StatusCode::Ok,
+                           "Cached store");
+        ok &= ExpectStatus(objectModule->Get(points[0], "y", value), StatusCode::Ok, "Read stored value");
+        ok &= ExpectTrue(value.Int() == 7, "Cached store applied");
+
+        ObjectModule::Handle prototype = 0;
+        ObjectModule::Handle derived = 0;
+        ok &= ExpectStatus(objectModule->Create("shape.proto", 0, prototype), StatusCode::Ok, "Create prototype");
+        ok &= ExpectStatus(objectModule->Set(prototype, "y", Value::Int64(100)), StatusCode::Ok, "Set proto y");
+        ok &= ExpectStatus(objectModule->Create("shape.derived", prototype, derived), StatusCode::Ok,
+                           "Create derived");
+        ok &= ExpectStatus(objectModule->LookupCached(derived, "y", site, value), StatusCode::Ok, "Proto lookup");
+        ok &= ExpectStatus(objectModule->LookupCached(derived, "y", site, value), StatusCode::Ok, "Proto cached");
+        ok &= ExpectTrue(value.Int() == 100 && site.Polymorphic(), "Prototype hit cached");
+
+        ok &= ExpectStatus(objectModule->Set(derived, "y", Value::Int64(5)), StatusCode::Ok, "Shadow y");
+        ok &= ExpectStatus(objectModule->LookupCached(derived, "y", site, value), StatusCode::Ok, "Shadowed lookup");
+        ok &= ExpectTrue(value.Int() == 5, "Shadowing invalidates prototype entry");
+        bool deleted = false;
+        ok &= ExpectStatus(objectModule->Delete(points[1], "y", deleted), StatusCode::Ok, "Delete y");
+        ok &= ExpectStatus(objectModule->LookupCached(points[1], "y", site, value), StatusCode::NotFound,
+                           "Deleted property misses");
+        ok &= ExpectStatus(objectModule->Freeze(points[2]), StatusCode::Ok, "Freeze point");
+        ok &= ExpectStatus(objectModule->StoreCached(points[2], "y", site, Value::Int64(1)),
+                           StatusCode::InvalidArgument, "Frozen store rejected");
+
+        ObjectModule::Handle bag = 0;
+        ok &= ExpectStatus(objectModule->Create("shape.bag", 0, bag), StatusCode::Ok, "Create bag");
+        for (int i = 0; i < 100; ++i) {
+            ok &= ExpectStatus(objectModule->Set(bag, "k" + std::to_string(i), Value::Int64(i)), StatusCode::Ok,
+                               "Fill bag");
+        }
+        ok &= ExpectStatus(objectModule->Get(bag, "k99", value), StatusCode::Ok, "Dictionary lookup");
+        ok &= ExpectTrue(value.Int() == 99, "Dictionary value");
+        ok &= ExpectTrue(objectModule->GetMetrics().dictionaryObjects >= 1, "Bag left shared shapes");
+        return ok;
+    }
+
+    bool ObjectShapesShareDescriptorArrays() {
+        auto runtime = SpectreRuntime::Create(MakeConfig(RuntimeMode::SingleThread));
+        bool ok = ExpectTrue(runtime != nullptr, "Runtime created");
+        if (!runtime) {
+            return false;
+        }
+        auto *objects = dynamic_cast<spectre::es2025::ObjectModule *>(
+            runtime->EsEnvironment().FindModule("Object"));
+        ok &= ExpectTrue(objects != nullptr, "Object module available");
+        if (!objects) {
+            return false;
+        }
+        using spectre::es2025::ObjectModule;
+        using spectre::es2025::Value;
+        // A long chain followed by a branch off its middle: the branch must see only the prefix
+        // it shares with the chain, and the chain must keep its own tail.
+        ObjectModule::Handle chain = 0;
+        ObjectModule::Handle branch = 0;
+        ok &= ExpectStatus(objects->Create("shape.chain", 0, chain), StatusCode::Ok, "Create chain");
+        ok &= ExpectStatus(objects->Create("shape.branch", 0, branch), StatusCode::Ok, "Create branch");
+        for (int i = 0; i < 40; ++i) {
+            ok &= ExpectStatus(objects->Set(chain, "p" + std::to_string(i), Value::Int64(i)), StatusCode::Ok,
+                               "Extend chain");
+        }
+        for (int i = 0; i < 20; ++i) {
+            ok &= ExpectStatus(objects->Set(branch, "p" + std::to_string(i), Value::Int64(i + 100)),
+                               StatusCode::Ok, "Follow chain");
+        }
+        for (int i = 0; i < 20; ++i) {
+            ok &= ExpectStatus(objects->Set(branch, "q" + std::to_string(i), Value::Int64(i + 200)),
+                               StatusCode::Ok, "Branch off");
+        }
+        for (int round = 0; round < 8; ++round) {
+            for (int i = 0; i < 40; ++i) {
+                Value value;
+                ok &= ExpectStatus(objects->Get(chain, "p" + std::to_string(i), value), StatusCode::Ok,
+                                   "Chain lookup");
+                ok &= ExpectTrue(value.Int() == i, "Chain value");
+            }
+            for (int i = 0; i < 20; ++i) {
+                Value value;
+                ok &= ExpectStatus(objects->Get(branch, "q" + std::to_string(i), value), StatusCode::Ok,
+                                   "Branch lookup");
+                ok &= ExpectTrue(value.Int() == i + 200, "Branch value");
+            }
+        }
+        Value missing;
+        ok &= ExpectStatus(objects->Get(branch, "p30", missing), StatusCode::NotFound,
+                           "Branch does not see the chain's tail");
+        ok &= ExpectStatus(objects->Get(chain, "q0", missing), StatusCode::NotFound,
+                           "Chain does not see the branch");
+        std::vector<std::string> keys;
+        ok &= ExpectStatus(objects->OwnKeys(branch, keys), StatusCode::Ok, "Branch keys");
+        ok &= ExpectTrue(keys.size() == 40 && keys[19] == "p19" && keys[20] == "q0", "Branch key order");
+
+        bool deleted = false;
+        ok &= ExpectStatus(objects->Delete(chain, "p5", deleted), StatusCode::Ok, "Delete from chain");
+        Value value;
+        ok &= ExpectStatus(objects->Get(chain, "p39", value), StatusCode::Ok, "Relaid chain lookup");
+        ok &= ExpectTrue(value.Int() == 39, "Relaid chain value");
+        ok &= ExpectStatus(objects->Get(branch, "p5", value), StatusCode::Ok, "Branch unaffected");
+        ok &= ExpectTrue(value.Int() == 105, "Branch value unaffected");
+        return ok;
+    }
+
+    bool DictionaryKeysReleaseTheirAtoms() {
+        auto runtime = SpectreRuntime::Create(MakeConfig(RuntimeMode::SingleThread));
+        bool ok = ExpectTrue(runtime != nullptr, "Runtime created");
+        if (!runtime) {
+            return false;
+        }
+        auto &environment = runtime->EsEnvironment();
+        auto *strings = dynamic_cast<spectre::es2025::StringModule *>(environment.FindModule("String"));
+        auto *objects = dynamic_cast<spectre::es2025::ObjectModule *>(environment.FindModule("Object"));
+        ok &= ExpectTrue(strings && objects, "Modules available");
+        if (!strings || !objects) {
+            return false;
+        }
+        using spectre::es2025::ObjectModule;
+        using spectre::es2025::StringModule;
+        using spectre::es2025::Value;
+        std::size_t atomsAfterFirstRound = 0;
+        std::uint64_t liveAtoms = 0;
+        for (int round = 0; round < 4; ++round) {
+            ObjectModule::Handle bag = 0;
+            ok &= ExpectStatus(objects->Create("atoms.bag", 0, bag), StatusCode::Ok, "Create bag");
+            for (int i = 0; i < 64; ++i) {
+                ok &= ExpectStatus(objects->Set(bag, "shared" + std::to_string(i), Value::Int64(i)), StatusCode::Ok,
+                                   "Fill shared layout");
+            }
+            for (int i = 0; i < 200; ++i) {
+                auto key = "r" + std::to_string(round) + ".k" + std::to_string(i);
+                ok &= ExpectStatus(objects->Set(bag, key, Value::Int64(i)), StatusCode::Ok, "Fill dictionary");
+            }
+            bool deleted = false;
+            ok &= ExpectStatus(objects->Delete(bag, "r" + std::to_string(round) + ".k7", deleted), StatusCode::Ok,
+                               "Delete dictionary key");
+            ok &= ExpectTrue(deleted, "Dictionary key deleted");
+            Value value;
+            ok &= ExpectStatus(objects->Get(bag, "r" + std::to_string(round) + ".k199", value), StatusCode::Ok,
+                               "Dictionary key readable");
+            ok &= ExpectTrue(value.Int() == 199, "Dictionary value intact");
+            ok &= ExpectTrue(strings->FindAtom("r" + std::to_string(round) + ".k7") == StringModule::kInvalidAtom,
+                             "Deleted key collected");
+            ok &= ExpectStatus(objects->Destroy(bag), StatusCode::Ok, "Destroy bag");
+            ok &= ExpectTrue(strings->FindAtom("r" + std::to_string(round) + ".k199") == StringModule::kInvalidAtom,
+                             "Destroyed object's keys collected");
+            ok &= ExpectTrue(strings->FindAtom("shared63") != StringModule::kInvalidAtom,
+                             "Shared layout keys stay interned");
+            if (round == 0) {
+                atomsAfterFirstRound = strings->AtomCount();
+                liveAtoms = strings->GetMetrics().atoms;
+            }
+        }
+        ok &= ExpectTrue(strings->AtomCount() == atomsAfterFirstRound, "Atom ids reused across rounds");
+        ok &= ExpectTrue(strings->GetMetrics().atoms == liveAtoms, "Live atoms stay flat");
+        return ok;
+    }
+
+    bool PropertyAtomsAreSharedAcrossModules() {
+        auto runtime = SpectreRuntime::Create(MakeConfig(RuntimeMode::SingleThread));
+        bool ok = ExpectTrue(runtime != nullptr, "Runtime created");
+        if (!runtime) {
+            return false;
+        }
+        auto &environment = runtime->EsEnvironment();
+        auto *strings = dynamic_cast<spectre::es2025::StringModule *>(environment.FindModule("String"));
+        auto *objects = dynamic_cast<spectre::es2025::ObjectModule *>(environment.FindModule("Object"));
+        auto *reflect = dynamic_cast<spectre::es2025::ReflectModule *>(environment.FindModule("Reflect"));
+        auto *realms = dynamic_cast<spectre::es2025::ShadowRealmModule *>(environment.FindModule("ShadowRealm"));
+        ok &= ExpectTrue(strings && objects && reflect && realms, "Modules available");
+        if (!strings || !objects || !reflect || !realms) {
+            return false;
+        }
+        using spectre::es2025::Value;
+        spectre::es2025::StringModule::Atom health = spectre::es2025::StringModule::kInvalidAtom;
+        ok &= ExpectStatus(strings->InternAtom("health", health), StatusCode::Ok, "Intern atom");
+        spectre::es2025::StringModule::Atom again = spectre::es2025::StringModule::kInvalidAtom;
+        ok &= ExpectStatus(strings->InternAtom("health", again), StatusCode::Ok, "Intern atom again");
+        ok &= ExpectTrue(health == again && strings->AtomView(health) == "health", "Atom is stable");
+        ok &= ExpectTrue(strings->FindAtom("mana") == spectre::es2025::StringModule::kInvalidAtom,
+                         "Unknown key has no atom");
+
+        auto atomsBefore = strings->AtomCount();
+        for (int i = 0; i < 64; ++i) {
+            spectre::es2025::ObjectModule::Handle unit = 0;
+            ok &= ExpectStatus(objects->Create("atom.unit", 0, unit), StatusCode::Ok, "Create unit");
+            ok &= ExpectStatus(objects->Set(unit, "health", Value::Int64(i)), StatusCode::Ok, "String-keyed set");
+            ok &= ExpectStatus(objects->Set(unit, "armor", Value::Int64(1)), StatusCode::Ok, "Second key");
+            Value value;
+            ok &= ExpectStatus(objects->Get(unit, health, value), StatusCode::Ok, "Atom-keyed get");
+            ok &= ExpectTrue(value.Int() == i, "Atom get matches string set");
+        }
+        ok &= ExpectTrue(strings->AtomCount() == atomsBefore + 1, "Keys stored once across objects");
+
+        spectre::es2025::ObjectModule::Handle target = 0;
+        ok &= ExpectStatus(objects->Create("atom.target", 0, target), StatusCode::Ok, "Create target");
+        ok &= ExpectStatus(reflect->Set(target, health, Value::Int64(9)), StatusCode::Ok, "Reflect atom set");
+        ok &= ExpectTrue(reflect->Has(target, health) && objects->Has(target, "health"), "Reflect atom has");
+        std::vector<std::string> keys;
+        ok &= ExpectStatus(objects->OwnKeys(target, keys), StatusCode::Ok, "Own keys");
+        ok &= ExpectTrue(keys.size() == 1 && keys[0] == "health", "Own keys resolve atom text");
+        bool deleted = false;
+        ok &= ExpectStatus(objects->Delete(target, health, deleted), StatusCode::Ok, "Atom delete");
+        ok &= ExpectTrue(deleted && !objects->Has(target, health), "Atom delete applied");
+
+        spectre::es2025::ShadowRealmModule::Handle source = 0;
+        spectre::es2025::ShadowRealmModule::Handle sink = 0;
+        ok &= ExpectStatus(realms->Create("atom.source", source), StatusCode::Ok, "Create source realm");
+        ok &= ExpectStatus(realms->Create("atom.sink", sink), StatusCode::Ok, "Create sink realm");
+        ok &= ExpectStatus(realms->ExportValue(source, "health", Value::Int64(3)), StatusCode::Ok, "Export by name");
+        Value imported;
+        ok &= ExpectStatus(realms->ImportValue(sink, source, health, imported), StatusCode::Ok, "Import by atom");
+        ok &= ExpectTrue(imported.Int() == 3, "Export shares the atom");
+        ok &= ExpectStatus(realms->ImportValue(sink, source, "mana", imported), StatusCode::NotFound,
+                           "Unknown export misses");
+        return ok;
+    }
+
     bool ProxyModuleCoordinatesTraps() {
         auto runtime = SpectreRuntime::Create(MakeConfig(RuntimeMode::SingleThread));
         bool ok = ExpectTrue(runtime != nullptr, "Runtime created");
@@ -2532,13 +4313,15 @@ namespace {
             int gets;
             int sets;
             int deletes;
-        } state{0, 0, 0};
+            std::string lastKey;
+        } state{0, 0, 0, {}};
         spectre::es2025::ProxyModule::TrapTable traps{};
         traps.get = [](spectre::es2025::ObjectModule &objects, spectre::es2025::ObjectModule::Handle handle,
                        std::string_view key, spectre::es2025::Value &outValue,
                        void *userdata) -> StatusCode {
             auto *stats = static_cast<TrapState *>(userdata);
             stats->gets += 1;
+            stats->lastKey.assign(key);
             return objects.Get(handle, key, outValue);
         };
         traps.set = [](spectre::es2025::ObjectModule &objects, spectre::es2025::ObjectModule::Handle handle,
@@ -2562,6 +4345,17 @@ namespace {
         ok &= ExpectTrue(value.IsInt() && value.Int() == 1, "Proxy get value");
         ok &= ExpectStatus(proxyModule->Set(proxy, "count", spectre::es2025::Value::Int64(5)),
                            StatusCode::Ok, "Proxy set");
+        auto *stringModule = dynamic_cast<spectre::es2025::StringModule *>(environment.FindModule("String"));
+        ok &= ExpectTrue(stringModule != nullptr, "String module available");
+        if (stringModule) {
+            spectre::es2025::ObjectModule::Atom countAtom = spectre::es2025::StringModule::kInvalidAtom;
+            ok &= ExpectStatus(stringModule->InternAtom("count", countAtom), StatusCode::Ok, "Intern count atom");
+            state.lastKey.clear();
+            spectre::es2025::Value atomValue;
+            ok &= ExpectStatus(proxyModule->Get(proxy, countAtom, atomValue), StatusCode::Ok, "Proxy atom get");
+            ok &= ExpectTrue(atomValue.IsInt() && atomValue.Int() == 5, "Proxy atom get value");
+            ok &= ExpectTrue(state.lastKey == "count", "Atom trap receives key text");
+        }
         bool hasCount = false;
         ok &= ExpectStatus(proxyModule->Has(proxy, "count", hasCount), StatusCode::Ok, "Proxy has");
         ok &= ExpectTrue(hasCount, "Proxy reports presence");
@@ -2679,6 +4473,251 @@ namespace {
         return ok;
     }
 
+    bool MapAndSetUseFlatTablesWithReserve() {
+        auto runtime = SpectreRuntime::Create(MakeConfig(RuntimeMode::SingleThread));
+        bool ok = ExpectTrue(runtime != nullptr, "Runtime created");
+        if (!runtime) {
+            return false;
+        }
+        auto &environment = runtime->EsEnvironment();
+        auto *mapModule = dynamic_cast<spectre::es2025::MapModule *>(environment.FindModule("Map"));
+        auto *setModule = dynamic_cast<spectre::es2025::SetModule *>(environment.FindModule("Set"));
+        ok &= ExpectTrue(mapModule != nullptr && setModule != nullptr, "Map and Set modules available");
+        if (!mapModule || !setModule) {
+            return false;
+        }
+        using spectre::es2025::Value;
+        spectre::es2025::MapModule::Handle map = 0;
+        ok &= ExpectStatus(mapModule->Create("flat.map", map), StatusCode::Ok, "Create map");
+        ok &= ExpectStatus(mapModule->Set(map, Value::Int32(1), Value::String("one")), StatusCode::Ok, "Set int key");
+        ok &= ExpectStatus(mapModule->Set(map, Value::Number(1.0), Value::String("uno")), StatusCode::Ok,
+                           "Set equal number key");
+        ok &= ExpectStatus(mapModule->Set(map, Value::String("1"), Value::Int32(1)), StatusCode::Ok, "Set string key");
+        ok &= ExpectStatus(mapModule->Set(map, Value::Boolean(true), Value::Int32(2)), StatusCode::Ok, "Set bool key");
+        ok &= ExpectTrue(mapModule->Size(map) == 3, "SameValueZero keys collapse");
+        Value value;
+        ok &= ExpectStatus(mapModule->Get(map, Value::Int64(1), value), StatusCode::Ok, "Get through int64");
+        ok &= ExpectTrue(value.IsString() && value.String() == "uno", "Overwrite kept latest value");
+
+        bool removed = false;
+        for (int i = 0; i < 2000; ++i) {
+            ok &= ExpectStatus(mapModule->Set(map, Value::Int32(1000 + i), Value::Int32(i)), StatusCode::Ok,
+                               "Bulk set");
+        }
+        for (int i = 0; i < 2000; i += 2) {
+            ok &= ExpectStatus(mapModule->Delete(map, Value::Int32(1000 + i), removed), StatusCode::Ok, "Bulk delete");
+        }
+        ok &= ExpectStatus(mapModule->Delete(map, Value::String("1"), removed), StatusCode::Ok, "Delete string key");
+        ok &= ExpectStatus(mapModule->Set(map, Value::String("1"), Value::Int32(3)), StatusCode::Ok, "Re-add string key");
+        for (int i = 0; i < 2000; i += 2) {
+            ok &= ExpectStatus(mapModule->Delete(map, Value::Int32(1001 + i), removed), StatusCode::Ok, "Drain odd");
+        }
+        ok &= ExpectTrue(mapModule->Size(map) == 3, "Size after churn");
+        std::vector<Value> keys;
+        ok &= ExpectStatus(mapModule->Keys(map, keys), StatusCode::Ok, "Keys after churn");
+        ok &= ExpectTrue(keys.size() == 3 && keys[0].IsInt() && keys[1].IsBoolean() && keys[2].IsString(),
+                         "Insertion order survives deletes and re-adds");
+
+        auto rehashes = mapModule->GetMetrics().rehashes;
+        ok &= ExpectStatus(mapModule->Reserve(map, 5000), StatusCode::Ok, "Reserve map");
+        auto afterReserve = mapModule->GetMetrics().rehashes;
+        ok &= ExpectTrue(afterReserve == rehashes + 1, "Reserve rehashes once");
+        for (int i = 0; i < 4997; ++i) {
+            mapModule->Set(map, Value::Int32(-i - 1), Value::Int32(i));
+        }
+        ok &= ExpectTrue(mapModule->Size(map) == 5000, "Reserved map filled");
+        ok &= ExpectTrue(mapModule->GetMetrics().rehashes == afterReserve, "No rehash inside reservation");
+        ok &= ExpectStatus(mapModule->Reserve(0, 16), StatusCode::NotFound, "Reserve unknown map");
+        ok &= ExpectStatus(mapModule->Destroy(map), StatusCode::Ok, "Destroy map");
+
+        spectre::es2025::SetModule::Handle set = 0;
+        ok &= ExpectStatus(setModule->Create("flat.set", set), StatusCode::Ok, "Create set");
+        ok &= ExpectStatus(setModule->Reserve(set, 4096), StatusCode::Ok, "Reserve set");
+        auto setRehashes = setModule->GetMetrics().rehashes;
+        for (int i = 0; i < 4096; ++i) {
+            setModule->Add(set, Value::Int32(i));
+        }
+        ok &= ExpectTrue(setModule->GetMetrics().rehashes == setRehashes, "Set reservation holds");
+        for (int i = 0; i < 4096; ++i) {
+            if (i % 100 != 0) {
+                setModule->Delete(set, Value::Number(static_cast<double>(i)), removed);
+            }
+        }
+        ok &= ExpectTrue(setModule->Size(set) == 41, "Set size after deletes");
+        ok &= ExpectStatus(setModule->Add(set, Value::Int32(50)), StatusCode::Ok, "Re-add value");
+        ok &= ExpectTrue(setModule->Has(set, Value::Number(4000.0)), "Survivor found after compaction");
+        ok &= ExpectTrue(!setModule->Has(set, Value::Int32(4001)), "Deleted value missing");
+        std::vector<Value> values;
+        ok &= ExpectStatus(setModule->Values(set, values), StatusCode::Ok, "Set values");
+        ok &= ExpectTrue(values.size() == 42 && values[1].SameValueZero(Value::Int32(100))
+                         && values.back().SameValueZero(Value::Int32(50)), "Set order after compaction");
+        ok &= ExpectStatus(setModule->Reserve(set + 1, 8), StatusCode::NotFound, "Reserve unknown set");
+        ok &= ExpectStatus(setModule->Destroy(set), StatusCode::Ok, "Destroy set");
+        return ok;
+    }
+
+    bool MapModuleBatchesSetAndGet() {
+        auto runtime = SpectreRuntime::Create(MakeConfig(RuntimeMode::SingleThread));
+        bool ok = ExpectTrue(runtime != nullptr, "Runtime created");
+        if (!runtime) {
+            return false;
+        }
+        auto *mapModule = dynamic_cast<spectre::es2025::MapModule *>(runtime->EsEnvironment().FindModule("Map"));
+        ok &= ExpectTrue(mapModule != nullptr, "Map module available");
+        if (!mapModule) {
+            return false;
+        }
+        using spectre::es2025::Value;
+        spectre::es2025::MapModule::Handle map = 0;
+        ok &= ExpectStatus(mapModule->Create("batch.map", map), StatusCode::Ok, "Create map");
+        std::vector<std::pair<Value, Value> > pairs;
+        for (int i = 0; i < 10000; ++i) {
+            pairs.emplace_back(Value::Int32(i), Value::Int32(i * 3));
+        }
+        pairs.emplace_back(Value::String("tail"), Value::Boolean(true));
+        pairs.emplace_back(Value::Int32(5), Value::Int32(-5));
+        auto rehashes = mapModule->GetMetrics().rehashes;
+        ok &= ExpectStatus(mapModule->SetMany(map, pairs), StatusCode::Ok, "SetMany");
+        ok &= ExpectTrue(mapModule->GetMetrics().rehashes == rehashes + 1, "SetMany sizes the table once");
+        ok &= ExpectTrue(mapModule->Size(map) == 10001, "Duplicate key in batch overwrites");
+        std::vector<Value> keys;
+        ok &= ExpectStatus(mapModule->Keys(map, keys), StatusCode::Ok, "Keys after batch");
+        ok &= ExpectTrue(keys.size() == 10001 && keys.back().IsString(), "Batch keeps insertion order");
+
+        std::vector<Value> probes;
+        for (int i = 0; i < 130; ++i) {
+            probes.push_back(Value::Int32(i % 2 == 0 ? i : 20000 + i));
+        }
+        probes.push_back(Value::String("tail"));
+        std::vector<Value> values(probes.size());
+        std::vector<std::uint64_t> found((probes.size() + 63) / 64);
+        ok &= ExpectStatus(mapModule->GetMany(map, probes, values, found), StatusCode::Ok, "GetMany");
+        bool matches = true;
+        for (std::size_t i = 0; i < probes.size(); ++i) {
+            bool bit = (found[i / 64] >> (i % 64)) & 1u;
+            Value single;
+            bool present = mapModule->Get(map, probes[i], single) == StatusCode::Ok;
+            matches &= bit == present;
+            matches &= !present || values[i].SameValueZero(single);
+            matches &= present || values[i].IsUndefined();
+        }
+        ok &= ExpectTrue(matches, "GetMany agrees with Get");
+        ok &= ExpectTrue(values[0].SameValueZero(Value::Int32(0)) && values.back().IsBoolean(), "GetMany values");
+        std::vector<std::uint64_t> shortBitmap(1);
+        ok &= ExpectStatus(mapModule->GetMany(map, probes, values, shortBitmap), StatusCode::InvalidArgument,
+                           "Short bitmap rejected");
+        ok &= ExpectStatus(mapModule->GetMany(0, probes, values, found), StatusCode::NotFound, "Unknown handle");
+        ok &= ExpectTrue(found[0] == 0, "Bitmap cleared on failure");
+        ok &= ExpectStatus(mapModule->SetMany(0, pairs), StatusCode::NotFound, "SetMany unknown handle");
+        ok &= ExpectStatus(mapModule->Destroy(map), StatusCode::Ok, "Destroy map");
+        return ok;
+    }
+
+    bool CollectionCursorsIterateInPlace() {
+        auto runtime = SpectreRuntime::Create(MakeConfig(RuntimeMode::SingleThread));
+        bool ok = ExpectTrue(runtime != nullptr, "Runtime created");
+        if (!runtime) {
+            return false;
+        }
+        auto &environment = runtime->EsEnvironment();
+        auto *mapModule = dynamic_cast<spectre::es2025::MapModule *>(environment.FindModule("Map"));
+        auto *setModule = dynamic_cast<spectre::es2025::SetModule *>(environment.FindModule("Set"));
+        auto *arrayModule = dynamic_cast<spectre::es2025::ArrayModule *>(environment.FindModule("Array"));
+        ok &= ExpectTrue(mapModule && setModule && arrayModule, "Collection modules available");
+        if (!mapModule || !setModule || !arrayModule) {
+            return false;
+        }
+        using spectre::es2025::Value;
+        spectre::es2025::MapModule::Handle map = 0;
+        ok &= ExpectStatus(mapModule->Create("cursor.map", map), StatusCode::Ok, "Create map");
+        bool removed = false;
+        for (int i = 0; i < 1000; ++i) {
+            mapModule->Set(map, Value::Int32(i), Value::Int32(i * 2));
+        }
+        for (int i = 0; i < 1000; i += 3) {
+            mapModule->Delete(map, Value::Int32(i), removed);
+        }
+        std::vector<std::pair<Value, Value> > expected;
+        ok &= ExpectStatus(mapModule->Entries(map, expected), StatusCode::Ok, "Materialized entries");
+        spectre::es2025::MapModule::Cursor mapCursor{};
+        ok &= ExpectStatus(mapModule->OpenCursor(map, mapCursor), StatusCode::Ok, "Open map cursor");
+        std::array<std::pair<Value, Value>, 64> chunk;
+        std::size_t count = 0;
+        std::size_t seen = 0;
+        bool matches = true;
+        do {
+            ok &= ExpectStatus(mapModule->NextEntries(mapCursor, chunk, count), StatusCode::Ok, "Next entries");
+            for (std::size_t i = 0; i < count && seen + i < expected.size(); ++i) {
+                matches &= chunk[i].first.SameValueZero(expected[seen + i].first);
+                matches &= chunk[i].second.SameValueZero(expected[seen + i].second);
+            }
+            seen += count;
+        } while (count != 0);
+        ok &= ExpectTrue(matches && seen == expected.size(), "Cursor walks entries in insertion order");
+        ok &= ExpectStatus(mapModule->OpenCursor(map, mapCursor), StatusCode::Ok, "Reopen map cursor");
+        std::array<Value, 8> keys;
+        ok &= ExpectStatus(mapModule->NextKeys(mapCursor, keys, count), StatusCode::Ok, "Next keys");
+        ok &= ExpectTrue(count == 8 && keys[0].SameValueZero(Value::Int32(1)), "First key skips hole");
+        ok &= ExpectStatus(mapModule->NextValues(mapCursor, keys, count), StatusCode::Ok, "Next values");
+        ok &= ExpectTrue(count == 8 && keys[0].SameValueZero(Value::Int32(26)), "Values continue from cursor");
+        mapModule->Set(map, Value::Int32(5000), Value::Int32(0));
+        ok &= ExpectStatus(mapModule->NextKeys(mapCursor, keys, count), StatusCode::InvalidArgument,
+                           "Mutation invalidates map cursor");
+        ok &= ExpectTrue(count == 0, "Stale cursor yields nothing");
+        ok &= ExpectStatus(mapModule->OpenCursor(map, mapCursor), StatusCode::Ok, "Reopen before reserve");
+        ok &= ExpectStatus(mapModule->Reserve(map, 100000), StatusCode::Ok, "Reserve past capacity");
+        ok &= ExpectStatus(mapModule->NextKeys(mapCursor, keys, count), StatusCode::InvalidArgument,
+                           "Compacting reserve invalidates map cursor");
+        ok &= ExpectStatus(mapModule->Destroy(map), StatusCode::Ok, "Destroy map");
+        ok &= ExpectStatus(mapModule->NextKeys(mapCursor, keys, count), StatusCode::NotFound, "Destroyed map cursor");
+
+        spectre::es2025::SetModule::Handle set = 0;
+        ok &= ExpectStatus(setModule->Create("cursor.set", set), StatusCode::Ok, "Create set");
+        setModule->Add(set, Value::String("a"));
+        setModule->Add(set, Value::String("b"));
+        setModule->Add(set, Value::String("c"));
+        setModule->Delete(set, Value::String("b"), removed);
+        spectre::es2025::SetModule::Cursor setCursor{};
+        ok &= ExpectStatus(setModule->OpenCursor(set, setCursor), StatusCode::Ok, "Open set cursor");
+        ok &= ExpectStatus(setModule->Next(setCursor, keys, count), StatusCode::Ok, "Next set values");
+        ok &= ExpectTrue(count == 2 && keys[0].String() == "a" && keys[1].String() == "c", "Set cursor values");
+        ok &= ExpectStatus(setModule->Next(setCursor, keys, count), StatusCode::Ok, "Exhausted set cursor");
+        ok &= ExpectTrue(count == 0, "Set cursor exhausted");
+        setModule->Add(set, Value::String("d"));
+        ok &= ExpectStatus(setModule->Next(setCursor, keys, count), StatusCode::InvalidArgument, "Stale set cursor");
+        ok &= ExpectStatus(setModule->OpenCursor(set, setCursor), StatusCode::Ok, "Reopen set cursor");
+        ok &= ExpectStatus(setModule->Reserve(set, 4096), StatusCode::Ok, "Reserve set past capacity");
+        ok &= ExpectStatus(setModule->Next(setCursor, keys, count), StatusCode::InvalidArgument,
+                           "Compacting reserve invalidates set cursor");
+        ok &= ExpectStatus(setModule->Destroy(set), StatusCode::Ok, "Destroy set");
+
+        spectre::es2025::ArrayModule::Handle array = 0;
+        ok &= ExpectStatus(arrayModule->CreateDense("cursor.array", 16, array), StatusCode::Ok, "Create array");
+        for (int i = 0; i < 20; ++i) {
+            arrayModule->Push(array, Value::Int32(i));
+        }
+        spectre::es2025::ArrayModule::Cursor arrayCursor{};
+        ok &= ExpectStatus(arrayModule->OpenCursor(array, 5, 30, arrayCursor), StatusCode::InvalidArgument,
+                           "Cursor range checked");
+        ok &= ExpectStatus(arrayModule->OpenCursor(array, 5, 15, arrayCursor), StatusCode::Ok, "Open array cursor");
+        ok &= ExpectStatus(arrayModule->Next(arrayCursor, keys, count), StatusCode::Ok, "Next array chunk");
+        ok &= ExpectTrue(count == 8 && keys[0].SameValueZero(Value::Int32(5)), "Array chunk start");
+        ok &= ExpectStatus(arrayModule->Next(arrayCursor, keys, count), StatusCode::Ok, "Array chunk tail");
+        ok &= ExpectTrue(count == 2 && keys[1].SameValueZero(Value::Int32(14)), "Array chunk bounded by end");
+        spectre::es2025::ArrayModule::Handle sparse = 0;
+        ok &= ExpectStatus(arrayModule->CreateSparse("cursor.sparse", sparse), StatusCode::Ok, "Create sparse");
+        arrayModule->Set(sparse, 2, Value::String("two"));
+        arrayModule->Set(sparse, 6, Value::String("six"));
+        ok &= ExpectStatus(arrayModule->OpenCursor(sparse, 1, 7, arrayCursor), StatusCode::Ok, "Open sparse cursor");
+        ok &= ExpectStatus(arrayModule->Next(arrayCursor, keys, count), StatusCode::Ok, "Next sparse chunk");
+        ok &= ExpectTrue(count == 6 && keys[0].IsUndefined() && keys[1].String() == "two" && keys[5].String() == "six",
+                         "Sparse holes read as undefined");
+        arrayModule->Push(sparse, Value::Int32(1));
+        ok &= ExpectStatus(arrayModule->Next(arrayCursor, keys, count), StatusCode::InvalidArgument,
+                           "Stale array cursor");
+        return ok;
+    }
+
     bool WeakSetModuleCompactsInvalidEntries() {
         auto runtime = SpectreRuntime::Create(MakeConfig(RuntimeMode::SingleThread));
         bool ok = ExpectTrue(runtime != nullptr, "Runtime created");
@@ -3088,6 +5127,34 @@ namespace {
         ok &= ExpectStatus(shadowModule->ClearExports(realmA), StatusCode::Ok, "Clear exports");
         ok &= ExpectStatus(shadowModule->ImportValue(realmB, realmA, "answer", imported),
                            StatusCode::NotFound, "Import missing export");
+
+        using StringModule = spectre::es2025::StringModule;
+        auto *strings = dynamic_cast<StringModule *>(environment.FindModule("String"));
+        ok &= ExpectTrue(strings != nullptr, "String module available");
+        if (strings) {
+            auto atom = StringModule::kInvalidAtom;
+            ok &= ExpectStatus(strings->AcquireAtom("shadow.dynamic", atom), StatusCode::Ok, "Acquire export atom");
+            ok &= ExpectStatus(shadowModule->ExportValue(realmA, atom, spectre::es2025::Value::Number(7.0)),
+                               StatusCode::Ok, "Export by atom");
+            strings->ReleaseAtom(atom);
+            ok &= ExpectTrue(strings->IsAtom(atom), "Export keeps its atom alive");
+            auto other = StringModule::kInvalidAtom;
+            ok &= ExpectStatus(strings->AcquireAtom("shadow.other", other), StatusCode::Ok, "Acquire other atom");
+            ok &= ExpectTrue(other != atom, "Held atom id is not recycled");
+            ok &= ExpectStatus(shadowModule->ImportValue(realmB, realmA, "shadow.other", imported),
+                               StatusCode::NotFound, "Other name does not alias the export");
+            ok &= ExpectStatus(shadowModule->ImportValue(realmB, realmA, atom, imported), StatusCode::Ok,
+                               "Import by atom");
+            ok &= ExpectTrue(imported.IsNumber() && imported.AsNumber() == 7.0, "Atom import content");
+            strings->ReleaseAtom(other);
+            ok &= ExpectStatus(shadowModule->ExportValue(realmA, "shadow.named", spectre::es2025::Value::Number(1.0)),
+                               StatusCode::Ok, "Export by name");
+            ok &= ExpectTrue(strings->FindAtom("shadow.named") != StringModule::kInvalidAtom, "Name held by export");
+            ok &= ExpectStatus(shadowModule->ClearExports(realmA), StatusCode::Ok, "Clear atom exports");
+            ok &= ExpectTrue(!strings->IsAtom(atom), "Cleared export releases its atom");
+            ok &= ExpectTrue(strings->FindAtom("shadow.named") == StringModule::kInvalidAtom,
+                             "Export names are not made permanent");
+        }
         ok &= ExpectStatus(shadowModule->Destroy(realmA), StatusCode::Ok, "Destroy realmA");
         ok &= ExpectStatus(shadowModule->Destroy(realmB), StatusCode::Ok, "Destroy realmB");
         const auto &metrics = shadowModule->GetMetrics();
@@ -3900,6 +5967,9 @@ int main() {
     std::vector<TestCase> tests{
         {"ArrayBufferModuleAllocatesAndPools", ArrayBufferModuleAllocatesAndPools},
         {"ArrayBufferModuleResizesAndDetaches", ArrayBufferModuleResizesAndDetaches},
+        {"ArrayBufferModuleMapsLargeBuffers", ArrayBufferModuleMapsLargeBuffers},
+        {"ArrayBufferPoolIsBoundedAndDecays", ArrayBufferPoolIsBoundedAndDecays},
+        {"ArrayBufferCreateMappedSharesFilePages", ArrayBufferCreateMappedSharesFilePages},
         {"DefaultConfigPopulatesDefaults", DefaultConfigPopulatesDefaults},
         {"ContextLifecycle", ContextLifecycle},
         {"LoadFailuresSurfaceStatuses", LoadFailuresSurfaceStatuses},
@@ -3911,6 +5981,8 @@ int main() {
         {"DestroyContextRejectsOperations", DestroyContextRejectsOperations},
         {"MultiThreadLifecycle", MultiThreadLifecycle},
         {"SubsystemSuiteProvidesCpuBackends", SubsystemSuiteProvidesCpuBackends},
+        {"TelemetryRingCountsDropsAndConcurrentProducers", TelemetryRingCountsDropsAndConcurrentProducers},
+        {"ValueIsCompactAndSharesStrings", ValueIsCompactAndSharesStrings},
         {"GlobalModuleInitializesDefaultContext", GlobalModuleInitializesDefaultContext},
         {"GlobalModuleEvaluatesScripts", GlobalModuleEvaluatesScripts},
         {"GlobalModuleReconfigureTogglesGpu", GlobalModuleReconfigureTogglesGpu},
@@ -3933,20 +6005,40 @@ int main() {
         {"ArrayModuleSupportsSparseConversions", ArrayModuleSupportsSparseConversions},
         {"ArrayModuleConcatSliceAndBinarySearch", ArrayModuleConcatSliceAndBinarySearch},
         {"ArrayModuleCloneAndClear", ArrayModuleCloneAndClear},
+        {"ArrayModuleSpecializesElementKinds", ArrayModuleSpecializesElementKinds},
         {"AtomicsModuleAllocatesAndAtomicallyUpdates", AtomicsModuleAllocatesAndAtomicallyUpdates},
+        {"AtomicsWaitBlocksUntilNotify", AtomicsWaitBlocksUntilNotify},
+        {"AtomicsWaitSurvivesBufferChurn", AtomicsWaitSurvivesBufferChurn},
+        {"AtomicsPaddedLanesAndShardedCountersScale", AtomicsPaddedLanesAndShardedCountersScale},
+        {"SharedArrayBufferMemoryIsStableAcrossRuntimes", SharedArrayBufferMemoryIsStableAcrossRuntimes},
+        {"SharedArrayBufferChannelPassesMessagesBetweenRuntimes", SharedArrayBufferChannelPassesMessagesBetweenRuntimes},
         {"BooleanModuleCastsAndBoxes", BooleanModuleCastsAndBoxes},
         {"StringModuleHandlesInterningAndTransforms", StringModuleHandlesInterningAndTransforms},
+        {"StringModuleBuildsRopesAndInlineStrings", StringModuleBuildsRopesAndInlineStrings},
+        {"StringArenaCompactsFragmentedPages", StringArenaCompactsFragmentedPages},
+        {"StringPinnedViewsStayPut", StringPinnedViewsStayPut},
+        {"StringKernelsMatchScalarReference", StringKernelsMatchScalarReference},
         {"DateModuleConstructsAndFormats", DateModuleConstructsAndFormats},
         {"NumberModuleHandlesAggregates", NumberModuleHandlesAggregates},
         {"BigIntModulePerformsArithmetic", BigIntModulePerformsArithmetic},
         {"ObjectModuleHandlesPrototypes", ObjectModuleHandlesPrototypes},
+        {"ObjectModuleSharesShapesAndCachesLookups", ObjectModuleSharesShapesAndCachesLookups},
+        {"ObjectShapesShareDescriptorArrays", ObjectShapesShareDescriptorArrays},
+        {"DictionaryKeysReleaseTheirAtoms", DictionaryKeysReleaseTheirAtoms},
+        {"PropertyAtomsAreSharedAcrossModules", PropertyAtomsAreSharedAcrossModules},
         {"ProxyModuleCoordinatesTraps", ProxyModuleCoordinatesTraps},
         {"SymbolModuleManagesSymbols", SymbolModuleManagesSymbols},
         {"RegExpModuleCompilesAndMatches", RegExpModuleCompilesAndMatches},
         {"TypedArrayModuleCoversElementOps", TypedArrayModuleCoversElementOps},
+        {"TypedArrayBulkKernelsMatchScalarReference", TypedArrayBulkKernelsMatchScalarReference},
+        {"TypedArrayBorrowPinsBackingBuffer", TypedArrayBorrowPinsBackingBuffer},
         {"DataViewModuleHandlesEndianAccess", DataViewModuleHandlesEndianAccess},
+        {"DataViewSchemaCodecsRoundTripRecords", DataViewSchemaCodecsRoundTripRecords},
         {"MapModuleMaintainsOrder", MapModuleMaintainsOrder},
         {"SetModuleMaintainsUniqueness", SetModuleMaintainsUniqueness},
+        {"MapAndSetUseFlatTablesWithReserve", MapAndSetUseFlatTablesWithReserve},
+        {"MapModuleBatchesSetAndGet", MapModuleBatchesSetAndGet},
+        {"CollectionCursorsIterateInPlace", CollectionCursorsIterateInPlace},
         {"WeakSetModuleCompactsInvalidEntries", WeakSetModuleCompactsInvalidEntries},
         {"ReflectModuleProvidesMetaOperations", ReflectModuleProvidesMetaOperations},
         {"WeakRefModuleTracksLifetime", WeakRefModuleTracksLifetime},
@@ -3965,7 +6057,10 @@ int main() {
         {"ModuleLoaderModuleResolvesLazyModules", ModuleLoaderModuleResolvesLazyModules},
         {"StructuredCloneModuleClonesComplexGraphs", StructuredCloneModuleClonesComplexGraphs},
         {"StructuredCloneModuleSerializesRoundTrips", StructuredCloneModuleSerializesRoundTrips},
-        {"TickAndReconfigureUpdatesState", TickAndReconfigureUpdatesState}
+        {"TickAndReconfigureUpdatesState", TickAndReconfigureUpdatesState},
+        {"MemoryReportTracksModulesAndContexts", MemoryReportTracksModulesAndContexts},
+        {"ScopedTracingExportsChromeTrace", ScopedTracingExportsChromeTrace},
+        {"OpcodeProfilingRanksHotPrograms", OpcodeProfilingRanksHotPrograms}
     };
 
     std::size_t passed = 0;